@@ -6,9 +6,15 @@
 #define AWS_MOCK_CORE_AWS_UTILS_H
 
 // C++ standard includes
+#include <atomic>
+#include <cctype>
 #include <chrono>
+#include <iomanip>
 #include <iostream>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 // Poco includes
 #include <Poco/Net/HTTPRequest.h>
@@ -16,12 +22,14 @@
 
 // Boost includes
 #include <boost/lexical_cast.hpp>
+#include <boost/thread/mutex.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
 // AwsMock includes
 #include "awsmock/core/config/Configuration.h"
 #include <awsmock/core/CryptoUtils.h>
+#include <awsmock/core/HashSink.h>
 #include <awsmock/core/HttpUtils.h>
 #include <awsmock/core/StringUtils.h>
 #include <awsmock/core/SystemUtils.h>
@@ -39,6 +47,8 @@
 #define GATEWAY_DEFAULT_PROTOCOL std::string("http")
 #define GATEWAY_DEFAULT_REGION "eu-central-1"
 
+#define SIGNING_KEY_CACHE_SIZE 64
+
 namespace AwsMock::Core {
 
     struct AuthorizationHeaderKeys {
@@ -94,6 +104,54 @@ namespace AwsMock::Core {
         std::string signature;
     };
 
+    /**
+     * @brief Authorization header pieces as views into the original header.
+     *
+     * Only valid as long as the header string is alive.
+     */
+    struct AuthorizationHeaderView {
+
+        /**
+         * AWS signing version, i.e: AWS4-HMAC-SHA256
+         */
+        std::string_view signingVersion;
+
+        /**
+         * Access key ID
+         */
+        std::string_view accessKeyId;
+
+        /**
+         * Date
+         */
+        std::string_view dateTime;
+
+        /**
+         * Region
+         */
+        std::string_view region;
+
+        /**
+         * Module
+         */
+        std::string_view module;
+
+        /**
+         * Request version
+         */
+        std::string_view requestVersion;
+
+        /**
+         * Signed headers
+         */
+        std::string_view signedHeaders;
+
+        /**
+         * Signature
+         */
+        std::string_view signature;
+    };
+
     /**
      * @brief General AWS utilities.
      *
@@ -250,6 +308,15 @@ namespace AwsMock::Core {
             return StringUtils::GenerateRandomString(SQS_RECEIPT_HANDLE_LENGTH);
         }
 
+        /**
+         * @brief Returns a sequence number of a FIFO queue message.
+         *
+         * <p>Sequence numbers are strictly increasing within the process, they consist of 20 digits, starting with the creation time in microseconds.</p>
+         *
+         * @return sequence number
+         */
+        static std::string CreateSqsSequenceNumber();
+
         /**
          * @brief Generate a S3 file name
          *
@@ -310,6 +377,21 @@ namespace AwsMock::Core {
          */
         static bool VerifySignature(const http::request<http::dynamic_body> &request, const std::string &secretAccessKey);
 
+        /**
+         * @brief Splits an AWS4 authorization header into its pieces, without copying or allocating.
+         *
+         * @par
+         * Expected format:
+         * @code
+         * AWS4-HMAC-SHA256 Credential=<key>/<yyyymmdd>/<region>/<module>/aws4_request, SignedHeaders=<headers>, Signature=<signature>
+         * @endcode
+         *
+         * @param authorizationHeader authorization header value
+         * @param view resulting views into the authorization header
+         * @return true, if the header could be parsed
+         */
+        static bool ParseAuthorizationHeader(std::string_view authorizationHeader, AuthorizationHeaderView &view);
+
         /**
          * @brief Returns the bucket name from the request.
          *
@@ -451,6 +533,18 @@ namespace AwsMock::Core {
          */
         static std::string GetHashedPayload(const std::string &payload);
 
+        /**
+         * @brief Returns the hashed payload of a request.
+         *
+         * @par
+         * If the client sent a x-amz-content-sha256 header, the value is part of the signature and is used as is. Otherwise, the SHA256 hash is
+         * calculated incrementally over the body buffers, without copying the body into a string.
+         *
+         * @param request HTTP request
+         * @return hashed payload
+         */
+        static std::string GetHashedPayload(const http::request<http::dynamic_body> &request);
+
         /**
          * @brief Splits the authorization header into pieces and stores the result into a struct.
          *
@@ -469,6 +563,18 @@ namespace AwsMock::Core {
          */
         static std::string GetSignature(const AuthorizationHeaderKeys &authorizationHeaderKeys, const std::string &stringToSign);
 
+        /**
+         * @brief Returns the derived signing key.
+         *
+         * @par
+         * The key depends only on the secret, date, region and service. Therefore, it is derived once per day and service and cached. The cache
+         * is bounded, when it is full, it is cleared, as old keys are not used anymore after a date change.
+         *
+         * @param authorizationHeaderKeys authorization header
+         * @return signing key
+         */
+        static std::vector<unsigned char> GetSigningKey(const AuthorizationHeaderKeys &authorizationHeaderKeys);
+
         /**
          * @brief Returns the date string in format yyyyMMdd
          *
@@ -486,6 +592,16 @@ namespace AwsMock::Core {
          * @return date string.
          */
         static std::string GetISODateString();
+
+        /**
+         * Signing key cache, keyed by secret, date, region and service
+         */
+        static std::unordered_map<std::string, std::vector<unsigned char>> _signingKeys;
+
+        /**
+         * Signing key cache mutex
+         */
+        static boost::mutex _signingKeyMutex;
     };
 
     /**
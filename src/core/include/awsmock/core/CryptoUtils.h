@@ -26,6 +26,7 @@
 #include <sstream>
 #include <string>
 #include <string_view>
+#include <vector>
 
 // TODO: Removed, until AWS uses openssl 3.0
 // AWS cryptographic methods
@@ -115,6 +116,18 @@ namespace AwsMock::Core {
          */
         static std::string GetMd5FromFile(const std::string &fileName);
 
+        /**
+         * @brief Returns the ETag of a multipart upload.
+         *
+         * @par
+         * The ETag is the MD5 hash of the concatenated binary MD5 hashes of the parts, followed by a dash and the number of parts, like S3
+         * does. Only the part hashes are needed, the parts themselves are not read again.
+         *
+         * @param partMd5Sums hex encoded MD5 hashes of the parts, in part order
+         * @return multipart ETag
+         */
+        static std::string GetMultipartEtag(const std::vector<std::string> &partMd5Sums);
+
         /**
          * @brief Returns the SHA1 hash of a string.
          *
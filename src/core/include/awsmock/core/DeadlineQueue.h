@@ -0,0 +1,112 @@
+//
+// Created by vogje01 on 6/14/24.
+//
+
+#ifndef AWSMOCK_CORE_DEADLINE_QUEUE_H
+#define AWSMOCK_CORE_DEADLINE_QUEUE_H
+
+// C++ includes
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Boost includes
+#include <boost/thread/mutex.hpp>
+
+namespace AwsMock::Core {
+
+    /**
+     * @brief Keyed deadline queue
+     *
+     * @par
+     * Each key has at most one deadline, the earliest one wins. Due keys are taken out in deadline order. The deadlines are kept in a
+     * min-heap, a rescheduled key leaves a stale heap entry behind, which is skipped, when it comes up. Schedule and take are O(log n), an
+     * idle queue costs nothing.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class DeadlineQueue {
+
+      public:
+
+        /**
+         * @brief Schedules a key
+         *
+         * Ignored, if the key is already scheduled at the same time or earlier.
+         *
+         * @param key key, e.g. the queue URL
+         * @param timePoint deadline
+         */
+        void Schedule(const std::string &key, std::chrono::system_clock::time_point timePoint);
+
+        /**
+         * @brief Removes all keys, which are due
+         *
+         * @param now current time
+         * @return due keys, in deadline order
+         */
+        std::vector<std::string> TakeDue(std::chrono::system_clock::time_point now);
+
+        /**
+         * @brief Returns the earliest deadline
+         *
+         * @return earliest deadline, time_point::max() if nothing is scheduled
+         */
+        std::chrono::system_clock::time_point NextDeadline();
+
+        /**
+         * @brief Returns the number of scheduled keys
+         *
+         * @return number of keys
+         */
+        long Size();
+
+      private:
+
+        /**
+         * Heap entry
+         */
+        struct Entry {
+
+            /**
+             * Deadline
+             */
+            std::chrono::system_clock::time_point due;
+
+            /**
+             * Key
+             */
+            std::string key;
+
+            /**
+             * Min-heap order
+             */
+            bool operator>(const Entry &other) const { return due > other.due; }
+        };
+
+        /**
+         * @brief Drops stale entries from the top of the heap. Needs the mutex.
+         */
+        void DropStale();
+
+        /**
+         * Min-heap of the deadlines
+         */
+        std::vector<Entry> _heap;
+
+        /**
+         * Current deadline by key
+         */
+        std::unordered_map<std::string, std::chrono::system_clock::time_point> _deadlines;
+
+        /**
+         * Queue mutex
+         */
+        boost::mutex _mutex;
+    };
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_DEADLINE_QUEUE_H
@@ -8,7 +8,9 @@
 // Standard C includes
 #include <fcntl.h>
 #include <grp.h>
+#include <linux/fs.h>
 #include <pwd.h>
+#include <sys/ioctl.h>
 #include <sys/sendfile.h>
 #include <sys/stat.h>
 #include <sys/time.h>
@@ -17,8 +19,10 @@
 #include <utime.h>
 
 // Standard C++ includes
+#include <cerrno>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <execution>
 #include <filesystem>
 #include <fstream>
@@ -45,6 +49,7 @@
 #include <awsmock/core/DirUtils.h>
 #include <awsmock/core/LogStream.h>
 #include <awsmock/core/StringUtils.h>
+#include <awsmock/core/exception/CoreException.h>
 
 #define BUFFER_LEN 8092
 
@@ -179,14 +184,33 @@ namespace AwsMock::Core {
          */
         static void CopyTo(const std::string &sourceFileName, const std::string &targetFileName, bool createDir = true);
 
+        /**
+         * @brief Copies a byte range from one file to another inside the kernel.
+         *
+         * <p>Uses copy_file_range, which shares the extents on filesystems supporting it, and falls back to sendfile, if the files are on
+         * different filesystems or the kernel does not support copy_file_range.</p>
+         *
+         * @param source source file descriptor
+         * @param sourceOffset offset in the source file
+         * @param dest destination file descriptor
+         * @param destOffset offset in the destination file
+         * @param length number of bytes to copy
+         * @return number of bytes copied, which is less than length, if the source file is shorter
+         * @throws CoreException if the copy fails
+         */
+        static long CopyFileRange(int source, long sourceOffset, int dest, long destOffset, long length);
+
         /**
          * @brief Append several binary files to a single output file.
          *
-         * <p>The out file will be truncated, before its used </p>
+         * <p>The out file will be truncated, before its used. The files are cloned (FICLONERANGE) into the output file, if the filesystem
+         * supports reflinks and the file boundaries are block aligned, otherwise they are copied with CopyFileRange.</p>
          *
          * @param outFile output file name
          * @param inDir input directory
          * @param files string vector of binary files to append to output file
+         * @return output file size
+         * @throws CoreException if a file cannot be opened or copied
          */
         static long AppendBinaryFiles(const std::string &outFile, const std::string &inDir, const std::vector<std::string> &files);
 
@@ -0,0 +1,141 @@
+//
+// Created by vogje01 on 6/2/24.
+//
+
+#ifndef AWSMOCK_CORE_HASH_SINK_H
+#define AWSMOCK_CORE_HASH_SINK_H
+
+// C++ standard includes
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+// Openssl includes
+#include <openssl/evp.h>
+
+// AwsMock includes
+#include <awsmock/core/CryptoUtils.h>
+#include <awsmock/core/LogStream.h>
+
+// Copy buffer size (64kB)
+#define HASH_SINK_BUFFER_SIZE (64 * 1024)
+
+namespace AwsMock::Core {
+
+    /**
+     * @brief Computes several message digests in a single pass.
+     *
+     * @par
+     * Every chunk of data is fed into all requested digest contexts from the same buffer, which is also written to the output. This way a
+     * file is hashed while it is written, and does not need to be read again to compute the MD5, SHA1 or SHA256 checksums.
+     *
+     * @par
+     * Usage:
+     * @code{.cpp}
+     * HashSink hashSink({"MD5", "SHA256"});
+     * std::ofstream ofs(fileName, std::ios::binary);
+     * long size = hashSink.CopyStream(stream, ofs);
+     * std::string md5 = hashSink.GetHash("MD5");
+     * @endcode
+     *
+     * Supported algorithms are MD5, SHA1 and SHA256. Unsupported algorithms (e.g. CRC32) are ignored.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class HashSink {
+
+      public:
+
+        /**
+         * @brief Constructor
+         *
+         * @param algorithms list of digest algorithms
+         */
+        explicit HashSink(const std::vector<std::string> &algorithms);
+
+        /**
+         * @brief Destructor
+         */
+        ~HashSink();
+
+        /**
+         * Not copyable, owns the digest contexts
+         */
+        HashSink(const HashSink &) = delete;
+        HashSink &operator=(const HashSink &) = delete;
+
+        /**
+         * @brief Feeds a chunk of data into all digest contexts.
+         *
+         * @param data data buffer
+         * @param length length of the data in bytes
+         */
+        void Update(const char *data, std::size_t length);
+
+        /**
+         * @brief Copies the input stream to the output stream and hashes the data on the way.
+         *
+         * @param input input stream
+         * @param output output stream
+         * @return number of bytes copied
+         */
+        long CopyStream(std::istream &input, std::ostream &output);
+
+        /**
+         * @brief Hashes an existing file, reading it once for all algorithms.
+         *
+         * @param fileName name of the file
+         * @return number of bytes read
+         */
+        long UpdateFromFile(const std::string &fileName);
+
+        /**
+         * @brief Returns the hex encoded digest of the given algorithm.
+         *
+         * The first call finalizes all digests, no more data must be added afterward.
+         *
+         * @param algorithm digest algorithm
+         * @return hex encoded digest, or empty string, if the algorithm was not requested
+         */
+        std::string GetHash(const std::string &algorithm);
+
+        /**
+         * @brief Returns the number of bytes hashed so far
+         *
+         * @return number of bytes
+         */
+        [[nodiscard]] long GetSize() const;
+
+      private:
+
+        /**
+         * @brief Finalizes all digest contexts
+         */
+        void Finalize();
+
+        /**
+         * Digest contexts by algorithm
+         */
+        std::map<std::string, EVP_MD_CTX *> _contexts;
+
+        /**
+         * Finalized hex encoded digests by algorithm
+         */
+        std::map<std::string, std::string> _hashes;
+
+        /**
+         * Number of bytes hashed
+         */
+        long _size = 0;
+
+        /**
+         * Finalized flag
+         */
+        bool _finalized = false;
+    };
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_HASH_SINK_H
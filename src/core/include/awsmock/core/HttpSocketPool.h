@@ -0,0 +1,259 @@
+//
+// Created by vogje01 on 6/5/24.
+//
+
+#ifndef AWSMOCK_CORE_HTTP_SOCKET_POOL_H
+#define AWSMOCK_CORE_HTTP_SOCKET_POOL_H
+
+// C++ includes
+#include <chrono>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+
+// Boost includes
+#include <boost/asio.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/beast.hpp>
+#include <boost/thread/mutex.hpp>
+
+// AwsMock includes
+#include <awsmock/core/HttpSocket.h>
+#include <awsmock/core/HttpSocketResponse.h>
+#include <awsmock/core/LogStream.h>
+#include <awsmock/core/config/Configuration.h>
+
+#define DEFAULT_HTTP_POOL_SIZE 16
+#define DEFAULT_HTTP_POOL_IDLE_TIMEOUT 30
+#define DEFAULT_HTTP_POOL_CONNECT_TIMEOUT 10
+#define DEFAULT_HTTP_POOL_TIMEOUT 900
+
+namespace AwsMock::Core {
+
+    namespace http = boost::beast::http;
+
+    /**
+     * @brief Pool of persistent HTTP/1.1 connections.
+     *
+     * @par
+     * Keeps idle keep-alive connections per host and port, so that subsequent requests to the same backend (DynamoDB docker container,
+     * lambda function containers) do not pay for the resolution, connect and teardown. The resolution results are cached per host and port.
+     *
+     * @par
+     * Before an idle connection is reused, it is checked for idle timeout and whether the peer closed it. If the request can not be written to a
+     * reused connection, or the peer closes it before sending any byte of the response, the request is retried once on a fresh connection.
+     * Other errors are not retried, as the peer might have processed the request already (e.g. a lambda invocation). The number of idle
+     * connections per host and port is bounded by ```awsmock.http.pool.size```, idle connections are closed after
+     * ```awsmock.http.pool.idle.timeout``` seconds.
+     *
+     * @par
+     * Connecting is limited by ```awsmock.http.pool.connect.timeout```, writing the request and reading the response by
+     * ```awsmock.http.pool.timeout``` seconds each. Every connection has its own IO context, so the timeouts apply to the calling thread only.
+     *
+     * @par
+     * The async variants run the request on a small worker pool and return a future, so callers can overlap several requests.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class HttpSocketPool {
+
+      public:
+
+        /**
+         * @brief Constructor
+         */
+        HttpSocketPool();
+
+        /**
+         * @brief Destructor, closes all idle connections
+         */
+        ~HttpSocketPool();
+
+        /**
+         * @brief Singleton
+         *
+         * @return singleton instance
+         */
+        static HttpSocketPool &instance() {
+            static HttpSocketPool httpSocketPool;
+            return httpSocketPool;
+        }
+
+        /**
+         * @brief Send a JSON string to a HTTP endpoint using a pooled connection
+         *
+         * @param method HTTP method
+         * @param host HTTP host
+         * @param port HTTP port
+         * @param path URL path
+         * @param body HTTP body
+         * @param headers HTTP headers
+         * @return HTTP response
+         */
+        HttpSocketResponse SendJson(http::verb method, const std::string &host, int port, const std::string &path, const std::string &body = {}, const std::map<std::string, std::string> &headers = {});
+
+        /**
+         * @brief Send a JSON string to a HTTP endpoint asynchronously using a pooled connection
+         *
+         * @param method HTTP method
+         * @param host HTTP host
+         * @param port HTTP port
+         * @param path URL path
+         * @param body HTTP body
+         * @param headers HTTP headers
+         * @return future of the HTTP response
+         */
+        std::future<HttpSocketResponse> SendJsonAsync(http::verb method, const std::string &host, int port, const std::string &path, const std::string &body = {}, const std::map<std::string, std::string> &headers = {});
+
+        /**
+         * @brief Returns the number of idle connections to the given endpoint
+         *
+         * @param host HTTP host
+         * @param port HTTP port
+         * @return number of idle connections
+         */
+        std::size_t IdleConnections(const std::string &host, int port);
+
+        /**
+         * @brief Closes all idle connections and clears the resolution cache
+         */
+        void Clear();
+
+      private:
+
+        /**
+         * Pooled socket, the IO context runs the timed operations of a single request on the calling thread
+         */
+        struct Channel {
+            boost::asio::io_context ioContext;
+            boost::beast::tcp_stream stream{ioContext};
+        };
+
+        /**
+         * Idle connection
+         */
+        struct Connection {
+            std::unique_ptr<Channel> channel;
+            std::chrono::steady_clock::time_point lastUsed;
+        };
+
+        /**
+         * @brief Sends the request over the given connection
+         *
+         * @param channel pooled socket
+         * @param request HTTP request
+         * @param response HTTP response
+         * @param retryable set to true, if the peer did not start to process the request
+         * @return error code
+         */
+        boost::system::error_code SendRequest(Channel &channel, http::request<http::string_body> &request, http::response<http::string_body> &response, bool &retryable) const;
+
+        /**
+         * @brief Returns an idle connection or opens a new one.
+         *
+         * @param host HTTP host
+         * @param port HTTP port
+         * @param reused set to true, if an idle connection is returned
+         * @param ec error code
+         * @return pooled socket, nullptr in case of an error
+         */
+        std::unique_ptr<Channel> Acquire(const std::string &host, int port, bool &reused, boost::system::error_code &ec);
+
+        /**
+         * @brief Opens a new connection.
+         *
+         * @param host HTTP host
+         * @param port HTTP port
+         * @param ec error code
+         * @return pooled socket, nullptr in case of an error
+         */
+        std::unique_ptr<Channel> Connect(const std::string &host, int port, boost::system::error_code &ec);
+
+        /**
+         * @brief Returns the connection to the pool, or closes it, if the pool is full.
+         *
+         * @param host HTTP host
+         * @param port HTTP port
+         * @param channel pooled socket
+         */
+        void Release(const std::string &host, int port, std::unique_ptr<Channel> channel);
+
+        /**
+         * @brief Runs the pending operations of the channel until they are completed or timed out.
+         *
+         * @param channel pooled socket
+         */
+        static void Run(Channel &channel);
+
+        /**
+         * @brief Checks whether an idle connection can be reused.
+         *
+         * The peer must not have closed the connection and no unexpected data must be pending.
+         *
+         * @param connection idle connection
+         * @return true, if the connection is healthy
+         */
+        bool IsHealthy(Connection &connection) const;
+
+        /**
+         * @brief Closes the connection
+         *
+         * @param stream TCP stream
+         */
+        static void Close(boost::beast::tcp_stream &stream);
+
+        /**
+         * @brief Returns the pool key
+         *
+         * @param host HTTP host
+         * @param port HTTP port
+         * @return pool key
+         */
+        static std::string GetKey(const std::string &host, int port);
+
+        /**
+         * Worker pool for the async variants
+         */
+        boost::asio::thread_pool _workerPool;
+
+        /**
+         * Idle connections by host and port
+         */
+        std::map<std::string, std::deque<Connection>> _idleConnections;
+
+        /**
+         * Resolution cache by host and port
+         */
+        std::map<std::string, boost::asio::ip::tcp::resolver::results_type> _resolved;
+
+        /**
+         * Maximal number of idle connections per host and port
+         */
+        std::size_t _maxIdle;
+
+        /**
+         * Idle timeout
+         */
+        std::chrono::seconds _idleTimeout;
+
+        /**
+         * Connect timeout
+         */
+        std::chrono::seconds _connectTimeout;
+
+        /**
+         * Write and read timeout
+         */
+        std::chrono::seconds _timeout;
+
+        /**
+         * Mutex
+         */
+        boost::mutex _mutex;
+    };
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_HTTP_SOCKET_POOL_H
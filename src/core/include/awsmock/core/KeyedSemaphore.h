@@ -0,0 +1,158 @@
+//
+// Created by vogje01 on 6/22/24.
+//
+
+#ifndef AWSMOCK_CORE_KEYED_SEMAPHORE_H
+#define AWSMOCK_CORE_KEYED_SEMAPHORE_H
+
+// C++ includes
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace AwsMock::Core {
+
+    /**
+     * @brief Counting semaphore per key
+     *
+     * @par
+     * Limits the number of concurrent holders of a key, e.g. the parts of a multipart upload, which are processed in parallel. Different
+     * keys do not block each other. The state of a key only exists, while the key is held or waited for.
+     *
+     * @par
+     * Usage:
+     * @code{.cpp}
+     * KeyedSemaphore::Permit permit(semaphore, uploadId, 16, std::chrono::seconds(60));
+     * if (!permit) {
+     *   // timeout
+     * }
+     * @endcode
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class KeyedSemaphore {
+
+      public:
+
+        /**
+         * @brief Holds a key as long as it is in scope
+         */
+        class Permit {
+
+          public:
+
+            /**
+             * @brief Constructor, acquires the key
+             *
+             * @param semaphore semaphore
+             * @param key key
+             * @param limit maximal number of concurrent holders
+             * @param timeout maximal wait time
+             */
+            Permit(KeyedSemaphore &semaphore, const std::string &key, int limit, std::chrono::milliseconds timeout) : _semaphore(semaphore), _key(key) {
+                _acquired = _semaphore.Acquire(key, limit, timeout);
+            }
+
+            /**
+             * @brief Destructor, releases the key, if it has been acquired
+             */
+            ~Permit() {
+                if (_acquired) {
+                    _semaphore.Release(_key);
+                }
+            }
+
+            Permit(const Permit &) = delete;
+            Permit &operator=(const Permit &) = delete;
+
+            /**
+             * @brief Checks whether the key has been acquired
+             *
+             * @return true, if the key has been acquired before the timeout elapsed
+             */
+            explicit operator bool() const { return _acquired; }
+
+          private:
+
+            /**
+             * Semaphore
+             */
+            KeyedSemaphore &_semaphore;
+
+            /**
+             * Key
+             */
+            std::string _key;
+
+            /**
+             * Acquired flag
+             */
+            bool _acquired = false;
+        };
+
+        /**
+         * @brief Acquires a key
+         *
+         * @param key key
+         * @param limit maximal number of concurrent holders, values below one are treated as one
+         * @param timeout maximal wait time
+         * @return true, if the key has been acquired before the timeout elapsed
+         */
+        bool Acquire(const std::string &key, int limit, std::chrono::milliseconds timeout);
+
+        /**
+         * @brief Releases a key, wakes up a waiter of the key
+         *
+         * @param key key
+         */
+        void Release(const std::string &key);
+
+        /**
+         * @brief Returns the number of holders of a key
+         *
+         * @param key key
+         * @return number of holders
+         */
+        int CountHolders(const std::string &key);
+
+      private:
+
+        /**
+         * State of a key
+         */
+        struct Slot {
+
+            /**
+             * Number of holders
+             */
+            int holders = 0;
+
+            /**
+             * Number of waiters
+             */
+            int waiters = 0;
+
+            /**
+             * Signalled, when a holder releases the key
+             */
+            std::condition_variable released;
+        };
+
+        /**
+         * Slots by key
+         */
+        std::map<std::string, std::unique_ptr<Slot>> _slots;
+
+        /**
+         * Slot mutex
+         */
+        std::mutex _mutex;
+    };
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_KEYED_SEMAPHORE_H
@@ -13,12 +13,9 @@
 #include <unistd.h>
 
 // C++ includes
+#include <cstring>
 #include <string>
 
-// Boost includes
-#include <boost/thread/mutex.hpp>
-#include <boost/thread/thread.hpp>
-
 // AwsMock includes
 #include <awsmock/core/FileUtils.h>
 #include <awsmock/core/LogStream.h>
@@ -26,7 +23,10 @@
 namespace AwsMock::Core {
 
     /**
-     * @brief Memory mapped file utility.
+     * @brief Read-only memory mapped file.
+     *
+     * The file is mapped in the constructor and unmapped in the destructor. As the mapping is read-only and never changes after construction,
+     * any number of threads can read from it concurrently without locking. Use the MemoryMappedFileCache to share mappings between requests.
      *
      * @author jens.vogt\@opitz-consulting.com
      */
@@ -36,87 +36,88 @@ namespace AwsMock::Core {
 
         /**
          * @brief Constructor
-         */
-        MemoryMappedFile() : _start(nullptr), _membuffer(nullptr), _mapped(false) {}
-
-        /**
-         * @brief Singleton
          *
-         * @return singleton instance
+         * Opens the file and maps it into memory. Check IsMapped() for success.
+         *
+         * @param filename name of the file.
          */
-        static MemoryMappedFile &instance() {
-            static MemoryMappedFile memoryMappedFile;
-            return memoryMappedFile;
-        }
+        explicit MemoryMappedFile(const std::string &filename);
 
         /**
-         * @brief Opens a file and prepares the memory map
-         *
-         * @param filename name of the file.
-         * @return true on success
+         * @brief Destructor, releases the mapping
          */
-        bool OpenFile(const std::string &filename);
+        ~MemoryMappedFile();
 
         /**
-         * @brief Release all resources
+         * Not copyable, owns the mapping
          */
-        void CloseFile();
+        MemoryMappedFile(const MemoryMappedFile &) = delete;
+        MemoryMappedFile &operator=(const MemoryMappedFile &) = delete;
 
         /**
          * @brief Copy a chunk of data from the memory mapped file the provided output buffer
          *
          * @param start start index
-         * @param end end index
+         * @param length number of bytes to copy
          * @param buffer char buffer
          * @return number of bytes actually read
          */
-        long ReadChunk(long start, long end, char *buffer);
+        long ReadChunk(long start, long length, char *buffer) const;
+
+        /**
+         * @brief Returns a pointer to the start of the mapping
+         *
+         * @return start of the mapped memory
+         */
+        [[nodiscard]] const char *GetData() const { return _membuffer; }
+
+        /**
+         * @brief Returns the size of the mapped file
+         *
+         * @return file size in bytes
+         */
+        [[nodiscard]] long GetSize() const { return _fileSize; }
+
+        /**
+         * @brief Returns the name of the mapped file
+         *
+         * @return file name
+         */
+        [[nodiscard]] const std::string &GetFilename() const { return _filename; }
 
         /**
-         * @brief Returns true in case the file is mapped already.
+         * @brief Returns true in case the file is mapped.
          *
-         * @return true, in case file is already mapped.
+         * @return true, in case file is mapped.
          */
         [[nodiscard]] bool IsMapped() const { return _mapped; }
 
       private:
 
-        typedef int FileHandle;
-
         /**
          * Start pointer
          */
-        void *_start;
+        void *_start = nullptr;
 
         /**
          * Char buffer
          */
-        char *_membuffer;
+        char *_membuffer = nullptr;
 
         /**
          * Mapped flag
          */
-        bool _mapped;
+        bool _mapped = false;
 
         /**
-         * Start pointer
-        */
-        std::string _filename;
-
-        /**
-         * File handle
+         * File name
          */
-        FileHandle _file{};
+        std::string _filename;
 
         /**
          * File size
          */
         long _fileSize = 0;
-
-        /**
-         * Mutex
-         */
-        static boost::mutex _mutex;
     };
 
 }// namespace AwsMock::Core
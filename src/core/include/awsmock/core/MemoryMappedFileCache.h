@@ -0,0 +1,128 @@
+//
+// Created by vogje01 on 6/3/24.
+//
+
+#ifndef AWSMOCK_CORE_MEMORY_MAPPED_FILE_CACHE_H
+#define AWSMOCK_CORE_MEMORY_MAPPED_FILE_CACHE_H
+
+// C++ includes
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+// Boost includes
+#include <boost/thread/mutex.hpp>
+
+// AwsMock includes
+#include <awsmock/core/LogStream.h>
+#include <awsmock/core/MemoryMappedFile.h>
+#include <awsmock/core/config/Configuration.h>
+
+#define DEFAULT_MMAP_CACHE_SIZE 64
+
+namespace AwsMock::Core {
+
+    /**
+     * @brief LRU bounded cache of read-only memory mapped files.
+     *
+     * @par
+     * Mappings are keyed by file name and shared through reference counted pointers. Concurrent range requests on the same object share one
+     * mapping, requests on different objects use different mappings. The lock is only held for the lookup, the reads itself go directly to the
+     * mapped memory. When the cache is full, the least recently used mapping is removed from the cache. It stays valid until the last reader
+     * releases it.
+     *
+     * @par
+     * The maximal number of mappings is configured with ```awsmock.mmap.cache.size```.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class MemoryMappedFileCache {
+
+      public:
+
+        /**
+         * @brief Constructor
+         */
+        MemoryMappedFileCache();
+
+        /**
+         * @brief Singleton
+         *
+         * @return singleton instance
+         */
+        static MemoryMappedFileCache &instance() {
+            static MemoryMappedFileCache memoryMappedFileCache;
+            return memoryMappedFileCache;
+        }
+
+        /**
+         * @brief Returns the mapping of the given file, mapping it, if not in the cache yet.
+         *
+         * @param filename name of the file
+         * @return shared mapping, or nullptr, if the file could not be mapped
+         */
+        std::shared_ptr<const MemoryMappedFile> GetFile(const std::string &filename);
+
+        /**
+         * @brief Removes the mapping of the given file from the cache.
+         *
+         * Must be called, when the file is deleted or replaced.
+         *
+         * @param filename name of the file
+         */
+        void RemoveFile(const std::string &filename);
+
+        /**
+         * @brief Sets the maximal number of cached mappings
+         *
+         * @param maxSize maximal number of mappings
+         */
+        void SetMaxSize(std::size_t maxSize);
+
+        /**
+         * @brief Returns the number of cached mappings
+         *
+         * @return number of mappings
+         */
+        std::size_t Size();
+
+      private:
+
+        /**
+         * Cache entry
+         */
+        struct Entry {
+            std::shared_ptr<const MemoryMappedFile> file;
+            std::list<std::string>::iterator lruPosition;
+        };
+
+        /**
+         * @brief Removes least recently used mappings, until the cache has the maximal size.
+         */
+        void Evict();
+
+        /**
+         * Mappings by file name
+         */
+        std::unordered_map<std::string, Entry> _files;
+
+        /**
+         * LRU list, most recently used first
+         */
+        std::list<std::string> _lru;
+
+        /**
+         * Maximal number of mappings
+         */
+        std::size_t _maxSize;
+
+        /**
+         * Mutex
+         */
+        boost::mutex _mutex;
+    };
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_MEMORY_MAPPED_FILE_CACHE_H
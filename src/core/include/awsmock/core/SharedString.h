@@ -0,0 +1,122 @@
+//
+// Created by vogje01 on 6/16/24.
+//
+
+#ifndef AWSMOCK_CORE_SHARED_STRING_H
+#define AWSMOCK_CORE_SHARED_STRING_H
+
+// C++ includes
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace AwsMock::Core {
+
+    /**
+     * @brief Reference counted immutable string
+     *
+     * @par
+     * Copies share the same buffer, copying a shared string costs a reference count increment, independent of the length of the string. It
+     * is used for large payloads, like SQS message bodies, which are passed through the DTOs, entities, in-memory database and responses
+     * without ever being modified. A shared string converts implicitly to and from a std::string, a std::string rvalue is moved into the
+     * buffer.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class SharedString {
+
+      public:
+
+        /**
+         * @brief Constructor, empty string
+         */
+        SharedString() = default;
+
+        /**
+         * @brief Constructor
+         *
+         * @param value string value, moved into the shared buffer
+         */
+        SharedString(std::string value);
+
+        /**
+         * @brief Constructor
+         *
+         * @param value C string value
+         */
+        SharedString(const char *value);
+
+        /**
+         * @brief Returns the underlying string
+         *
+         * @return string value
+         */
+        [[nodiscard]] const std::string &str() const { return _value ? *_value : Empty(); }
+
+        /**
+         * @brief Conversion to the underlying string
+         */
+        operator const std::string &() const { return str(); }
+
+        /**
+         * @brief Returns the C string
+         *
+         * @return C string value
+         */
+        [[nodiscard]] const char *c_str() const { return str().c_str(); }
+
+        /**
+         * @brief Returns the length of the string
+         *
+         * @return length in bytes
+         */
+        [[nodiscard]] std::string::size_type size() const { return _value ? _value->size() : 0; }
+
+        /**
+         * @brief Checks for an empty string
+         *
+         * @return true, if the string is empty
+         */
+        [[nodiscard]] bool empty() const { return !_value || _value->empty(); }
+
+        /**
+         * @brief Returns the number of shared strings, which share the buffer
+         *
+         * @return use count, 0 for the empty string
+         */
+        [[nodiscard]] long UseCount() const { return _value.use_count(); }
+
+        /**
+         * @brief Equality operators
+         */
+        friend bool operator==(const SharedString &lhs, const SharedString &rhs) { return lhs._value == rhs._value || lhs.str() == rhs.str(); }
+        friend bool operator==(const SharedString &lhs, const std::string &rhs) { return lhs.str() == rhs; }
+        friend bool operator==(const SharedString &lhs, const char *rhs) { return lhs.str() == rhs; }
+
+        /**
+         * @brief Stream output operator
+         *
+         * @param os output stream
+         * @param s shared string
+         * @return output stream
+         */
+        friend std::ostream &operator<<(std::ostream &os, const SharedString &s);
+
+      private:
+
+        /**
+         * @brief Returns the static empty string
+         *
+         * @return empty string
+         */
+        static const std::string &Empty();
+
+        /**
+         * Shared immutable buffer, null for the empty string
+         */
+        std::shared_ptr<const std::string> _value;
+    };
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_SHARED_STRING_H
@@ -201,6 +201,16 @@ namespace AwsMock::Core {
          */
         static bool EndsWith(const std::string &s1, const std::string &s2);
 
+        /**
+         * @brief Returns the smallest string, which is greater than all strings starting with the given prefix.
+         *
+         * Used for range queries on sorted keys, i.e. all keys with the prefix are in [prefix, successor).
+         *
+         * @param prefix key prefix
+         * @return prefix successor, empty if there is no upper bound
+         */
+        static std::string PrefixSuccessor(const std::string &prefix);
+
         /**
          * @brief Returns a substring by index.
          *
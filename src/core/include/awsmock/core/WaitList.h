@@ -0,0 +1,212 @@
+//
+// Created by vogje01 on 6/9/24.
+//
+
+#ifndef AWSMOCK_CORE_WAIT_LIST_H
+#define AWSMOCK_CORE_WAIT_LIST_H
+
+// C++ includes
+#include <chrono>
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <string>
+
+// Boost includes
+#include <boost/asio/post.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <boost/thread/mutex.hpp>
+
+// AwsMock includes
+#include <awsmock/core/LogStream.h>
+
+#define DEFAULT_WAIT_LIST_THREADS 4
+
+namespace AwsMock::Core {
+
+    /**
+     * @brief Keyed list of parked asynchronous waiters
+     *
+     * @par
+     * A waiter consists of a receive function, which tries to satisfy the waiter and returns true on success, and an expire function, which
+     * completes the waiter, if the timeout elapses first. Parked waiters hold no thread. When a key is notified, the waiters of that key are
+     * retried in FIFO order on a small worker pool, until the first one comes back empty. Retries of the same key never run in parallel,
+     * notifications arriving during a retry run trigger another round.
+     *
+     * @par
+     * Besides explicit notifications, a key can be scheduled for a notification at a given point in time, e.g. when the next message of a
+     * queue becomes visible again. Each key has at most one such wake-up timer, the earliest one wins.
+     *
+     * @par
+     * A waiter is completed exactly once, either by its receive function returning true, or by its expire function.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class WaitList {
+
+      public:
+
+        /**
+         * Receive function, returns true if the waiter has been satisfied
+         */
+        typedef std::function<bool()> ReceiveFunction;
+
+        /**
+         * Expire function, completes the waiter after the timeout
+         */
+        typedef std::function<void()> ExpireFunction;
+
+        /**
+         * @brief Constructor
+         *
+         * @param threads number of worker threads
+         */
+        explicit WaitList(int threads = DEFAULT_WAIT_LIST_THREADS);
+
+        /**
+         * @brief Destructor, stops the worker pool
+         */
+        ~WaitList();
+
+        /**
+         * @brief Parks a waiter
+         *
+         * The waiter is tried once right away, on the worker pool, so a notification between the caller's own attempt and the parking
+         * cannot get lost.
+         *
+         * @param key wait key, e.g. the queue URL
+         * @param timeout maximal wait time
+         * @param receive receive function
+         * @param expire expire function
+         */
+        void Wait(const std::string &key, std::chrono::milliseconds timeout, ReceiveFunction receive, ExpireFunction expire);
+
+        /**
+         * @brief Retries the waiters of the given key
+         *
+         * Cheap, if nobody is waiting.
+         *
+         * @param key wait key
+         */
+        void Notify(const std::string &key);
+
+        /**
+         * @brief Schedules a notification of the given key
+         *
+         * Ignored, if nobody is waiting or an earlier wake-up is already scheduled.
+         *
+         * @param key wait key
+         * @param timePoint time of the notification
+         */
+        void NotifyAt(const std::string &key, std::chrono::system_clock::time_point timePoint);
+
+        /**
+         * @brief Returns the number of parked waiters
+         *
+         * @param key wait key
+         * @return number of waiters
+         */
+        long CountWaiters(const std::string &key);
+
+      private:
+
+        /**
+         * Parked waiter
+         */
+        struct Waiter {
+
+            /**
+             * Receive function
+             */
+            ReceiveFunction receive;
+
+            /**
+             * Expire function
+             */
+            ExpireFunction expire;
+
+            /**
+             * Timeout timer
+             */
+            std::unique_ptr<boost::asio::steady_timer> timer;
+
+            /**
+             * Timeout elapsed while the waiter was being retried
+             */
+            bool expired = false;
+        };
+
+        /**
+         * Waiters of one key
+         */
+        struct WaitQueue {
+
+            /**
+             * Parked waiters, in arrival order
+             */
+            std::list<std::shared_ptr<Waiter>> waiters;
+
+            /**
+             * A retry round is running
+             */
+            bool draining = false;
+
+            /**
+             * Notification arrived during a retry round
+             */
+            bool pending = false;
+
+            /**
+             * Scheduled wake-up
+             */
+            std::shared_ptr<boost::asio::steady_timer> wakeup;
+
+            /**
+             * Time of the scheduled wake-up
+             */
+            std::chrono::system_clock::time_point wakeupAt;
+        };
+
+        /**
+         * @brief Retries the waiters of a key, until the first one comes back empty
+         *
+         * @param key wait key
+         */
+        void Drain(const std::string &key);
+
+        /**
+         * @brief Timeout handler of a waiter
+         *
+         * @param key wait key
+         * @param waiter waiter
+         */
+        void Expire(const std::string &key, const std::shared_ptr<Waiter> &waiter);
+
+        /**
+         * @brief Removes the wait queue of a key, if it is not used anymore. Needs the mutex.
+         *
+         * @param key wait key
+         */
+        void Cleanup(const std::string &key);
+
+        /**
+         * Wait queues by key
+         */
+        std::map<std::string, WaitQueue> _queues;
+
+        /**
+         * Worker pool, runs the timers and the retries
+         */
+        boost::asio::thread_pool _workerPool;
+
+        /**
+         * Wait queue mutex
+         */
+        boost::mutex _mutex;
+    };
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_WAIT_LIST_H
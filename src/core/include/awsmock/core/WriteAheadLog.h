@@ -0,0 +1,259 @@
+//
+// Created by vogje01 on 6/17/24.
+//
+
+#ifndef AWSMOCK_CORE_WRITE_AHEAD_LOG_H
+#define AWSMOCK_CORE_WRITE_AHEAD_LOG_H
+
+// Standard C includes
+#include <fcntl.h>
+#include <unistd.h>
+
+// C++ includes
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+
+// Boost includes
+#include <boost/crc.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+
+// AwsMock includes
+#include <awsmock/core/LogStream.h>
+#include <awsmock/core/exception/CoreException.h>
+
+// Snapshot write buffer size
+#define WAL_SNAPSHOT_BUFFER_SIZE (1024 * 1024)
+
+namespace AwsMock::Core {
+
+    /**
+     * @brief Append-only, CRC checked write-ahead log with snapshots
+     *
+     * @par
+     * Records are opaque byte strings. Each record is framed by its length and its CRC-32, a torn or corrupt tail, e.g. after a crash during
+     * a write, is detected on replay and cut off. Writing a record only appends it to an in-memory buffer and returns its sequence number.
+     * Committing a sequence number makes it durable: the first committing thread writes the whole buffer, including the records of all
+     * other threads, with a single write and, if enabled, a single fdatasync (group commit). Concurrent committers wait for that write.
+     *
+     * @par
+     * If the write or the fdatasync fails, the log is failed: the records of the buffer are lost and the file might end with a torn record,
+     * so no later record could be replayed. All waiting and all later commits throw, until the log is opened again.
+     *
+     * @par
+     * A snapshot replaces the log. The current log is rotated first, then the snapshot function writes the complete state, then the
+     * rotated log is deleted. Records written during the snapshot go to the new log. The owner applies its changes before it writes the
+     * corresponding record, therefore a snapshot contains at least everything of the rotated log. Replay reads the snapshot, the rotated
+     * log, if a crash interrupted a snapshot, and the current log. Records must be idempotent, as a record might be replayed on top of a
+     * snapshot, which already contains its effect.
+     *
+     * @par
+     * Files: <base>.snapshot, <base>.wal and <base>.wal.old during a snapshot.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class WriteAheadLog {
+
+      public:
+
+        /**
+         * Replay function, called for each record in log order
+         */
+        typedef std::function<void(const std::string &record)> ReplayFunction;
+
+        /**
+         * Write function, used by the snapshot function to write a record
+         */
+        typedef std::function<void(const std::string &record)> WriteFunction;
+
+        /**
+         * Snapshot function, writes the complete state as a sequence of records
+         */
+        typedef std::function<void(const WriteFunction &write)> SnapshotFunction;
+
+        /**
+         * @brief Constructor
+         */
+        WriteAheadLog() = default;
+
+        /**
+         * @brief Destructor, closes the log
+         */
+        ~WriteAheadLog();
+
+        /**
+         * @brief Replays the snapshot and the logs and opens the log for writing
+         *
+         * @param baseName base file name, e.g. /home/awsmock/data/wal/sqs
+         * @param sync if true, commits wait for fdatasync, otherwise only for the write
+         * @param replay replay function
+         * @return number of replayed records
+         */
+        long Open(const std::string &baseName, bool sync, const ReplayFunction &replay);
+
+        /**
+         * @brief Commits all pending records and closes the log
+         */
+        void Close();
+
+        /**
+         * @brief Checks whether the log is open
+         *
+         * @return true, if the log is open
+         */
+        bool IsOpen() const { return _open; }
+
+        /**
+         * @brief Appends a record to the commit buffer
+         *
+         * @param record record
+         * @return sequence number of the record, 0 if the log is not open
+         */
+        long Write(const std::string &record);
+
+        /**
+         * @brief Waits until the record with the given sequence number and all records before it are written
+         *
+         * @param sequence sequence number returned by Write, 0 is ignored
+         * @throws CoreException if the log cannot be written, or a previous write failed
+         */
+        void Commit(long sequence);
+
+        /**
+         * @brief Replaces the log by a snapshot
+         *
+         * Ignored, if another snapshot is running.
+         *
+         * @param snapshot snapshot function
+         * @throws CoreException if the snapshot cannot be written, or the log is failed
+         */
+        void Snapshot(const SnapshotFunction &snapshot);
+
+        /**
+         * @brief Returns the number of records written since the last snapshot
+         *
+         * @return number of records
+         */
+        long Size() const { return _size; }
+
+      private:
+
+        /**
+         * @brief Reads a log file and replays its records
+         *
+         * @param fileName log file name
+         * @param replay replay function
+         * @param count number of replayed records, incremented
+         * @return valid part of the file, without a torn or corrupt tail
+         */
+        static std::string ReadLog(const std::string &fileName, const ReplayFunction &replay, long &count);
+
+        /**
+         * @brief Appends a framed record to a buffer
+         *
+         * @param buffer output buffer
+         * @param record record
+         */
+        static void AppendFrame(std::string &buffer, const std::string &record);
+
+        /**
+         * @brief Writes a buffer completely
+         *
+         * @param fd file descriptor
+         * @param buffer buffer
+         * @throws CoreException on write errors
+         */
+        static void WriteFully(int fd, const std::string &buffer);
+
+        /**
+         * @brief Writes the commit buffer. Needs the mutex, which is released during the write.
+         *
+         * @param lock mutex lock
+         * @throws CoreException if the buffer cannot be written, the log is failed afterward
+         */
+        void Flush(boost::unique_lock<boost::mutex> &lock);
+
+        /**
+         * @brief Opens a file for appending
+         *
+         * @param fileName file name
+         * @return file descriptor
+         * @throws CoreException if the file cannot be opened
+         */
+        static int OpenFile(const std::string &fileName);
+
+        /**
+         * Base file name
+         */
+        std::string _baseName;
+
+        /**
+         * Sync on commit
+         */
+        bool _sync = true;
+
+        /**
+         * Log file descriptor
+         */
+        int _fd = -1;
+
+        /**
+         * Open flag
+         */
+        std::atomic<bool> _open = false;
+
+        /**
+         * Framed records, which are not written yet
+         */
+        std::string _buffer;
+
+        /**
+         * Sequence number of the last record in the buffer
+         */
+        long _written = 0;
+
+        /**
+         * Sequence number of the last written record
+         */
+        long _committed = 0;
+
+        /**
+         * A commit is writing the buffer
+         */
+        bool _flushing = false;
+
+        /**
+         * Error of a failed write, no record is committed anymore
+         */
+        std::string _error;
+
+        /**
+         * A snapshot is running
+         */
+        std::atomic<bool> _snapshotting = false;
+
+        /**
+         * Records since the last snapshot
+         */
+        std::atomic<long> _size = 0;
+
+        /**
+         * Log mutex
+         */
+        boost::mutex _mutex;
+
+        /**
+         * Signals the end of a write
+         */
+        boost::condition_variable _condition;
+    };
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_WRITE_AHEAD_LOG_H
@@ -33,6 +33,7 @@
 #define SQS_MESSAGE_BY_QUEUE_COUNT "sqs_message_by_queue_counter"
 #define SQS_SERVICE_TIMER "sqs_service_timer"
 #define SQS_MESSAGE_WAIT_TIME "sqs_message_wait_time"
+#define SQS_MESSAGE_WAIT_TIME_P99 "sqs_message_wait_time_p99"
 
 // S3 counter, timer
 #define S3_BUCKET_COUNT "s3_bucket_counter"
@@ -27,6 +27,11 @@ namespace AwsMock::Core {
         DefineStringProperty("awsmock.data.dir", "AWSMOCK_DATA_DIR", "/tmp/awsmock/data");
         DefineStringProperty("awsmock.temp.dir", "AWSMOCK_TEMP_DIR", "/tmp/awsmock/tmp");
         DefineBoolProperty("awsmock.pretty", "AWSMOCK_PRETTY", false);
+        DefineIntProperty("awsmock.mmap.cache.size", "AWSMOCK_MMAP_CACHE_SIZE", 64);
+        DefineIntProperty("awsmock.http.pool.size", "AWSMOCK_HTTP_POOL_SIZE", 16);
+        DefineIntProperty("awsmock.http.pool.idle.timeout", "AWSMOCK_HTTP_POOL_IDLE_TIMEOUT", 30);
+        DefineIntProperty("awsmock.http.pool.connect.timeout", "AWSMOCK_HTTP_POOL_CONNECT_TIMEOUT", 10);
+        DefineIntProperty("awsmock.http.pool.timeout", "AWSMOCK_HTTP_POOL_TIMEOUT", 900);
 
         // Manager
         DefineStringProperty("awsmock.manager.host", "AWSMOCK_MANAGER_HOST", "localhost");
@@ -41,6 +46,7 @@ namespace AwsMock::Core {
         DefineIntProperty("awsmock.service.gateway.http.max.queue", "AWSMOCK_SERVICE_GATEWAY_MAX_QUEUE", 250);
         DefineIntProperty("awsmock.service.gateway.http.max.threads", "AWSMOCK_SERVICE_GATEWAY_MAX_THREADS", 50);
         DefineIntProperty("awsmock.service.gateway.http.timeout", "AWSMOCK_SERVICE_GATEWAY_TIMEOUT", 900);
+        DefineIntProperty("awsmock.service.gateway.http.worker.threads", "AWSMOCK_SERVICE_GATEWAY_WORKER_THREADS", 50);
 
         // S3
         DefineBoolProperty("awsmock.service.s3.active", "AWSMOCK_SERVICE_S3_ACTIVE", true);
@@ -50,6 +56,8 @@ namespace AwsMock::Core {
         DefineIntProperty("awsmock.service.s3.http.max.threads", "AWSMOCK_SERVICE_S3_MAX_THREADS", 50);
         DefineIntProperty("awsmock.service.s3.http.timeout", "AWSMOCK_SERVICE_S3_TIMEOUT", 900);
         DefineIntProperty("awsmock.service.s3.monitoring.period", "AWSMOCK_SERVICE_S3_MONITORING_PERIOD", 900);
+        DefineIntProperty("awsmock.service.s3.worker.period", "AWSMOCK_SERVICE_S3_WORKER_PERIOD", 10);
+        DefineIntProperty("awsmock.service.s3.sweeper.budget", "AWSMOCK_SERVICE_S3_SWEEPER_BUDGET", 1000);
 
         // SQS
         DefineBoolProperty("awsmock.service.sqs.active", "AWSMOCK_SERVICE_SQS_ACTIVE", true);
@@ -59,8 +67,8 @@ namespace AwsMock::Core {
         DefineIntProperty("awsmock.service.sqs.http.max.threads", "AWSMOCK_SERVICE_SQS_MAX_THREADS", 50);
         DefineIntProperty("awsmock.service.sqs.http.timeout", "AWSMOCK_SERVICE_SQS_TIMEOUT", 900);
         DefineStringProperty("awsmock.service.sqs.hostname", "AWSMOCK_SERVICE_SQS_HOSTNAME", "localstack");
-        DefineIntProperty("awsmock.service.s3.monitoring.period", "AWSMOCK_MONITORING_SQS_PERIOD", 300);
-        DefineIntProperty("awsmock.service.s3.worker.period", "AWSMOCK_WORKER_SQS_PERIOD", 30);
+        DefineIntProperty("awsmock.service.sqs.monitoring.period", "AWSMOCK_MONITORING_SQS_PERIOD", 300);
+        DefineIntProperty("awsmock.service.sqs.worker.period", "AWSMOCK_WORKER_SQS_PERIOD", 1);
 
         // SNS
         DefineBoolProperty("awsmock.service.sns.active", "AWSMOCK_SERVICE_SNS_ACTIVE", true);
@@ -112,6 +120,7 @@ namespace AwsMock::Core {
         DefineIntProperty("awsmock.service.dynamodb.http.max.threads", "AWSMOCK_SERVICE_DYNAMODB_MAX_THREADS", 50);
         DefineIntProperty("awsmock.service.dynamodb.http.timeout", "AWSMOCK_SERVICE_DYNAMODB_TIMEOUT", 120);
         DefineIntProperty("awsmock.monitoring.dynamodb.period", "AWSMOCK_MONITORING_DYNAMODB_PERIOD", 300);
+        DefineStringProperty("awsmock.dynamodb.engine", "AWSMOCK_DYNAMODB_ENGINE", "docker");
 
         // SecretsManager
         DefineBoolProperty("awsmock.service.secretsmanager.active", "AWSMOCK_SERVICE_SECRETSMANAGER_ACTIVE", true);
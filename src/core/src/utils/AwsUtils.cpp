@@ -6,6 +6,9 @@
 
 namespace AwsMock::Core {
 
+    std::unordered_map<std::string, std::vector<unsigned char>> AwsUtils::_signingKeys;
+    boost::mutex AwsUtils::_signingKeyMutex;
+
     std::string AwsUtils::CreateS3Arn(const std::string &region, const std::string &accountId, const std::string &bucket, const std::string &key) {
         return CreateArn("s3", region, accountId, bucket + "/" + key);
     }
@@ -78,6 +81,13 @@ namespace AwsMock::Core {
         return stringstream.str();
     }
 
+    std::string AwsUtils::CreateSqsSequenceNumber() {
+        static std::atomic<long> sequence = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        std::stringstream stringstream;
+        stringstream << std::setw(20) << std::setfill('0') << ++sequence;
+        return stringstream.str();
+    }
+
     std::string AwsUtils::GetS3BucketName(const http::request<http::dynamic_body> &request) {
         if (IsS3HostStyle(request)) {
             return GetS3HostStyleBucket(request);
@@ -203,7 +213,7 @@ namespace AwsMock::Core {
         canonicalRequest << GetCanonicalQueryParameters(request.target()) << '\n';
         canonicalRequest << GetCanonicalHeaders(request, authorizationHeaderKeys) << '\n';
         canonicalRequest << authorizationHeaderKeys.signedHeaders << '\n';
-        canonicalRequest << GetHashedPayload(Core::HttpUtils::GetBodyAsString(request));
+        canonicalRequest << GetHashedPayload(request);
         return canonicalRequest.str();
     }
 
@@ -297,47 +307,149 @@ namespace AwsMock::Core {
         return Core::Crypto::GetSha256FromString(payload);
     }
 
+    std::string AwsUtils::GetHashedPayload(const http::request<http::dynamic_body> &request) {
+
+        auto it = request.find("x-amz-content-sha256");
+        if (it != request.end() && !it->value().empty()) {
+            return {it->value().data(), it->value().size()};
+        }
+
+        HashSink hashSink({"SHA256"});
+        for (const auto &buffer: request.body().data()) {
+            hashSink.Update(static_cast<const char *>(buffer.data()), buffer.size());
+        }
+        return hashSink.GetHash("SHA256");
+    }
+
     AuthorizationHeaderKeys AwsUtils::GetAuthorizationKeys(const http::request<http::dynamic_body> &request, const std::string &secretAccessKey) {
 
-        std::string authorizationHeader = request["Authorization"];
+        boost::beast::string_view header = request[http::field::authorization];
+        std::string_view authorizationHeader(header.data(), header.size());
+
+        AuthorizationHeaderView view;
+        if (!ParseAuthorizationHeader(authorizationHeader, view)) {
+            log_error << "Could not extract authorization, authorization: " << authorizationHeader;
+            return {};
+        }
 
-        // Get signing version
         AuthorizationHeaderKeys authKeys;
-        authKeys.signingVersion = StringUtils::Split(authorizationHeader, ' ')[0];
-
-        try {
-            Poco::RegularExpression::MatchVec posVec;
-            Poco::RegularExpression pattern(R"(Credential=([a-zA-Z0-9]+)\/([0-9]{8})\/([a-zA-Z0-9\-]+)\/([a-zA-Z0-9\-]+)\/(aws4_request),\ ?SignedHeaders=(.*),\ ?Signature=(.*)$)");
-            if (!pattern.match(authorizationHeader, 0, posVec)) {
-                log_error << "Could not extract authorization, authorization: " << authorizationHeader;
-                throw Core::UnauthorizedException("Could not extract authorization, authorization: " + authorizationHeader);
+        authKeys.signingVersion = view.signingVersion;
+        authKeys.secretAccessKey = secretAccessKey.empty() ? "none" : secretAccessKey;
+        authKeys.dateTime = view.dateTime;
+        authKeys.region = view.region;
+        authKeys.module = view.module;
+        authKeys.requestVersion = view.requestVersion;
+        authKeys.signedHeaders = view.signedHeaders;
+        authKeys.signature = view.signature;
+        authKeys.scope = authKeys.dateTime + "/" + authKeys.region + "/" + authKeys.module + "/" + authKeys.requestVersion;
+        authKeys.isoDateTime = Core::HttpUtils::HasHeader(request, "x-amz-date") ? Core::HttpUtils::GetHeaderValue(request, "x-amz-date") : GetISODateString();
+        return authKeys;
+    }
+
+    bool AwsUtils::ParseAuthorizationHeader(std::string_view authorizationHeader, AuthorizationHeaderView &view) {
+
+        constexpr std::string_view credentialKey = "Credential=";
+        constexpr std::string_view signedHeadersKey = "SignedHeaders=";
+        constexpr std::string_view signatureKey = "Signature=";
+
+        auto isToken = [](std::string_view value, bool allowDash) {
+            if (value.empty()) {
+                return false;
+            }
+            for (char c: value) {
+                if (!std::isalnum(static_cast<unsigned char>(c)) && !(allowDash && c == '-')) {
+                    return false;
+                }
             }
-            authKeys.secretAccessKey = secretAccessKey.empty() ? "none" : secretAccessKey;
-            authKeys.dateTime = authorizationHeader.substr(posVec[2].offset, posVec[2].length);
-            authKeys.region = authorizationHeader.substr(posVec[3].offset, posVec[3].length);
-            authKeys.module = authorizationHeader.substr(posVec[4].offset, posVec[4].length);
-            authKeys.requestVersion = authorizationHeader.substr(posVec[5].offset, posVec[5].length);
-            authKeys.signedHeaders = authorizationHeader.substr(posVec[6].offset, posVec[6].length);
-            authKeys.signature = authorizationHeader.substr(posVec[7].offset, posVec[7].length);
-            authKeys.scope = authKeys.dateTime + "/" + authKeys.region + "/" + authKeys.module + "/" + authKeys.requestVersion;
-            authKeys.isoDateTime = Core::HttpUtils::HasHeader(request, "x-amz-date") ? Core::HttpUtils::GetHeaderValue(request, "x-amz-date") : GetISODateString();
-            return authKeys;
-
-        } catch (Poco::Exception &e) {
-            log_error << e.message();
+            return true;
+        };
+
+        // Signing version
+        view.signingVersion = authorizationHeader.substr(0, authorizationHeader.find(' '));
+
+        // Credential=<key>/<date>/<region>/<module>/aws4_request
+        std::size_t start = authorizationHeader.find(credentialKey);
+        if (start == std::string_view::npos) {
+            return false;
         }
-        return {};
+        start += credentialKey.size();
+        std::size_t end = authorizationHeader.find(',', start);
+        if (end == std::string_view::npos) {
+            return false;
+        }
+        std::string_view credential = authorizationHeader.substr(start, end - start);
+
+        std::string_view *parts[] = {&view.accessKeyId, &view.dateTime, &view.region, &view.module, &view.requestVersion};
+        for (std::size_t i = 0; i < 5; i++) {
+            std::size_t slash = credential.find('/');
+            if (slash == std::string_view::npos && i < 4) {
+                return false;
+            }
+            *parts[i] = credential.substr(0, slash);
+            credential = slash == std::string_view::npos ? std::string_view{} : credential.substr(slash + 1);
+        }
+        if (!credential.empty() || !isToken(view.accessKeyId, false) || view.dateTime.size() != 8 || !isToken(view.dateTime, false) ||
+            !isToken(view.region, true) || !isToken(view.module, true) || view.requestVersion != "aws4_request") {
+            return false;
+        }
+
+        // SignedHeaders follows the credential, separated by a comma and an optional blank
+        start = end + 1;
+        if (start < authorizationHeader.size() && authorizationHeader[start] == ' ') {
+            start++;
+        }
+        if (authorizationHeader.substr(start, signedHeadersKey.size()) != signedHeadersKey) {
+            return false;
+        }
+        start += signedHeadersKey.size();
+
+        // Signature is the last element
+        std::size_t signature = authorizationHeader.rfind(signatureKey);
+        if (signature == std::string_view::npos || signature < start + 1) {
+            return false;
+        }
+        end = signature;
+        if (authorizationHeader[end - 1] == ' ') {
+            end--;
+        }
+        if (end <= start || authorizationHeader[end - 1] != ',') {
+            return false;
+        }
+        view.signedHeaders = authorizationHeader.substr(start, end - 1 - start);
+        view.signature = authorizationHeader.substr(signature + signatureKey.size());
+        return true;
     }
 
     std::string AwsUtils::GetSignature(const AuthorizationHeaderKeys &authorizationHeaderKeys, const std::string &stringToSign) {
-        std::vector<unsigned char> digest = Core::Crypto::GetHmacSha256FromStringRaw("AWS4" + authorizationHeaderKeys.secretAccessKey, authorizationHeaderKeys.dateTime);
-        digest = Core::Crypto::GetHmacSha256FromStringRaw(digest, authorizationHeaderKeys.region);
-        digest = Core::Crypto::GetHmacSha256FromStringRaw(digest, authorizationHeaderKeys.module);
-        digest = Core::Crypto::GetHmacSha256FromStringRaw(digest, authorizationHeaderKeys.requestVersion);
-        digest = Core::Crypto::GetHmacSha256FromStringRaw(digest, stringToSign);
+        std::vector<unsigned char> digest = Core::Crypto::GetHmacSha256FromStringRaw(GetSigningKey(authorizationHeaderKeys), stringToSign);
         return Core::Crypto::HexEncode(digest.data(), static_cast<int>(digest.size()));
     }
 
+    std::vector<unsigned char> AwsUtils::GetSigningKey(const AuthorizationHeaderKeys &authorizationHeaderKeys) {
+
+        std::string cacheKey = authorizationHeaderKeys.secretAccessKey + "/" + authorizationHeaderKeys.dateTime + "/" + authorizationHeaderKeys.region + "/" + authorizationHeaderKeys.module + "/" + authorizationHeaderKeys.requestVersion;
+        {
+            boost::mutex::scoped_lock lock(_signingKeyMutex);
+            auto it = _signingKeys.find(cacheKey);
+            if (it != _signingKeys.end()) {
+                return it->second;
+            }
+        }
+
+        std::vector<unsigned char> signingKey = Core::Crypto::GetHmacSha256FromStringRaw("AWS4" + authorizationHeaderKeys.secretAccessKey, authorizationHeaderKeys.dateTime);
+        signingKey = Core::Crypto::GetHmacSha256FromStringRaw(signingKey, authorizationHeaderKeys.region);
+        signingKey = Core::Crypto::GetHmacSha256FromStringRaw(signingKey, authorizationHeaderKeys.module);
+        signingKey = Core::Crypto::GetHmacSha256FromStringRaw(signingKey, authorizationHeaderKeys.requestVersion);
+
+        boost::mutex::scoped_lock lock(_signingKeyMutex);
+        if (_signingKeys.size() >= SIGNING_KEY_CACHE_SIZE) {
+            _signingKeys.clear();
+        }
+        _signingKeys[cacheKey] = signingKey;
+        log_trace << "Signing key cached, date: " << authorizationHeaderKeys.dateTime << " region: " << authorizationHeaderKeys.region << " module: " << authorizationHeaderKeys.module;
+        return signingKey;
+    }
+
     std::string AwsUtils::GetDateString() {
         auto t = std::time(nullptr);
         auto tm = *std::gmtime(&t);
@@ -97,6 +97,26 @@ namespace AwsMock::Core {
         return HexEncode(md_value, static_cast<int>(md_len));
     }
 
+    std::string Crypto::GetMultipartEtag(const std::vector<std::string> &partMd5Sums) {
+
+        EVP_MD_CTX *context = EVP_MD_CTX_new();
+        unsigned char md_value[EVP_MAX_MD_SIZE];
+        unsigned int md_len;
+
+        EVP_DigestInit_ex(context, EVP_md5(), nullptr);
+        for (const auto &partMd5Sum: partMd5Sums) {
+            unsigned char digest[MD5_DIGEST_LENGTH] = {};
+            for (size_t i = 0; i < MD5_DIGEST_LENGTH && 2 * i + 1 < partMd5Sum.length(); i++) {
+                digest[i] = static_cast<unsigned char>(std::stoi(partMd5Sum.substr(2 * i, 2), nullptr, 16));
+            }
+            EVP_DigestUpdate(context, digest, MD5_DIGEST_LENGTH);
+        }
+        EVP_DigestFinal_ex(context, md_value, &md_len);
+        EVP_MD_CTX_free(context);
+
+        return HexEncode(md_value, static_cast<int>(md_len)) + "-" + std::to_string(partMd5Sums.size());
+    }
+
     // TODO: Removed, until AWS uses openssl 3.0
     /*std::string Crypto::AwsGetMd5FromFile(const std::string &fileName) {
 
@@ -0,0 +1,71 @@
+//
+// Created by vogje01 on 6/14/24.
+//
+
+#include <awsmock/core/DeadlineQueue.h>
+
+namespace AwsMock::Core {
+
+    void DeadlineQueue::Schedule(const std::string &key, std::chrono::system_clock::time_point timePoint) {
+        boost::mutex::scoped_lock lock(_mutex);
+
+        auto [it, inserted] = _deadlines.try_emplace(key, timePoint);
+        if (!inserted) {
+            if (it->second <= timePoint) {
+                return;
+            }
+            it->second = timePoint;
+        }
+        _heap.push_back({.due = timePoint, .key = key});
+        std::push_heap(_heap.begin(), _heap.end(), std::greater<>());
+
+        // Frequent rescheduling leaves many stale entries behind
+        if (_heap.size() > 2 * _deadlines.size() + 64) {
+            std::erase_if(_heap, [this](const Entry &entry) {
+                auto it = _deadlines.find(entry.key);
+                return it == _deadlines.end() || it->second != entry.due;
+            });
+            std::make_heap(_heap.begin(), _heap.end(), std::greater<>());
+        }
+    }
+
+    std::vector<std::string> DeadlineQueue::TakeDue(std::chrono::system_clock::time_point now) {
+        boost::mutex::scoped_lock lock(_mutex);
+
+        std::vector<std::string> keys;
+        DropStale();
+        while (!_heap.empty() && _heap.front().due <= now) {
+            std::pop_heap(_heap.begin(), _heap.end(), std::greater<>());
+            keys.emplace_back(std::move(_heap.back().key));
+            _heap.pop_back();
+            _deadlines.erase(keys.back());
+            DropStale();
+        }
+        return keys;
+    }
+
+    std::chrono::system_clock::time_point DeadlineQueue::NextDeadline() {
+        boost::mutex::scoped_lock lock(_mutex);
+
+        DropStale();
+        return _heap.empty() ? std::chrono::system_clock::time_point::max() : _heap.front().due;
+    }
+
+    long DeadlineQueue::Size() {
+        boost::mutex::scoped_lock lock(_mutex);
+        return static_cast<long>(_deadlines.size());
+    }
+
+    void DeadlineQueue::DropStale() {
+
+        while (!_heap.empty()) {
+            auto it = _deadlines.find(_heap.front().key);
+            if (it != _deadlines.end() && it->second == _heap.front().due) {
+                return;
+            }
+            std::pop_heap(_heap.begin(), _heap.end(), std::greater<>());
+            _heap.pop_back();
+        }
+    }
+
+}// namespace AwsMock::Core
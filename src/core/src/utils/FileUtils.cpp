@@ -67,25 +67,86 @@ namespace AwsMock::Core {
         sourceFile.copyTo(targetFileName);
     }
 
+    long FileUtils::CopyFileRange(int source, long sourceOffset, int dest, long destOffset, long length) {
+
+        loff_t sourcePos = sourceOffset;
+        loff_t destPos = destOffset;
+        long copied = 0;
+        bool useSendfile = false;
+        while (copied < length) {
+
+            ssize_t count;
+            if (!useSendfile) {
+                count = copy_file_range(source, &sourcePos, dest, &destPos, length - copied, 0);
+                if (count < 0 && (errno == ENOSYS || errno == EXDEV || errno == EOPNOTSUPP || errno == EINVAL)) {
+                    log_debug << "copy_file_range not supported, falling back to sendfile, errno: " << errno;
+                    useSendfile = true;
+                    continue;
+                }
+            } else {
+                if (lseek(dest, destPos, SEEK_SET) < 0) {
+                    throw CoreException("Seek failed, error: " + std::string(strerror(errno)));
+                }
+                off_t offset = sourcePos;
+                count = sendfile(dest, source, &offset, length - copied);
+                if (count > 0) {
+                    sourcePos += count;
+                    destPos += count;
+                }
+            }
+
+            if (count < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw CoreException("Copy file range failed, error: " + std::string(strerror(errno)));
+            }
+            if (count == 0) {
+                break;
+            }
+            copied += count;
+        }
+        return copied;
+    }
+
     long FileUtils::AppendBinaryFiles(const std::string &outFile, const std::string &inDir, const std::vector<std::string> &files) {
 
-        int dest = open(outFile.c_str(), O_WRONLY | O_CREAT, 0644);
+        int dest = open(outFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (dest < 0) {
+            throw CoreException("Could not open output file, outFile: " + outFile + " error: " + std::string(strerror(errno)));
+        }
 
-        size_t copied = 0;
+        long copied = 0;
         for (auto &it: files) {
 
             std::string inFile = inDir + "/" + it;
             int source = open(inFile.c_str(), O_RDONLY, 0);
+            if (source < 0) {
+                close(dest);
+                throw CoreException("Could not open input file, inFile: " + inFile + " error: " + std::string(strerror(errno)));
+            }
 
             // struct required, rationale: function stat() exists also
             struct stat stat_source {};
             fstat(source, &stat_source);
-            copied += sendfile(dest, source, nullptr, stat_source.st_size);
 
+            // Share the extents of the part, the output offset must be block aligned, otherwise copy the part
+            file_clone_range range{.src_fd = source, .src_offset = 0, .src_length = 0, .dest_offset = static_cast<__u64>(copied)};
+            if (stat_source.st_size > 0 && ioctl(dest, FICLONERANGE, &range) == 0) {
+                copied += stat_source.st_size;
+            } else {
+                try {
+                    copied += CopyFileRange(source, 0, dest, copied, stat_source.st_size);
+                } catch (CoreException &) {
+                    close(source);
+                    close(dest);
+                    throw;
+                }
+            }
             close(source);
         }
         close(dest);
-        return static_cast<long>(copied);
+        return copied;
     }
 
     // TODO: Calculate correct checksum: https://docs.aws.amazon.com/AmazonS3/latest/userguide/checking-object-integrity.html
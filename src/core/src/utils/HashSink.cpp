@@ -0,0 +1,104 @@
+//
+// Created by vogje01 on 6/2/24.
+//
+
+#include <awsmock/core/HashSink.h>
+
+namespace AwsMock::Core {
+
+    HashSink::HashSink(const std::vector<std::string> &algorithms) {
+
+        for (const auto &algorithm: algorithms) {
+
+            const EVP_MD *md = nullptr;
+            if (algorithm == "MD5") {
+                md = EVP_md5();
+            } else if (algorithm == "SHA1") {
+                md = EVP_sha1();
+            } else if (algorithm == "SHA256") {
+                md = EVP_sha256();
+            } else {
+                log_warning << "Unsupported hash algorithm, algorithm: " << algorithm;
+                continue;
+            }
+
+            if (_contexts.contains(algorithm)) {
+                continue;
+            }
+            EVP_MD_CTX *context = EVP_MD_CTX_new();
+            EVP_DigestInit_ex(context, md, nullptr);
+            _contexts[algorithm] = context;
+        }
+    }
+
+    HashSink::~HashSink() {
+        for (auto &context: _contexts) {
+            EVP_MD_CTX_free(context.second);
+        }
+    }
+
+    void HashSink::Update(const char *data, std::size_t length) {
+        for (auto &context: _contexts) {
+            EVP_DigestUpdate(context.second, data, length);
+        }
+        _size += static_cast<long>(length);
+    }
+
+    long HashSink::CopyStream(std::istream &input, std::ostream &output) {
+
+        std::vector<char> buffer(HASH_SINK_BUFFER_SIZE);
+        long copied = 0;
+        while (input.good()) {
+            input.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            std::streamsize count = input.gcount();
+            if (count > 0) {
+                Update(buffer.data(), count);
+                output.write(buffer.data(), count);
+                copied += count;
+            }
+        }
+        return copied;
+    }
+
+    long HashSink::UpdateFromFile(const std::string &fileName) {
+
+        std::ifstream ifs(fileName, std::ios::binary);
+        std::vector<char> buffer(HASH_SINK_BUFFER_SIZE);
+        long count = 0;
+        while (ifs.good()) {
+            ifs.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            if (ifs.gcount() > 0) {
+                Update(buffer.data(), ifs.gcount());
+                count += ifs.gcount();
+            }
+        }
+        ifs.close();
+        return count;
+    }
+
+    std::string HashSink::GetHash(const std::string &algorithm) {
+        Finalize();
+        auto it = _hashes.find(algorithm);
+        return it != _hashes.end() ? it->second : std::string{};
+    }
+
+    long HashSink::GetSize() const {
+        return _size;
+    }
+
+    void HashSink::Finalize() {
+
+        if (_finalized) {
+            return;
+        }
+
+        unsigned char md_value[EVP_MAX_MD_SIZE];
+        unsigned int md_len;
+        for (auto &context: _contexts) {
+            EVP_DigestFinal_ex(context.second, md_value, &md_len);
+            _hashes[context.first] = Crypto::HexEncode(md_value, static_cast<int>(md_len));
+        }
+        _finalized = true;
+    }
+
+}// namespace AwsMock::Core
@@ -0,0 +1,239 @@
+//
+// Created by vogje01 on 6/5/24.
+//
+
+#include <awsmock/core/HttpSocketPool.h>
+
+namespace AwsMock::Core {
+
+    HttpSocketPool::HttpSocketPool() : _workerPool(4) {
+        _maxIdle = Configuration::instance().getInt("awsmock.http.pool.size", DEFAULT_HTTP_POOL_SIZE);
+        _idleTimeout = std::chrono::seconds(Configuration::instance().getInt("awsmock.http.pool.idle.timeout", DEFAULT_HTTP_POOL_IDLE_TIMEOUT));
+        _connectTimeout = std::chrono::seconds(Configuration::instance().getInt("awsmock.http.pool.connect.timeout", DEFAULT_HTTP_POOL_CONNECT_TIMEOUT));
+        _timeout = std::chrono::seconds(Configuration::instance().getInt("awsmock.http.pool.timeout", DEFAULT_HTTP_POOL_TIMEOUT));
+    }
+
+    HttpSocketPool::~HttpSocketPool() {
+        _workerPool.join();
+        Clear();
+    }
+
+    HttpSocketResponse HttpSocketPool::SendJson(http::verb method, const std::string &host, int port, const std::string &path, const std::string &body, const std::map<std::string, std::string> &headers) {
+
+        http::request<http::string_body> request;
+        request.method(method);
+        request.set(http::field::host, "localhost");
+        request.set(http::field::user_agent, BOOST_BEAST_VERSION_STRING);
+        request.target(path);
+        request.keep_alive(true);
+        request.body() = body;
+        request.prepare_payload();
+        for (const auto &header: headers) {
+            request.base().set(header.first, header.second);
+        }
+
+        // A reused connection may have been closed by the peer in the meantime, retry once on a fresh connection
+        for (int attempt = 0; attempt < 2; attempt++) {
+
+            bool reused = false;
+            boost::system::error_code ec;
+            std::unique_ptr<Channel> channel = attempt == 0 ? Acquire(host, port, reused, ec) : Connect(host, port, ec);
+            if (!channel) {
+                log_error << "Connect to " << host << ":" << port << " failed, error: " << ec.message();
+                return {.statusCode = http::status::internal_server_error, .body = ec.message()};
+            }
+
+            bool retryable = false;
+            http::response<http::string_body> response;
+            ec = SendRequest(*channel, request, response, retryable);
+            if (ec) {
+                Close(channel->stream);
+                if (reused && retryable) {
+                    log_debug << "Pooled connection to " << host << ":" << port << " failed, retrying, error: " << ec.message();
+                    continue;
+                }
+                log_error << "Send to " << host << ":" << port << " failed, error: " << ec.message();
+                return {.statusCode = http::status::internal_server_error, .body = ec.message()};
+            }
+
+            if (response.keep_alive()) {
+                Release(host, port, std::move(channel));
+            } else {
+                Close(channel->stream);
+            }
+            return {.statusCode = response.result(), .body = std::move(response.body())};
+        }
+        return {.statusCode = http::status::internal_server_error, .body = "Connection failed"};
+    }
+
+    std::future<HttpSocketResponse> HttpSocketPool::SendJsonAsync(http::verb method, const std::string &host, int port, const std::string &path, const std::string &body, const std::map<std::string, std::string> &headers) {
+
+        auto task = std::make_shared<std::packaged_task<HttpSocketResponse()>>([this, method, host, port, path, body, headers]() {
+            return SendJson(method, host, port, path, body, headers);
+        });
+        std::future<HttpSocketResponse> future = task->get_future();
+        boost::asio::post(_workerPool, [task]() { (*task)(); });
+        return future;
+    }
+
+    std::size_t HttpSocketPool::IdleConnections(const std::string &host, int port) {
+
+        boost::mutex::scoped_lock lock(_mutex);
+
+        auto it = _idleConnections.find(GetKey(host, port));
+        return it == _idleConnections.end() ? 0 : it->second.size();
+    }
+
+    void HttpSocketPool::Clear() {
+
+        boost::mutex::scoped_lock lock(_mutex);
+
+        for (auto &[key, connections]: _idleConnections) {
+            for (auto &connection: connections) {
+                Close(connection.channel->stream);
+            }
+        }
+        _idleConnections.clear();
+        _resolved.clear();
+    }
+
+    boost::system::error_code HttpSocketPool::SendRequest(Channel &channel, http::request<http::string_body> &request, http::response<http::string_body> &response, bool &retryable) const {
+
+        // The peer has not seen a complete request
+        boost::system::error_code ec;
+        channel.stream.expires_after(_timeout);
+        http::async_write(channel.stream, request, [&ec](boost::system::error_code result, std::size_t) { ec = result; });
+        Run(channel);
+        if (ec) {
+            retryable = true;
+            return ec;
+        }
+
+        boost::beast::flat_buffer buffer;
+        http::response_parser<http::string_body> parser;
+        channel.stream.expires_after(_timeout);
+        http::async_read(channel.stream, buffer, parser, [&ec](boost::system::error_code result, std::size_t) { ec = result; });
+        Run(channel);
+        if (ec) {
+
+            // Closed before the response started, i.e. the peer dropped the idle connection instead of processing the request
+            retryable = (ec == http::error::end_of_stream || ec == boost::asio::error::connection_reset) && !parser.got_some() && buffer.size() == 0;
+            return ec;
+        }
+        channel.stream.expires_never();
+        response = parser.release();
+        return ec;
+    }
+
+    std::unique_ptr<HttpSocketPool::Channel> HttpSocketPool::Acquire(const std::string &host, int port, bool &reused, boost::system::error_code &ec) {
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+
+            auto it = _idleConnections.find(GetKey(host, port));
+            if (it != _idleConnections.end()) {
+
+                // Most recently used connections are at the back
+                while (!it->second.empty()) {
+                    Connection connection = std::move(it->second.back());
+                    it->second.pop_back();
+                    if (IsHealthy(connection)) {
+                        reused = true;
+                        return std::move(connection.channel);
+                    }
+                    Close(connection.channel->stream);
+                }
+            }
+        }
+        reused = false;
+        return Connect(host, port, ec);
+    }
+
+    std::unique_ptr<HttpSocketPool::Channel> HttpSocketPool::Connect(const std::string &host, int port, boost::system::error_code &ec) {
+
+        auto channel = std::make_unique<Channel>();
+        std::string key = GetKey(host, port);
+        boost::asio::ip::tcp::resolver::results_type results;
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            auto it = _resolved.find(key);
+            if (it != _resolved.end()) {
+                results = it->second;
+            }
+        }
+
+        // Resolve host/port, outside the lock
+        if (results.empty()) {
+            boost::asio::ip::tcp::resolver resolver(channel->ioContext);
+            results = resolver.resolve(host, std::to_string(port), ec);
+            if (ec) {
+                return nullptr;
+            }
+            boost::mutex::scoped_lock lock(_mutex);
+            _resolved[key] = results;
+        }
+
+        channel->stream.expires_after(_connectTimeout);
+        channel->stream.async_connect(results, [&ec](boost::system::error_code result, const boost::asio::ip::tcp::endpoint &) { ec = result; });
+        Run(*channel);
+        if (ec) {
+
+            // Address may have changed, e.g. a restarted container
+            boost::mutex::scoped_lock lock(_mutex);
+            _resolved.erase(key);
+            return nullptr;
+        }
+        channel->stream.expires_never();
+        channel->stream.socket().set_option(boost::asio::ip::tcp::no_delay(true), ec);
+        ec = {};
+        return channel;
+    }
+
+    void HttpSocketPool::Release(const std::string &host, int port, std::unique_ptr<Channel> channel) {
+
+        boost::mutex::scoped_lock lock(_mutex);
+
+        std::deque<Connection> &connections = _idleConnections[GetKey(host, port)];
+        if (connections.size() >= _maxIdle) {
+            Close(channel->stream);
+            return;
+        }
+        connections.push_back({.channel = std::move(channel), .lastUsed = std::chrono::steady_clock::now()});
+    }
+
+    void HttpSocketPool::Run(Channel &channel) {
+        channel.ioContext.restart();
+        channel.ioContext.run();
+    }
+
+    bool HttpSocketPool::IsHealthy(Connection &connection) const {
+
+        if (std::chrono::steady_clock::now() - connection.lastUsed > _idleTimeout) {
+            return false;
+        }
+
+        boost::asio::ip::tcp::socket &socket = connection.channel->stream.socket();
+        if (!socket.is_open()) {
+            return false;
+        }
+
+        // An idle connection must not be readable. Readable means either EOF (peer closed) or unexpected data.
+        boost::system::error_code ec;
+        socket.non_blocking(true, ec);
+        char c;
+        std::size_t n = socket.receive(boost::asio::buffer(&c, 1), boost::asio::socket_base::message_peek, ec);
+        bool healthy = ec == boost::asio::error::would_block && n == 0;
+        socket.non_blocking(false, ec);
+        return healthy;
+    }
+
+    void HttpSocketPool::Close(boost::beast::tcp_stream &stream) {
+        boost::system::error_code ec;
+        stream.socket().shutdown(boost::asio::ip::tcp::socket::shutdown_both, ec);
+        stream.socket().close(ec);
+    }
+
+    std::string HttpSocketPool::GetKey(const std::string &host, int port) {
+        return host + ":" + std::to_string(port);
+    }
+
+}// namespace AwsMock::Core
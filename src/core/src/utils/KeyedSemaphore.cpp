@@ -0,0 +1,53 @@
+//
+// Created by vogje01 on 6/22/24.
+//
+
+#include <awsmock/core/KeyedSemaphore.h>
+
+namespace AwsMock::Core {
+
+    bool KeyedSemaphore::Acquire(const std::string &key, int limit, std::chrono::milliseconds timeout) {
+        std::unique_lock lock(_mutex);
+
+        std::unique_ptr<Slot> &entry = _slots[key];
+        if (!entry) {
+            entry = std::make_unique<Slot>();
+        }
+
+        // The slot stays in the map, as long as somebody holds or waits for it, so the pointer remains valid
+        Slot *slot = entry.get();
+        slot->waiters++;
+        bool acquired = slot->released.wait_for(lock, timeout, [slot, limit]() { return slot->holders < std::max(limit, 1); });
+        slot->waiters--;
+
+        if (acquired) {
+            slot->holders++;
+        } else if (slot->holders == 0 && slot->waiters == 0) {
+            _slots.erase(key);
+        }
+        return acquired;
+    }
+
+    void KeyedSemaphore::Release(const std::string &key) {
+        std::unique_lock lock(_mutex);
+
+        auto it = _slots.find(key);
+        if (it == _slots.end()) {
+            return;
+        }
+        it->second->holders--;
+        if (it->second->waiters > 0) {
+            it->second->released.notify_one();
+        } else if (it->second->holders == 0) {
+            _slots.erase(it);
+        }
+    }
+
+    int KeyedSemaphore::CountHolders(const std::string &key) {
+        std::unique_lock lock(_mutex);
+
+        auto it = _slots.find(key);
+        return it != _slots.end() ? it->second->holders : 0;
+    }
+
+}// namespace AwsMock::Core
@@ -6,49 +6,46 @@
 
 namespace AwsMock::Core {
 
-    boost::mutex MemoryMappedFile::_mutex;
-
-    bool MemoryMappedFile::OpenFile(const std::string &filename) {
+    MemoryMappedFile::MemoryMappedFile(const std::string &filename) : _filename(filename) {
 
         _fileSize = FileUtils::FileSize(filename);
 
         int fd = open(filename.c_str(), O_RDONLY);
         if (fd < 0) {
-            log_error << "Could not open file for memory mapping";
-            return false;
+            log_error << "Could not open file for memory mapping, filename: " << filename;
+            return;
         }
 
         _start = mmap(nullptr, _fileSize, PROT_READ, MAP_SHARED, fd, 0);
-        _membuffer = (char *) _start;
+        close(fd);
 
-        if (_membuffer == MAP_FAILED) {
-            close(fd);
+        if (_start == MAP_FAILED) {
+            _start = nullptr;
             log_error << "Could not memory map file: " << filename;
-            return false;
+            return;
         }
-        close(fd);
-
+        _membuffer = static_cast<char *>(_start);
         _mapped = true;
-        return _mapped;
+        log_debug << "Memory mapped file opened, filename: " << filename << " size: " << _fileSize;
     }
 
-    void MemoryMappedFile::CloseFile() {
-        boost::mutex::scoped_lock lock(_mutex);
-        if (munmap(_start, _fileSize) < 0) {
-            log_error << "Could not unmap file";
+    MemoryMappedFile::~MemoryMappedFile() {
+        if (_mapped && munmap(_start, _fileSize) < 0) {
+            log_error << "Could not unmap file, filename: " << _filename;
         }
-        log_debug << "Memory mapped file closed";
-        _mapped = false;
+        log_debug << "Memory mapped file closed, filename: " << _filename;
     }
 
-    long MemoryMappedFile::ReadChunk(long start, long length, char *buffer) {
+    long MemoryMappedFile::ReadChunk(long start, long length, char *buffer) const {
+        if (start >= _fileSize) {
+            return 0;
+        }
         if (start + length > _fileSize) {
             length = _fileSize - start;
         }
-        boost::mutex::scoped_lock lock(_mutex);
-        log_debug << "start: " << start << " length: " << length << " size: " << _fileSize;
+        log_trace << "start: " << start << " length: " << length << " size: " << _fileSize;
         memcpy(buffer, _membuffer + start, length);
         return length;
     }
 
-}// namespace AwsMock::Core
\ No newline at end of file
+}// namespace AwsMock::Core
@@ -0,0 +1,67 @@
+//
+// Created by vogje01 on 6/3/24.
+//
+
+#include <awsmock/core/MemoryMappedFileCache.h>
+
+namespace AwsMock::Core {
+
+    MemoryMappedFileCache::MemoryMappedFileCache() {
+        _maxSize = Configuration::instance().getInt("awsmock.mmap.cache.size", DEFAULT_MMAP_CACHE_SIZE);
+    }
+
+    std::shared_ptr<const MemoryMappedFile> MemoryMappedFileCache::GetFile(const std::string &filename) {
+
+        boost::mutex::scoped_lock lock(_mutex);
+
+        auto it = _files.find(filename);
+        if (it != _files.end()) {
+
+            // Move to the front of the LRU list
+            _lru.splice(_lru.begin(), _lru, it->second.lruPosition);
+            return it->second.file;
+        }
+
+        auto file = std::make_shared<const MemoryMappedFile>(filename);
+        if (!file->IsMapped()) {
+            return nullptr;
+        }
+
+        _lru.push_front(filename);
+        _files[filename] = {.file = file, .lruPosition = _lru.begin()};
+        Evict();
+        log_debug << "Memory mapped file cached, filename: " << filename << " size: " << _files.size();
+        return file;
+    }
+
+    void MemoryMappedFileCache::RemoveFile(const std::string &filename) {
+
+        boost::mutex::scoped_lock lock(_mutex);
+
+        auto it = _files.find(filename);
+        if (it != _files.end()) {
+            _lru.erase(it->second.lruPosition);
+            _files.erase(it);
+            log_debug << "Memory mapped file removed from cache, filename: " << filename;
+        }
+    }
+
+    void MemoryMappedFileCache::SetMaxSize(std::size_t maxSize) {
+        boost::mutex::scoped_lock lock(_mutex);
+        _maxSize = maxSize;
+        Evict();
+    }
+
+    std::size_t MemoryMappedFileCache::Size() {
+        boost::mutex::scoped_lock lock(_mutex);
+        return _files.size();
+    }
+
+    void MemoryMappedFileCache::Evict() {
+        while (_files.size() > _maxSize && !_lru.empty()) {
+            _files.erase(_lru.back());
+            _lru.pop_back();
+        }
+    }
+
+}// namespace AwsMock::Core
@@ -0,0 +1,30 @@
+//
+// Created by vogje01 on 6/16/24.
+//
+
+#include <awsmock/core/SharedString.h>
+
+namespace AwsMock::Core {
+
+    SharedString::SharedString(std::string value) {
+        if (!value.empty()) {
+            _value = std::make_shared<const std::string>(std::move(value));
+        }
+    }
+
+    SharedString::SharedString(const char *value) {
+        if (value != nullptr && *value != '\0') {
+            _value = std::make_shared<const std::string>(value);
+        }
+    }
+
+    const std::string &SharedString::Empty() {
+        static const std::string empty;
+        return empty;
+    }
+
+    std::ostream &operator<<(std::ostream &os, const SharedString &s) {
+        return os << s.str();
+    }
+
+}// namespace AwsMock::Core
@@ -155,6 +155,18 @@ namespace AwsMock::Core {
         return s1.ends_with(s2);
     }
 
+    std::string StringUtils::PrefixSuccessor(const std::string &prefix) {
+
+        std::string successor = prefix;
+        while (!successor.empty() && static_cast<unsigned char>(successor.back()) == 0xff) {
+            successor.pop_back();
+        }
+        if (!successor.empty()) {
+            successor.back() = static_cast<char>(static_cast<unsigned char>(successor.back()) + 1);
+        }
+        return successor;
+    }
+
     std::string StringUtils::SubString(const std::string &string, int beginIndex, int endIndex) {
         int size = (int) string.size();
         if (beginIndex < 0 || beginIndex > size - 1)
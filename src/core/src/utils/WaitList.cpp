@@ -0,0 +1,187 @@
+//
+// Created by vogje01 on 6/9/24.
+//
+
+#include <awsmock/core/WaitList.h>
+
+namespace AwsMock::Core {
+
+    WaitList::WaitList(int threads) : _workerPool(threads) {}
+
+    WaitList::~WaitList() {
+        _workerPool.stop();
+        _workerPool.join();
+
+        // Timers must go before the worker pool
+        boost::mutex::scoped_lock lock(_mutex);
+        _queues.clear();
+    }
+
+    void WaitList::Wait(const std::string &key, std::chrono::milliseconds timeout, ReceiveFunction receive, ExpireFunction expire) {
+
+        auto waiter = std::make_shared<Waiter>();
+        waiter->receive = std::move(receive);
+        waiter->expire = std::move(expire);
+        waiter->timer = std::make_unique<boost::asio::steady_timer>(_workerPool.get_executor(), timeout);
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            waiter->timer->async_wait([this, key, waiter](const boost::system::error_code &ec) {
+                if (ec != boost::asio::error::operation_aborted) {
+                    Expire(key, waiter);
+                }
+            });
+            _queues[key].waiters.push_back(waiter);
+        }
+        log_trace << "Waiter parked, key: " << key << " timeout: " << timeout.count() << "ms";
+
+        // First try, messages might have arrived before the waiter was parked
+        Notify(key);
+    }
+
+    void WaitList::Notify(const std::string &key) {
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            auto it = _queues.find(key);
+            if (it == _queues.end()) {
+                return;
+            }
+
+            // The running round picks up the notification
+            if (it->second.draining) {
+                it->second.pending = true;
+                return;
+            }
+            if (it->second.waiters.empty()) {
+                return;
+            }
+            it->second.draining = true;
+        }
+        boost::asio::post(_workerPool, [this, key]() { Drain(key); });
+    }
+
+    void WaitList::NotifyAt(const std::string &key, std::chrono::system_clock::time_point timePoint) {
+
+        boost::mutex::scoped_lock lock(_mutex);
+        auto it = _queues.find(key);
+        if (it == _queues.end()) {
+            return;
+        }
+
+        WaitQueue &queue = it->second;
+        if (queue.wakeup && queue.wakeupAt <= timePoint) {
+            return;
+        }
+        if (queue.wakeup) {
+            queue.wakeup->cancel();
+        }
+
+        auto delay = std::chrono::duration_cast<std::chrono::steady_clock::duration>(timePoint - std::chrono::system_clock::now());
+        queue.wakeup = std::make_shared<boost::asio::steady_timer>(_workerPool.get_executor(), delay);
+        queue.wakeupAt = timePoint;
+        queue.wakeup->async_wait([this, key, wakeup = std::weak_ptr(queue.wakeup)](const boost::system::error_code &ec) {
+            if (ec == boost::asio::error::operation_aborted) {
+                return;
+            }
+            {
+                boost::mutex::scoped_lock lock(_mutex);
+                auto it = _queues.find(key);
+                if (it != _queues.end() && it->second.wakeup == wakeup.lock()) {
+                    it->second.wakeup.reset();
+                }
+            }
+            Notify(key);
+        });
+    }
+
+    long WaitList::CountWaiters(const std::string &key) {
+
+        boost::mutex::scoped_lock lock(_mutex);
+        auto it = _queues.find(key);
+        return it == _queues.end() ? 0 : static_cast<long>(it->second.waiters.size());
+    }
+
+    void WaitList::Drain(const std::string &key) {
+
+        while (true) {
+
+            // Take the oldest waiter
+            std::shared_ptr<Waiter> waiter;
+            {
+                boost::mutex::scoped_lock lock(_mutex);
+                WaitQueue &queue = _queues[key];
+                queue.pending = false;
+                if (queue.waiters.empty()) {
+                    queue.draining = false;
+                    Cleanup(key);
+                    return;
+                }
+                waiter = queue.waiters.front();
+                queue.waiters.pop_front();
+            }
+
+            // Retry without the lock, the receive function usually goes to the database
+            bool received;
+            try {
+                received = waiter->receive();
+            } catch (std::exception &e) {
+                log_error << "Waiter failed, key: " << key << " error: " << e.what();
+                waiter->expire();
+                received = true;
+            }
+
+            boost::mutex::scoped_lock lock(_mutex);
+            WaitQueue &queue = _queues[key];
+            if (received) {
+                waiter->timer->cancel();
+                continue;
+            }
+
+            // Still nothing there, the waiter keeps its place, unless it timed out in the meantime
+            bool expired = waiter->expired;
+            if (!expired) {
+                queue.waiters.push_front(waiter);
+            }
+            bool pending = queue.pending;
+            if (!pending) {
+                queue.draining = false;
+                Cleanup(key);
+            }
+            lock.unlock();
+
+            if (expired) {
+                waiter->expire();
+            }
+            if (!pending) {
+                return;
+            }
+        }
+    }
+
+    void WaitList::Expire(const std::string &key, const std::shared_ptr<Waiter> &waiter) {
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            auto it = _queues.find(key);
+            if (it == _queues.end() || std::erase(it->second.waiters, waiter) == 0) {
+
+                // Currently retried, the retry round completes the waiter
+                waiter->expired = true;
+                return;
+            }
+            Cleanup(key);
+        }
+        log_trace << "Waiter expired, key: " << key;
+        waiter->expire();
+    }
+
+    void WaitList::Cleanup(const std::string &key) {
+
+        auto it = _queues.find(key);
+        if (it != _queues.end() && it->second.waiters.empty() && !it->second.draining) {
+            if (it->second.wakeup) {
+                it->second.wakeup->cancel();
+            }
+            _queues.erase(it);
+        }
+    }
+
+}// namespace AwsMock::Core
@@ -0,0 +1,315 @@
+//
+// Created by vogje01 on 6/17/24.
+//
+
+#include <awsmock/core/WriteAheadLog.h>
+
+namespace AwsMock::Core {
+
+    WriteAheadLog::~WriteAheadLog() {
+        try {
+            Close();
+        } catch (CoreException &exc) {
+            log_error << "Could not close write-ahead log, error: " << exc.message();
+        }
+    }
+
+    long WriteAheadLog::Open(const std::string &baseName, bool sync, const ReplayFunction &replay) {
+        boost::mutex::scoped_lock lock(_mutex);
+
+        if (_fd >= 0) {
+            log_warning << "Write-ahead log already open, baseName: " << _baseName;
+            return 0;
+        }
+
+        _baseName = baseName;
+        _sync = sync;
+        std::string walFile = baseName + ".wal";
+        std::string rotatedFile = walFile + ".old";
+        std::string snapshotFile = baseName + ".snapshot";
+        std::filesystem::create_directories(std::filesystem::path(baseName).parent_path());
+        std::filesystem::remove(snapshotFile + ".tmp");
+
+        // Snapshot, rotated log of an interrupted snapshot, current log
+        long count = 0;
+        ReadLog(snapshotFile, replay, count);
+        long snapshotCount = count;
+        std::string rotated = ReadLog(rotatedFile, replay, count);
+        std::string current = ReadLog(walFile, replay, count);
+
+        // Merge the rotated log into the current log and cut off a torn tail
+        if (std::filesystem::exists(rotatedFile) || (std::filesystem::exists(walFile) && std::filesystem::file_size(walFile) != current.size())) {
+            std::string tmpFile = walFile + ".tmp";
+            int fd = ::open(tmpFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0) {
+                throw CoreException("Could not open write-ahead log, file: " + tmpFile + " error: " + std::strerror(errno));
+            }
+            WriteFully(fd, rotated + current);
+            fdatasync(fd);
+            ::close(fd);
+            std::filesystem::rename(tmpFile, walFile);
+            std::filesystem::remove(rotatedFile);
+        }
+
+        _fd = OpenFile(walFile);
+        _error.clear();
+        _size = count - snapshotCount;
+        _open = true;
+        log_info << "Write-ahead log opened, baseName: " << baseName << " replayed: " << count << " sync: " << std::boolalpha << sync;
+        return count;
+    }
+
+    void WriteAheadLog::Close() {
+        boost::unique_lock<boost::mutex> lock(_mutex);
+
+        if (_fd < 0) {
+            return;
+        }
+        _open = false;
+        while (_flushing || (!_buffer.empty() && _error.empty())) {
+            if (_flushing) {
+                _condition.wait(lock);
+            } else {
+                Flush(lock);
+            }
+        }
+        _buffer.clear();
+        ::close(_fd);
+        _fd = -1;
+        log_debug << "Write-ahead log closed, baseName: " << _baseName;
+    }
+
+    long WriteAheadLog::Write(const std::string &record) {
+
+        if (!_open) {
+            return 0;
+        }
+
+        boost::mutex::scoped_lock lock(_mutex);
+        if (_fd < 0) {
+            return 0;
+        }
+
+        // The record is not written anymore, its commit fails
+        if (!_error.empty()) {
+            return ++_written;
+        }
+        AppendFrame(_buffer, record);
+        _size++;
+        return ++_written;
+    }
+
+    void WriteAheadLog::Commit(long sequence) {
+
+        if (sequence <= 0) {
+            return;
+        }
+
+        // The first waiting committer writes the buffer for all others
+        boost::unique_lock<boost::mutex> lock(_mutex);
+        while (_committed < sequence) {
+            if (!_error.empty()) {
+                throw CoreException("Write-ahead log failed, baseName: " + _baseName + " error: " + _error);
+            }
+            if (_flushing) {
+                _condition.wait(lock);
+            } else {
+                Flush(lock);
+            }
+        }
+    }
+
+    void WriteAheadLog::Snapshot(const SnapshotFunction &snapshot) {
+
+        bool expected = false;
+        if (!_open || !_snapshotting.compare_exchange_strong(expected, true)) {
+            return;
+        }
+
+        std::string walFile = _baseName + ".wal";
+        std::string rotatedFile = walFile + ".old";
+        std::string snapshotFile = _baseName + ".snapshot";
+        std::string tmpFile = snapshotFile + ".tmp";
+        try {
+
+            // Rotate the log, records written from now on go to the new log
+            {
+                boost::unique_lock<boost::mutex> lock(_mutex);
+                while (_flushing || !_buffer.empty()) {
+                    if (!_error.empty()) {
+                        throw CoreException("Write-ahead log failed, baseName: " + _baseName + " error: " + _error);
+                    }
+                    if (_flushing) {
+                        _condition.wait(lock);
+                    } else {
+                        Flush(lock);
+                    }
+                }
+
+                // A failed snapshot left its rotated log behind, it is still needed
+                if (std::filesystem::exists(rotatedFile)) {
+                    std::ifstream ifs(walFile, std::ios::binary);
+                    std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+                    int fd = OpenFile(rotatedFile);
+                    WriteFully(fd, content);
+                    fdatasync(fd);
+                    ::close(fd);
+                    std::filesystem::resize_file(walFile, 0);
+                } else {
+                    std::filesystem::rename(walFile, rotatedFile);
+                }
+                ::close(_fd);
+                _fd = OpenFile(walFile);
+                _size = 0;
+            }
+
+            // Write the snapshot to a temporary file and replace the old snapshot
+            int fd = ::open(tmpFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (fd < 0) {
+                throw CoreException("Could not open snapshot, file: " + tmpFile + " error: " + std::strerror(errno));
+            }
+
+            long count = 0;
+            std::string buffer;
+            try {
+                snapshot([&fd, &buffer, &count](const std::string &record) {
+                    AppendFrame(buffer, record);
+                    count++;
+                    if (buffer.size() >= WAL_SNAPSHOT_BUFFER_SIZE) {
+                        WriteFully(fd, buffer);
+                        buffer.clear();
+                    }
+                });
+                WriteFully(fd, buffer);
+                if (fdatasync(fd) != 0) {
+                    throw CoreException("Could not sync snapshot, file: " + tmpFile + " error: " + std::strerror(errno));
+                }
+            } catch (...) {
+                ::close(fd);
+                throw;
+            }
+            ::close(fd);
+            std::filesystem::rename(tmpFile, snapshotFile);
+            std::filesystem::remove(rotatedFile);
+            log_info << "Write-ahead log snapshot written, file: " << snapshotFile << " records: " << count;
+
+        } catch (CoreException &exc) {
+            _snapshotting = false;
+            log_error << "Write-ahead log snapshot failed, baseName: " << _baseName << " error: " << exc.message();
+            throw;
+        } catch (std::exception &exc) {
+            _snapshotting = false;
+            log_error << "Write-ahead log snapshot failed, baseName: " << _baseName << " error: " << exc.what();
+            throw CoreException("Write-ahead log snapshot failed, baseName: " + _baseName + " error: " + exc.what());
+        }
+        _snapshotting = false;
+    }
+
+    std::string WriteAheadLog::ReadLog(const std::string &fileName, const ReplayFunction &replay, long &count) {
+
+        std::ifstream ifs(fileName, std::ios::binary);
+        if (!ifs) {
+            return {};
+        }
+        std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+        // Frame: 4 bytes length, 4 bytes CRC-32 of the record, record
+        size_t offset = 0;
+        while (offset + 2 * sizeof(uint32_t) <= content.size()) {
+
+            uint32_t length, crc;
+            std::memcpy(&length, content.data() + offset, sizeof(uint32_t));
+            std::memcpy(&crc, content.data() + offset + sizeof(uint32_t), sizeof(uint32_t));
+            size_t start = offset + 2 * sizeof(uint32_t);
+            if (length > content.size() - start) {
+                break;
+            }
+
+            boost::crc_32_type checksum;
+            checksum.process_bytes(content.data() + start, length);
+            if (checksum.checksum() != crc) {
+                break;
+            }
+
+            replay(content.substr(start, length));
+            count++;
+            offset = start + length;
+        }
+
+        if (offset != content.size()) {
+            log_warning << "Write-ahead log has a corrupt tail, file: " << fileName << " valid: " << offset << " size: " << content.size();
+            content.resize(offset);
+        }
+        return content;
+    }
+
+    void WriteAheadLog::AppendFrame(std::string &buffer, const std::string &record) {
+
+        auto length = static_cast<uint32_t>(record.size());
+        boost::crc_32_type checksum;
+        checksum.process_bytes(record.data(), record.size());
+        uint32_t crc = checksum.checksum();
+
+        buffer.append(reinterpret_cast<const char *>(&length), sizeof(uint32_t));
+        buffer.append(reinterpret_cast<const char *>(&crc), sizeof(uint32_t));
+        buffer.append(record);
+    }
+
+    void WriteAheadLog::WriteFully(int fd, const std::string &buffer) {
+
+        size_t offset = 0;
+        while (offset < buffer.size()) {
+            ssize_t written = ::write(fd, buffer.data() + offset, buffer.size() - offset);
+            if (written < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                throw CoreException(std::string("Could not write write-ahead log, error: ") + std::strerror(errno));
+            }
+            offset += written;
+        }
+    }
+
+    void WriteAheadLog::Flush(boost::unique_lock<boost::mutex> &lock) {
+
+        _flushing = true;
+        std::string buffer;
+        buffer.swap(_buffer);
+        long written = _written;
+        int fd = _fd;
+
+        // Write without the mutex, new records are collected for the next commit meanwhile
+        lock.unlock();
+        std::string error;
+        try {
+            WriteFully(fd, buffer);
+            if (_sync && fdatasync(fd) != 0) {
+                throw CoreException(std::string("Could not sync write-ahead log, error: ") + std::strerror(errno));
+            }
+        } catch (CoreException &exc) {
+            error = exc.message();
+        }
+        lock.lock();
+
+        // The waiting committers check the error
+        _flushing = false;
+        _condition.notify_all();
+        if (!error.empty()) {
+            _error = error;
+            _buffer.clear();
+            log_error << "Write-ahead log failed, no more records are committed, baseName: " << _baseName << " error: " << error;
+            throw CoreException("Write-ahead log failed, baseName: " + _baseName + " error: " + error);
+        }
+        _committed = written;
+    }
+
+    int WriteAheadLog::OpenFile(const std::string &fileName) {
+
+        int fd = ::open(fileName.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+        if (fd < 0) {
+            throw CoreException("Could not open write-ahead log, file: " + fileName + " error: " + std::strerror(errno));
+        }
+        return fd;
+    }
+
+}// namespace AwsMock::Core
@@ -24,6 +24,7 @@
 #define MD5_SUM "9e107d9d372bb6826bd81d3542a419d6"
 #define MD5_SUM1 "72fb6002ac7b21b3dc7f55eb4069adf6"
 #define MD5_SUM2 "d3988b8541236d28988a4ccf4f7a38d8"
+#define MULTIPART_ETAG "2ef6d3eebb6b340a5667d4e455f64ce3-2"
 #define SHA1_SUM "2fd4e1c67a2d28fced849ee1bb76e7391b93eb12"
 #define SHA256_SUM "d7a8fbb307d7809469ca9abcb0082e4f8d5651e46d3cdb762d02d0bf37c9e592"
 #define SHA256_SUM_EMPTY "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"
@@ -81,6 +82,18 @@ namespace AwsMock::Core {
         EXPECT_TRUE(result == MD5_SUM);
     }
 
+    TEST_F(CryptoTest, MultipartEtagTest) {
+
+        // arrange
+        std::vector<std::string> partMd5Sums = {Crypto::GetMd5FromString(TEST_STRING), Crypto::GetMd5FromString("")};
+
+        // act
+        std::string result = Crypto::GetMultipartEtag(partMd5Sums);
+
+        // assert
+        EXPECT_EQ(MULTIPART_ETAG, result);
+    }
+
     // TODO: Removed, until AWS supported openssl3
     /*TEST_F(CryptoTest, Md5AwsFileTest) {
         // arrange
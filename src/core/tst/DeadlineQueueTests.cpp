@@ -0,0 +1,75 @@
+//
+// Created by vogje01 on 6/14/24.
+//
+
+#ifndef AWSMOCK_CORE_DEADLINE_QUEUE_TEST_H
+#define AWSMOCK_CORE_DEADLINE_QUEUE_TEST_H
+
+// GTest includes
+#include <gtest/gtest.h>
+
+// Local includes
+#include <awsmock/core/DeadlineQueue.h>
+
+namespace AwsMock::Core {
+
+    using std::chrono::system_clock;
+
+    class DeadlineQueueTest : public ::testing::Test {
+
+      protected:
+
+        system_clock::time_point _now = system_clock::now();
+        DeadlineQueue _deadlineQueue;
+    };
+
+    TEST_F(DeadlineQueueTest, TakeDueTest) {
+
+        // arrange
+        _deadlineQueue.Schedule("queue-2", _now + std::chrono::seconds(2));
+        _deadlineQueue.Schedule("queue-1", _now + std::chrono::seconds(1));
+        _deadlineQueue.Schedule("queue-3", _now + std::chrono::seconds(3));
+
+        // act
+        std::vector<std::string> due = _deadlineQueue.TakeDue(_now + std::chrono::seconds(2));
+
+        // assert
+        ASSERT_EQ(2, due.size());
+        EXPECT_EQ("queue-1", due[0]);
+        EXPECT_EQ("queue-2", due[1]);
+        EXPECT_EQ(1, _deadlineQueue.Size());
+        EXPECT_EQ(_now + std::chrono::seconds(3), _deadlineQueue.NextDeadline());
+    }
+
+    TEST_F(DeadlineQueueTest, EarliestWinsTest) {
+
+        // arrange
+        _deadlineQueue.Schedule("queue-1", _now + std::chrono::seconds(5));
+        _deadlineQueue.Schedule("queue-1", _now + std::chrono::seconds(1));
+        _deadlineQueue.Schedule("queue-1", _now + std::chrono::seconds(3));
+
+        // act
+        std::vector<std::string> due = _deadlineQueue.TakeDue(_now + std::chrono::seconds(10));
+
+        // assert
+        EXPECT_EQ(1, due.size());
+        EXPECT_EQ(0, _deadlineQueue.Size());
+        EXPECT_EQ(system_clock::time_point::max(), _deadlineQueue.NextDeadline());
+    }
+
+    TEST_F(DeadlineQueueTest, IdleTest) {
+
+        // arrange
+        _deadlineQueue.Schedule("queue-1", _now + std::chrono::seconds(60));
+
+        // act
+        std::vector<std::string> due = _deadlineQueue.TakeDue(_now);
+
+        // assert
+        EXPECT_TRUE(due.empty());
+        EXPECT_EQ(1, _deadlineQueue.Size());
+    }
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_DEADLINE_QUEUE_TEST_H
@@ -83,6 +83,31 @@ namespace AwsMock::Core {
         EXPECT_TRUE(result);
     }
 
+    TEST_F(FileUtilsTest, AppendBinaryFilesTest) {
+
+        // arrange, parts with and without block aligned sizes
+        std::vector<std::string> files = {"part-1", "part-2", "part-3"};
+        std::vector<long> sizes = {8192, 1000, FILE_SIZE};
+        std::string expected;
+        for (size_t i = 0; i < files.size(); i++) {
+            std::string content = StringUtils::GenerateRandomString(static_cast<int>(sizes[i]));
+            std::ofstream ofs(tempDir + Poco::Path::separator() + files[i], std::ios::binary);
+            ofs << content;
+            expected += content;
+        }
+        std::string outFile = tempDir + Poco::Path::separator() + "out.bin";
+        std::ofstream(outFile) << "previous content, which must be truncated";
+
+        // act
+        long result = FileUtils::AppendBinaryFiles(outFile, tempDir, files);
+
+        // assert
+        std::ifstream ifs(outFile, std::ios::binary);
+        std::string content((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+        EXPECT_EQ(expected.length(), result);
+        EXPECT_EQ(expected, content);
+    }
+
     TEST_F(FileUtilsTest, DeleteFileTest) {
 
         // arrange
@@ -0,0 +1,76 @@
+//
+// Created by vogje01 on 6/2/24.
+//
+
+#ifndef AWSMOCK_CORE_HASH_SINK_TEST_H
+#define AWSMOCK_CORE_HASH_SINK_TEST_H
+
+// GTest includes
+#include <gtest/gtest.h>
+
+// C++ includes
+#include <sstream>
+
+// Local includes
+#include <awsmock/core/FileUtils.h>
+#include <awsmock/core/HashSink.h>
+
+#define TEST_STRING "The quick brown fox jumps over the lazy dog"
+#define MD5_SUM "9e107d9d372bb6826bd81d3542a419d6"
+#define SHA1_SUM "2fd4e1c67a2d28fced849ee1bb76e7391b93eb12"
+#define SHA256_SUM "d7a8fbb307d7809469ca9abcb0082e4f8d5651e46d3cdb762d02d0bf37c9e592"
+
+namespace AwsMock::Core {
+
+    class HashSinkTest : public ::testing::Test {};
+
+    TEST_F(HashSinkTest, CopyStreamTest) {
+
+        // arrange
+        std::stringstream input(TEST_STRING);
+        std::stringstream output;
+        HashSink hashSink({"MD5", "SHA1", "SHA256"});
+
+        // act
+        long copied = hashSink.CopyStream(input, output);
+
+        // assert
+        EXPECT_EQ(std::string(TEST_STRING).length(), copied);
+        EXPECT_EQ(TEST_STRING, output.str());
+        EXPECT_EQ(MD5_SUM, hashSink.GetHash("MD5"));
+        EXPECT_EQ(SHA1_SUM, hashSink.GetHash("SHA1"));
+        EXPECT_EQ(SHA256_SUM, hashSink.GetHash("SHA256"));
+    }
+
+    TEST_F(HashSinkTest, UpdateFromFileTest) {
+
+        // arrange
+        std::string file = FileUtils::CreateTempFile("txt", TEST_STRING);
+        HashSink hashSink({"MD5", "SHA256"});
+
+        // act
+        hashSink.UpdateFromFile(file);
+
+        // assert
+        EXPECT_EQ(MD5_SUM, hashSink.GetHash("MD5"));
+        EXPECT_EQ(SHA256_SUM, hashSink.GetHash("SHA256"));
+        EXPECT_TRUE(hashSink.GetHash("SHA1").empty());
+        FileUtils::DeleteFile(file);
+    }
+
+    TEST_F(HashSinkTest, UnsupportedAlgorithmTest) {
+
+        // arrange
+        HashSink hashSink({"CRC32", "MD5"});
+
+        // act
+        hashSink.Update(TEST_STRING, std::string(TEST_STRING).length());
+
+        // assert
+        EXPECT_TRUE(hashSink.GetHash("CRC32").empty());
+        EXPECT_EQ(MD5_SUM, hashSink.GetHash("MD5"));
+    }
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_HASH_SINK_TEST_H
@@ -0,0 +1,206 @@
+//
+// Created by vogje01 on 6/5/24.
+//
+
+#ifndef AWSMOCK_CORE_HTTP_SOCKET_POOL_TEST_H
+#define AWSMOCK_CORE_HTTP_SOCKET_POOL_TEST_H
+
+// C++ includes
+#include <atomic>
+#include <thread>
+
+// GTest includes
+#include <gtest/gtest.h>
+
+// Local includes
+#include <awsmock/core/HttpSocketPool.h>
+
+#define TEST_HOST "127.0.0.1"
+
+namespace AwsMock::Core {
+
+    /**
+     * Minimal keep-alive HTTP server, echoes the request body and counts the accepted connections.
+     */
+    class HttpSocketPoolTest : public ::testing::Test {
+
+      protected:
+
+        void SetUp() override {
+            _acceptor.open(boost::asio::ip::tcp::v4());
+            _acceptor.set_option(boost::asio::socket_base::reuse_address(true));
+            _acceptor.bind({boost::asio::ip::make_address(TEST_HOST), 0});
+            _acceptor.listen();
+            _port = _acceptor.local_endpoint().port();
+            _serverThread = std::thread([this]() { Accept(); });
+        }
+
+        void TearDown() override {
+            _pool.Clear();
+
+            // Wake up the blocking accept
+            _stopped = true;
+            boost::system::error_code ec;
+            boost::asio::ip::tcp::socket wakeup(_ioContext);
+            wakeup.connect({boost::asio::ip::make_address(TEST_HOST), static_cast<unsigned short>(_port)}, ec);
+            _serverThread.join();
+            _acceptor.close(ec);
+            for (auto &thread: _sessionThreads) {
+                thread.join();
+            }
+        }
+
+        void Accept() {
+            while (true) {
+                boost::system::error_code ec;
+                boost::asio::ip::tcp::socket socket(_ioContext);
+                _acceptor.accept(socket, ec);
+                if (ec || _stopped) {
+                    return;
+                }
+                _connections++;
+                _sessionThreads.emplace_back([socket = std::move(socket)]() mutable { Serve(socket); });
+            }
+        }
+
+        static void Serve(boost::asio::ip::tcp::socket &socket) {
+            boost::beast::flat_buffer buffer;
+            while (true) {
+                boost::system::error_code ec;
+                http::request<http::string_body> request;
+                http::read(socket, buffer, request, ec);
+                if (ec) {
+                    return;
+                }
+
+                // Never answers, the client times out and closes the connection
+                if (request.target() == "/hang") {
+                    http::read(socket, buffer, request, ec);
+                    return;
+                }
+
+                // Starts the response and closes the connection
+                if (request.target() == "/partial") {
+                    boost::asio::write(socket, boost::asio::buffer(std::string("HTTP/1.1 200 OK\r\n")), ec);
+                    return;
+                }
+
+                http::response<http::string_body> response{http::status::ok, request.version()};
+                response.keep_alive(request.keep_alive());
+                response.body() = request.body();
+                response.prepare_payload();
+                http::write(socket, response, ec);
+                if (ec || !request.keep_alive()) {
+                    return;
+                }
+            }
+        }
+
+        boost::asio::io_context _ioContext;
+        boost::asio::ip::tcp::acceptor _acceptor{_ioContext};
+        std::thread _serverThread;
+        std::vector<std::thread> _sessionThreads;
+        std::atomic<int> _connections = 0;
+        std::atomic<bool> _stopped = false;
+        int _port = 0;
+        HttpSocketPool _pool;
+    };
+
+    TEST_F(HttpSocketPoolTest, ReuseConnectionTest) {
+
+        // arrange
+
+        // act
+        HttpSocketResponse response1 = _pool.SendJson(http::verb::post, TEST_HOST, _port, "/", "first");
+        HttpSocketResponse response2 = _pool.SendJson(http::verb::post, TEST_HOST, _port, "/", "second");
+
+        // assert
+        EXPECT_EQ(http::status::ok, response1.statusCode);
+        EXPECT_EQ("first", response1.body);
+        EXPECT_EQ(http::status::ok, response2.statusCode);
+        EXPECT_EQ("second", response2.body);
+        EXPECT_EQ(1, _connections);
+        EXPECT_EQ(1, _pool.IdleConnections(TEST_HOST, _port));
+    }
+
+    TEST_F(HttpSocketPoolTest, ReconnectAfterCloseTest) {
+
+        // arrange
+        HttpSocketResponse response1 = _pool.SendJson(http::verb::post, TEST_HOST, _port, "/", "first");
+        HttpSocketResponse close = _pool.SendJson(http::verb::post, TEST_HOST, _port, "/", "close", {{"Connection", "close"}});
+
+        // act
+        HttpSocketResponse response2 = _pool.SendJson(http::verb::post, TEST_HOST, _port, "/", "second");
+
+        // assert
+        EXPECT_EQ(http::status::ok, close.statusCode);
+        EXPECT_EQ(http::status::ok, response2.statusCode);
+        EXPECT_EQ("second", response2.body);
+        EXPECT_EQ(2, _connections);
+    }
+
+    TEST_F(HttpSocketPoolTest, AsyncTest) {
+
+        // arrange
+        std::vector<std::future<HttpSocketResponse>> futures;
+
+        // act
+        for (int i = 0; i < 8; i++) {
+            futures.push_back(_pool.SendJsonAsync(http::verb::post, TEST_HOST, _port, "/", std::to_string(i)));
+        }
+
+        // assert
+        for (int i = 0; i < 8; i++) {
+            HttpSocketResponse response = futures[i].get();
+            EXPECT_EQ(http::status::ok, response.statusCode);
+            EXPECT_EQ(std::to_string(i), response.body);
+        }
+        EXPECT_GE(DEFAULT_HTTP_POOL_SIZE, _pool.IdleConnections(TEST_HOST, _port));
+    }
+
+    TEST_F(HttpSocketPoolTest, ConnectionRefusedTest) {
+
+        // arrange, bind a port without listening on it
+        boost::asio::ip::tcp::acceptor unused(_ioContext, {boost::asio::ip::make_address(TEST_HOST), 0});
+        int port = unused.local_endpoint().port();
+        unused.close();
+
+        // act
+        HttpSocketResponse response = _pool.SendJson(http::verb::post, TEST_HOST, port, "/", "first");
+
+        // assert
+        EXPECT_EQ(http::status::internal_server_error, response.statusCode);
+    }
+
+    TEST_F(HttpSocketPoolTest, TimeoutTest) {
+
+        // arrange
+        Configuration::instance().SetValue("awsmock.http.pool.timeout", 1);
+        HttpSocketPool pool;
+        Configuration::instance().SetValue("awsmock.http.pool.timeout", DEFAULT_HTTP_POOL_TIMEOUT);
+
+        // act
+        HttpSocketResponse response = pool.SendJson(http::verb::post, TEST_HOST, _port, "/hang", "first");
+
+        // assert
+        EXPECT_EQ(http::status::internal_server_error, response.statusCode);
+        EXPECT_EQ(0, pool.IdleConnections(TEST_HOST, _port));
+    }
+
+    TEST_F(HttpSocketPoolTest, PartialResponseNotRetriedTest) {
+
+        // arrange
+        HttpSocketResponse response1 = _pool.SendJson(http::verb::post, TEST_HOST, _port, "/", "first");
+
+        // act
+        HttpSocketResponse response2 = _pool.SendJson(http::verb::post, TEST_HOST, _port, "/partial", "second");
+
+        // assert
+        EXPECT_EQ(http::status::ok, response1.statusCode);
+        EXPECT_EQ(http::status::internal_server_error, response2.statusCode);
+        EXPECT_EQ(1, _connections);
+    }
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_HTTP_SOCKET_POOL_TEST_H
@@ -0,0 +1,77 @@
+//
+// Created by vogje01 on 6/22/24.
+//
+
+#ifndef AWSMOCK_CORE_KEYED_SEMAPHORE_TEST_H
+#define AWSMOCK_CORE_KEYED_SEMAPHORE_TEST_H
+
+// C++ includes
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// GTest includes
+#include <gtest/gtest.h>
+
+// Local includes
+#include <awsmock/core/KeyedSemaphore.h>
+
+namespace AwsMock::Core {
+
+    class KeyedSemaphoreTest : public ::testing::Test {};
+
+    TEST_F(KeyedSemaphoreTest, LimitTest) {
+
+        // arrange
+        KeyedSemaphore semaphore;
+        KeyedSemaphore::Permit permit1(semaphore, "upload-1", 2, std::chrono::milliseconds(10));
+        KeyedSemaphore::Permit permit2(semaphore, "upload-1", 2, std::chrono::milliseconds(10));
+
+        // act
+        KeyedSemaphore::Permit permit3(semaphore, "upload-1", 2, std::chrono::milliseconds(10));
+        KeyedSemaphore::Permit otherPermit(semaphore, "upload-2", 2, std::chrono::milliseconds(10));
+
+        // assert
+        EXPECT_TRUE(permit1);
+        EXPECT_TRUE(permit2);
+        EXPECT_FALSE(permit3);
+        EXPECT_TRUE(otherPermit);
+        EXPECT_EQ(2, semaphore.CountHolders("upload-1"));
+    }
+
+    TEST_F(KeyedSemaphoreTest, ConcurrencyTest) {
+
+        // arrange
+        KeyedSemaphore semaphore;
+        std::atomic<int> active = 0;
+        std::atomic<int> maxActive = 0;
+        std::atomic<int> completed = 0;
+
+        // act
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 16; t++) {
+            threads.emplace_back([&]() {
+                KeyedSemaphore::Permit permit(semaphore, "upload", 4, std::chrono::seconds(10));
+                if (permit) {
+                    int current = ++active;
+                    int expected = maxActive;
+                    while (current > expected && !maxActive.compare_exchange_weak(expected, current)) {}
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                    active--;
+                    completed++;
+                }
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+
+        // assert
+        EXPECT_EQ(16, completed);
+        EXPECT_LE(maxActive, 4);
+        EXPECT_EQ(0, semaphore.CountHolders("upload"));
+    }
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_KEYED_SEMAPHORE_TEST_H
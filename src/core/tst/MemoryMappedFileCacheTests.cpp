@@ -0,0 +1,100 @@
+//
+// Created by vogje01 on 6/3/24.
+//
+
+#ifndef AWSMOCK_CORE_MEMORY_MAPPED_FILE_CACHE_TEST_H
+#define AWSMOCK_CORE_MEMORY_MAPPED_FILE_CACHE_TEST_H
+
+// GTest includes
+#include <gtest/gtest.h>
+
+// Local includes
+#include <awsmock/core/FileUtils.h>
+#include <awsmock/core/MemoryMappedFileCache.h>
+
+#define TEST_STRING "The quick brown fox jumps over the lazy dog"
+
+namespace AwsMock::Core {
+
+    class MemoryMappedFileCacheTest : public ::testing::Test {
+
+      protected:
+
+        void SetUp() override {
+            _cache.SetMaxSize(2);
+        }
+
+        MemoryMappedFileCache _cache;
+    };
+
+    TEST_F(MemoryMappedFileCacheTest, ReadChunkTest) {
+
+        // arrange
+        std::string file = FileUtils::CreateTempFile("txt", TEST_STRING);
+        char buffer[5];
+
+        // act
+        std::shared_ptr<const MemoryMappedFile> mappedFile = _cache.GetFile(file);
+        long read = mappedFile->ReadChunk(4, 5, buffer);
+
+        // assert
+        EXPECT_TRUE(mappedFile->IsMapped());
+        EXPECT_EQ(5, read);
+        EXPECT_EQ("quick", std::string(buffer, read));
+        FileUtils::DeleteFile(file);
+    }
+
+    TEST_F(MemoryMappedFileCacheTest, SharedMappingTest) {
+
+        // arrange
+        std::string file = FileUtils::CreateTempFile("txt", TEST_STRING);
+
+        // act
+        std::shared_ptr<const MemoryMappedFile> mappedFile1 = _cache.GetFile(file);
+        std::shared_ptr<const MemoryMappedFile> mappedFile2 = _cache.GetFile(file);
+
+        // assert
+        EXPECT_EQ(mappedFile1.get(), mappedFile2.get());
+        EXPECT_EQ(1, _cache.Size());
+        FileUtils::DeleteFile(file);
+    }
+
+    TEST_F(MemoryMappedFileCacheTest, EvictionTest) {
+
+        // arrange
+        std::string file1 = FileUtils::CreateTempFile("txt", TEST_STRING);
+        std::string file2 = FileUtils::CreateTempFile("txt", TEST_STRING);
+        std::string file3 = FileUtils::CreateTempFile("txt", TEST_STRING);
+        std::shared_ptr<const MemoryMappedFile> mappedFile1 = _cache.GetFile(file1);
+
+        // act
+        _cache.GetFile(file2);
+        _cache.GetFile(file3);
+
+        // assert, evicted mapping is still readable by its holder
+        EXPECT_EQ(2, _cache.Size());
+        EXPECT_TRUE(mappedFile1->IsMapped());
+        EXPECT_EQ(std::string(TEST_STRING), std::string(mappedFile1->GetData(), mappedFile1->GetSize()));
+        EXPECT_NE(mappedFile1.get(), _cache.GetFile(file1).get());
+        FileUtils::DeleteFile(file1);
+        FileUtils::DeleteFile(file2);
+        FileUtils::DeleteFile(file3);
+    }
+
+    TEST_F(MemoryMappedFileCacheTest, RemoveFileTest) {
+
+        // arrange
+        std::string file = FileUtils::CreateTempFile("txt", TEST_STRING);
+        _cache.GetFile(file);
+
+        // act
+        _cache.RemoveFile(file);
+
+        // assert
+        EXPECT_EQ(0, _cache.Size());
+        FileUtils::DeleteFile(file);
+    }
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_MEMORY_MAPPED_FILE_CACHE_TEST_H
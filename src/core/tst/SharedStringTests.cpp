@@ -0,0 +1,70 @@
+//
+// Created by vogje01 on 6/16/24.
+//
+
+#ifndef AWSMOCK_CORE_SHARED_STRING_TEST_H
+#define AWSMOCK_CORE_SHARED_STRING_TEST_H
+
+// C++ includes
+#include <vector>
+
+// GTest includes
+#include <gtest/gtest.h>
+
+// Local includes
+#include <awsmock/core/SharedString.h>
+
+namespace AwsMock::Core {
+
+    class SharedStringTest : public ::testing::Test {};
+
+    TEST_F(SharedStringTest, ShareTest) {
+
+        // arrange
+        std::string value(4096, 'x');
+        SharedString original = value;
+
+        // act
+        SharedString copy = original;
+        std::vector<SharedString> list(3, copy);
+
+        // assert
+        EXPECT_EQ(5, original.UseCount());
+        EXPECT_EQ(original.c_str(), list[2].c_str());
+        EXPECT_EQ(value, list[0]);
+        EXPECT_EQ(4096, list[1].size());
+    }
+
+    TEST_F(SharedStringTest, MoveTest) {
+
+        // arrange
+        std::string value(4096, 'x');
+        const char *data = value.data();
+
+        // act
+        SharedString shared = std::move(value);
+
+        // assert
+        EXPECT_EQ(data, shared.c_str());
+    }
+
+    TEST_F(SharedStringTest, EmptyTest) {
+
+        // arrange
+        SharedString empty;
+        SharedString emptyString = std::string();
+
+        // act
+        const std::string &value = empty;
+
+        // assert
+        EXPECT_TRUE(empty.empty());
+        EXPECT_TRUE(value.empty());
+        EXPECT_EQ(0, emptyString.UseCount());
+        EXPECT_TRUE(empty == emptyString);
+        EXPECT_TRUE(empty == "");
+    }
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_SHARED_STRING_TEST_H
@@ -211,6 +211,24 @@ namespace AwsMock::Core {
         EXPECT_TRUE(result == "some invalid stuff");
     }*/
 
+    TEST_F(StringUtilsTest, PrefixSuccessorTest) {
+
+        // arrange
+        std::string input1 = "photos/";
+        std::string input2 = std::string("a\xff\xff", 3);
+
+        // act
+        std::string result1 = StringUtils::PrefixSuccessor(input1);
+        std::string result2 = StringUtils::PrefixSuccessor(input2);
+        std::string result3 = StringUtils::PrefixSuccessor("");
+
+        // assert
+        EXPECT_EQ("photos0", result1);
+        EXPECT_EQ("b", result2);
+        EXPECT_TRUE(result3.empty());
+        EXPECT_TRUE(result1 > "photos/" + std::string(3, '\xff'));
+    }
+
     TEST_F(StringUtilsTest, SnakeCaseTest) {
 
         // arrange
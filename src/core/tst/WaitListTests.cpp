@@ -0,0 +1,142 @@
+//
+// Created by vogje01 on 6/9/24.
+//
+
+#ifndef AWSMOCK_CORE_WAIT_LIST_TEST_H
+#define AWSMOCK_CORE_WAIT_LIST_TEST_H
+
+// GTest includes
+#include <gtest/gtest.h>
+
+// C++ includes
+#include <atomic>
+#include <future>
+
+// Local includes
+#include <awsmock/core/WaitList.h>
+
+#define WAIT_KEY "test-queue"
+
+namespace AwsMock::Core {
+
+    /**
+     * Wait list tests, the 'queue' is a simple counter of available messages.
+     */
+    class WaitListTest : public ::testing::Test {
+
+      protected:
+
+        /**
+         * Takes one message, if there is any
+         */
+        bool Take() {
+            long available = _available.load();
+            while (available > 0) {
+                if (_available.compare_exchange_weak(available, available - 1)) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        std::atomic<long> _available = 0;
+        WaitList _waitList;
+    };
+
+    TEST_F(WaitListTest, NotifyTest) {
+
+        // arrange
+        std::promise<bool> promise;
+        _waitList.Wait(
+                WAIT_KEY, std::chrono::seconds(10), [this, &promise]() {
+                    if (!Take()) return false;
+                    promise.set_value(true);
+                    return true; }, [&promise]() { promise.set_value(false); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        EXPECT_EQ(1, _waitList.CountWaiters(WAIT_KEY));
+
+        // act
+        auto begin = std::chrono::steady_clock::now();
+        _available++;
+        _waitList.Notify(WAIT_KEY);
+        bool received = promise.get_future().get();
+
+        // assert
+        EXPECT_TRUE(received);
+        EXPECT_LT(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(100));
+        EXPECT_EQ(0, _waitList.CountWaiters(WAIT_KEY));
+    }
+
+    TEST_F(WaitListTest, ExpireTest) {
+
+        // arrange
+        std::promise<bool> promise;
+        auto begin = std::chrono::steady_clock::now();
+
+        // act
+        _waitList.Wait(
+                WAIT_KEY, std::chrono::milliseconds(100), [this, &promise]() {
+                    if (!Take()) return false;
+                    promise.set_value(true);
+                    return true; }, [&promise]() { promise.set_value(false); });
+        bool received = promise.get_future().get();
+
+        // assert
+        EXPECT_FALSE(received);
+        EXPECT_GE(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(100));
+        EXPECT_EQ(0, _waitList.CountWaiters(WAIT_KEY));
+    }
+
+    TEST_F(WaitListTest, NotifyAtTest) {
+
+        // arrange
+        std::promise<bool> promise;
+        _waitList.Wait(
+                WAIT_KEY, std::chrono::seconds(10), [this, &promise]() {
+                    if (!Take()) return false;
+                    promise.set_value(true);
+                    return true; }, [&promise]() { promise.set_value(false); });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        // act, the message becomes visible later, nobody calls notify
+        auto begin = std::chrono::steady_clock::now();
+        _available++;
+        _waitList.NotifyAt(WAIT_KEY, std::chrono::system_clock::now() + std::chrono::milliseconds(100));
+        bool received = promise.get_future().get();
+
+        // assert
+        EXPECT_TRUE(received);
+        EXPECT_GE(std::chrono::steady_clock::now() - begin, std::chrono::milliseconds(100));
+    }
+
+    TEST_F(WaitListTest, OrderTest) {
+
+        // arrange
+        std::atomic<int> sequence = 0;
+        std::promise<int> first, second;
+        _waitList.Wait(
+                WAIT_KEY, std::chrono::seconds(10), [this, &first, &sequence]() {
+                    if (!Take()) return false;
+                    first.set_value(sequence++);
+                    return true; }, [&first]() { first.set_value(-1); });
+        _waitList.Wait(
+                WAIT_KEY, std::chrono::seconds(10), [this, &second, &sequence]() {
+                    if (!Take()) return false;
+                    second.set_value(sequence++);
+                    return true; }, [&second]() { second.set_value(-1); });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+        // act
+        _available += 2;
+        _waitList.Notify(WAIT_KEY);
+
+        // assert
+        EXPECT_EQ(0, first.get_future().get());
+        EXPECT_EQ(1, second.get_future().get());
+        EXPECT_EQ(0, _available.load());
+    }
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_WAIT_LIST_TEST_H
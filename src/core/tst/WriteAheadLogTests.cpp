@@ -0,0 +1,216 @@
+//
+// Created by vogje01 on 6/17/24.
+//
+
+#ifndef AWSMOCK_CORE_WRITE_AHEAD_LOG_TEST_H
+#define AWSMOCK_CORE_WRITE_AHEAD_LOG_TEST_H
+
+// C++ includes
+#include <atomic>
+#include <filesystem>
+#include <thread>
+#include <vector>
+
+// GTest includes
+#include <gtest/gtest.h>
+
+// Local includes
+#include <awsmock/core/WriteAheadLog.h>
+
+namespace AwsMock::Core {
+
+    class WriteAheadLogTest : public ::testing::Test {
+
+      protected:
+
+        void SetUp() override {
+            _directory = std::filesystem::temp_directory_path() / ("awsmock-wal-" + std::to_string(::getpid()));
+            std::filesystem::remove_all(_directory);
+            _baseName = (_directory / "test").string();
+        }
+
+        void TearDown() override {
+            std::filesystem::remove_all(_directory);
+        }
+
+        std::vector<std::string> Replay() {
+            std::vector<std::string> records;
+            WriteAheadLog log;
+            log.Open(_baseName, false, [&records](const std::string &record) { records.emplace_back(record); });
+            return records;
+        }
+
+        /**
+         * Replaces the open log file by a read-only descriptor, so that the next write fails
+         */
+        void BreakLogFile() {
+            std::filesystem::path walFile = std::filesystem::canonical(_baseName + ".wal");
+            for (const auto &entry: std::filesystem::directory_iterator("/proc/self/fd")) {
+                std::error_code ec;
+                if (std::filesystem::read_symlink(entry.path(), ec) == walFile) {
+                    int fd = ::open("/dev/null", O_RDONLY);
+                    ::dup2(fd, std::stoi(entry.path().filename().string()));
+                    ::close(fd);
+                }
+            }
+        }
+
+        std::filesystem::path _directory;
+        std::string _baseName;
+    };
+
+    TEST_F(WriteAheadLogTest, ReplayTest) {
+
+        // arrange
+        {
+            WriteAheadLog log;
+            log.Open(_baseName, true, [](const std::string &) {});
+            log.Commit(log.Write("record-1"));
+            log.Write("record-2");
+            log.Commit(log.Write(std::string("binary\0record", 13)));
+        }
+
+        // act
+        std::vector<std::string> records = Replay();
+
+        // assert
+        ASSERT_EQ(3, records.size());
+        EXPECT_EQ("record-1", records[0]);
+        EXPECT_EQ("record-2", records[1]);
+        EXPECT_EQ(std::string("binary\0record", 13), records[2]);
+    }
+
+    TEST_F(WriteAheadLogTest, TornTailTest) {
+
+        // arrange
+        {
+            WriteAheadLog log;
+            log.Open(_baseName, false, [](const std::string &) {});
+            log.Write("record-1");
+            log.Commit(log.Write("record-2"));
+        }
+        std::filesystem::resize_file(_baseName + ".wal", std::filesystem::file_size(_baseName + ".wal") - 3);
+
+        // act
+        std::vector<std::string> records = Replay();
+        {
+            WriteAheadLog log;
+            log.Open(_baseName, false, [](const std::string &) {});
+            log.Commit(log.Write("record-3"));
+        }
+        std::vector<std::string> recordsAfterWrite = Replay();
+
+        // assert
+        ASSERT_EQ(1, records.size());
+        EXPECT_EQ("record-1", records[0]);
+        ASSERT_EQ(2, recordsAfterWrite.size());
+        EXPECT_EQ("record-3", recordsAfterWrite[1]);
+    }
+
+    TEST_F(WriteAheadLogTest, SnapshotTest) {
+
+        // arrange
+        {
+            WriteAheadLog log;
+            log.Open(_baseName, false, [](const std::string &) {});
+            for (int i = 0; i < 10; i++) {
+                log.Commit(log.Write("record-" + std::to_string(i)));
+            }
+
+            // act
+            log.Snapshot([](const WriteAheadLog::WriteFunction &write) { write("state"); });
+            log.Commit(log.Write("record-10"));
+            EXPECT_EQ(1, log.Size());
+        }
+        std::vector<std::string> records = Replay();
+
+        // assert
+        ASSERT_EQ(2, records.size());
+        EXPECT_EQ("state", records[0]);
+        EXPECT_EQ("record-10", records[1]);
+        EXPECT_FALSE(std::filesystem::exists(_baseName + ".wal.old"));
+    }
+
+    TEST_F(WriteAheadLogTest, InterruptedSnapshotTest) {
+
+        // arrange, a crash after the rotation leaves the rotated log behind
+        {
+            WriteAheadLog log;
+            log.Open(_baseName, false, [](const std::string &) {});
+            log.Commit(log.Write("record-1"));
+        }
+        std::filesystem::rename(_baseName + ".wal", _baseName + ".wal.old");
+        {
+            WriteAheadLog log;
+            log.Open(_baseName, false, [](const std::string &) {});
+            log.Commit(log.Write("record-2"));
+        }
+
+        // act
+        std::vector<std::string> records = Replay();
+
+        // assert
+        ASSERT_EQ(2, records.size());
+        EXPECT_EQ("record-1", records[0]);
+        EXPECT_EQ("record-2", records[1]);
+        EXPECT_FALSE(std::filesystem::exists(_baseName + ".wal.old"));
+    }
+
+    TEST_F(WriteAheadLogTest, GroupCommitTest) {
+
+        // arrange
+        {
+            WriteAheadLog log;
+            log.Open(_baseName, true, [](const std::string &) {});
+
+            // act
+            std::vector<std::thread> threads;
+            for (int t = 0; t < 8; t++) {
+                threads.emplace_back([&log, t]() {
+                    for (int i = 0; i < 100; i++) {
+                        log.Commit(log.Write(std::to_string(t) + "-" + std::to_string(i)));
+                    }
+                });
+            }
+            for (auto &thread: threads) {
+                thread.join();
+            }
+        }
+        std::vector<std::string> records = Replay();
+
+        // assert
+        EXPECT_EQ(800, records.size());
+    }
+
+    TEST_F(WriteAheadLogTest, WriteFailureTest) {
+
+        // arrange
+        WriteAheadLog log;
+        log.Open(_baseName, false, [](const std::string &) {});
+        log.Commit(log.Write("record-1"));
+        BreakLogFile();
+
+        // act
+        std::atomic<int> failed = 0;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 8; t++) {
+            threads.emplace_back([&log, &failed, t]() {
+                try {
+                    log.Commit(log.Write(std::to_string(t)));
+                } catch (CoreException &) {
+                    failed++;
+                }
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+
+        // assert, no commit succeeds after the failed write
+        EXPECT_EQ(8, failed);
+        EXPECT_THROW(log.Commit(log.Write("record-2")), CoreException);
+    }
+
+}// namespace AwsMock::Core
+
+#endif// AWSMOCK_CORE_WRITE_AHEAD_LOG_TEST_H
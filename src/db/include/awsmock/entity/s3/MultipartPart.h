@@ -0,0 +1,93 @@
+//
+// Created by vogje01 on 6/22/24.
+//
+
+#ifndef AWSMOCK_DB_ENTITY_S3_MULTIPART_PART_H
+#define AWSMOCK_DB_ENTITY_S3_MULTIPART_PART_H
+
+// C++ standard includes
+#include <chrono>
+#include <sstream>
+#include <string>
+
+// MongoDB includes
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/json.hpp>
+#include <bsoncxx/string/to_string.hpp>
+#include <mongocxx/stdx.hpp>
+
+namespace AwsMock::Database::Entity::S3 {
+
+    using bsoncxx::view_or_value;
+    using bsoncxx::builder::basic::kvp;
+    using bsoncxx::builder::basic::make_document;
+    using bsoncxx::document::value;
+    using bsoncxx::document::view;
+    using std::chrono::system_clock;
+
+    /**
+     * @brief Uploaded part of a S3 multipart upload
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    struct MultipartPart {
+
+        /**
+         * Part number
+         */
+        int partNumber = 0;
+
+        /**
+         * Part size in bytes
+         */
+        long size = 0;
+
+        /**
+         * Part MD5 sum, the ETag of the part
+         */
+        std::string md5sum;
+
+        /**
+         * File name of the part in the upload directory
+         */
+        std::string fileName;
+
+        /**
+         * Upload date
+         */
+        system_clock::time_point modified = system_clock::now();
+
+        /**
+         * @brief Converts the entity to a MongoDB document
+         *
+         * @return entity as MongoDB document.
+         */
+        [[nodiscard]] view_or_value<view, value> ToDocument() const;
+
+        /**
+         * @brief Converts the MongoDB document to an entity
+         *
+         * @param mResult MongoDB document.
+         */
+        void FromDocument(const view &mResult);
+
+        /**
+         * @brief Converts the entity to a string representation.
+         *
+         * @return entity as string for logging.
+         */
+        [[nodiscard]] std::string ToString() const;
+
+        /**
+         * @brief Stream provider.
+         *
+         * @param os output stream
+         * @param part part entity
+         * @return output stream
+         */
+        friend std::ostream &operator<<(std::ostream &os, const MultipartPart &part);
+    };
+
+}// namespace AwsMock::Database::Entity::S3
+
+#endif// AWSMOCK_DB_ENTITY_S3_MULTIPART_PART_H
@@ -0,0 +1,129 @@
+//
+// Created by vogje01 on 6/22/24.
+//
+
+#ifndef AWSMOCK_DB_ENTITY_S3_MULTIPART_UPLOAD_H
+#define AWSMOCK_DB_ENTITY_S3_MULTIPART_UPLOAD_H
+
+// C++ includes
+#include <chrono>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// MongoDB includes
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/json.hpp>
+#include <bsoncxx/string/to_string.hpp>
+#include <mongocxx/stdx.hpp>
+
+// AwsMock includes
+#include <awsmock/entity/s3/MultipartPart.h>
+
+namespace AwsMock::Database::Entity::S3 {
+
+    using bsoncxx::view_or_value;
+    using bsoncxx::builder::basic::kvp;
+    using bsoncxx::builder::basic::make_document;
+    using bsoncxx::document::value;
+    using bsoncxx::document::view;
+    using std::chrono::system_clock;
+
+    /**
+     * @brief S3 multipart upload entity, the manifest of an upload
+     *
+     * @par
+     * The parts are stored by part number. In MongoDB the parts are a sub-document with the part number as field name, so that a part is
+     * added or replaced by a single atomic update, even if the parts of an upload arrive in parallel.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    struct MultipartUpload {
+
+        /**
+         * ID
+         */
+        std::string oid;
+
+        /**
+         * Aws region name
+         */
+        std::string region;
+
+        /**
+         * Bucket name
+         */
+        std::string bucket;
+
+        /**
+         * Object key
+         */
+        std::string key;
+
+        /**
+         * Upload owner
+         */
+        std::string owner;
+
+        /**
+         * Upload ID
+         */
+        std::string uploadId;
+
+        /**
+         * Object metadata
+         */
+        std::map<std::string, std::string> metadata;
+
+        /**
+         * Uploaded parts by part number
+         */
+        std::map<int, MultipartPart> parts;
+
+        /**
+         * Creation date
+         */
+        system_clock::time_point created = system_clock::now();
+
+        /**
+         * Last modification date
+         */
+        system_clock::time_point modified = system_clock::now();
+
+        /**
+         * @brief Converts the entity to a MongoDB document
+         *
+         * @return entity as MongoDB document.
+         */
+        [[nodiscard]] view_or_value<view, value> ToDocument() const;
+
+        /**
+         * @brief Converts the MongoDB document to an entity
+         *
+         * @param mResult MongoDB document.
+         */
+        void FromDocument(mongocxx::stdx::optional<bsoncxx::document::view> mResult);
+
+        /**
+         * @brief Converts the entity to a string representation.
+         *
+         * @return entity as string for logging.
+         */
+        [[nodiscard]] std::string ToString() const;
+
+        /**
+         * @brief Stream provider.
+         *
+         * @param os output stream
+         * @param upload upload entity
+         * @return output stream
+         */
+        friend std::ostream &operator<<(std::ostream &os, const MultipartUpload &upload);
+    };
+
+    typedef std::vector<MultipartUpload> MultipartUploadList;
+
+}// namespace AwsMock::Database::Entity::S3
+
+#endif// AWSMOCK_DB_ENTITY_S3_MULTIPART_UPLOAD_H
@@ -26,6 +26,7 @@
 #include <awsmock/core/CryptoUtils.h>
 #include <awsmock/core/JsonUtils.h>
 #include <awsmock/core/NumberUtils.h>
+#include <awsmock/core/SharedString.h>
 #include <awsmock/core/exception/JsonException.h>
 #include <awsmock/entity/sqs/MessageAttribute.h>
 #include <awsmock/entity/sqs/MessageStatus.h>
@@ -68,9 +69,9 @@ namespace AwsMock::Database::Entity::SQS {
         std::string queueName;
 
         /**
-         * Message body
+         * Message body, shared between the database and the responses
          */
-        std::string body;
+        Core::SharedString body;
 
         /**
          * Status
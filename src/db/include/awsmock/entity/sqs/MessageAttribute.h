@@ -23,6 +23,9 @@
 #include <bsoncxx/string/to_string.hpp>
 #include <mongocxx/stdx.hpp>
 
+// AwsMock includes
+#include <awsmock/core/SharedString.h>
+
 namespace AwsMock::Database::Entity::SQS {
 
     using bsoncxx::view_or_value;
@@ -69,9 +72,9 @@ namespace AwsMock::Database::Entity::SQS {
         std::string attributeName;
 
         /**
-         * Message attribute value
+         * Message attribute value, shared between the database and the responses
          */
-        std::string attributeValue;
+        Core::SharedString attributeValue;
 
         /**
          * Message attribute value
@@ -116,6 +116,20 @@ namespace AwsMock::Database::Entity::SQS {
          */
         std::string redriveAllowPolicy;
 
+        /**
+         * FIFO queue
+         *
+         * <p>Designates a queue as FIFO. The name of a FIFO queue must end with the .fifo suffix. Messages of the same message group are delivered in order, one batch at a time.</p>
+         */
+        bool fifoQueue = false;
+
+        /**
+         * Content based deduplication
+         *
+         * <p>Enables content-based deduplication for FIFO queues. The SHA-256 hash of the message body is used as deduplication ID, if the message has no explicit deduplication ID.</p>
+         */
+        bool contentBasedDeduplication = false;
+
         /**
          * Number of message counter
          */
@@ -7,12 +7,11 @@
 
 // C++ standard includes
 #include <iostream>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
 // Poco includes
-#include <Poco/Mutex.h>
-#include <Poco/ScopedLock.h>
 #include <Poco/UUIDGenerator.h>
 
 // AwsMock includes
@@ -303,17 +302,17 @@ namespace AwsMock::Database {
         /**
          * Cognito user pool mutex
          */
-        static Poco::Mutex _userPoolMutex;
+        static std::shared_mutex _userPoolMutex;
 
         /**
          * Cognito user mutex
          */
-        static Poco::Mutex _userMutex;
+        static std::shared_mutex _userMutex;
 
         /**
          * Cognito group mutex
          */
-        static Poco::Mutex _groupMutex;
+        static std::shared_mutex _groupMutex;
     };
 
 }// namespace AwsMock::Database
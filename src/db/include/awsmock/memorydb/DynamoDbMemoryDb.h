@@ -7,12 +7,11 @@
 
 // C++ standard includes
 #include <iostream>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
 // Poco includes
-#include <Poco/Mutex.h>
-#include <Poco/ScopedLock.h>
 #include <Poco/UUIDGenerator.h>
 
 // AwsMock includes
@@ -218,12 +217,12 @@ namespace AwsMock::Database {
         /**
          * Table mutex
          */
-        static Poco::Mutex _tableMutex;
+        static std::shared_mutex _tableMutex;
 
         /**
          * Item mutex
          */
-        static Poco::Mutex _itemMutex;
+        static std::shared_mutex _itemMutex;
     };
 
 }// namespace AwsMock::Database
@@ -6,11 +6,10 @@
 #define AWSMOCK_REPOSITORY_KMS_MEMORYDB_H
 
 // C++ includes
+#include <shared_mutex>
 #include <string>
 
 // Poco includes
-#include <Poco/Mutex.h>
-#include <Poco/ScopedLock.h>
 #include <Poco/UUIDGenerator.h>
 
 // AwsMock includes
@@ -130,7 +129,7 @@ namespace AwsMock::Database {
         /**
          * Key mutex
          */
-        static Poco::Mutex _keyMutex;
+        static std::shared_mutex _keyMutex;
     };
 
 }// namespace AwsMock::Database
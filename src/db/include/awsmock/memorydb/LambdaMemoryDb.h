@@ -7,12 +7,11 @@
 
 // C++ standard includes
 #include <iostream>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
 // Poco includes
-#include <Poco/Mutex.h>
-#include <Poco/ScopedLock.h>
 #include <Poco/UUIDGenerator.h>
 
 // AwsMock includes
@@ -180,7 +179,7 @@ namespace AwsMock::Database {
         /**
          * Lambda mutex
          */
-        static Poco::Mutex _lambdaMutex;
+        static std::shared_mutex _lambdaMutex;
     };
 
 }// namespace AwsMock::Database
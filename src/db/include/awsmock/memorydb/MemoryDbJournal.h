@@ -0,0 +1,261 @@
+//
+// Created by vogje01 on 6/17/24.
+//
+
+#ifndef AWSMOCK_MEMORYDB_MEMORYDB_JOURNAL_H
+#define AWSMOCK_MEMORYDB_MEMORYDB_JOURNAL_H
+
+// C++ includes
+#include <exception>
+#include <functional>
+#include <string>
+
+// MongoDB includes
+#include <bsoncxx/builder/basic/document.hpp>
+#include <bsoncxx/builder/concatenate.hpp>
+#include <bsoncxx/document/value.hpp>
+#include <bsoncxx/document/view.hpp>
+#include <bsoncxx/oid.hpp>
+#include <bsoncxx/string/to_string.hpp>
+
+// AwsMock includes
+#include <awsmock/core/LogStream.h>
+#include <awsmock/core/WriteAheadLog.h>
+#include <awsmock/core/config/Configuration.h>
+#include <awsmock/core/exception/CoreException.h>
+#include <awsmock/core/exception/DatabaseException.h>
+
+#define DEFAULT_MEMORYDB_WAL_SNAPSHOT 100000
+
+namespace AwsMock::Database {
+
+    /**
+     * @brief Durable journal of an in-memory database
+     *
+     * @par
+     * Writes the changes of an in-memory database as BSON records to a write-ahead log, one log per module, and replays them on startup. A
+     * record has an operation (put, update, delete, clear), an entity type, an entity key, an optional scope, e.g. the queue URL of an SQS
+     * message, and for put and update the entity document. The entity documents are the MongoDB documents of the entities, so the in-memory
+     * database and MongoDB share the same serialization.
+     *
+     * @par
+     * Changes are written through a transaction. The transaction is created before the in-memory database takes its lock and the records are
+     * written while the lock is held, so that the log order matches the order of the changes. The transaction commits, when it goes out of
+     * scope, i.e. after the lock has been released, so that concurrent changes are committed by a single write (group commit). A failed
+     * commit is thrown to the database call, so the change is not acknowledged. After a configurable number of records, the journal is
+     * replaced by a snapshot of the in-memory database.
+     *
+     * @par
+     * The journal is only active, if awsmock.memorydb.wal.active is true, otherwise all operations are no-ops.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class MemoryDbJournal {
+
+      public:
+
+        /**
+         * Replay function, called for each record
+         */
+        typedef std::function<void(const bsoncxx::document::view &record)> ReplayFunction;
+
+        /**
+         * Write function, used by the snapshot function to write a record
+         */
+        typedef std::function<void(const bsoncxx::document::view &record)> WriteFunction;
+
+        /**
+         * Snapshot function, writes put records for the complete state of the in-memory database
+         */
+        typedef std::function<void(const WriteFunction &write)> SnapshotFunction;
+
+        /**
+         * @brief Journal transaction, commits its records when it goes out of scope
+         */
+        class Transaction {
+
+          public:
+
+            /**
+             * @brief Constructor
+             *
+             * @param journal journal
+             */
+            explicit Transaction(MemoryDbJournal &journal) : _journal(journal) {}
+
+            /**
+             * @brief Destructor, commits the records of the transaction
+             *
+             * A failed commit is thrown, unless the transaction is destroyed by another exception, which is propagated instead.
+             *
+             * @throws Core::DatabaseException if the records cannot be committed
+             */
+            ~Transaction() noexcept(false);
+
+            Transaction(const Transaction &) = delete;
+            Transaction &operator=(const Transaction &) = delete;
+
+            /**
+             * @brief Checks whether the journal is active, records of an inactive journal are dropped
+             *
+             * @return true, if the journal is active
+             */
+            [[nodiscard]] bool IsActive() const { return _journal.IsOpen(); }
+
+            /**
+             * @brief Writes the complete entity
+             *
+             * @param type entity type
+             * @param key entity key
+             * @param entity entity, needs a ToDocument method
+             * @param scope entity scope
+             */
+            template<typename T>
+            void Put(const std::string &type, const std::string &key, const T &entity, const std::string &scope = {}) {
+                if (IsActive()) {
+                    auto document = entity.ToDocument();
+                    Write(PutRecord(type, key, document.view(), scope));
+                }
+            }
+
+            /**
+             * @brief Writes changed fields of an entity
+             *
+             * @param type entity type
+             * @param key entity key
+             * @param fields changed fields
+             * @param scope entity scope
+             */
+            void Update(const std::string &type, const std::string &key, const bsoncxx::document::view &fields, const std::string &scope = {});
+
+            /**
+             * @brief Writes the deletion of an entity
+             *
+             * @param type entity type
+             * @param key entity key
+             * @param scope entity scope
+             */
+            void Delete(const std::string &type, const std::string &key, const std::string &scope = {});
+
+            /**
+             * @brief Writes the deletion of all entities of a type
+             *
+             * @param type entity type
+             * @param scope entity scope, empty for all scopes
+             */
+            void Clear(const std::string &type, const std::string &scope = {});
+
+          private:
+
+            /**
+             * @brief Writes a record
+             *
+             * @param record record
+             */
+            void Write(const bsoncxx::document::view &record);
+
+            /**
+             * Journal
+             */
+            MemoryDbJournal &_journal;
+
+            /**
+             * Sequence number of the last record
+             */
+            long _sequence = 0;
+
+            /**
+             * Number of uncaught exceptions at construction, detects stack unwinding in the destructor
+             */
+            int _uncaughtExceptions = std::uncaught_exceptions();
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * @param module module name, used as log file name
+         */
+        explicit MemoryDbJournal(std::string module) : _module(std::move(module)) {}
+
+        /**
+         * @brief Replays the journal and activates it, if the journal is enabled in the configuration
+         *
+         * @param replay replay function
+         * @param snapshot snapshot function
+         * @throws CoreException if the journal cannot be opened
+         */
+        void Open(const ReplayFunction &replay, const SnapshotFunction &snapshot);
+
+        /**
+         * @brief Checks whether the journal is active
+         *
+         * @return true, if the journal is active
+         */
+        [[nodiscard]] bool IsOpen() const { return _log.IsOpen(); }
+
+        /**
+         * @brief Returns a put record
+         *
+         * @param type entity type
+         * @param key entity key
+         * @param entity entity document
+         * @param scope entity scope
+         * @return put record
+         */
+        static bsoncxx::document::value PutRecord(const std::string &type, const std::string &key, const bsoncxx::document::view &entity, const std::string &scope = {});
+
+        /**
+         * @brief Returns a string field of a record
+         *
+         * @param record record
+         * @param name field name: op, type, key or scope
+         * @return field value
+         */
+        static std::string GetField(const bsoncxx::document::view &record, const std::string &name);
+
+        /**
+         * @brief Returns the entity document of a put or update record
+         *
+         * The document contains an object ID, as the entities expect MongoDB documents.
+         *
+         * @param record record
+         * @return entity document
+         */
+        static bsoncxx::document::view GetValue(const bsoncxx::document::view &record);
+
+      private:
+
+        /**
+         * @brief Commits a record and takes a snapshot, if the journal has grown too large
+         *
+         * A failed snapshot is only logged, as the record itself has been committed.
+         *
+         * @param sequence sequence number of the record
+         * @throws Core::CoreException if the record cannot be committed
+         */
+        void Commit(long sequence);
+
+        /**
+         * Module name
+         */
+        std::string _module;
+
+        /**
+         * Number of records, which trigger a snapshot
+         */
+        long _snapshotRecords = DEFAULT_MEMORYDB_WAL_SNAPSHOT;
+
+        /**
+         * Snapshot function
+         */
+        SnapshotFunction _snapshot;
+
+        /**
+         * Write-ahead log
+         */
+        Core::WriteAheadLog _log;
+    };
+
+}// namespace AwsMock::Database
+
+#endif// AWSMOCK_MEMORYDB_MEMORYDB_JOURNAL_H
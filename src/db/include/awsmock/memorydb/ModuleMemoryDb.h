@@ -6,11 +6,10 @@
 #define AWSMOCK_REPOSITORY_MODULE_MEMORYDB_H
 
 // C++ standard includes
+#include <shared_mutex>
 #include <string>
 
 // Poco includes
-#include <Poco/Mutex.h>
-#include <Poco/ScopedLock.h>
 #include <Poco/UUIDGenerator.h>
 
 // AwsMock includes
@@ -176,7 +175,7 @@ namespace AwsMock::Database {
         /**
          * Module lock
          */
-        static Poco::Mutex _moduleMutex;
+        static std::shared_mutex _moduleMutex;
     };
 
 }// namespace AwsMock::Database
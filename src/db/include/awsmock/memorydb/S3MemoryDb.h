@@ -6,18 +6,22 @@
 #define AWSMOCK_REPOSITORY_S3_MEMORYDB_H
 
 // C++ includes
+#include <map>
+#include <shared_mutex>
 #include <string>
+#include <vector>
 
 // Poco includes
-#include <Poco/Mutex.h>
-#include <Poco/ScopedLock.h>
 #include <Poco/UUIDGenerator.h>
 
 // AwsMock includes
 #include <awsmock/core/AwsUtils.h>
 #include <awsmock/core/LogStream.h>
+#include <awsmock/core/exception/DatabaseException.h>
 #include <awsmock/entity/s3/Bucket.h>
+#include <awsmock/entity/s3/MultipartUpload.h>
 #include <awsmock/entity/s3/Object.h>
+#include <awsmock/memorydb/MemoryDbJournal.h>
 #include <awsmock/repository/Database.h>
 
 namespace AwsMock::Database {
@@ -25,6 +29,13 @@ namespace AwsMock::Database {
     /**
      * @brief S3 in-memory database.
      *
+     * @par
+     * Object keys are indexed per bucket in key order, so that a bucket listing seeks to the prefix or the continuation point and reads only
+     * a single page, independent of the size of the bucket.
+     *
+     * @par
+     * If the journal is enabled, buckets, objects and multipart uploads survive a restart. The object data itself is stored in the data directory anyway.
+     *
      * @author jens.vogt\@opitz-consulting.com
      */
     class S3MemoryDb {
@@ -46,6 +57,13 @@ namespace AwsMock::Database {
             return s3MemoryDb;
         }
 
+        /**
+         * @brief Replays the journal and activates it, if the journal is enabled
+         *
+         * @throws CoreException if the journal cannot be opened
+         */
+        void OpenJournal();
+
         /**
          * @brief Bucket exists
          *
@@ -127,6 +145,24 @@ namespace AwsMock::Database {
          */
         Entity::S3::ObjectList ListBucket(const std::string &bucket, const std::string &prefix = {});
 
+        /**
+         * @brief List a page of objects of a bucket in key order
+         *
+         * @par
+         * Keys, which contain the delimiter after the prefix, are rolled up into a common prefix and the whole prefix range is skipped. Objects
+         * and common prefixes are counted together against maxKeys. Only the latest version of a key is returned.
+         *
+         * @param bucket S3 bucket name
+         * @param prefix S3 key prefix
+         * @param delimiter delimiter, empty for no roll-up
+         * @param startAfter list keys and common prefixes after this one
+         * @param maxKeys maximal number of objects and common prefixes
+         * @param commonPrefixes common prefixes of the page
+         * @param isTruncated true, if there are more keys
+         * @return objects of the page
+         */
+        Entity::S3::ObjectList ListBucket(const std::string &bucket, const std::string &prefix, const std::string &delimiter, const std::string &startAfter, long maxKeys, std::vector<std::string> &commonPrefixes, bool &isTruncated);
+
         /**
          * @brief Returns the total number of buckets
          *
@@ -152,6 +188,15 @@ namespace AwsMock::Database {
          */
         Entity::S3::ObjectList ListObjects(const std::string &prefix = {});
 
+        /**
+         * @brief Returns a page of all objects, including all versions, in object ID order.
+         *
+         * @param startAfter object ID of the last object of the previous page, empty for the first page
+         * @param maxKeys maximal number of objects
+         * @return ObjectList
+         */
+        Entity::S3::ObjectList ListObjectsAfter(const std::string &startAfter, long maxKeys);
+
         /**
          * @brief Delete a bucket.
          *
@@ -260,13 +305,93 @@ namespace AwsMock::Database {
          */
         void DeleteObjects(const std::string &bucket, const std::vector<std::string> &keys);
 
+        /**
+         * @brief Deletes objects by object ID.
+         *
+         * An object is only deleted, if its internal name is unchanged, i.e. the object was not overwritten in between.
+         *
+         * @param objects objects to delete
+         */
+        void DeleteObjects(const Entity::S3::ObjectList &objects);
+
         /**
          * @brief Deletes all objects
          */
         void DeleteAllObjects();
 
+        /**
+         * @brief Creates a multipart upload
+         *
+         * @param upload upload entity
+         * @return created upload entity
+         */
+        Entity::S3::MultipartUpload CreateMultipartUpload(const Entity::S3::MultipartUpload &upload);
+
+        /**
+         * @brief Returns a multipart upload
+         *
+         * @param uploadId upload ID
+         * @return upload entity, empty upload ID, if not existing
+         */
+        Entity::S3::MultipartUpload GetMultipartUpload(const std::string &uploadId);
+
+        /**
+         * @brief Adds a part to a multipart upload, a part with the same part number is replaced
+         *
+         * @param uploadId upload ID
+         * @param part part entity
+         * @return replaced part, empty file name, if the part is new
+         * @throws DatabaseException if the upload does not exist
+         */
+        Entity::S3::MultipartPart AddMultipartPart(const std::string &uploadId, const Entity::S3::MultipartPart &part);
+
+        /**
+         * @brief Deletes a multipart upload
+         *
+         * @param uploadId upload ID
+         */
+        void DeleteMultipartUpload(const std::string &uploadId);
+
       private:
 
+        /**
+         * @brief Applies a journal record
+         *
+         * @param record journal record
+         */
+        void ReplayRecord(const bsoncxx::document::view &record);
+
+        /**
+         * @brief Writes the buckets, objects and multipart uploads as journal records
+         *
+         * @param write write function
+         */
+        void WriteSnapshot(const MemoryDbJournal::WriteFunction &write);
+
+        /**
+         * @brief Adds an object to the key index. The object mutex must be locked.
+         *
+         * @param oid object ID
+         * @param object object entity
+         */
+        void IndexObject(const std::string &oid, const Entity::S3::Object &object);
+
+        /**
+         * @brief Removes an object from the key index. The object mutex must be locked.
+         *
+         * @param oid object ID
+         * @param object object entity
+         */
+        void UnindexObject(const std::string &oid, const Entity::S3::Object &object);
+
+        /**
+         * @brief Returns the latest version of a key. The object mutex must be locked.
+         *
+         * @param oids object IDs of the key
+         * @return latest object
+         */
+        const Entity::S3::Object &LatestObject(const std::vector<std::string> &oids) const;
+
         /**
          * S3 bucket map, when running without database
          */
@@ -277,15 +402,35 @@ namespace AwsMock::Database {
          */
         std::map<std::string, Entity::S3::Object> _objects{};
 
+        /**
+         * Object IDs by key in key order, by bucket name. A key has more than one object ID, if the bucket is versioned.
+         */
+        std::map<std::string, std::map<std::string, std::vector<std::string>>> _objectKeys{};
+
+        /**
+         * S3 multipart uploads by upload ID
+         */
+        std::map<std::string, Entity::S3::MultipartUpload> _uploads{};
+
         /**
          * Bucket mutex
          */
-        static Poco::Mutex _bucketMutex;
+        static std::shared_mutex _bucketMutex;
 
         /**
          * Object mutex
          */
-        static Poco::Mutex _objectMutex;
+        static std::shared_mutex _objectMutex;
+
+        /**
+         * Multipart upload mutex
+         */
+        static std::shared_mutex _uploadMutex;
+
+        /**
+         * Journal
+         */
+        MemoryDbJournal _journal{"s3"};
     };
 
 }// namespace AwsMock::Database
@@ -6,11 +6,10 @@
 #define AWSMOCK_REPOSITORY_SNS_MEMORYDB_H
 
 // C++ includes
+#include <shared_mutex>
 #include <string>
 
 // Poco includes
-#include <Poco/Mutex.h>
-#include <Poco/ScopedLock.h>
 #include <Poco/UUIDGenerator.h>
 
 // AwsMock includes
@@ -18,6 +17,7 @@
 #include <awsmock/core/LogStream.h>
 #include <awsmock/entity/sns/Message.h>
 #include <awsmock/entity/sns/Topic.h>
+#include <awsmock/memorydb/MemoryDbJournal.h>
 #include <awsmock/repository/Database.h>
 
 namespace AwsMock::Database {
@@ -25,6 +25,9 @@ namespace AwsMock::Database {
     /**
      * SNS in-memory database.
      *
+     * @par
+     * If the journal is enabled, topics and messages survive a restart.
+     *
      * @author jens.vogt\@opitz-consulting.com
      */
     class SNSMemoryDb {
@@ -44,6 +47,13 @@ namespace AwsMock::Database {
             return snsMemoryDb;
         }
 
+        /**
+         * Replays the journal and activates it, if the journal is enabled
+         *
+         * @throws CoreException if the journal cannot be opened
+         */
+        void OpenJournal();
+
         /**
          * Check existence of topic
          *
@@ -243,6 +253,20 @@ namespace AwsMock::Database {
 
       private:
 
+        /**
+         * Applies a journal record
+         *
+         * @param record journal record
+         */
+        void ReplayRecord(const bsoncxx::document::view &record);
+
+        /**
+         * Writes the topics and messages as journal records
+         *
+         * @param write write function
+         */
+        void WriteSnapshot(const MemoryDbJournal::WriteFunction &write);
+
         /**
          * SNS topic vector, when running without database
          */
@@ -256,12 +280,17 @@ namespace AwsMock::Database {
         /**
          * Topic mutex
          */
-        static Poco::Mutex _snsTopicMutex;
+        static std::shared_mutex _snsTopicMutex;
 
         /**
          * Message mutex
          */
-        static Poco::Mutex _snsMessageMutex;
+        static std::shared_mutex _snsMessageMutex;
+
+        /**
+         * Journal
+         */
+        MemoryDbJournal _journal{"sns"};
     };
 
 }// namespace AwsMock::Database
@@ -6,11 +6,18 @@
 #define AWSMOCK_REPOSITORY_SQS_MEMORYDB_H
 
 // C++ includes
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 // Poco includes
-#include <Poco/Mutex.h>
-#include <Poco/ScopedLock.h>
 #include <Poco/UUIDGenerator.h>
 
 // AwsMock includes
@@ -18,13 +25,38 @@
 #include <awsmock/core/LogStream.h>
 #include <awsmock/entity/sqs/Message.h>
 #include <awsmock/entity/sqs/Queue.h>
+#include <awsmock/memorydb/MemoryDbJournal.h>
 #include <awsmock/repository/Database.h>
 
+// Minimal number of stale entries before a message store is compacted
+#define SQS_MESSAGE_STORE_COMPACTION 1024
+
 namespace AwsMock::Database {
 
     /**
      * SQS in-memory database.
      *
+     * @par
+     * Messages are kept per queue in a message store with its own lock. A store holds the messages by ID, a FIFO list of the visible
+     * messages, a min-heap of the visibility and delay deadlines and a receipt handle index. Receive and delete are therefore O(k) in the
+     * number of processed messages and independent of the number of messages in the other queues.
+     *
+     * @par
+     * The maintenance is incremental as well: the store counts its messages by status, keeps the messages in creation order for the
+     * retention period and remembers the messages, which became visible again after a receive, as candidates for the dead letter queue.
+     *
+     * @par
+     * Entries in the ready list and in the deadline heap are invalidated lazily: every message carries a sequence number, which is
+     * incremented, whenever the message is scheduled again. Stale entries are skipped and removed, when the lists grow too much.
+     *
+     * @par
+     * Queues are indexed by URL, ARN and region/name, receipt handles are indexed across all stores. Queue lookups and the receipt handle
+     * lookups of delete and change visibility therefore do not depend on the number of queues or in-flight messages.
+     *
+     * @par
+     * If the journal is enabled, queues and messages survive a restart. Every change is written to the journal, a receive only writes the
+     * new state of the received messages. Deadlines are not journaled, the replay recomputes them from the message state.
+     *
      * @author jens.vogt\@opitz-consulting.com
      */
     class SQSMemoryDb {
@@ -44,6 +76,13 @@ namespace AwsMock::Database {
             return sqsMemoryDb;
         }
 
+        /**
+         * Replays the journal and activates it, if the journal is enabled
+         *
+         * @throws CoreException if the journal cannot be opened
+         */
+        void OpenJournal();
+
         /**
          * Check existence of queue
          *
@@ -174,6 +213,14 @@ namespace AwsMock::Database {
          */
         Entity::SQS::Message CreateMessage(const Entity::SQS::Message &message);
 
+        /**
+         * Creates a list of messages of one queue in one locked pass
+         *
+         * @param messages SQS message entities
+         * @return saved message entities
+         */
+        Entity::SQS::MessageList CreateMessages(const Entity::SQS::MessageList &messages);
+
         /**
          * Checks whether the message exists by receipt handle.
          *
@@ -212,6 +259,10 @@ namespace AwsMock::Database {
         /**
          * Receive resources from a queue.
          *
+         * @par
+         * On FIFO queues the messages are received in order per message group. A group with an invisible message is locked, until the
+         * message is deleted or becomes visible again.
+         *
          * @param region AWS region
          * @param queueUrl queue URL
          * @param visibility in seconds
@@ -228,9 +279,30 @@ namespace AwsMock::Database {
          */
         [[maybe_unused]] void ResetMessages(const std::string &queueUrl, long visibility);
 
+        /**
+         * Returns the time, when the next invisible or delayed message of the queue becomes visible again
+         *
+         * @param queueUrl URL of the queue
+         * @return time of the next reset, time_point::max() if there is none
+         */
+        std::chrono::system_clock::time_point GetNextMessageReset(const std::string &queueUrl);
+
+        /**
+         * Returns the time, when the oldest message of the queue exceeds the retention period
+         *
+         * @param queueUrl URL of the queue
+         * @param retentionPeriod retention period in seconds
+         * @return time of the next expiry, time_point::max() if the queue is empty
+         */
+        std::chrono::system_clock::time_point GetNextMessageExpiry(const std::string &queueUrl, long retentionPeriod);
+
         /**
          * Redrive expired resources.
          *
+         * @par
+         * Only messages, which became visible again since the last call, are checked. Messages received too often are moved to the dead
+         * letter queue.
+         *
          * @param queueUrl URL of the queue
          * @param redrivePolicy redrive policy
          * @param configuration AwsMock configuration
@@ -303,6 +375,24 @@ namespace AwsMock::Database {
          */
         void DeleteMessage(const std::string &receiptHandle);
 
+        /**
+         * Deletes a list of messages by receipt handle in one locked pass
+         *
+         * @param queueUrl URL of the queue, holding the messages
+         * @param receiptHandles message receipt handles
+         * @return receipt handles of the deleted messages
+         */
+        std::vector<std::string> DeleteMessages(const std::string &queueUrl, const std::vector<std::string> &receiptHandles);
+
+        /**
+         * Changes the visibility timeout of a list of messages in one locked pass
+         *
+         * @param queueUrl URL of the queue, holding the messages
+         * @param visibilityTimeouts new visibility timeouts in seconds by receipt handle
+         * @return receipt handles of the changed messages
+         */
+        std::vector<std::string> ChangeMessageVisibilities(const std::string &queueUrl, const std::map<std::string, int> &visibilityTimeouts);
+
         /**
          * Deletes a resources.
          *
@@ -318,19 +408,409 @@ namespace AwsMock::Database {
         std::map<std::string, Entity::SQS::Queue> _queues;
 
         /**
-         * SQS message vector, when running without database
+         * Secondary queue index, queue ID by key. Guarded by the queue mutex.
+         */
+        typedef std::unordered_multimap<std::string, std::string> QueueIndex;
+
+        /**
+         * Queue IDs by queue URL
+         */
+        QueueIndex _queueUrlIndex;
+
+        /**
+         * Queue IDs by queue ARN
+         */
+        QueueIndex _queueArnIndex;
+
+        /**
+         * Queue IDs by region and name
+         */
+        QueueIndex _queueNameIndex;
+
+        /**
+         * Queue URLs by receipt handle, over all message stores
+         */
+        struct ReceiptHandleIndex {
+
+            /**
+             * Queue URL by receipt handle
+             */
+            std::unordered_map<std::string, std::string> queueUrls;
+
+            /**
+             * Index mutex, always taken after a store mutex
+             */
+            std::shared_mutex mutex;
+        };
+
+        /**
+         * Message with its scheduling sequence
+         */
+        struct StoredMessage {
+
+            /**
+             * Message entity
+             */
+            Entity::SQS::Message message;
+
+            /**
+             * Scheduling sequence, entries in the ready list or in the deadline heap are only valid with the current sequence
+             */
+            long sequence = 0;
+        };
+
+        /**
+         * Visibility or delay deadline of a message
+         */
+        struct Deadline {
+
+            /**
+             * Point in time, when the message becomes visible again
+             */
+            std::chrono::system_clock::time_point due;
+
+            /**
+             * Message ID
+             */
+            std::string oid;
+
+            /**
+             * Message sequence at scheduling time
+             */
+            long sequence;
+
+            bool operator>(const Deadline &other) const {
+                return due > other.due;
+            }
+        };
+
+        /**
+         * Messages of a FIFO message group
+         */
+        struct MessageGroup {
+
+            /**
+             * Message IDs in send order. Messages stay in the list until they are deleted, an invisible message at the head locks the group.
+             */
+            std::deque<std::string> messages;
+
+            /**
+             * Group is in the ready list of the store
+             */
+            bool queued = false;
+        };
+
+        /**
+         * Messages of a single queue
+         */
+        struct MessageStore {
+
+            /**
+             * Queue URL
+             */
+            std::string queueUrl;
+
+            /**
+             * AWS region of the queue
+             */
+            std::string region;
+
+            /**
+             * Receipt handle index of the database
+             */
+            ReceiptHandleIndex *receiptHandleIndex = nullptr;
+
+            /**
+             * Messages by ID
+             */
+            std::unordered_map<std::string, StoredMessage> messages;
+
+            /**
+             * Visible messages in receive order, message ID and sequence
+             */
+            std::deque<std::pair<std::string, long>> ready;
+
+            /**
+             * Min-heap of the deadlines of invisible and delayed messages
+             */
+            std::vector<Deadline> deadlines;
+
+            /**
+             * Message ID by receipt handle
+             */
+            std::unordered_map<std::string, std::string> receiptHandles;
+
+            /**
+             * Message IDs in creation order, used for the retention period
+             */
+            std::deque<std::pair<std::chrono::system_clock::time_point, std::string>> created;
+
+            /**
+             * Messages, which became visible again after a receive, message ID and sequence. Checked by the next redrive.
+             */
+            std::deque<std::pair<std::string, long>> redrive;
+
+            /**
+             * Number of messages by status
+             */
+            std::map<Entity::SQS::MessageStatus, long> statusCounts;
+
+            /**
+             * FIFO queue, messages are delivered by message group
+             */
+            bool fifo = false;
+
+            /**
+             * FIFO message groups by message group ID
+             */
+            std::unordered_map<std::string, MessageGroup> groups;
+
+            /**
+             * FIFO message groups, which might have visible messages, in receive order
+             */
+            std::deque<std::string> readyGroups;
+
+            /**
+             * Store mutex
+             */
+            std::shared_mutex mutex;
+        };
+
+        /**
+         * Returns the message store of a queue
+         *
+         * @param queueUrl queue URL
+         * @param region AWS region, used when a new store is created
+         * @param create create the store, if it does not exist
+         * @return message store, null if it does not exist
+         */
+        std::shared_ptr<MessageStore> GetMessageStore(const std::string &queueUrl, const std::string &region = {}, bool create = false);
+
+        /**
+         * Adds a queue to the secondary indexes. The queue mutex must be locked.
+         *
+         * @param oid queue ID
+         * @param queue queue entity
+         */
+        void IndexQueue(const std::string &oid, const Entity::SQS::Queue &queue);
+
+        /**
+         * Removes a queue from the secondary indexes. The queue mutex must be locked.
+         *
+         * @param oid queue ID
+         * @param queue queue entity
+         */
+        void UnindexQueue(const std::string &oid, const Entity::SQS::Queue &queue);
+
+        /**
+         * Looks up a queue in a secondary index. The queue mutex must be locked.
+         *
+         * @param index secondary index
+         * @param key index key
+         * @param region AWS region, empty for all regions
+         * @return queue iterator, end if the queue does not exist
+         */
+        std::map<std::string, Entity::SQS::Queue>::iterator FindQueue(const QueueIndex &index, const std::string &key, const std::string &region = {});
+
+        /**
+         * Returns the key of the region/name index
+         *
+         * @param region AWS region
+         * @param name queue name
+         * @return index key
+         */
+        static std::string QueueNameKey(const std::string &region, const std::string &name);
+
+        /**
+         * Removes the message store of a deleted queue together with the remaining messages
+         *
+         * @param queueUrl queue URL
+         * @param transaction journal transaction
+         */
+        void RemoveMessageStore(const std::string &queueUrl, MemoryDbJournal::Transaction &transaction);
+
+        /**
+         * Returns a snapshot of all message stores
+         *
+         * @return message stores
+         */
+        std::vector<std::shared_ptr<MessageStore>> GetMessageStores();
+
+        /**
+         * Returns the message store, which contains the message with the given receipt handle
+         *
+         * @param receiptHandle receipt handle
+         * @return message store, null if the receipt handle is unknown
+         */
+        std::shared_ptr<MessageStore> FindMessageStoreByReceiptHandle(const std::string &receiptHandle);
+
+        /**
+         * Calls the function for every existing receipt handle, the store of the queue is locked only once. Receipt handles of other queues
+         * are looked up one by one.
+         */
+        void ForEachReceiptHandle(const std::string &queueUrl, const std::vector<std::string> &receiptHandles, const std::function<void(MessageStore &, const std::string &, const std::string &)> &function);
+
+        /**
+         * Assigns a receipt handle to a message, in the store and in the receipt handle index. The store must be locked.
+         *
+         * @param store message store
+         * @param receiptHandle receipt handle, ignored if empty
+         * @param oid message ID
+         */
+        static void AddReceiptHandle(MessageStore &store, const std::string &receiptHandle, const std::string &oid);
+
+        /**
+         * Removes a receipt handle from the store and from the receipt handle index. The store must be locked.
+         *
+         * @param store message store
+         * @param receiptHandle receipt handle
+         */
+        static void RemoveReceiptHandle(MessageStore &store, const std::string &receiptHandle);
+
+        /**
+         * Adds a message to a store. The store must be locked.
+         *
+         * @param store message store
+         * @param oid message ID
+         * @param message message entity
+         * @return stored message
+         */
+        static StoredMessage &InsertMessage(MessageStore &store, const std::string &oid, const Entity::SQS::Message &message);
+
+        /**
+         * Removes a message from a store. The store must be locked.
+         *
+         * @param store message store
+         * @param oid message ID
+         * @return true, if the message was removed
+         */
+        static bool EraseMessage(MessageStore &store, const std::string &oid);
+
+        /**
+         * Removes all messages from a store. The store must be locked.
+         *
+         * @param store message store
+         * @return number of removed messages
+         */
+        static long ClearMessageStore(MessageStore &store);
+
+        /**
+         * Puts a message into the ready list or the deadline heap, according to its status. The store must be locked.
+         *
+         * @param store message store
+         * @param oid message ID
+         * @param stored stored message
          */
-        std::map<std::string, Entity::SQS::Message> _messages;
+        static void ScheduleMessage(MessageStore &store, const std::string &oid, StoredMessage &stored);
+
+        /**
+         * Changes the status of a message and the status counters of the store. The store must be locked.
+         *
+         * @param store message store
+         * @param message message entity
+         * @param status new status
+         */
+        static void SetMessageStatus(MessageStore &store, Entity::SQS::Message &message, Entity::SQS::MessageStatus status);
+
+        /**
+         * Makes a message invisible and assigns a new receipt handle. The store must be locked.
+         *
+         * @param store message store
+         * @param oid message ID
+         * @param stored stored message
+         * @param reset end of the visibility timeout
+         */
+        static void ClaimMessage(MessageStore &store, const std::string &oid, StoredMessage &stored, std::chrono::system_clock::time_point reset);
+
+        /**
+         * Receives the messages of a FIFO queue. Messages of a group are received in send order, and only if no other message of the group is
+         * in flight. The store must be locked.
+         *
+         * @param store message store
+         * @param maxMessages maximal number of messages
+         * @param reset end of the visibility timeout
+         * @param messageList received messages
+         */
+        static void ReceiveGroupMessages(MessageStore &store, int maxMessages, std::chrono::system_clock::time_point reset, Entity::SQS::MessageList &messageList);
+
+        /**
+         * Appends a FIFO message group to the ready list, unless it is already there. The store must be locked.
+         *
+         * @param store message store
+         * @param groupId message group ID
+         */
+        static void QueueMessageGroup(MessageStore &store, const std::string &groupId);
+
+        /**
+         * Returns the message group ID of a message
+         *
+         * @param message message entity
+         * @return message group ID, empty for standard queues
+         */
+        static std::string GetMessageGroupId(const Entity::SQS::Message &message);
+
+        /**
+         * Makes all invisible and delayed messages visible, which deadline has passed. The store must be locked.
+         *
+         * @param store message store
+         * @return number of reset messages
+         */
+        static long ProcessDeadlines(MessageStore &store);
+
+        /**
+         * Removes stale entries from the ready list, the deadline heap and the redrive list. The store must be locked.
+         *
+         * @param store message store
+         */
+        static void CompactMessageStore(MessageStore &store);
+
+        /**
+         * Applies a journal record
+         *
+         * @param record journal record
+         */
+        void ReplayRecord(const bsoncxx::document::view &record);
+
+        /**
+         * Writes the queues and messages as journal records
+         *
+         * @param write write function
+         */
+        void WriteSnapshot(const MemoryDbJournal::WriteFunction &write);
+
+        /**
+         * Writes the receive state of a message, i.e. receipt handle, retries, status and visibility deadline, to the journal
+         *
+         * @param transaction journal transaction
+         * @param queueUrl queue URL of the message store
+         * @param message message entity
+         */
+        static void JournalMessageState(MemoryDbJournal::Transaction &transaction, const std::string &queueUrl, const Entity::SQS::Message &message);
+
+        /**
+         * SQS messages by queue URL, when running without database
+         */
+        std::map<std::string, std::shared_ptr<MessageStore>> _messageStores;
+
+        /**
+         * Receipt handle index
+         */
+        ReceiptHandleIndex _receiptHandleIndex;
 
         /**
          * Queue mutex
          */
-        static Poco::Mutex sqsQueueMutex;
+        static std::shared_mutex sqsQueueMutex;
+
+        /**
+         * Message store map mutex
+         */
+        static std::shared_mutex _sqsMessageMutex;
 
         /**
-         * Message mutex
+         * Journal
          */
-        static Poco::Mutex _sqsMessageMutex;
+        MemoryDbJournal _journal{"sqs"};
     };
 
 }// namespace AwsMock::Database
@@ -7,13 +7,12 @@
 
 // C++ standard includes
 #include <iostream>
+#include <shared_mutex>
 #include <string>
 #include <vector>
 
 // Poco includes
-#include <Poco/Mutex.h>
 #include <Poco/Net/HTTPResponse.h>
-#include <Poco/ScopedLock.h>
 #include <Poco/UUIDGenerator.h>
 
 // AwsMock includes
@@ -163,7 +162,7 @@ namespace AwsMock::Database {
         /**
          * Lambda mutex
          */
-        static Poco::Mutex _secretMutex;
+        static std::shared_mutex _secretMutex;
     };
 
 }// namespace AwsMock::Database
@@ -6,11 +6,10 @@
 #define AWSMOCK_REPOSITORY_TRANSFER_MEMORYDB_H
 
 // C++ includes
+#include <shared_mutex>
 #include <string>
 
 // Poco includes
-#include <Poco/Mutex.h>
-#include <Poco/ScopedLock.h>
 #include <Poco/UUIDGenerator.h>
 
 // AwsMock includes
@@ -181,12 +180,12 @@ namespace AwsMock::Database {
         /**
          * Transfer mutex
          */
-        static Poco::Mutex _transferMutex;
+        static std::shared_mutex _transferMutex;
 
         /**
          * User mutex
          */
-        static Poco::Mutex _userMutex;
+        static std::shared_mutex _userMutex;
     };
 
 }// namespace AwsMock::Database
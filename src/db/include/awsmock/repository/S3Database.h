@@ -22,6 +22,7 @@
 #include <awsmock/core/FileUtils.h>
 #include <awsmock/core/LogStream.h>
 #include <awsmock/entity/s3/Bucket.h>
+#include <awsmock/entity/s3/MultipartUpload.h>
 #include <awsmock/entity/s3/Object.h>
 #include <awsmock/memorydb/S3MemoryDb.h>
 #include <awsmock/repository/Database.h>
@@ -264,6 +265,26 @@ namespace AwsMock::Database {
          */
         Entity::S3::ObjectList ListBucket(const std::string &bucket, const std::string &prefix = {});
 
+        /**
+         * @brief List a page of objects of a bucket in key order
+         *
+         * @par
+         * Keys, which contain the delimiter after the prefix, are rolled up into a common prefix and the whole prefix range is skipped. Objects
+         * and common prefixes are counted together against maxKeys. Only the latest version of a key is returned. MongoDB is queried by key
+         * ranges on the bucket/key index.
+         *
+         * @param bucket S3 bucket name
+         * @param prefix S3 key prefix
+         * @param delimiter delimiter, empty for no roll-up
+         * @param startAfter list keys and common prefixes after this one
+         * @param maxKeys maximal number of objects and common prefixes
+         * @param commonPrefixes common prefixes of the page
+         * @param isTruncated true, if there are more keys
+         * @return objects of the page
+         * @throws DatabaseException
+         */
+        Entity::S3::ObjectList ListBucket(const std::string &bucket, const std::string &prefix, const std::string &delimiter, const std::string &startAfter, long maxKeys, std::vector<std::string> &commonPrefixes, bool &isTruncated);
+
         /**
          * @brief List all objects.
          *
@@ -272,6 +293,18 @@ namespace AwsMock::Database {
          */
         Entity::S3::ObjectList ListObjects(const std::string &prefix = {});
 
+        /**
+         * @brief Returns a page of all objects, including all versions, in object ID order.
+         *
+         * Used as cursor over the whole object collection, without keeping a database cursor open.
+         *
+         * @param startAfter object ID of the last object of the previous page, empty for the first page
+         * @param maxKeys maximal number of objects
+         * @return ObjectList
+         * @throws DatabaseException
+         */
+        Entity::S3::ObjectList ListObjectsAfter(const std::string &startAfter, long maxKeys);
+
         /**
          * @brief Counts the number of keys in a bucket
          *
@@ -332,11 +365,60 @@ namespace AwsMock::Database {
          */
         void DeleteObjects(const std::string &bucket, const std::vector<std::string> &keys);
 
+        /**
+         * @brief Deletes objects by object ID in a single request.
+         *
+         * An object is only deleted, if its internal name is unchanged, i.e. the object was not overwritten in between.
+         *
+         * @param objects objects to delete
+         * @throws DatabaseException
+         */
+        void DeleteObjects(const Entity::S3::ObjectList &objects);
+
         /**
          * @brief Deletes all objects
          */
         void DeleteAllObjects();
 
+        /**
+         * @brief Creates a multipart upload
+         *
+         * @param upload upload entity
+         * @return created upload entity
+         * @throws DatabaseException
+         */
+        Entity::S3::MultipartUpload CreateMultipartUpload(const Entity::S3::MultipartUpload &upload);
+
+        /**
+         * @brief Returns a multipart upload
+         *
+         * @param uploadId upload ID
+         * @return upload entity, empty upload ID, if not existing
+         * @throws DatabaseException
+         */
+        Entity::S3::MultipartUpload GetMultipartUpload(const std::string &uploadId);
+
+        /**
+         * @brief Adds a part to a multipart upload, a part with the same part number is replaced
+         *
+         * @par
+         * The part is added by a single atomic update, so parts of the same upload can be added in parallel.
+         *
+         * @param uploadId upload ID
+         * @param part part entity
+         * @return replaced part, empty file name, if the part is new
+         * @throws DatabaseException if the upload does not exist
+         */
+        Entity::S3::MultipartPart AddMultipartPart(const std::string &uploadId, const Entity::S3::MultipartPart &part);
+
+        /**
+         * @brief Deletes a multipart upload
+         *
+         * @param uploadId upload ID
+         * @throws DatabaseException
+         */
+        void DeleteMultipartUpload(const std::string &uploadId);
+
       private:
 
         /**
@@ -364,6 +446,11 @@ namespace AwsMock::Database {
          */
         std::string _objectCollectionName;
 
+        /**
+         * Multipart upload collection name
+         */
+        std::string _uploadCollectionName;
+
         /**
          * S3 in-memory database
          */
@@ -7,6 +7,7 @@
 
 // C++ standard includes
 #include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -15,6 +16,7 @@
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/stream/document.hpp>
 #include <mongocxx/client.hpp>
+#include <mongocxx/model/update_one.hpp>
 #include <mongocxx/options/find_one_and_update.hpp>
 
 // AwsMock includes
@@ -203,6 +205,15 @@ namespace AwsMock::Database {
          */
         Entity::SQS::Message CreateMessage(const Entity::SQS::Message &message);
 
+        /**
+         * @brief Creates a list of messages of one queue with a single insert_many
+         *
+         * @param messages SQS message entities
+         * @return saved message entities
+         * @throws Core::DatabaseException
+         */
+        Entity::SQS::MessageList CreateMessages(const Entity::SQS::MessageList &messages);
+
         /**
          * @brief Checks whether the message exists by receipt handle.
          *
@@ -268,6 +279,15 @@ namespace AwsMock::Database {
         /**
          * @brief Receive resources from an queue.
          *
+         * @par
+         * Messages are claimed one by one with an atomic find_one_and_update, so concurrent receivers on the same queue need no transaction
+         * and never get the same message. Invisible messages with an expired visibility timeout are claimed directly, the regular reset
+         * of the invisible messages is done by the SQS worker.
+         *
+         * @par
+         * For FIFO queues, message groups with in-flight messages are skipped and the messages of a group are claimed in send order. The
+         * locked groups are determined once per call, so two concurrent receivers might still get messages of the same group.
+         *
          * @param region AWS region
          * @param queueUrl queue URL
          * @param visibility in seconds
@@ -284,6 +304,24 @@ namespace AwsMock::Database {
          */
         [[maybe_unused]] void ResetMessages(const std::string &queueUrl, long visibility);
 
+        /**
+         * @brief Returns the time, when the next invisible or delayed message of the queue becomes visible again
+         *
+         * @param queueUrl URL of the queue
+         * @return time of the next reset, time_point::max() if there is none
+         */
+        std::chrono::system_clock::time_point GetNextMessageReset(const std::string &queueUrl);
+
+        /**
+         * @brief Returns the time, when the oldest message of the queue exceeds the retention period
+         *
+         * @param queueUrl URL of the queue
+         * @param retentionPeriod retention period in seconds
+         * @return time of the next expiry, time_point::max() if the queue is empty
+         * @throws DatabaseException
+         */
+        std::chrono::system_clock::time_point GetNextMessageExpiry(const std::string &queueUrl, long retentionPeriod);
+
         /**
          * @brief Redrive expired resources.
          *
@@ -366,6 +404,30 @@ namespace AwsMock::Database {
          */
         void DeleteMessage(const std::string &receiptHandle);
 
+        /**
+         * @brief Deletes a list of messages by receipt handle.
+         *
+         * Needs two round trips, one to find the existing receipt handles, one for the deletion.
+         *
+         * @param queueUrl URL of the queue, holding the messages
+         * @param receiptHandles message receipt handles
+         * @return receipt handles of the deleted messages
+         * @throws Core::DatabaseException
+         */
+        std::vector<std::string> DeleteMessages(const std::string &queueUrl, const std::vector<std::string> &receiptHandles);
+
+        /**
+         * @brief Changes the visibility timeout of a list of messages.
+         *
+         * Needs two round trips, one to find the existing receipt handles, one bulk write for the updates.
+         *
+         * @param queueUrl URL of the queue, holding the messages
+         * @param visibilityTimeouts new visibility timeouts in seconds by receipt handle
+         * @return receipt handles of the changed messages
+         * @throws Core::DatabaseException
+         */
+        std::vector<std::string> ChangeMessageVisibilities(const std::string &queueUrl, const std::map<std::string, int> &visibilityTimeouts);
+
         /**
          * @brief Deletes a resources.
          *
@@ -375,6 +437,15 @@ namespace AwsMock::Database {
 
       private:
 
+        /**
+         * @brief Returns the receipt handles of the given list, which exist in the message collection
+         *
+         * @param messageCollection message collection
+         * @param receiptHandles receipt handles to look for
+         * @return existing receipt handles
+         */
+        static std::vector<std::string> FindReceiptHandles(mongocxx::collection &messageCollection, const std::vector<std::string> &receiptHandles);
+
         /**
          * SQS queue vector, when running without database
          */
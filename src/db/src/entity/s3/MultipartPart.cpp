@@ -0,0 +1,41 @@
+//
+// Created by vogje01 on 6/22/24.
+//
+
+#include <awsmock/entity/s3/MultipartPart.h>
+
+namespace AwsMock::Database::Entity::S3 {
+
+    view_or_value<view, value> MultipartPart::ToDocument() const {
+
+        view_or_value<view, value> partDoc = make_document(
+                kvp("partNumber", partNumber),
+                kvp("size", static_cast<bsoncxx::types::b_int64>(size)),
+                kvp("md5sum", md5sum),
+                kvp("fileName", fileName),
+                kvp("modified", bsoncxx::types::b_date(modified)));
+
+        return partDoc;
+    }
+
+    void MultipartPart::FromDocument(const view &mResult) {
+
+        partNumber = mResult["partNumber"].get_int32().value;
+        size = static_cast<long>(mResult["size"].get_int64().value);
+        md5sum = bsoncxx::string::to_string(mResult["md5sum"].get_string().value);
+        fileName = bsoncxx::string::to_string(mResult["fileName"].get_string().value);
+        modified = bsoncxx::types::b_date(mResult["modified"].get_date());
+    }
+
+    std::string MultipartPart::ToString() const {
+        std::stringstream ss;
+        ss << (*this);
+        return ss.str();
+    }
+
+    std::ostream &operator<<(std::ostream &os, const MultipartPart &p) {
+        os << "MultipartPart=" << bsoncxx::to_json(p.ToDocument());
+        return os;
+    }
+
+}// namespace AwsMock::Database::Entity::S3
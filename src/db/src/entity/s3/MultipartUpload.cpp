@@ -0,0 +1,74 @@
+//
+// Created by vogje01 on 6/22/24.
+//
+
+#include <awsmock/entity/s3/MultipartUpload.h>
+
+namespace AwsMock::Database::Entity::S3 {
+
+    view_or_value<view, value> MultipartUpload::ToDocument() const {
+
+        auto metadataDoc = bsoncxx::builder::basic::document{};
+        for (const auto &m: metadata) {
+            metadataDoc.append(kvp(m.first, m.second));
+        }
+
+        auto partsDoc = bsoncxx::builder::basic::document{};
+        for (const auto &[partNumber, part]: parts) {
+            partsDoc.append(kvp(std::to_string(partNumber), part.ToDocument().view()));
+        }
+
+        view_or_value<view, value> uploadDoc = make_document(
+                kvp("region", region),
+                kvp("bucket", bucket),
+                kvp("key", key),
+                kvp("owner", owner),
+                kvp("uploadId", uploadId),
+                kvp("metadata", metadataDoc),
+                kvp("parts", partsDoc),
+                kvp("created", bsoncxx::types::b_date(created)),
+                kvp("modified", bsoncxx::types::b_date(modified)));
+
+        return uploadDoc;
+    }
+
+    void MultipartUpload::FromDocument(mongocxx::stdx::optional<bsoncxx::document::view> mResult) {
+
+        oid = mResult.value()["_id"].get_oid().value.to_string();
+        region = bsoncxx::string::to_string(mResult.value()["region"].get_string().value);
+        bucket = bsoncxx::string::to_string(mResult.value()["bucket"].get_string().value);
+        key = bsoncxx::string::to_string(mResult.value()["key"].get_string().value);
+        owner = bsoncxx::string::to_string(mResult.value()["owner"].get_string().value);
+        uploadId = bsoncxx::string::to_string(mResult.value()["uploadId"].get_string().value);
+        created = bsoncxx::types::b_date(mResult.value()["created"].get_date());
+        modified = bsoncxx::types::b_date(mResult.value()["modified"].get_date());
+
+        // Get metadata
+        if (mResult.value().find("metadata") != mResult.value().end()) {
+            for (const bsoncxx::document::element &metadataElement: mResult.value()["metadata"].get_document().value) {
+                metadata.emplace(bsoncxx::string::to_string(metadataElement.key()), bsoncxx::string::to_string(metadataElement.get_string().value));
+            }
+        }
+
+        // Get parts
+        if (mResult.value().find("parts") != mResult.value().end()) {
+            for (const bsoncxx::document::element &partElement: mResult.value()["parts"].get_document().value) {
+                MultipartPart part;
+                part.FromDocument(partElement.get_document().view());
+                parts[part.partNumber] = part;
+            }
+        }
+    }
+
+    std::string MultipartUpload::ToString() const {
+        std::stringstream ss;
+        ss << (*this);
+        return ss.str();
+    }
+
+    std::ostream &operator<<(std::ostream &os, const MultipartUpload &u) {
+        os << "MultipartUpload=" << bsoncxx::to_json(u.ToDocument());
+        return os;
+    }
+
+}// namespace AwsMock::Database::Entity::S3
@@ -46,7 +46,7 @@ namespace AwsMock::Database::Entity::SQS {
                 kvp("region", region),
                 kvp("queueUrl", queueUrl),
                 kvp("queueName", queueName),
-                kvp("body", body),
+                kvp("body", body.str()),
                 kvp("status", MessageStatusToString(status)),
                 kvp("retries", retries),
                 kvp("messageId", messageId),
@@ -115,7 +115,7 @@ namespace AwsMock::Database::Entity::SQS {
             jsonObject.set("region", region);
             jsonObject.set("queueUrl", queueUrl);
             jsonObject.set("queueName", queueName);
-            jsonObject.set("body", body);
+            jsonObject.set("body", body.str());
             jsonObject.set("status", MessageStatusToString(status));
             jsonObject.set("messageId", messageId);
             jsonObject.set("receiptHandle", receiptHandle);
@@ -131,7 +131,7 @@ namespace AwsMock::Database::Entity::SQS {
                 Poco::JSON::Object jsonMessageAttributeObject;
                 for (const auto &attribute: messageAttributes) {
                     Poco::JSON::Object jsonAttributeObject;
-                    jsonAttributeObject.set("StringValue", attribute.attributeValue);
+                    jsonAttributeObject.set("StringValue", attribute.attributeValue.str());
                     jsonAttributeObject.set("DataType", attribute.attributeType);
                     jsonMessageAttributeObject.set(attribute.attributeName, jsonAttributeObject);
                 }
@@ -162,7 +162,9 @@ namespace AwsMock::Database::Entity::SQS {
             Core::JsonUtils::GetJsonValueString("region", jsonObject, region);
             Core::JsonUtils::GetJsonValueString("queueUrl", jsonObject, queueUrl);
             Core::JsonUtils::GetJsonValueString("queueName", jsonObject, queueName);
-            Core::JsonUtils::GetJsonValueString("body", jsonObject, body);
+            std::string bodyStr;
+            Core::JsonUtils::GetJsonValueString("body", jsonObject, bodyStr);
+            body = std::move(bodyStr);
             Core::JsonUtils::GetJsonValueString("messageId", jsonObject, messageId);
             Core::JsonUtils::GetJsonValueString("receiptHandle", jsonObject, receiptHandle);
             Core::JsonUtils::GetJsonValueString("md5Body", jsonObject, md5Body);
@@ -187,10 +189,12 @@ namespace AwsMock::Database::Entity::SQS {
             Poco::JSON::Array::Ptr jsonMessageAttributeArray = jsonObject->getArray("messageAttributes");
             for (int i = 0; i < jsonMessageAttributeArray->size(); i++) {
                 MessageAttribute messageAttribute;
+                std::string attributeValue;
                 Poco::JSON::Object::Ptr jsonAttributeObject = jsonAttributeArray->getObject(i);
                 Core::JsonUtils::GetJsonValueString("name", jsonAttributeObject, messageAttribute.attributeName);
-                Core::JsonUtils::GetJsonValueString("value", jsonAttributeObject, messageAttribute.attributeValue);
-                attributes[messageAttribute.attributeName] = messageAttribute.attributeValue;
+                Core::JsonUtils::GetJsonValueString("value", jsonAttributeObject, attributeValue);
+                messageAttribute.attributeValue = attributeValue;
+                attributes[messageAttribute.attributeName] = attributeValue;
             }
         } catch (Poco::Exception &e) {
             log_error << e.message();
@@ -14,7 +14,7 @@ namespace AwsMock::Database::Entity::SQS {
 
         view_or_value<view, value> messageAttributeDoc = make_document(
                 kvp("attributeName", attributeName),
-                kvp("attributeValue", attributeValue),
+                kvp("attributeValue", attributeValue.str()),
                 kvp("systemAttribute", systemAttribute),
                 kvp("attributeType", Database::Entity::SQS::MessageAttributeTypeToString(attributeType)));
 
@@ -17,6 +17,8 @@ namespace AwsMock::Database::Entity::SQS {
                 kvp("visibilityTimeout", visibilityTimeout),
                 kvp("redrivePolicy", redrivePolicy.ToDocument()),
                 kvp("redriveAllowPolicy", redriveAllowPolicy),
+                kvp("fifoQueue", fifoQueue),
+                kvp("contentBasedDeduplication", contentBasedDeduplication),
                 kvp("approximateNumberOfMessages", static_cast<bsoncxx::types::b_int64>(approximateNumberOfMessages)),
                 kvp("approximateNumberOfMessagesDelayed", static_cast<bsoncxx::types::b_int64>(approximateNumberOfMessagesDelayed)),
                 kvp("approximateNumberOfMessagesNotVisible", static_cast<bsoncxx::types::b_int64>(approximateNumberOfMessagesNotVisible)),
@@ -35,6 +37,10 @@ namespace AwsMock::Database::Entity::SQS {
         visibilityTimeout = mResult.value()["visibilityTimeout"].get_int32().value;
         redrivePolicy.FromDocument(mResult.value()["redrivePolicy"].get_document().value);
         redriveAllowPolicy = bsoncxx::string::to_string(mResult.value()["redriveAllowPolicy"].get_string().value);
+        if (mResult.value().find("fifoQueue") != mResult.value().end()) {
+            fifoQueue = mResult.value()["fifoQueue"].get_bool().value;
+            contentBasedDeduplication = mResult.value()["contentBasedDeduplication"].get_bool().value;
+        }
         approximateNumberOfMessages = static_cast<long>(mResult.value()["approximateNumberOfMessages"].get_int64().value);
         approximateNumberOfMessagesDelayed = static_cast<long>(mResult.value()["approximateNumberOfMessagesDelayed"].get_int64().value);
         approximateNumberOfMessagesNotVisible = static_cast<long>(mResult.value()["approximateNumberOfMessagesNotVisible"].get_int64().value);
@@ -53,6 +59,8 @@ namespace AwsMock::Database::Entity::SQS {
             jsonObject.set("visibilityTimeout", visibilityTimeout);
             jsonObject.set("redrivePolicy", redrivePolicy.ToJsonObject());
             jsonObject.set("redriveAllowPolicy", redriveAllowPolicy);
+            jsonObject.set("fifoQueue", fifoQueue);
+            jsonObject.set("contentBasedDeduplication", contentBasedDeduplication);
             jsonObject.set("approximateNumberOfMessages", approximateNumberOfMessages);
             jsonObject.set("approximateNumberOfMessagesDelayed", approximateNumberOfMessagesDelayed);
             jsonObject.set("approximateNumberOfMessagesNotVisible", approximateNumberOfMessagesNotVisible);
@@ -75,6 +83,8 @@ namespace AwsMock::Database::Entity::SQS {
             Core::JsonUtils::GetJsonValueInt("receiveMessageWaitTime", jsonObject, receiveMessageWaitTime);
             Core::JsonUtils::GetJsonValueInt("visibilityTimeout", jsonObject, visibilityTimeout);
             Core::JsonUtils::GetJsonValueString("redriveAllowPolicy", jsonObject, redriveAllowPolicy);
+            Core::JsonUtils::GetJsonValueBool("fifoQueue", jsonObject, fifoQueue);
+            Core::JsonUtils::GetJsonValueBool("contentBasedDeduplication", jsonObject, contentBasedDeduplication);
             Core::JsonUtils::GetJsonValueLong("approximateNumberOfMessages", jsonObject, approximateNumberOfMessages);
             Core::JsonUtils::GetJsonValueLong("approximateNumberOfMessagesDelayed", jsonObject, approximateNumberOfMessagesDelayed);
             Core::JsonUtils::GetJsonValueLong("approximateNumberOfMessagesNotVisible", jsonObject, approximateNumberOfMessagesNotVisible);
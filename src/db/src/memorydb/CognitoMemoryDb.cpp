@@ -6,11 +6,12 @@
 
 namespace AwsMock::Database {
 
-    Poco::Mutex CognitoMemoryDb::_userPoolMutex;
-    Poco::Mutex CognitoMemoryDb::_userMutex;
-    Poco::Mutex CognitoMemoryDb::_groupMutex;
+    std::shared_mutex CognitoMemoryDb::_userPoolMutex;
+    std::shared_mutex CognitoMemoryDb::_userMutex;
+    std::shared_mutex CognitoMemoryDb::_groupMutex;
 
     bool CognitoMemoryDb::UserPoolExists(const std::string &region, const std::string &name) {
+        std::shared_lock lock(_userPoolMutex);
 
         return find_if(_userPools.begin(),
                        _userPools.end(),
@@ -20,6 +21,7 @@ namespace AwsMock::Database {
     }
 
     bool CognitoMemoryDb::UserPoolExists(const std::string &userPoolId) {
+        std::shared_lock lock(_userPoolMutex);
 
         return find_if(_userPools.begin(),
                        _userPools.end(),
@@ -29,6 +31,7 @@ namespace AwsMock::Database {
     }
 
     Entity::Cognito::UserPoolList CognitoMemoryDb::ListUserPools(const std::string &region) {
+        std::shared_lock lock(_userPoolMutex);
 
         Entity::Cognito::UserPoolList userPoolList;
         if (region.empty()) {
@@ -48,15 +51,17 @@ namespace AwsMock::Database {
     }
 
     Entity::Cognito::UserPool CognitoMemoryDb::CreateUserPool(const Entity::Cognito::UserPool &userPool) {
-        Poco::ScopedLock lock(_userPoolMutex);
+        std::unique_lock lock(_userPoolMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _userPools[oid] = userPool;
+        _userPools[oid].oid = oid;
         log_trace << "Cognito user pool created, oid: " << oid;
-        return GetUserPoolByOid(oid);
+        return _userPools[oid];
     }
 
     Entity::Cognito::UserPool CognitoMemoryDb::GetUserPoolByOid(const std::string &oid) {
+        std::shared_lock lock(_userPoolMutex);
 
         auto it = find_if(_userPools.begin(),
                           _userPools.end(),
@@ -69,11 +74,11 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get cognito user pool by oid failed, oid: " + oid);
         }
 
-        it->second.oid = oid;
         return it->second;
     }
 
     Entity::Cognito::UserPool CognitoMemoryDb::GetUserPoolByUserPoolId(const std::string &userPoolId) {
+        std::shared_lock lock(_userPoolMutex);
 
         auto it = find_if(_userPools.begin(),
                           _userPools.end(),
@@ -86,11 +91,11 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get cognito user pool by userPoolId failed, userPoolId: " + userPoolId);
         }
 
-        it->second.oid = it->first;
         return it->second;
     }
 
     Entity::Cognito::UserPool CognitoMemoryDb::GetUserPoolByRegionName(const std::string &region, const std::string &name) {
+        std::shared_lock lock(_userPoolMutex);
 
         auto it = find_if(_userPools.begin(),
                           _userPools.end(),
@@ -103,11 +108,11 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get cognito user pool by region and name failed, region: " + region + " name: " + name);
         }
 
-        it->second.oid = it->first;
         return it->second;
     }
 
     long CognitoMemoryDb::CountUserPools(const std::string &region) {
+        std::shared_lock lock(_userPoolMutex);
         long count = 0;
         if (region.empty()) {
             count = static_cast<long>(_userPools.size());
@@ -125,7 +130,7 @@ namespace AwsMock::Database {
 
     Entity::Cognito::UserPool CognitoMemoryDb::UpdateUserPool(const Entity::Cognito::UserPool &userPool) {
 
-        Poco::ScopedLock lock(_userPoolMutex);
+        std::unique_lock lock(_userPoolMutex);
 
         std::string region = userPool.region;
         std::string name = userPool.name;
@@ -139,12 +144,13 @@ namespace AwsMock::Database {
             log_error << "Update user pool failed, region: " << userPool.region << " name: " << userPool.name;
             throw Core::DatabaseException("Update cognito user pool failed, region: " + userPool.region + " name: " + userPool.name);
         }
-        _userPools[it->first] = userPool;
-        return _userPools[it->first];
+        it->second = userPool;
+        it->second.oid = it->first;
+        return it->second;
     }
 
     void CognitoMemoryDb::DeleteUserPool(const std::string &userPoolId) {
-        Poco::ScopedLock lock(_userPoolMutex);
+        std::unique_lock lock(_userPoolMutex);
 
         const auto count = std::erase_if(_userPools, [userPoolId](const auto &item) {
             auto const &[key, value] = item;
@@ -154,13 +160,14 @@ namespace AwsMock::Database {
     }
 
     void CognitoMemoryDb::DeleteAllUserPools() {
-        Poco::ScopedLock lock(_userPoolMutex);
+        std::unique_lock lock(_userPoolMutex);
 
         log_debug << "All cognito user pools deleted, count: " << _userPools.size();
         _userPools.clear();
     }
 
     bool CognitoMemoryDb::UserExists(const std::string &region, const std::string &userPoolId, const std::string &userName) {
+        std::shared_lock lock(_userMutex);
 
         return find_if(_users.begin(),
                        _users.end(),
@@ -170,15 +177,17 @@ namespace AwsMock::Database {
     }
 
     Entity::Cognito::User CognitoMemoryDb::CreateUser(const Entity::Cognito::User &user) {
-        Poco::ScopedLock lock(_userMutex);
+        std::unique_lock lock(_userMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _users[oid] = user;
+        _users[oid].oid = oid;
         log_trace << "Cognito user created, oid: " << oid;
-        return GetUserByOid(oid);
+        return _users[oid];
     }
 
     Entity::Cognito::User CognitoMemoryDb::GetUserByOid(const std::string &oid) {
+        std::shared_lock lock(_userMutex);
 
         auto it = find_if(_users.begin(), _users.end(), [oid](const std::pair<std::string, Entity::Cognito::User> &user) {
             return user.first == oid;
@@ -189,11 +198,11 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get cognito user by oid failed, oid: " + oid);
         }
 
-        it->second.oid = oid;
         return it->second;
     }
 
     Entity::Cognito::User CognitoMemoryDb::GetUserByUserName(const std::string &region, const std::string &userPoolId, const std::string &userName) {
+        std::shared_lock lock(_userMutex);
 
         auto it = find_if(_users.begin(),
                           _users.end(),
@@ -206,11 +215,11 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get cognito user by user name failed, userName: " + userName);
         }
 
-        it->second.oid = it->first;
         return it->second;
     }
 
     long CognitoMemoryDb::CountUsers(const std::string &region, const std::string &userPoolId) {
+        std::shared_lock lock(_userMutex);
 
         long count = 0;
         if (!region.empty() && !userPoolId.empty()) {
@@ -239,6 +248,7 @@ namespace AwsMock::Database {
     }
 
     std::vector<Entity::Cognito::User> CognitoMemoryDb::ListUsers(const std::string &region, const std::string &userPoolId) {
+        std::shared_lock lock(_userMutex);
 
         Entity::Cognito::UserList userList;
         if (!region.empty() && !userPoolId.empty()) {
@@ -269,6 +279,7 @@ namespace AwsMock::Database {
     }
 
     std::vector<Entity::Cognito::User> CognitoMemoryDb::ListUsersInGroup(const std::string &region, const std::string &userPoolId, const std::string &groupName) {
+        std::shared_lock lock(_userMutex);
 
         Entity::Cognito::UserList userList;
 
@@ -286,7 +297,7 @@ namespace AwsMock::Database {
 
     Entity::Cognito::User CognitoMemoryDb::UpdateUser(const Entity::Cognito::User &user) {
 
-        Poco::ScopedLock lock(_userMutex);
+        std::unique_lock lock(_userMutex);
 
         std::string region = user.region;
         std::string userPoolId = user.userPoolId;
@@ -301,12 +312,13 @@ namespace AwsMock::Database {
             log_error << "Update user failed, region: " << user.region << " name: " << user.userName;
             throw Core::DatabaseException("Update cognito user failed, region: " + user.region + " name: " + user.userName);
         }
-        _users[it->first] = user;
-        return _users[it->first];
+        it->second = user;
+        it->second.oid = it->first;
+        return it->second;
     }
 
     void CognitoMemoryDb::DeleteUser(const Entity::Cognito::User &user) {
-        Poco::ScopedLock lock(_userMutex);
+        std::unique_lock lock(_userMutex);
 
         const auto count = std::erase_if(_users, [user](const std::pair<std::string, Entity::Cognito::User> &u) {
             return u.second.region == user.region && u.second.userPoolId == user.userPoolId && u.second.userName == user.userName;
@@ -315,13 +327,14 @@ namespace AwsMock::Database {
     }
 
     void CognitoMemoryDb::DeleteAllUsers() {
-        Poco::ScopedLock lock(_userMutex);
+        std::unique_lock lock(_userMutex);
 
         log_debug << "All cognito users deleted, count: " << _userPools.size();
         _users.clear();
     }
 
     bool CognitoMemoryDb::GroupExists(const std::string &region, const std::string &groupName) {
+        std::shared_lock lock(_groupMutex);
 
         return find_if(_groups.begin(),
                        _groups.end(),
@@ -331,6 +344,7 @@ namespace AwsMock::Database {
     }
 
     Entity::Cognito::Group CognitoMemoryDb::GetGroupByGroupName(const std::string &region, const std::string &groupPoolId, const std::string &groupName) {
+        std::shared_lock lock(_groupMutex);
 
         auto it = find_if(_groups.begin(),
                           _groups.end(),
@@ -343,20 +357,21 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get cognito group by group name failed, groupName: " + groupName);
         }
 
-        it->second.oid = it->first;
         return it->second;
     }
 
     Entity::Cognito::Group CognitoMemoryDb::CreateGroup(const Entity::Cognito::Group &group) {
-        Poco::ScopedLock lock(_groupMutex);
+        std::unique_lock lock(_groupMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _groups[oid] = group;
+        _groups[oid].oid = oid;
         log_trace << "Cognito user pool created, oid: " << oid;
         return _groups[oid];
     }
 
     std::vector<Entity::Cognito::Group> CognitoMemoryDb::ListGroups(const std::string &region, const std::string &userPoolId) {
+        std::shared_lock lock(_groupMutex);
 
         Entity::Cognito::GroupList groupList;
         if (!region.empty() && !userPoolId.empty()) {
@@ -387,7 +402,7 @@ namespace AwsMock::Database {
     }
 
     void CognitoMemoryDb::DeleteGroup(const std::string &region, const std::string &userPoolId, const std::string &groupName) {
-        Poco::ScopedLock lock(_groupMutex);
+        std::unique_lock lock(_groupMutex);
 
         const auto count = std::erase_if(_groups, [region, userPoolId, groupName](const std::pair<std::string, Entity::Cognito::Group> &g) {
             return g.second.region == region && g.second.userPoolId == userPoolId && g.second.groupName == groupName;
@@ -6,8 +6,8 @@
 
 namespace AwsMock::Database {
 
-    Poco::Mutex DynamoDbMemoryDb::_tableMutex;
-    Poco::Mutex DynamoDbMemoryDb::_itemMutex;
+    std::shared_mutex DynamoDbMemoryDb::_tableMutex;
+    std::shared_mutex DynamoDbMemoryDb::_itemMutex;
 
 
     template<typename Map, typename Key>
@@ -19,6 +19,7 @@ namespace AwsMock::Database {
     }
 
     bool DynamoDbMemoryDb::TableExists(const std::string &region, const std::string &tableName) {
+        std::shared_lock lock(_tableMutex);
 
         if (!region.empty()) {
             return find_if(_tables.begin(),
@@ -36,6 +37,7 @@ namespace AwsMock::Database {
     }
 
     Entity::DynamoDb::TableList DynamoDbMemoryDb::ListTables(const std::string &region) {
+        std::shared_lock lock(_tableMutex);
 
         Entity::DynamoDb::TableList tables;
         if (region.empty()) {
@@ -55,15 +57,17 @@ namespace AwsMock::Database {
     }
 
     Entity::DynamoDb::Table DynamoDbMemoryDb::CreateTable(const Entity::DynamoDb::Table &table) {
-        Poco::ScopedLock lock(_tableMutex);
+        std::unique_lock lock(_tableMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _tables[oid] = table;
+        _tables[oid].oid = oid;
         log_trace << "Lambda created, oid: " << oid;
-        return GetTableById(oid);
+        return _tables[oid];
     }
 
     Entity::DynamoDb::Table DynamoDbMemoryDb::GetTableById(const std::string &oid) {
+        std::shared_lock lock(_tableMutex);
 
         auto it =
                 find_if(_tables.begin(), _tables.end(), [oid](const std::pair<std::string, Entity::DynamoDb::Table> &table) {
@@ -75,11 +79,11 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get table by ID failed, oid: " + oid);
         }
 
-        it->second.oid = oid;
         return it->second;
     }
 
     Entity::DynamoDb::Table DynamoDbMemoryDb::GetTableByRegionName(const std::string &region, const std::string &name) {
+        std::shared_lock lock(_tableMutex);
 
         auto it = find_if(_tables.begin(),
                           _tables.end(),
@@ -92,12 +96,11 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get table by region and name failed, region: " + region + " name: " + name);
         }
 
-        it->second.oid = it->first;
         return it->second;
     }
 
     Entity::DynamoDb::Table DynamoDbMemoryDb::UpdateTable(const Entity::DynamoDb::Table &table) {
-        Poco::ScopedLock lock(_tableMutex);
+        std::unique_lock lock(_tableMutex);
 
         std::string region = table.region;
         std::string name = table.name;
@@ -106,12 +109,13 @@ namespace AwsMock::Database {
                           [region, name](const std::pair<std::string, Entity::DynamoDb::Table> &table) {
                               return table.second.region == region && table.second.name == name;
                           });
-        _tables[it->first] = table;
-        return _tables[it->first];
+        it->second = table;
+        it->second.oid = it->first;
+        return it->second;
     }
 
     void DynamoDbMemoryDb::DeleteTable(const std::string &tableName) {
-        Poco::ScopedLock lock(_tableMutex);
+        std::unique_lock lock(_tableMutex);
 
         const auto count = std::erase_if(_tables, [tableName](const auto &item) {
             auto const &[key, value] = item;
@@ -121,7 +125,7 @@ namespace AwsMock::Database {
     }
 
     void DynamoDbMemoryDb::DeleteAllTables() {
-        Poco::ScopedLock lock(_tableMutex);
+        std::unique_lock lock(_tableMutex);
 
         log_debug << "All DynamoDb tables deleted, count: " << _tables.size();
         _tables.clear();
@@ -135,6 +139,8 @@ namespace AwsMock::Database {
         // Get table
         Entity::DynamoDb::Table table = GetTableByRegionName(region, tableName);
 
+        std::shared_lock lock(_itemMutex);
+
         if (!region.empty()) {
             return find_if(_items.begin(),
                            _items.end(),
@@ -153,6 +159,7 @@ namespace AwsMock::Database {
     }
 
     Entity::DynamoDb::ItemList DynamoDbMemoryDb::ListItems(const std::string &region, const std::string &tableName) {
+        std::shared_lock lock(_itemMutex);
 
         Entity::DynamoDb::ItemList items;
         if (region.empty() && tableName.empty()) {
@@ -183,6 +190,7 @@ namespace AwsMock::Database {
     }
 
     long DynamoDbMemoryDb::CountTables(const std::string &region) {
+        std::shared_lock lock(_tableMutex);
 
         if (!region.empty()) {
 
@@ -201,6 +209,7 @@ namespace AwsMock::Database {
     }
 
     Entity::DynamoDb::Item DynamoDbMemoryDb::GetItemById(const std::string &oid) {
+        std::shared_lock lock(_itemMutex);
 
         auto it =
                 find_if(_items.begin(), _items.end(), [oid](const std::pair<std::string, Entity::DynamoDb::Item> &item) {
@@ -212,21 +221,21 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get item by ID failed, oid: " + oid);
         }
 
-        it->second.oid = oid;
         return it->second;
     }
 
     Entity::DynamoDb::Item DynamoDbMemoryDb::CreateItem(const Entity::DynamoDb::Item &item) {
-        Poco::ScopedLock lock(_itemMutex);
+        std::unique_lock lock(_itemMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _items[oid] = item;
+        _items[oid].oid = oid;
         log_trace << "Item created, oid: " << oid;
-        return GetItemById(oid);
+        return _items[oid];
     }
 
     Entity::DynamoDb::Item DynamoDbMemoryDb::UpdateItem(const Entity::DynamoDb::Item &item) {
-        Poco::ScopedLock lock(_itemMutex);
+        std::unique_lock lock(_itemMutex);
 
         std::string region = item.region;
         std::string tableName = item.tableName;
@@ -235,11 +244,13 @@ namespace AwsMock::Database {
                           [region, tableName](const std::pair<std::string, Entity::DynamoDb::Item> &item) {
                               return item.second.region == region && item.second.tableName == tableName;
                           });
-        _items[it->first] = item;
-        return _items[it->first];
+        it->second = item;
+        it->second.oid = it->first;
+        return it->second;
     }
 
     long DynamoDbMemoryDb::CountItems(const std::string &region) {
+        std::shared_lock lock(_itemMutex);
 
         if (!region.empty()) {
             long count = 0;
@@ -257,7 +268,7 @@ namespace AwsMock::Database {
     }
 
     void DynamoDbMemoryDb::DeleteItem(const std::string &region, const std::string &tableName, const std::string &key) {
-        Poco::ScopedLock lock(_itemMutex);
+        std::unique_lock lock(_itemMutex);
 
         const auto count = std::erase_if(_items, [region, tableName, key](const auto &item) {
             auto const &[k, v] = item;
@@ -267,7 +278,7 @@ namespace AwsMock::Database {
     }
 
     void DynamoDbMemoryDb::DeleteItems(const std::string &region, const std::string &tableName) {
-        Poco::ScopedLock lock(_itemMutex);
+        std::unique_lock lock(_itemMutex);
 
         const auto count = std::erase_if(_items, [region, tableName](const auto &item) {
             auto const &[k, v] = item;
@@ -277,7 +288,7 @@ namespace AwsMock::Database {
     }
 
     void DynamoDbMemoryDb::DeleteAllItems() {
-        Poco::ScopedLock lock(_itemMutex);
+        std::unique_lock lock(_itemMutex);
 
         log_debug << "DynamoDB items deleted, count: " << _items.size();
 
@@ -6,9 +6,10 @@
 
 namespace AwsMock::Database {
 
-    Poco::Mutex KMSMemoryDb::_keyMutex;
+    std::shared_mutex KMSMemoryDb::_keyMutex;
 
     bool KMSMemoryDb::KeyExists(const std::string &keyId) {
+        std::shared_lock lock(_keyMutex);
 
         return find_if(_keys.begin(), _keys.end(), [keyId](const std::pair<std::string, Entity::KMS::Key> &topic) {
                    return topic.second.keyId == keyId;
@@ -16,13 +17,13 @@ namespace AwsMock::Database {
     }
 
     Entity::KMS::Key KMSMemoryDb::GetKeyById(const std::string &oid) {
+        std::shared_lock lock(_keyMutex);
 
         auto it = find_if(_keys.begin(), _keys.end(), [oid](const std::pair<std::string, Entity::KMS::Key> &topic) {
             return topic.first == oid;
         });
 
         if (it != _keys.end()) {
-            it->second.oid = oid;
             return it->second;
         }
 
@@ -31,13 +32,13 @@ namespace AwsMock::Database {
     }
 
     Entity::KMS::Key KMSMemoryDb::GetKeyByKeyId(const std::string &keyId) {
+        std::shared_lock lock(_keyMutex);
 
         auto it = find_if(_keys.begin(), _keys.end(), [keyId](const std::pair<std::string, Entity::KMS::Key> &topic) {
             return topic.second.keyId == keyId;
         });
 
         if (it != _keys.end()) {
-            it->second.oid = it->first;
             return it->second;
         }
 
@@ -46,6 +47,7 @@ namespace AwsMock::Database {
     }
 
     Entity::KMS::KeyList KMSMemoryDb::ListKeys(const std::string &region) {
+        std::shared_lock lock(_keyMutex);
 
         Entity::KMS::KeyList keyList;
 
@@ -69,21 +71,23 @@ namespace AwsMock::Database {
     }
 
     long KMSMemoryDb::CountKeys() {
+        std::shared_lock lock(_keyMutex);
 
         return (long) _keys.size();
     }
 
     Entity::KMS::Key KMSMemoryDb::CreateKey(const Entity::KMS::Key &topic) {
-        Poco::ScopedLock loc(_keyMutex);
+        std::unique_lock lock(_keyMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _keys[oid] = topic;
+        _keys[oid].oid = oid;
         log_trace << "Key created, oid: " << oid;
-        return GetKeyById(oid);
+        return _keys[oid];
     }
 
     Entity::KMS::Key KMSMemoryDb::UpdateKey(const Entity::KMS::Key &key) {
-        Poco::ScopedLock lock(_keyMutex);
+        std::unique_lock lock(_keyMutex);
 
         std::string keyId = key.keyId;
         auto it = find_if(_keys.begin(),
@@ -92,15 +96,16 @@ namespace AwsMock::Database {
                               return key.second.keyId == keyId;
                           });
         if (it != _keys.end()) {
-            _keys[it->first] = key;
-            return _keys[it->first];
+            it->second = key;
+            it->second.oid = it->first;
+            return it->second;
         }
         log_warning << "Key not found, keyId: " << keyId;
         return key;
     }
 
     void KMSMemoryDb::DeleteKey(const Entity::KMS::Key &key) {
-        Poco::ScopedLock lock(_keyMutex);
+        std::unique_lock lock(_keyMutex);
 
         std::string keyId = key.keyId;
         const auto count = std::erase_if(_keys, [keyId](const auto &item) {
@@ -111,7 +116,7 @@ namespace AwsMock::Database {
     }
 
     void KMSMemoryDb::DeleteAllKeys() {
-        Poco::ScopedLock lock(_keyMutex);
+        std::unique_lock lock(_keyMutex);
         _keys.clear();
         log_debug << "All KMS keys deleted";
     }
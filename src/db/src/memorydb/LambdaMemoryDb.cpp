@@ -6,9 +6,10 @@
 
 namespace AwsMock::Database {
 
-    Poco::Mutex LambdaMemoryDb::_lambdaMutex;
+    std::shared_mutex LambdaMemoryDb::_lambdaMutex;
 
     bool LambdaMemoryDb::LambdaExists(const std::string &function) {
+        std::shared_lock lock(_lambdaMutex);
 
         return find_if(_lambdas.begin(),
                        _lambdas.end(),
@@ -18,6 +19,7 @@ namespace AwsMock::Database {
     }
 
     bool LambdaMemoryDb::LambdaExists(const Entity::Lambda::Lambda &lambda) {
+        std::shared_lock lock(_lambdaMutex);
 
         std::string region = lambda.region;
         std::string function = lambda.function;
@@ -31,6 +33,7 @@ namespace AwsMock::Database {
     bool LambdaMemoryDb::LambdaExists(const std::string &region,
                                       const std::string &function,
                                       const std::string &runtime) {
+        std::shared_lock lock(_lambdaMutex);
 
         return find_if(_lambdas.begin(),
                        _lambdas.end(),
@@ -40,6 +43,7 @@ namespace AwsMock::Database {
     }
 
     bool LambdaMemoryDb::LambdaExistsByArn(const std::string &arn) {
+        std::shared_lock lock(_lambdaMutex);
 
         return find_if(_lambdas.begin(), _lambdas.end(), [arn](const std::pair<std::string, Entity::Lambda::Lambda> &lambda) {
                    return lambda.second.arn == arn;
@@ -47,6 +51,7 @@ namespace AwsMock::Database {
     }
 
     Entity::Lambda::LambdaList LambdaMemoryDb::ListLambdas(const std::string &region) {
+        std::shared_lock lock(_lambdaMutex);
 
         Entity::Lambda::LambdaList lambdaList;
         if (region.empty()) {
@@ -66,15 +71,17 @@ namespace AwsMock::Database {
     }
 
     Entity::Lambda::Lambda LambdaMemoryDb::CreateLambda(const Entity::Lambda::Lambda &lambda) {
-        Poco::ScopedLock lock(_lambdaMutex);
+        std::unique_lock lock(_lambdaMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _lambdas[oid] = lambda;
+        _lambdas[oid].oid = oid;
         log_trace << "Lambda created, oid: " << oid;
-        return GetLambdaById(oid);
+        return _lambdas[oid];
     }
 
     Entity::Lambda::Lambda LambdaMemoryDb::GetLambdaById(const std::string &oid) {
+        std::shared_lock lock(_lambdaMutex);
 
         auto it =
                 find_if(_lambdas.begin(), _lambdas.end(), [oid](const std::pair<std::string, Entity::Lambda::Lambda> &lambda) {
@@ -86,11 +93,11 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get lambda by ID failed, arn: " + oid);
         }
 
-        it->second.oid = oid;
         return it->second;
     }
 
     Entity::Lambda::Lambda LambdaMemoryDb::GetLambdaByArn(const std::string &arn) {
+        std::shared_lock lock(_lambdaMutex);
 
         auto it =
                 find_if(_lambdas.begin(), _lambdas.end(), [arn](const std::pair<std::string, Entity::Lambda::Lambda> &lambda) {
@@ -102,11 +109,11 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get lambda by ARN failed, arn: " + arn);
         }
 
-        it->second.oid = arn;
         return it->second;
     }
 
     Entity::Lambda::Lambda LambdaMemoryDb::GetLambdaByName(const std::string &region, const std::string &name) {
+        std::shared_lock lock(_lambdaMutex);
 
         auto it =
                 find_if(_lambdas.begin(), _lambdas.end(), [region, name](const std::pair<std::string, Entity::Lambda::Lambda> &lambda) {
@@ -118,11 +125,11 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Get lambda by name failed, name: " + name);
         }
 
-        it->second.oid = it->first;
         return it->second;
     }
 
     long LambdaMemoryDb::LambdaCount(const std::string &region) {
+        std::shared_lock lock(_lambdaMutex);
 
         long count = 0;
         if (region.empty()) {
@@ -139,7 +146,7 @@ namespace AwsMock::Database {
 
     Entity::Lambda::Lambda LambdaMemoryDb::UpdateLambda(const Entity::Lambda::Lambda &lambda) {
 
-        Poco::ScopedLock lock(_lambdaMutex);
+        std::unique_lock lock(_lambdaMutex);
 
         std::string region = lambda.region;
         std::string function = lambda.function;
@@ -153,11 +160,13 @@ namespace AwsMock::Database {
             log_error << "Update lambda failed, region: " << lambda.region << " function: " << lambda.function;
             throw Core::DatabaseException("Update lambda failed, region: " + lambda.region + " function: " + lambda.function);
         }
-        _lambdas[it->first] = lambda;
-        return _lambdas[it->first];
+        it->second = lambda;
+        it->second.oid = it->first;
+        return it->second;
     }
 
     void LambdaMemoryDb::SetInstanceStatus(const std::string &containerId, const Entity::Lambda::LambdaInstanceStatus &status) {
+        std::unique_lock lock(_lambdaMutex);
 
         for (auto &lambda: _lambdas) {
             for (auto &instance: lambda.second.instances) {
@@ -169,7 +178,7 @@ namespace AwsMock::Database {
     }
 
     void LambdaMemoryDb::DeleteLambda(const std::string &functionName) {
-        Poco::ScopedLock lock(_lambdaMutex);
+        std::unique_lock lock(_lambdaMutex);
 
         const auto count = std::erase_if(_lambdas, [functionName](const auto &item) {
             auto const &[key, value] = item;
@@ -179,7 +188,7 @@ namespace AwsMock::Database {
     }
 
     void LambdaMemoryDb::DeleteAllLambdas() {
-        Poco::ScopedLock lock(_lambdaMutex);
+        std::unique_lock lock(_lambdaMutex);
 
         log_debug << "All lambdas deleted, count: " << _lambdas.size();
         _lambdas.clear();
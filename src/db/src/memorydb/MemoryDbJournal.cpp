@@ -0,0 +1,110 @@
+//
+// Created by vogje01 on 6/17/24.
+//
+
+#include <awsmock/memorydb/MemoryDbJournal.h>
+
+namespace AwsMock::Database {
+
+    using bsoncxx::builder::basic::kvp;
+    using bsoncxx::builder::basic::make_document;
+
+    MemoryDbJournal::Transaction::~Transaction() noexcept(false) {
+        if (_sequence <= 0) {
+            return;
+        }
+        try {
+            _journal.Commit(_sequence);
+        } catch (Core::CoreException &exc) {
+            log_error << "Could not commit memory database journal, module: " << _journal._module << " error: " << exc.message();
+
+            // The change is not durable, the caller must not acknowledge it
+            if (std::uncaught_exceptions() == _uncaughtExceptions) {
+                throw Core::DatabaseException("Could not commit memory database journal, module: " + _journal._module + " error: " + exc.message());
+            }
+        }
+    }
+
+    void MemoryDbJournal::Transaction::Update(const std::string &type, const std::string &key, const bsoncxx::document::view &fields, const std::string &scope) {
+        if (IsActive()) {
+            Write(make_document(kvp("op", "update"), kvp("type", type), kvp("scope", scope), kvp("key", key), kvp("value", fields)));
+        }
+    }
+
+    void MemoryDbJournal::Transaction::Delete(const std::string &type, const std::string &key, const std::string &scope) {
+        if (IsActive()) {
+            Write(make_document(kvp("op", "delete"), kvp("type", type), kvp("scope", scope), kvp("key", key)));
+        }
+    }
+
+    void MemoryDbJournal::Transaction::Clear(const std::string &type, const std::string &scope) {
+        if (IsActive()) {
+            Write(make_document(kvp("op", "clear"), kvp("type", type), kvp("scope", scope), kvp("key", "")));
+        }
+    }
+
+    void MemoryDbJournal::Transaction::Write(const bsoncxx::document::view &record) {
+        long sequence = _journal._log.Write(std::string(reinterpret_cast<const char *>(record.data()), record.length()));
+        if (sequence > 0) {
+            _sequence = sequence;
+        }
+    }
+
+    void MemoryDbJournal::Open(const ReplayFunction &replay, const SnapshotFunction &snapshot) {
+
+        Core::Configuration &configuration = Core::Configuration::instance();
+        if (!configuration.getBool("awsmock.memorydb.wal.active", false)) {
+            return;
+        }
+
+        std::string dataDir = configuration.getString("awsmock.data.dir", "/home/awsmock/data");
+        std::string walDir = configuration.getString("awsmock.memorydb.wal.dir", dataDir + "/wal");
+        bool sync = configuration.getBool("awsmock.memorydb.wal.sync", true);
+        _snapshotRecords = configuration.getInt("awsmock.memorydb.wal.snapshot", DEFAULT_MEMORYDB_WAL_SNAPSHOT);
+        _snapshot = snapshot;
+
+        long failed = 0;
+        long count = _log.Open(walDir + "/" + _module, sync, [&replay, &failed, this](const std::string &record) {
+            try {
+                replay(bsoncxx::document::view(reinterpret_cast<const uint8_t *>(record.data()), record.size()));
+            } catch (std::exception &exc) {
+                failed++;
+                log_error << "Could not replay memory database journal record, module: " << _module << " error: " << exc.what();
+            }
+        });
+        log_info << "Memory database journal opened, module: " << _module << " records: " << count << " failed: " << failed;
+    }
+
+    void MemoryDbJournal::Commit(long sequence) {
+        _log.Commit(sequence);
+        if (_snapshotRecords > 0 && _log.Size() >= _snapshotRecords) {
+            try {
+                _log.Snapshot([this](const Core::WriteAheadLog::WriteFunction &write) {
+                    _snapshot([&write](const bsoncxx::document::view &record) {
+                        write(std::string(reinterpret_cast<const char *>(record.data()), record.length()));
+                    });
+                });
+            } catch (Core::CoreException &exc) {
+                log_error << "Memory database snapshot failed, the journal is kept, module: " << _module << " error: " << exc.message();
+            }
+        }
+    }
+
+    bsoncxx::document::value MemoryDbJournal::PutRecord(const std::string &type, const std::string &key, const bsoncxx::document::view &entity, const std::string &scope) {
+
+        // The entities expect an object ID, as their documents come from MongoDB otherwise
+        bsoncxx::builder::basic::document value;
+        value.append(kvp("_id", bsoncxx::oid()));
+        value.append(bsoncxx::builder::concatenate(entity));
+        return make_document(kvp("op", "put"), kvp("type", type), kvp("scope", scope), kvp("key", key), kvp("value", value.extract()));
+    }
+
+    std::string MemoryDbJournal::GetField(const bsoncxx::document::view &record, const std::string &name) {
+        return bsoncxx::string::to_string(record[name].get_string().value);
+    }
+
+    bsoncxx::document::view MemoryDbJournal::GetValue(const bsoncxx::document::view &record) {
+        return record["value"].get_document().value;
+    }
+
+}// namespace AwsMock::Database
@@ -6,9 +6,10 @@
 
 namespace AwsMock::Database {
 
-    Poco::Mutex ModuleMemoryDb::_moduleMutex;
+    std::shared_mutex ModuleMemoryDb::_moduleMutex;
 
     bool ModuleMemoryDb::ModuleExists(const std::string &name) {
+        std::shared_lock lock(_moduleMutex);
 
         return find_if(_modules.begin(), _modules.end(), [name](const std::pair<std::string, Entity::Module::Module> &module) {
                    return module.second.name == name;
@@ -16,6 +17,7 @@ namespace AwsMock::Database {
     }
 
     bool ModuleMemoryDb::IsActive(const std::string &name) {
+        std::shared_lock lock(_moduleMutex);
 
         return find_if(_modules.begin(), _modules.end(), [name](const std::pair<std::string, Entity::Module::Module> &module) {
                    return module.second.name == name && module.second.status == Entity::Module::ModuleStatus::ACTIVE;
@@ -23,6 +25,7 @@ namespace AwsMock::Database {
     }
 
     Entity::Module::Module ModuleMemoryDb::GetModuleById(const std::string &oid) {
+        std::shared_lock lock(_moduleMutex);
 
         auto it =
                 find_if(_modules.begin(), _modules.end(), [oid](const std::pair<std::string, Entity::Module::Module> &module) {
@@ -33,11 +36,11 @@ namespace AwsMock::Database {
             log_error << "Get module by ID failed, oid: " << oid;
             throw Core::DatabaseException("Get module by ID failed, oid: " + oid);
         }
-        it->second.oid = oid;
         return it->second;
     }
 
     Entity::Module::Module ModuleMemoryDb::GetModuleByName(const std::string &name) {
+        std::shared_lock lock(_moduleMutex);
 
         auto it =
                 find_if(_modules.begin(), _modules.end(), [name](const std::pair<std::string, Entity::Module::Module> &module) {
@@ -48,11 +51,11 @@ namespace AwsMock::Database {
             log_error << "Get module by name failed, oid: " << name;
             throw Core::DatabaseException("Get module by name failed, oid: " + name);
         }
-        it->second.oid = it->first;
         return it->second;
     }
 
     std::vector<std::string> ModuleMemoryDb::GetAllModuleNames() {
+        std::shared_lock lock(_moduleMutex);
 
         std::vector<std::string> moduleNameList;
         for (const auto &module: _modules) {
@@ -64,15 +67,17 @@ namespace AwsMock::Database {
     }
 
     Entity::Module::Module ModuleMemoryDb::CreateModule(const Entity::Module::Module &module) {
-        Poco::ScopedLock lock(_moduleMutex);
+        std::unique_lock lock(_moduleMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _modules[oid] = module;
+        _modules[oid].oid = oid;
         log_trace << "Module created, oid: " << oid;
-        return GetModuleById(oid);
+        return _modules[oid];
     }
 
     Entity::Module::ModuleList ModuleMemoryDb::ListModules() {
+        std::shared_lock lock(_moduleMutex);
 
         Entity::Module::ModuleList moduleList;
         for (const auto &module: _modules) {
@@ -84,7 +89,7 @@ namespace AwsMock::Database {
     }
 
     Entity::Module::Module ModuleMemoryDb::UpdateModule(const Entity::Module::Module &module) {
-        Poco::ScopedLock lock(_moduleMutex);
+        std::unique_lock lock(_moduleMutex);
 
         std::string name = module.name;
         auto it =
@@ -97,12 +102,13 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Update module failed, module: " + name);
         }
 
-        _modules[it->first] = module;
-        return _modules[it->first];
+        it->second = module;
+        it->second.oid = it->first;
+        return it->second;
     }
 
     Entity::Module::Module ModuleMemoryDb::SetState(const std::string &name, const Entity::Module::ModuleState &state) {
-        Poco::ScopedLock lock(_moduleMutex);
+        std::unique_lock lock(_moduleMutex);
 
         auto it =
                 find_if(_modules.begin(), _modules.end(), [name](const std::pair<std::string, Entity::Module::Module> &module) {
@@ -120,7 +126,7 @@ namespace AwsMock::Database {
     }
 
     void ModuleMemoryDb::SetStatus(const std::string &name, const Entity::Module::ModuleStatus &status) {
-        Poco::ScopedLock lock(_moduleMutex);
+        std::unique_lock lock(_moduleMutex);
 
         auto it =
                 find_if(_modules.begin(), _modules.end(), [name](const std::pair<std::string, Entity::Module::Module> &module) {
@@ -137,7 +143,7 @@ namespace AwsMock::Database {
     }
 
     void ModuleMemoryDb::SetPort(const std::string &name, int port) {
-        Poco::ScopedLock lock(_moduleMutex);
+        std::unique_lock lock(_moduleMutex);
 
         auto it =
                 find_if(_modules.begin(), _modules.end(), [name](const std::pair<std::string, Entity::Module::Module> &module) {
@@ -154,11 +160,12 @@ namespace AwsMock::Database {
     }
 
     int ModuleMemoryDb::ModuleCount() {
+        std::shared_lock lock(_moduleMutex);
         return static_cast<int>(_modules.size());
     }
 
     void ModuleMemoryDb::DeleteModule(const Entity::Module::Module &module) {
-        Poco::ScopedLock lock(_moduleMutex);
+        std::unique_lock lock(_moduleMutex);
 
         std::string name = module.name;
         const auto count = std::erase_if(_modules, [name](const auto &item) {
@@ -169,7 +176,7 @@ namespace AwsMock::Database {
     }
 
     void ModuleMemoryDb::DeleteAllModules() {
-        Poco::ScopedLock lock(_moduleMutex);
+        std::unique_lock lock(_moduleMutex);
 
         log_debug << "All modules deleted, count: " << _modules.size();
         _modules.clear();
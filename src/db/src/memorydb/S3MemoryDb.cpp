@@ -6,10 +6,17 @@
 
 namespace AwsMock::Database {
 
-    Poco::Mutex S3MemoryDb::_bucketMutex;
-    Poco::Mutex S3MemoryDb::_objectMutex;
+    std::shared_mutex S3MemoryDb::_bucketMutex;
+    std::shared_mutex S3MemoryDb::_objectMutex;
+    std::shared_mutex S3MemoryDb::_uploadMutex;
+
+    void S3MemoryDb::OpenJournal() {
+        _journal.Open([this](const bsoncxx::document::view &record) { ReplayRecord(record); },
+                      [this](const MemoryDbJournal::WriteFunction &write) { WriteSnapshot(write); });
+    }
 
     bool S3MemoryDb::BucketExists(const std::string &region, const std::string &name) {
+        std::shared_lock lock(_bucketMutex);
 
         return find_if(_buckets.begin(),
                        _buckets.end(),
@@ -23,6 +30,7 @@ namespace AwsMock::Database {
     }
 
     Entity::S3::Bucket S3MemoryDb::GetBucketById(const std::string &oid) {
+        std::shared_lock lock(_bucketMutex);
 
         auto
                 it = find_if(_buckets.begin(), _buckets.end(), [oid](const std::pair<std::string, Entity::S3::Bucket> &bucket) {
@@ -30,13 +38,13 @@ namespace AwsMock::Database {
                 });
 
         if (it != _buckets.end()) {
-            it->second.oid = oid;
             return it->second;
         }
         return {};
     }
 
     Entity::S3::Bucket S3MemoryDb::GetBucketByRegionName(const std::string &region, const std::string &name) {
+        std::shared_lock lock(_bucketMutex);
 
         Entity::S3::Bucket result;
 
@@ -47,22 +55,25 @@ namespace AwsMock::Database {
                           });
 
         if (it != _buckets.end()) {
-            it->second.oid = it->first;
             return it->second;
         }
         return {};
     }
 
     Entity::S3::Bucket S3MemoryDb::CreateBucket(const Entity::S3::Bucket &bucket) {
-        Poco::ScopedLock lock(_bucketMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_bucketMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _buckets[oid] = bucket;
+        _buckets[oid].oid = oid;
+        transaction.Put("bucket", oid, bucket);
         log_trace << "Bucket created, oid: " << oid;
-        return GetBucketById(oid);
+        return _buckets[oid];
     }
 
     Entity::S3::BucketList S3MemoryDb::ListBuckets() {
+        std::shared_lock lock(_bucketMutex);
 
         Entity::S3::BucketList bucketList;
         for (const auto &bucket: _buckets) {
@@ -74,6 +85,7 @@ namespace AwsMock::Database {
     }
 
     bool S3MemoryDb::HasObjects(const Entity::S3::Bucket &bucket) {
+        std::shared_lock lock(_objectMutex);
 
         long count = 0;
         for (const auto &object: _objects) {
@@ -85,6 +97,7 @@ namespace AwsMock::Database {
     }
 
     std::vector<Entity::S3::Object> S3MemoryDb::GetBucketObjectList(const std::string &region, const std::string &bucket, long maxKeys) {
+        std::shared_lock lock(_objectMutex);
 
         std::vector<Entity::S3::Object> objectList;
         for (const auto &object: _objects) {
@@ -98,38 +111,79 @@ namespace AwsMock::Database {
     }
 
     long S3MemoryDb::BucketCount() {
+        std::shared_lock lock(_bucketMutex);
 
         return static_cast<long>(_buckets.size());
     }
 
     Entity::S3::ObjectList S3MemoryDb::ListBucket(const std::string &bucket, const std::string &prefix) {
+        std::shared_lock lock(_objectMutex);
 
         Entity::S3::ObjectList objectList;
 
-        if (prefix.empty()) {
-
-            for (const auto &object: _objects) {
-                if (object.second.bucket == bucket) {
-                    objectList.emplace_back(object.second);
+        auto bucketIt = _objectKeys.find(bucket);
+        if (bucketIt != _objectKeys.end()) {
+            for (auto it = bucketIt->second.lower_bound(prefix); it != bucketIt->second.end() && it->first.starts_with(prefix); ++it) {
+                for (const auto &oid: it->second) {
+                    objectList.emplace_back(_objects.at(oid));
                 }
             }
+        }
 
-        } else {
+        log_trace << "Got object list, size: " << objectList.size();
+        return objectList;
+    }
 
-            for (const auto &object: _objects) {
-                if (object.second.bucket == bucket && Core::StringUtils::StartsWith(object.second.key, prefix)) {
-                    objectList.emplace_back(object.second);
+    Entity::S3::ObjectList S3MemoryDb::ListBucket(const std::string &bucket, const std::string &prefix, const std::string &delimiter, const std::string &startAfter, long maxKeys, std::vector<std::string> &commonPrefixes, bool &isTruncated) {
+        std::shared_lock lock(_objectMutex);
+
+        Entity::S3::ObjectList objectList;
+        isTruncated = false;
+
+        auto bucketIt = _objectKeys.find(bucket);
+        if (bucketIt == _objectKeys.end()) {
+            return objectList;
+        }
+        const auto &keys = bucketIt->second;
+
+        long count = 0;
+        auto it = startAfter < prefix ? keys.lower_bound(prefix) : keys.upper_bound(startAfter);
+        while (it != keys.end() && it->first.starts_with(prefix)) {
+
+            // Roll up into a common prefix and skip all keys of the common prefix
+            std::string::size_type pos = delimiter.empty() ? std::string::npos : it->first.find(delimiter, prefix.size());
+            if (pos != std::string::npos) {
+                std::string commonPrefix = it->first.substr(0, pos + delimiter.size());
+                if (commonPrefix > startAfter) {
+                    if (count == maxKeys) {
+                        isTruncated = true;
+                        break;
+                    }
+                    commonPrefixes.emplace_back(commonPrefix);
+                    count++;
                 }
+                std::string successor = Core::StringUtils::PrefixSuccessor(commonPrefix);
+                it = successor.empty() ? keys.end() : keys.lower_bound(successor);
+                continue;
+            }
+
+            if (count == maxKeys) {
+                isTruncated = true;
+                break;
             }
+            objectList.emplace_back(LatestObject(it->second));
+            count++;
+            ++it;
         }
 
-        log_trace << "Got object list, size: " << objectList.size();
+        log_trace << "Got object page, size: " << objectList.size() << " commonPrefixes: " << commonPrefixes.size() << " truncated: " << std::boolalpha << isTruncated;
         return objectList;
     }
 
     Entity::S3::Bucket S3MemoryDb::UpdateBucket(const Entity::S3::Bucket &bucket) {
 
-        Poco::ScopedLock lock(_bucketMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_bucketMutex);
 
         std::string region = bucket.region;
         std::string name = bucket.name;
@@ -138,30 +192,40 @@ namespace AwsMock::Database {
                           [region, name](const std::pair<std::string, Entity::S3::Bucket> &bucket) {
                               return bucket.second.region == region && bucket.second.name == name;
                           });
-        _buckets[it->first] = bucket;
-        return _buckets[it->first];
+        it->second = bucket;
+        it->second.oid = it->first;
+        transaction.Put("bucket", it->first, bucket);
+        return it->second;
     }
 
     void S3MemoryDb::DeleteBucket(const Entity::S3::Bucket &bucket) {
-        Poco::ScopedLock lock(_bucketMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_bucketMutex);
 
         std::string region = bucket.region;
         std::string name = bucket.name;
-        const auto count = std::erase_if(_buckets, [region, name](const auto &item) {
+        const auto count = std::erase_if(_buckets, [region, name, &transaction](const auto &item) {
             auto const &[key, value] = item;
-            return value.region == region && value.name == name;
+            if (value.region == region && value.name == name) {
+                transaction.Delete("bucket", key);
+                return true;
+            }
+            return false;
         });
         log_debug << "Bucket deleted, count: " << count;
     }
 
     void S3MemoryDb::DeleteAllBuckets() {
-        Poco::ScopedLock lock(_bucketMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_bucketMutex);
 
         log_debug << "All buckets deleted, count: " << _buckets.size();
         _buckets.clear();
+        transaction.Clear("bucket");
     }
 
     bool S3MemoryDb::ObjectExists(const Entity::S3::Object &object) {
+        std::shared_lock lock(_objectMutex);
 
         std::string region = object.region;
         std::string bucket = object.bucket;
@@ -174,6 +238,7 @@ namespace AwsMock::Database {
     }
 
     bool S3MemoryDb::ObjectExists(const std::string &filename) {
+        std::shared_lock lock(_objectMutex);
 
         return find_if(_objects.begin(),
                        _objects.end(),
@@ -183,16 +248,21 @@ namespace AwsMock::Database {
     }
 
     Entity::S3::Object S3MemoryDb::CreateObject(const Entity::S3::Object &object) {
-        Poco::ScopedLock lock(_objectMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_objectMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _objects[oid] = object;
+        _objects[oid].oid = oid;
+        IndexObject(oid, object);
+        transaction.Put("object", oid, object);
         log_trace << "Object created, oid: " << oid;
-        return GetObjectById(oid);
+        return _objects[oid];
     }
 
     Entity::S3::Object S3MemoryDb::UpdateObject(const Entity::S3::Object &object) {
-        Poco::ScopedLock lock(_objectMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_objectMutex);
 
         std::string bucket = object.bucket;
         std::string key = object.key;
@@ -201,11 +271,20 @@ namespace AwsMock::Database {
                           [bucket, key](const std::pair<std::string, Entity::S3::Object> &object) {
                               return object.second.bucket == bucket && object.second.key == key;
                           });
-        _objects[it->first] = object;
-        return _objects[it->first];
+        if (it == _objects.end()) {
+            log_warning << "Object not found, bucket: " << bucket << " key: " << key;
+            return object;
+        }
+        UnindexObject(it->first, it->second);
+        it->second = object;
+        it->second.oid = it->first;
+        IndexObject(it->first, it->second);
+        transaction.Put("object", it->first, object);
+        return it->second;
     }
 
     Entity::S3::Object S3MemoryDb::GetObjectById(const std::string &oid) {
+        std::shared_lock lock(_objectMutex);
 
         auto
                 it = find_if(_objects.begin(), _objects.end(), [oid](const std::pair<std::string, Entity::S3::Object> &object) {
@@ -213,13 +292,13 @@ namespace AwsMock::Database {
                 });
 
         if (it != _objects.end()) {
-            it->second.oid = oid;
             return it->second;
         }
         return {};
     }
 
     Entity::S3::Object S3MemoryDb::GetObject(const std::string &region, const std::string &bucket, const std::string &key) {
+        std::shared_lock lock(_objectMutex);
 
         auto it = find_if(_objects.begin(),
                           _objects.end(),
@@ -228,13 +307,13 @@ namespace AwsMock::Database {
                           });
 
         if (it != _objects.end()) {
-            it->second.oid = it->first;
             return it->second;
         }
         return {};
     }
 
     Entity::S3::Object S3MemoryDb::GetObjectMd5(const std::string &region, const std::string &bucket, const std::string &key, const std::string &md5sum) {
+        std::shared_lock lock(_objectMutex);
 
         auto it = find_if(_objects.begin(),
                           _objects.end(),
@@ -243,13 +322,13 @@ namespace AwsMock::Database {
                           });
 
         if (it != _objects.end()) {
-            it->second.oid = it->first;
             return it->second;
         }
         return {};
     }
 
     long S3MemoryDb::ObjectCount(const std::string &region, const std::string &bucket) {
+        std::shared_lock lock(_objectMutex);
 
         if (region.empty() && bucket.empty()) {
             return static_cast<long>(_objects.size());
@@ -269,6 +348,7 @@ namespace AwsMock::Database {
     }
 
     Entity::S3::ObjectList S3MemoryDb::ListObjects(const std::string &prefix) {
+        std::shared_lock lock(_objectMutex);
 
         Entity::S3::ObjectList objectList;
         if (prefix.empty()) {
@@ -287,34 +367,278 @@ namespace AwsMock::Database {
         return objectList;
     }
 
+    Entity::S3::ObjectList S3MemoryDb::ListObjectsAfter(const std::string &startAfter, long maxKeys) {
+        std::shared_lock lock(_objectMutex);
+
+        Entity::S3::ObjectList objectList;
+        for (auto it = _objects.upper_bound(startAfter); it != _objects.end() && static_cast<long>(objectList.size()) < maxKeys; ++it) {
+            objectList.emplace_back(it->second);
+        }
+
+        log_trace << "Got object page, size: " << objectList.size();
+        return objectList;
+    }
+
     void S3MemoryDb::DeleteObject(const Entity::S3::Object &object) {
-        Poco::ScopedLock lock(_objectMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_objectMutex);
 
-        std::string bucket = object.bucket;
-        std::string key = object.key;
-        const auto count = std::erase_if(_objects, [bucket, key](const auto &item) {
-            auto const &[k, v] = item;
-            return v.bucket == bucket && v.key == key;
-        });
+        long count = 0;
+        auto bucketIt = _objectKeys.find(object.bucket);
+        if (bucketIt != _objectKeys.end()) {
+            auto keyIt = bucketIt->second.find(object.key);
+            if (keyIt != bucketIt->second.end()) {
+                std::vector<std::string> oids = keyIt->second;
+                for (const auto &oid: oids) {
+                    UnindexObject(oid, _objects[oid]);
+                    _objects.erase(oid);
+                    transaction.Delete("object", oid);
+                    count++;
+                }
+            }
+        }
         log_debug << "Object deleted, count: " << count;
     }
 
     void S3MemoryDb::DeleteObjects(const std::string &bucket, const std::vector<std::string> &keys) {
-        Poco::ScopedLock lock(_objectMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_objectMutex);
 
-        auto count = 0;
+        long count = 0;
         for (const auto &key: keys) {
-            count += std::erase_if(_objects, [bucket, key](const auto &item) {
-                auto const &[k, v] = item;
-                return v.bucket == bucket && v.key == key;
-            });
+            auto bucketIt = _objectKeys.find(bucket);
+            if (bucketIt == _objectKeys.end()) {
+                break;
+            }
+            auto keyIt = bucketIt->second.find(key);
+            if (keyIt == bucketIt->second.end()) {
+                continue;
+            }
+            std::vector<std::string> oids = keyIt->second;
+            for (const auto &oid: oids) {
+                UnindexObject(oid, _objects[oid]);
+                _objects.erase(oid);
+                transaction.Delete("object", oid);
+                count++;
+            }
+        }
+        log_debug << "Objects deleted, count: " << count;
+    }
+
+    void S3MemoryDb::DeleteObjects(const Entity::S3::ObjectList &objects) {
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_objectMutex);
+
+        long count = 0;
+        for (const auto &object: objects) {
+            auto it = _objects.find(object.oid);
+            if (it == _objects.end() || it->second.internalName != object.internalName) {
+                continue;
+            }
+            UnindexObject(it->first, it->second);
+            transaction.Delete("object", it->first);
+            _objects.erase(it);
+            count++;
         }
         log_debug << "Objects deleted, count: " << count;
     }
 
     void S3MemoryDb::DeleteAllObjects() {
-        Poco::ScopedLock lock(_objectMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_objectMutex);
 
         _objects.clear();
+        _objectKeys.clear();
+        transaction.Clear("object");
+    }
+
+    Entity::S3::MultipartUpload S3MemoryDb::CreateMultipartUpload(const Entity::S3::MultipartUpload &upload) {
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_uploadMutex);
+
+        Entity::S3::MultipartUpload &result = _uploads[upload.uploadId];
+        result = upload;
+        result.oid = Poco::UUIDGenerator().createRandom().toString();
+        transaction.Put("upload", upload.uploadId, upload);
+        log_trace << "Multipart upload created, uploadId: " << upload.uploadId;
+        return result;
+    }
+
+    Entity::S3::MultipartUpload S3MemoryDb::GetMultipartUpload(const std::string &uploadId) {
+        std::shared_lock lock(_uploadMutex);
+
+        auto it = _uploads.find(uploadId);
+        if (it != _uploads.end()) {
+            return it->second;
+        }
+        return {};
+    }
+
+    Entity::S3::MultipartPart S3MemoryDb::AddMultipartPart(const std::string &uploadId, const Entity::S3::MultipartPart &part) {
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_uploadMutex);
+
+        auto it = _uploads.find(uploadId);
+        if (it == _uploads.end()) {
+            log_error << "Multipart upload not found, uploadId: " << uploadId;
+            throw Core::DatabaseException("Multipart upload not found, uploadId: " + uploadId);
+        }
+
+        Entity::S3::MultipartPart replaced;
+        auto partIt = it->second.parts.find(part.partNumber);
+        if (partIt != it->second.parts.end()) {
+            replaced = partIt->second;
+        }
+        it->second.parts[part.partNumber] = part;
+        it->second.modified = part.modified;
+
+        auto document = part.ToDocument();
+        transaction.Update("upload", uploadId, document.view());
+        log_trace << "Multipart part added, uploadId: " << uploadId << " part: " << part.partNumber;
+        return replaced;
+    }
+
+    void S3MemoryDb::DeleteMultipartUpload(const std::string &uploadId) {
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_uploadMutex);
+
+        if (_uploads.erase(uploadId) > 0) {
+            transaction.Delete("upload", uploadId);
+        }
+        log_debug << "Multipart upload deleted, uploadId: " << uploadId;
+    }
+
+    void S3MemoryDb::ReplayRecord(const bsoncxx::document::view &record) {
+
+        std::string op = MemoryDbJournal::GetField(record, "op");
+        std::string type = MemoryDbJournal::GetField(record, "type");
+        std::string key = MemoryDbJournal::GetField(record, "key");
+
+        if (type == "bucket") {
+
+            std::unique_lock lock(_bucketMutex);
+            if (op == "put") {
+                Entity::S3::Bucket bucket;
+                bucket.FromDocument(MemoryDbJournal::GetValue(record));
+                bucket.oid = key;
+                _buckets[key] = bucket;
+            } else if (op == "delete") {
+                _buckets.erase(key);
+            } else if (op == "clear") {
+                _buckets.clear();
+            }
+
+        } else if (type == "object") {
+
+            std::unique_lock lock(_objectMutex);
+            if (op == "put") {
+                Entity::S3::Object object;
+                object.FromDocument(MemoryDbJournal::GetValue(record));
+                object.oid = key;
+                auto it = _objects.find(key);
+                if (it != _objects.end()) {
+                    UnindexObject(key, it->second);
+                }
+                _objects[key] = object;
+                IndexObject(key, object);
+            } else if (op == "delete") {
+                auto it = _objects.find(key);
+                if (it != _objects.end()) {
+                    UnindexObject(key, it->second);
+                    _objects.erase(it);
+                }
+            } else if (op == "clear") {
+                _objects.clear();
+                _objectKeys.clear();
+            }
+
+        } else if (type == "upload") {
+
+            std::unique_lock lock(_uploadMutex);
+            if (op == "put") {
+                Entity::S3::MultipartUpload upload;
+                upload.FromDocument(MemoryDbJournal::GetValue(record));
+                _uploads[key] = upload;
+            } else if (op == "update") {
+                auto it = _uploads.find(key);
+                if (it != _uploads.end()) {
+                    Entity::S3::MultipartPart part;
+                    part.FromDocument(MemoryDbJournal::GetValue(record));
+                    it->second.parts[part.partNumber] = part;
+                    it->second.modified = part.modified;
+                }
+            } else if (op == "delete") {
+                _uploads.erase(key);
+            }
+        }
+    }
+
+    void S3MemoryDb::WriteSnapshot(const MemoryDbJournal::WriteFunction &write) {
+
+        std::map<std::string, Entity::S3::Bucket> buckets;
+        {
+            std::shared_lock lock(_bucketMutex);
+            buckets = _buckets;
+        }
+        for (const auto &[oid, bucket]: buckets) {
+            auto document = bucket.ToDocument();
+            write(MemoryDbJournal::PutRecord("bucket", oid, document.view()));
+        }
+
+        std::map<std::string, Entity::S3::Object> objects;
+        {
+            std::shared_lock lock(_objectMutex);
+            objects = _objects;
+        }
+        for (const auto &[oid, object]: objects) {
+            auto document = object.ToDocument();
+            write(MemoryDbJournal::PutRecord("object", oid, document.view()));
+        }
+
+        std::map<std::string, Entity::S3::MultipartUpload> uploads;
+        {
+            std::shared_lock lock(_uploadMutex);
+            uploads = _uploads;
+        }
+        for (const auto &[uploadId, upload]: uploads) {
+            auto document = upload.ToDocument();
+            write(MemoryDbJournal::PutRecord("upload", uploadId, document.view()));
+        }
+    }
+
+    void S3MemoryDb::IndexObject(const std::string &oid, const Entity::S3::Object &object) {
+
+        _objectKeys[object.bucket][object.key].emplace_back(oid);
+    }
+
+    void S3MemoryDb::UnindexObject(const std::string &oid, const Entity::S3::Object &object) {
+
+        auto bucketIt = _objectKeys.find(object.bucket);
+        if (bucketIt == _objectKeys.end()) {
+            return;
+        }
+        auto keyIt = bucketIt->second.find(object.key);
+        if (keyIt == bucketIt->second.end()) {
+            return;
+        }
+        std::erase(keyIt->second, oid);
+        if (keyIt->second.empty()) {
+            bucketIt->second.erase(keyIt);
+        }
+        if (bucketIt->second.empty()) {
+            _objectKeys.erase(bucketIt);
+        }
+    }
+
+    const Entity::S3::Object &S3MemoryDb::LatestObject(const std::vector<std::string> &oids) const {
+
+        const Entity::S3::Object *latest = &_objects.at(oids.front());
+        for (const auto &oid: oids) {
+            const Entity::S3::Object &object = _objects.at(oid);
+            if (object.modified > latest->modified) {
+                latest = &object;
+            }
+        }
+        return *latest;
     }
 }// namespace AwsMock::Database
\ No newline at end of file
@@ -6,10 +6,16 @@
 
 namespace AwsMock::Database {
 
-    Poco::Mutex SNSMemoryDb::_snsTopicMutex;
-    Poco::Mutex SNSMemoryDb::_snsMessageMutex;
+    std::shared_mutex SNSMemoryDb::_snsTopicMutex;
+    std::shared_mutex SNSMemoryDb::_snsMessageMutex;
+
+    void SNSMemoryDb::OpenJournal() {
+        _journal.Open([this](const bsoncxx::document::view &record) { ReplayRecord(record); },
+                      [this](const MemoryDbJournal::WriteFunction &write) { WriteSnapshot(write); });
+    }
 
     bool SNSMemoryDb::TopicExists(const std::string &region, const std::string &name) {
+        std::shared_lock lock(_snsTopicMutex);
 
         return find_if(_topics.begin(),
                        _topics.end(),
@@ -19,6 +25,7 @@ namespace AwsMock::Database {
     }
 
     bool SNSMemoryDb::TopicExists(const std::string &arn) {
+        std::shared_lock lock(_snsTopicMutex);
 
         return find_if(_topics.begin(), _topics.end(), [arn](const std::pair<std::string, Entity::SNS::Topic> &topic) {
                    return topic.second.topicArn == arn;
@@ -26,13 +33,13 @@ namespace AwsMock::Database {
     }
 
     Entity::SNS::Topic SNSMemoryDb::GetTopicById(const std::string &oid) {
+        std::shared_lock lock(_snsTopicMutex);
 
         auto it = find_if(_topics.begin(), _topics.end(), [oid](const std::pair<std::string, Entity::SNS::Topic> &topic) {
             return topic.first == oid;
         });
 
         if (it != _topics.end()) {
-            it->second.oid = oid;
             return it->second;
         }
 
@@ -41,6 +48,7 @@ namespace AwsMock::Database {
     }
 
     Entity::SNS::Topic SNSMemoryDb::GetTopicByArn(const std::string &topicArn) {
+        std::shared_lock lock(_snsTopicMutex);
 
         auto it =
                 find_if(_topics.begin(), _topics.end(), [topicArn](const std::pair<std::string, Entity::SNS::Topic> &topic) {
@@ -48,7 +56,6 @@ namespace AwsMock::Database {
                 });
 
         if (it != _topics.end()) {
-            it->second.oid = it->first;
             return it->second;
         }
         log_warning << "Topic not found, topicArn: " << topicArn;
@@ -56,6 +63,7 @@ namespace AwsMock::Database {
     }
 
     Entity::SNS::Topic SNSMemoryDb::GetTopicByName(const std::string &region, const std::string &topicName) {
+        std::shared_lock lock(_snsTopicMutex);
 
         auto it =
                 find_if(_topics.begin(), _topics.end(), [region, topicName](const std::pair<std::string, Entity::SNS::Topic> &topic) {
@@ -63,7 +71,6 @@ namespace AwsMock::Database {
                 });
 
         if (it != _topics.end()) {
-            it->second.oid = it->first;
             return it->second;
         }
 
@@ -72,6 +79,7 @@ namespace AwsMock::Database {
     }
 
     Entity::SNS::TopicList SNSMemoryDb::GetTopicsBySubscriptionArn(const std::string &subscriptionArn) {
+        std::shared_lock lock(_snsTopicMutex);
 
         Entity::SNS::TopicList topics;
         for (const auto &topic: _topics) {
@@ -90,16 +98,20 @@ namespace AwsMock::Database {
     }
 
     Entity::SNS::Topic SNSMemoryDb::CreateTopic(const Entity::SNS::Topic &topic) {
-        Poco::ScopedLock loc(_snsTopicMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_snsTopicMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _topics[oid] = topic;
+        _topics[oid].oid = oid;
+        transaction.Put("topic", oid, topic);
         log_trace << "Topic created, oid: " << oid;
-        return GetTopicById(oid);
+        return _topics[oid];
     }
 
     Entity::SNS::Topic SNSMemoryDb::UpdateTopic(const Entity::SNS::Topic &topic) {
-        Poco::ScopedLock loc(_snsTopicMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_snsTopicMutex);
 
         std::string region = topic.region;
         std::string name = topic.topicName;
@@ -108,11 +120,14 @@ namespace AwsMock::Database {
                           [region, name](const std::pair<std::string, Entity::SNS::Topic> &topic) {
                               return topic.second.region == region && topic.second.topicName == name;
                           });
-        _topics[it->first] = topic;
-        return _topics[it->first];
+        it->second = topic;
+        it->second.oid = it->first;
+        transaction.Put("topic", it->first, topic);
+        return it->second;
     }
 
     Entity::SNS::TopicList SNSMemoryDb::ListTopics(const std::string &region) {
+        std::shared_lock lock(_snsTopicMutex);
 
         Entity::SNS::TopicList topicList;
         if (region.empty()) {
@@ -135,6 +150,7 @@ namespace AwsMock::Database {
     }
 
     long SNSMemoryDb::CountTopics(const std::string &region) {
+        std::shared_lock lock(_snsTopicMutex);
 
         long count = 0;
         if (region.empty()) {
@@ -153,25 +169,33 @@ namespace AwsMock::Database {
     }
 
     void SNSMemoryDb::DeleteTopic(const Entity::SNS::Topic &topic) {
-        Poco::ScopedLock loc(_snsTopicMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_snsTopicMutex);
 
         std::string region = topic.region;
         std::string arn = topic.topicArn;
-        const auto count = std::erase_if(_topics, [region, arn](const auto &item) {
+        const auto count = std::erase_if(_topics, [region, arn, &transaction](const auto &item) {
             auto const &[key, value] = item;
-            return value.region == region && value.topicArn == arn;
+            if (value.region == region && value.topicArn == arn) {
+                transaction.Delete("topic", key);
+                return true;
+            }
+            return false;
         });
         log_debug << "Topic deleted, count: " << count;
     }
 
     void SNSMemoryDb::DeleteAllTopics() {
-        Poco::ScopedLock loc(_snsTopicMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_snsTopicMutex);
 
         log_debug << "All topics deleted, count: " << _topics.size();
         _topics.clear();
+        transaction.Clear("topic");
     }
 
     bool SNSMemoryDb::MessageExists(const std::string &id) {
+        std::shared_lock lock(_snsMessageMutex);
 
         return find_if(_messages.begin(), _messages.end(), [id](const std::pair<std::string, Entity::SNS::Message> &message) {
                    return message.first == id;
@@ -179,15 +203,19 @@ namespace AwsMock::Database {
     }
 
     Entity::SNS::Message SNSMemoryDb::CreateMessage(const Entity::SNS::Message &message) {
-        Poco::ScopedLock loc(_snsMessageMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_snsMessageMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _messages[oid] = message;
+        _messages[oid].oid = oid;
+        transaction.Put("message", oid, message);
         log_trace << "Message created, oid: " << oid;
-        return GetMessageById(oid);
+        return _messages[oid];
     }
 
     Entity::SNS::Message SNSMemoryDb::GetMessageById(const std::string &oid) {
+        std::shared_lock lock(_snsMessageMutex);
 
         auto it =
                 find_if(_messages.begin(), _messages.end(), [oid](const std::pair<std::string, Entity::SNS::Message> &message) {
@@ -195,13 +223,13 @@ namespace AwsMock::Database {
                 });
 
         if (it != _messages.end()) {
-            it->second.oid = oid;
             return it->second;
         }
         return {};
     }
 
     long SNSMemoryDb::CountMessages(const std::string &region, const std::string &topicArn) {
+        std::shared_lock lock(_snsMessageMutex);
 
         long count = 0;
         for (const auto &message: _messages) {
@@ -219,6 +247,7 @@ namespace AwsMock::Database {
     }
 
     long SNSMemoryDb::CountMessagesByStatus(const std::string &region, const std::string &topicArn, Entity::SNS::MessageStatus status) {
+        std::shared_lock lock(_snsMessageMutex);
 
         long count = 0;
         for (const auto &message: _messages) {
@@ -230,6 +259,7 @@ namespace AwsMock::Database {
     }
 
     Entity::SNS::MessageList SNSMemoryDb::ListMessages(const std::string &region) {
+        std::shared_lock lock(_snsMessageMutex);
 
         Entity::SNS::MessageList messageList;
         if (region.empty()) {
@@ -252,60 +282,139 @@ namespace AwsMock::Database {
     }
 
     Entity::SNS::Message SNSMemoryDb::UpdateMessage(Entity::SNS::Message &message) {
-        Poco::ScopedLock lock(_snsMessageMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_snsMessageMutex);
 
         std::string oid = message.oid;
         auto it =
                 find_if(_messages.begin(), _messages.end(), [oid](const std::pair<std::string, Entity::SNS::Message> &message) {
                     return message.second.oid == oid;
                 });
-        _messages[it->first] = message;
-        return _messages[it->first];
+        it->second = message;
+        it->second.oid = it->first;
+        transaction.Put("message", it->first, message);
+        return it->second;
     }
 
     void SNSMemoryDb::DeleteMessage(const Entity::SNS::Message &message) {
-        Poco::ScopedLock loc(_snsMessageMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_snsMessageMutex);
 
         std::string messageId = message.messageId;
-        const auto count = std::erase_if(_messages, [messageId](const auto &item) {
+        const auto count = std::erase_if(_messages, [messageId, &transaction](const auto &item) {
             auto const &[key, value] = item;
-            return value.messageId == messageId;
+            if (value.messageId == messageId) {
+                transaction.Delete("message", key);
+                return true;
+            }
+            return false;
         });
         log_debug << "Message deleted, messageId: " << message.messageId << " count: " << count;
     }
 
     void SNSMemoryDb::DeleteMessages(const std::string &region, const std::string &topicArn, const std::vector<std::string> &messageIds) {
-        Poco::ScopedLock loc(_snsMessageMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_snsMessageMutex);
 
         long count = 0;
         for (auto &messageId: messageIds) {
-            count += static_cast<long>(std::erase_if(_messages, [region, topicArn, messageId](const auto &item) {
+            count += static_cast<long>(std::erase_if(_messages, [region, topicArn, messageId, &transaction](const auto &item) {
                 auto const &[key, value] = item;
-                return value.region == region && value.topicArn == topicArn && value.messageId == messageId;
+                if (value.region == region && value.topicArn == topicArn && value.messageId == messageId) {
+                    transaction.Delete("message", key);
+                    return true;
+                }
+                return false;
             }));
         }
         log_debug << "Messages deleted, count: " << count;
     }
 
     void SNSMemoryDb::DeleteOldMessages(long timeout) {
-        Poco::ScopedLock loc(_snsMessageMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_snsMessageMutex);
 
         auto reset = std::chrono::high_resolution_clock::now() - std::chrono::seconds{timeout};
 
         long count = 0;
         for (auto &messageId: _messages) {
-            count += static_cast<long>(std::erase_if(_messages, [reset](const auto &item) {
+            count += static_cast<long>(std::erase_if(_messages, [reset, &transaction](const auto &item) {
                 auto const &[key, value] = item;
-                return value.created < Poco::Timestamp(reset.time_since_epoch().count() / 1000);
+                if (value.created < Poco::Timestamp(reset.time_since_epoch().count() / 1000)) {
+                    transaction.Delete("message", key);
+                    return true;
+                }
+                return false;
             }));
         }
         log_debug << "Old resources deleted, timeout: " << timeout << " count: " << count;
     }
 
     void SNSMemoryDb::DeleteAllMessages() {
-        Poco::ScopedLock loc(_snsMessageMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(_snsMessageMutex);
 
         log_debug << "All resources deleted, count: " << _messages.size();
         _messages.clear();
+        transaction.Clear("message");
+    }
+
+    void SNSMemoryDb::ReplayRecord(const bsoncxx::document::view &record) {
+
+        std::string op = MemoryDbJournal::GetField(record, "op");
+        std::string type = MemoryDbJournal::GetField(record, "type");
+        std::string key = MemoryDbJournal::GetField(record, "key");
+
+        if (type == "topic") {
+
+            std::unique_lock lock(_snsTopicMutex);
+            if (op == "put") {
+                Entity::SNS::Topic topic;
+                topic.FromDocument(MemoryDbJournal::GetValue(record));
+                topic.oid = key;
+                _topics[key] = topic;
+            } else if (op == "delete") {
+                _topics.erase(key);
+            } else if (op == "clear") {
+                _topics.clear();
+            }
+
+        } else if (type == "message") {
+
+            std::unique_lock lock(_snsMessageMutex);
+            if (op == "put") {
+                Entity::SNS::Message message;
+                message.FromDocument(MemoryDbJournal::GetValue(record));
+                message.oid = key;
+                _messages[key] = message;
+            } else if (op == "delete") {
+                _messages.erase(key);
+            } else if (op == "clear") {
+                _messages.clear();
+            }
+        }
+    }
+
+    void SNSMemoryDb::WriteSnapshot(const MemoryDbJournal::WriteFunction &write) {
+
+        std::map<std::string, Entity::SNS::Topic> topics;
+        {
+            std::shared_lock lock(_snsTopicMutex);
+            topics = _topics;
+        }
+        for (const auto &[oid, topic]: topics) {
+            auto document = topic.ToDocument();
+            write(MemoryDbJournal::PutRecord("topic", oid, document.view()));
+        }
+
+        std::map<std::string, Entity::SNS::Message> messages;
+        {
+            std::shared_lock lock(_snsMessageMutex);
+            messages = _messages;
+        }
+        for (const auto &[oid, message]: messages) {
+            auto document = message.ToDocument();
+            write(MemoryDbJournal::PutRecord("message", oid, document.view()));
+        }
     }
 }// namespace AwsMock::Database
\ No newline at end of file
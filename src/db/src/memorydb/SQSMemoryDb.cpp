@@ -6,104 +6,90 @@
 
 namespace AwsMock::Database {
 
-    Poco::Mutex SQSMemoryDb::sqsQueueMutex;
-    Poco::Mutex SQSMemoryDb::_sqsMessageMutex;
+    std::shared_mutex SQSMemoryDb::sqsQueueMutex;
+    std::shared_mutex SQSMemoryDb::_sqsMessageMutex;
+
+    using bsoncxx::builder::basic::kvp;
+    using bsoncxx::builder::basic::make_document;
+
+    void SQSMemoryDb::OpenJournal() {
+        _journal.Open([this](const bsoncxx::document::view &record) { ReplayRecord(record); },
+                      [this](const MemoryDbJournal::WriteFunction &write) { WriteSnapshot(write); });
+    }
 
     bool SQSMemoryDb::QueueExists(const std::string &region, const std::string &name) {
+        std::shared_lock lock(sqsQueueMutex);
 
-        return find_if(_queues.begin(),
-                       _queues.end(),
-                       [region, name](const std::pair<std::string, Entity::SQS::Queue> &queue) {
-                           return queue.second.region == region && queue.second.name == name;
-                       }) != _queues.end();
+        return FindQueue(_queueNameIndex, QueueNameKey(region, name)) != _queues.end();
     }
 
     bool SQSMemoryDb::QueueUrlExists(const std::string &region, const std::string &queueUrl) {
+        std::shared_lock lock(sqsQueueMutex);
 
-        return find_if(_queues.begin(),
-                       _queues.end(),
-                       [region, queueUrl](const std::pair<std::string, Entity::SQS::Queue> &queue) {
-                           return queue.second.region == region && queue.second.queueUrl == queueUrl;
-                       }) != _queues.end();
+        return FindQueue(_queueUrlIndex, queueUrl, region) != _queues.end();
     }
 
     bool SQSMemoryDb::QueueArnExists(const std::string &queueArn) {
+        std::shared_lock lock(sqsQueueMutex);
 
-        return find_if(_queues.begin(), _queues.end(), [queueArn](const std::pair<std::string, Entity::SQS::Queue> &queue) {
-                   return queue.second.queueArn == queueArn;
-               }) != _queues.end();
+        return FindQueue(_queueArnIndex, queueArn) != _queues.end();
     }
 
     Entity::SQS::Queue SQSMemoryDb::CreateQueue(const Entity::SQS::Queue &queue) {
-        Poco::ScopedLock lock(sqsQueueMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(sqsQueueMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _queues[oid] = queue;
+        _queues[oid].oid = oid;
+        IndexQueue(oid, queue);
+        transaction.Put("queue", oid, queue);
         log_trace << "Queue created, oid: " << oid;
-        return GetQueueById(oid);
+        return _queues[oid];
     }
 
     Entity::SQS::Queue SQSMemoryDb::GetQueueById(const std::string &oid) {
+        std::shared_lock lock(sqsQueueMutex);
 
-        auto it = find_if(_queues.begin(), _queues.end(), [oid](const std::pair<std::string, Entity::SQS::Queue> &queue) {
-            return queue.first == oid;
-        });
-
+        auto it = _queues.find(oid);
         if (it != _queues.end()) {
-            it->second.oid = oid;
             return it->second;
         }
         return {};
     }
 
     Entity::SQS::Queue SQSMemoryDb::GetQueueByArn(const std::string &queueArn) {
+        std::shared_lock lock(sqsQueueMutex);
 
-        Entity::SQS::Queue result;
-
-        auto it =
-                find_if(_queues.begin(), _queues.end(), [queueArn](const std::pair<std::string, Entity::SQS::Queue> &queue) {
-                    return queue.second.queueArn == queueArn;
-                });
-
+        auto it = FindQueue(_queueArnIndex, queueArn);
         if (it != _queues.end()) {
-            it->second.oid = it->first;
             return it->second;
         }
         return {};
     }
 
     Entity::SQS::Queue SQSMemoryDb::GetQueueByUrl(const std::string &queueUrl) {
+        std::shared_lock lock(sqsQueueMutex);
 
-        Entity::SQS::Queue result;
-        auto it =
-                find_if(_queues.begin(), _queues.end(), [queueUrl](const std::pair<std::string, Entity::SQS::Queue> &queue) {
-                    return queue.second.queueUrl == queueUrl;
-                });
-
+        auto it = FindQueue(_queueUrlIndex, queueUrl);
         if (it != _queues.end()) {
-            it->second.oid = it->first;
             return it->second;
         }
         return {};
     }
 
     Entity::SQS::Queue SQSMemoryDb::GetQueueByName(const std::string &region, const std::string &name) {
+        std::shared_lock lock(sqsQueueMutex);
 
-        Entity::SQS::Queue result;
-        auto it = find_if(_queues.begin(),
-                          _queues.end(),
-                          [region, name](const std::pair<std::string, Entity::SQS::Queue> &queue) {
-                              return queue.second.region == region && queue.second.name == name;
-                          });
-
+        auto it = FindQueue(_queueNameIndex, QueueNameKey(region, name));
         if (it != _queues.end()) {
-            it->second.oid = it->first;
             return it->second;
         }
         return {};
     }
 
     Entity::SQS::QueueList SQSMemoryDb::ListQueues(const std::string &region) {
+        std::shared_lock lock(sqsQueueMutex);
 
         Entity::SQS::QueueList queueList;
         for (const auto &queue: _queues) {
@@ -115,30 +101,38 @@ namespace AwsMock::Database {
     }
 
     void SQSMemoryDb::PurgeQueue(const std::string &region, const std::string &queueUrl) {
-        Poco::ScopedLock lock(sqsQueueMutex);
 
-        const auto count = std::erase_if(_messages, [region, queueUrl](const auto &item) {
-            auto const &[key, value] = item;
-            return value.region == region && value.queueUrl == queueUrl;
-        });
+        std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+        if (!store) {
+            return;
+        }
+
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(store->mutex);
+        long count = ClearMessageStore(*store);
+        transaction.Clear("message", queueUrl);
         log_debug << "Purged queue, region: " << region << " queueUrl: " << queueUrl << " count: " << count;
     }
 
     Entity::SQS::Queue SQSMemoryDb::UpdateQueue(Entity::SQS::Queue &queue) {
-        Poco::ScopedLock lock(sqsQueueMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(sqsQueueMutex);
 
-        std::string region = queue.region;
-        std::string name = queue.name;
-        auto it = find_if(_queues.begin(),
-                          _queues.end(),
-                          [region, name](const std::pair<std::string, Entity::SQS::Queue> &queue) {
-                              return queue.second.region == region && queue.second.name == name;
-                          });
-        _queues[it->first] = queue;
-        return _queues[it->first];
+        auto it = FindQueue(_queueNameIndex, QueueNameKey(queue.region, queue.name));
+        if (it == _queues.end()) {
+            log_warning << "Queue not found, region: " << queue.region << " name: " << queue.name;
+            return queue;
+        }
+        UnindexQueue(it->first, it->second);
+        it->second = queue;
+        it->second.oid = it->first;
+        IndexQueue(it->first, it->second);
+        transaction.Put("queue", it->first, queue);
+        return it->second;
     }
 
     long SQSMemoryDb::CountQueues(const std::string &region) {
+        std::shared_lock lock(sqsQueueMutex);
 
         long count = 0;
 
@@ -158,99 +152,157 @@ namespace AwsMock::Database {
     }
 
     void SQSMemoryDb::DeleteQueue(const Entity::SQS::Queue &queue) {
-        Poco::ScopedLock lock(sqsQueueMutex);
+        MemoryDbJournal::Transaction transaction(_journal);
 
-        std::string region = queue.region;
-        std::string queueUrl = queue.queueUrl;
-        const auto count = std::erase_if(_queues, [region, queueUrl](const auto &item) {
-            auto const &[key, value] = item;
-            return value.region == region && value.queueUrl == queueUrl;
-        });
+        long count = 0;
+        {
+            std::unique_lock lock(sqsQueueMutex);
+            for (auto it = FindQueue(_queueUrlIndex, queue.queueUrl, queue.region); it != _queues.end(); it = FindQueue(_queueUrlIndex, queue.queueUrl, queue.region)) {
+                transaction.Delete("queue", it->first);
+                UnindexQueue(it->first, it->second);
+                _queues.erase(it);
+                count++;
+            }
+        }
+        if (count > 0) {
+            RemoveMessageStore(queue.queueUrl, transaction);
+        }
         log_debug << "Queue deleted, count: " << count;
     }
 
     void SQSMemoryDb::DeleteAllQueues() {
-        Poco::ScopedLock lock(sqsQueueMutex);
-
-        log_debug << "All queues deleted, count: " << _queues.size();
-        _queues.clear();
+        MemoryDbJournal::Transaction transaction(_journal);
+        {
+            std::unique_lock lock(sqsQueueMutex);
+
+            log_debug << "All queues deleted, count: " << _queues.size();
+            _queues.clear();
+            _queueUrlIndex.clear();
+            _queueArnIndex.clear();
+            _queueNameIndex.clear();
+            transaction.Clear("queue");
+        }
+        for (const auto &store: GetMessageStores()) {
+            RemoveMessageStore(store->queueUrl, transaction);
+        }
     }
 
     Entity::SQS::Message SQSMemoryDb::CreateMessage(const Entity::SQS::Message &message) {
-        Poco::ScopedLock lock(_sqsMessageMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
-        _messages[oid] = message;
+        std::shared_ptr<MessageStore> store = GetMessageStore(message.queueUrl, message.region, true);
+
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(store->mutex);
+        StoredMessage &stored = InsertMessage(*store, oid, message);
+        ScheduleMessage(*store, oid, stored);
+        transaction.Put("message", oid, stored.message, store->queueUrl);
         log_trace << "Message created, oid: " << oid;
 
-        return GetMessageById(oid);
+        return stored.message;
+    }
+
+    Entity::SQS::MessageList SQSMemoryDb::CreateMessages(const Entity::SQS::MessageList &messages) {
+
+        Entity::SQS::MessageList messageList;
+        if (messages.empty()) {
+            return messageList;
+        }
+
+        std::shared_ptr<MessageStore> store = GetMessageStore(messages.front().queueUrl, messages.front().region, true);
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(store->mutex);
+        for (const auto &message: messages) {
+            std::string oid = Poco::UUIDGenerator().createRandom().toString();
+            StoredMessage &stored = InsertMessage(*store, oid, message);
+            ScheduleMessage(*store, oid, stored);
+            transaction.Put("message", oid, stored.message, store->queueUrl);
+            messageList.emplace_back(stored.message);
+        }
+        log_trace << "Messages created, count: " << messageList.size();
+        return messageList;
     }
 
     bool SQSMemoryDb::MessageExists(const std::string &receiptHandle) {
+        std::shared_lock lock(_receiptHandleIndex.mutex);
 
-        return find_if(_messages.begin(),
-                       _messages.end(),
-                       [receiptHandle](const std::pair<std::string, Entity::SQS::Message> &message) {
-                           return message.second.receiptHandle == receiptHandle;
-                       }) != _messages.end();
+        return _receiptHandleIndex.queueUrls.contains(receiptHandle);
     }
 
     Entity::SQS::Message SQSMemoryDb::GetMessageById(const std::string &oid) {
 
-        auto it =
-                find_if(_messages.begin(), _messages.end(), [oid](const std::pair<std::string, Entity::SQS::Message> &message) {
-                    return message.first == oid;
-                });
-
-        if (it != _messages.end()) {
-            it->second.oid = it->first;
-            return it->second;
+        for (const auto &store: GetMessageStores()) {
+            std::shared_lock lock(store->mutex);
+            auto it = store->messages.find(oid);
+            if (it != store->messages.end()) {
+                return it->second.message;
+            }
         }
         return {};
     }
 
     Entity::SQS::Message SQSMemoryDb::GetMessageByReceiptHandle(const std::string &receiptHandle) {
 
-        Entity::SQS::Message result;
-        auto it = find_if(_messages.begin(),
-                          _messages.end(),
-                          [receiptHandle](const std::pair<std::string, Entity::SQS::Message> &message) {
-                              return message.second.receiptHandle == receiptHandle;
-                          });
-
-        if (it != _messages.end()) {
-            it->second.oid = it->first;
-            result = it->second;
+        if (std::shared_ptr<MessageStore> store = FindMessageStoreByReceiptHandle(receiptHandle)) {
+            std::shared_lock lock(store->mutex);
+            auto it = store->receiptHandles.find(receiptHandle);
+            if (it != store->receiptHandles.end()) {
+                auto messageIt = store->messages.find(it->second);
+                if (messageIt != store->messages.end()) {
+                    return messageIt->second.message;
+                }
+            }
         }
-        return result;
+        return {};
     }
 
     Entity::SQS::Message SQSMemoryDb::UpdateMessage(Entity::SQS::Message &message) {
-        Poco::ScopedLock lock(_sqsMessageMutex);
-
-        std::string oid = message.oid;
-        auto it =
-                find_if(_messages.begin(), _messages.end(), [oid](const std::pair<std::string, Entity::SQS::Message> &message) {
-                    return message.second.oid == oid;
-                });
-        _messages[it->first] = message;
-        return _messages[it->first];
-    }
 
-    Entity::SQS::MessageList SQSMemoryDb::ListMessages(const std::string &region) {
+        std::vector<std::shared_ptr<MessageStore>> stores;
+        if (std::shared_ptr<MessageStore> store = GetMessageStore(message.queueUrl)) {
+            stores.emplace_back(store);
+        }
+        std::vector<std::shared_ptr<MessageStore>> allStores = GetMessageStores();
+        stores.insert(stores.end(), allStores.begin(), allStores.end());
+
+        MemoryDbJournal::Transaction transaction(_journal);
+        for (const auto &store: stores) {
+            std::unique_lock lock(store->mutex);
+            auto it = store->messages.find(message.oid);
+            if (it == store->messages.end()) {
+                continue;
+            }
 
-        Entity::SQS::MessageList messageList;
-        if (region.empty()) {
+            // Receipt handle index
+            StoredMessage &stored = it->second;
+            if (stored.message.receiptHandle != message.receiptHandle) {
+                RemoveReceiptHandle(*store, stored.message.receiptHandle);
+                AddReceiptHandle(*store, message.receiptHandle, message.oid);
+            }
 
-            for (const auto &message: _messages) {
-                messageList.emplace_back(message.second);
+            // Reschedule, if status or deadline have changed
+            bool reschedule = stored.message.status != message.status || stored.message.reset != message.reset;
+            store->statusCounts[stored.message.status]--;
+            store->statusCounts[message.status]++;
+            stored.message = message;
+            if (reschedule) {
+                ScheduleMessage(*store, message.oid, stored);
             }
+            transaction.Put("message", message.oid, stored.message, store->queueUrl);
+            return stored.message;
+        }
+        log_warning << "Message not found, oid: " << message.oid;
+        return message;
+    }
 
-        } else {
+    Entity::SQS::MessageList SQSMemoryDb::ListMessages(const std::string &region) {
 
-            for (const auto &message: _messages) {
-                if (message.second.region == region) {
-                    messageList.emplace_back(message.second);
+        Entity::SQS::MessageList messageList;
+        for (const auto &store: GetMessageStores()) {
+            std::shared_lock lock(store->mutex);
+            for (const auto &[oid, stored]: store->messages) {
+                if (region.empty() || stored.message.region == region) {
+                    messageList.emplace_back(stored.message);
                 }
             }
         }
@@ -260,199 +312,807 @@ namespace AwsMock::Database {
     }
 
     void SQSMemoryDb::ReceiveMessages(const std::string &region, const std::string &queueUrl, int visibility, int maxMessages, Entity::SQS::MessageList &messageList) {
-        Poco::ScopedLock lock(_sqsMessageMutex);
 
-        auto reset = std::chrono::high_resolution_clock::now() + std::chrono::seconds{visibility};
+        std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+        if (!store || (!region.empty() && store->region != region)) {
+            return;
+        }
 
-        // Get the cursor
-        for (auto message: _messages) {
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(store->mutex);
 
-            if (message.second.region == region && message.second.queueUrl == queueUrl && message.second.status == Entity::SQS::MessageStatus::INITIAL) {
+        // Make expired messages visible
+        ProcessDeadlines(*store);
 
-                message.second.retries++;
-                message.second.receiptHandle = Core::AwsUtils::CreateSqsReceiptHandler();
-                messageList.push_back(message.second);
+        size_t received = messageList.size();
+        auto reset = std::chrono::system_clock::now() + std::chrono::seconds{visibility};
+        if (store->fifo) {
+            ReceiveGroupMessages(*store, maxMessages, reset, messageList);
+        }
 
-                // Update values
-                message.second.status = Entity::SQS::MessageStatus::INVISIBLE;
-                message.second.reset = reset;
+        while (!store->fifo && !store->ready.empty() && messageList.size() < maxMessages) {
 
-                // Update store
-                _messages[message.first] = message.second;
+            auto [oid, sequence] = store->ready.front();
+            store->ready.pop_front();
 
-                // Check max resources
-                if (messageList.size() >= maxMessages) {
-                    break;
-                }
+            auto it = store->messages.find(oid);
+            if (it == store->messages.end() || it->second.sequence != sequence) {
+                continue;
             }
+
+            ClaimMessage(*store, oid, it->second, reset);
+            messageList.push_back(it->second.message);
+        }
+
+        for (size_t i = received; i < messageList.size() && transaction.IsActive(); i++) {
+            JournalMessageState(transaction, store->queueUrl, messageList[i]);
         }
 
         log_trace << "Messages received, region: " << region << " queue: " << queueUrl + " count: " << messageList.size();
     }
 
     void SQSMemoryDb::ResetMessages(const std::string &queueUrl, long visibility) {
-        Poco::ScopedLock lock(_sqsMessageMutex);
 
-        long count = 0;
-        auto now = std::chrono::high_resolution_clock::now();
-        for (auto message: _messages) {
+        std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+        if (!store) {
+            return;
+        }
 
-            if (message.second.queueUrl == queueUrl && message.second.status == Entity::SQS::MessageStatus::INVISIBLE && message.second.reset < std::chrono::system_clock::now()) {
+        std::unique_lock lock(store->mutex);
+        long count = ProcessDeadlines(*store);
+        log_trace << "Message reset, visibilityTimeout: " << visibility << " updated: " << count << " queue: " << queueUrl;
+    }
 
-                // Reset status
-                message.second.status = Entity::SQS::MessageStatus::INITIAL;
-                message.second.receiptHandle = "";
+    std::chrono::system_clock::time_point SQSMemoryDb::GetNextMessageReset(const std::string &queueUrl) {
 
-                // Update store
-                _messages[message.first] = message.second;
-                count++;
-            }
-            log_trace << "Message reset, visibilityTimeout: " << visibility << " updated: " << count << " queue: " << queueUrl;
+        std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+        if (!store) {
+            return std::chrono::system_clock::time_point::max();
+        }
+
+        // Stale heap entries lead to an early answer only
+        std::shared_lock lock(store->mutex);
+        return store->deadlines.empty() ? std::chrono::system_clock::time_point::max() : store->deadlines.front().due;
+    }
+
+    std::chrono::system_clock::time_point SQSMemoryDb::GetNextMessageExpiry(const std::string &queueUrl, long retentionPeriod) {
+
+        std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+        if (!store) {
+            return std::chrono::system_clock::time_point::max();
+        }
+
+        // Drop deleted messages from the head of the creation list
+        std::unique_lock lock(store->mutex);
+        while (!store->created.empty() && !store->messages.contains(store->created.front().second)) {
+            store->created.pop_front();
         }
+        return store->created.empty() ? std::chrono::system_clock::time_point::max() : store->created.front().first + std::chrono::seconds{retentionPeriod};
     }
 
     void SQSMemoryDb::RedriveMessages(const std::string &queueUrl, const Entity::SQS::RedrivePolicy &redrivePolicy, const Core::Configuration &configuration) {
-        Poco::ScopedLock lock(_sqsMessageMutex);
 
-        long count = 0;
+        std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+        if (!store) {
+            return;
+        }
+
+        // Remove the messages from the source queue
+        MemoryDbJournal::Transaction transaction(_journal);
+        Entity::SQS::MessageList messages;
+        {
+            std::unique_lock lock(store->mutex);
+            ProcessDeadlines(*store);
+            while (!store->redrive.empty()) {
+                auto [oid, sequence] = store->redrive.front();
+                store->redrive.pop_front();
+
+                auto it = store->messages.find(oid);
+                if (it != store->messages.end() && it->second.sequence == sequence && it->second.message.retries > redrivePolicy.maxReceiveCount) {
+                    messages.emplace_back(it->second.message);
+                }
+            }
+            for (const auto &message: messages) {
+                EraseMessage(*store, message.oid);
+                transaction.Delete("message", message.oid, store->queueUrl);
+            }
+        }
+
+        // Add them to the dead letter queue, the source queue is not locked anymore, so that two queues are never locked at the same time
         std::string dlqQueueUrl = Core::AwsUtils::ConvertSQSQueueArnToUrl(redrivePolicy.deadLetterTargetArn);
-        for (auto message: _messages) {
+        if (!messages.empty()) {
+            std::shared_ptr<MessageStore> dlqStore = GetMessageStore(dlqQueueUrl, store->region, true);
+
+            std::unique_lock lock(dlqStore->mutex);
+            for (auto &message: messages) {
+                message.retries = 0;
+                message.queueUrl = dlqQueueUrl;
+                StoredMessage &stored = InsertMessage(*dlqStore, message.oid, message);
+                ScheduleMessage(*dlqStore, message.oid, stored);
+                transaction.Put("message", message.oid, stored.message, dlqStore->queueUrl);
+            }
+        }
+        log_trace << "Message redrive, arn: " << redrivePolicy.deadLetterTargetArn << " updated: " << messages.size() << " queue: " << queueUrl;
+    }
 
-            if (message.second.queueUrl == queueUrl && message.second.status == Entity::SQS::MessageStatus::INITIAL && message.second.retries > redrivePolicy.maxReceiveCount) {
+    void SQSMemoryDb::ResetDelayedMessages(const std::string &queueUrl, long delay) {
 
-                message.second.retries = 0;
-                message.second.queueUrl = dlqQueueUrl;
-                _messages[message.first] = message.second;
+        std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+        if (!store) {
+            return;
+        }
 
+        std::unique_lock lock(store->mutex);
+        long count = ProcessDeadlines(*store);
+        log_trace << "Delayed message reset, updated: " << count << " queue: " << queueUrl;
+    }
+
+    void SQSMemoryDb::MessageRetention(const std::string &queueUrl, long retentionPeriod) {
+
+        std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+        if (!store) {
+            return;
+        }
+
+        long count = 0;
+        auto reset = std::chrono::system_clock::now() - std::chrono::seconds{retentionPeriod};
+
+        MemoryDbJournal::Transaction transaction(_journal);
+        std::unique_lock lock(store->mutex);
+        while (!store->created.empty() && store->created.front().first < reset) {
+            if (EraseMessage(*store, store->created.front().second)) {
+                transaction.Delete("message", store->created.front().second, store->queueUrl);
                 count++;
             }
+            store->created.pop_front();
         }
-        log_trace << "Message redrive, arn: " << redrivePolicy.deadLetterTargetArn << " updated: " << count << " queue: " << queueUrl;
+        log_trace << "Message retention reset, deleted: " << count << " queue: " << queueUrl;
     }
 
-    void SQSMemoryDb::ResetDelayedMessages(const std::string &queueUrl, long delay) {
-        Poco::ScopedLock lock(_sqsMessageMutex);
+    long SQSMemoryDb::CountMessages(const std::string &region, const std::string &queueUrl) {
 
         long count = 0;
-        auto now = std::chrono::high_resolution_clock::now();
 
-        for (auto &message: _messages) {
+        if (!queueUrl.empty()) {
 
-            if (message.second.queueUrl == queueUrl && message.second.status == Entity::SQS::MessageStatus::DELAYED && message.second.reset < std::chrono::system_clock::now()) {
+            std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+            if (store && (region.empty() || store->region == region)) {
+                std::shared_lock lock(store->mutex);
+                count = static_cast<long>(store->messages.size());
+            }
 
-                message.second.status = Entity::SQS::MessageStatus::INITIAL;
-                _messages[message.first] = message.second;
+        } else {
 
-                count++;
+            for (const auto &store: GetMessageStores()) {
+                if (region.empty() || store->region == region) {
+                    std::shared_lock lock(store->mutex);
+                    count += static_cast<long>(store->messages.size());
+                }
             }
         }
-        log_trace << "Delayed message reset, updated: " << count << " queue: " << queueUrl;
+        log_trace << "Count resources, result: " << count;
+        return count;
     }
 
-    void SQSMemoryDb::MessageRetention(const std::string &queueUrl, long retentionPeriod) {
-        Poco::ScopedLock lock(_sqsMessageMutex);
+    long SQSMemoryDb::CountMessagesByStatus(const std::string &region, const std::string &queueUrl, Entity::SQS::MessageStatus status) {
 
         long count = 0;
-        auto reset = std::chrono::high_resolution_clock::now() - std::chrono::seconds{retentionPeriod};
 
-        for (auto &message: _messages) {
+        std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+        if (store && store->region == region) {
+            std::shared_lock lock(store->mutex);
+            auto it = store->statusCounts.find(status);
+            count = it == store->statusCounts.end() ? 0 : it->second;
+        }
+        log_trace << "Count resources by status, result: " << count;
+        return count;
+    }
 
-            if (message.second.queueUrl == queueUrl && message.second.status == Entity::SQS::MessageStatus::DELAYED && message.second.reset < std::chrono::system_clock::now()) {
+    void SQSMemoryDb::DeleteMessages(const std::string &queueUrl) {
 
-                DeleteMessage(message.second);
-                count++;
+        long count = 0;
+        std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+        if (store) {
+            MemoryDbJournal::Transaction transaction(_journal);
+            std::unique_lock lock(store->mutex);
+            count = ClearMessageStore(*store);
+            transaction.Clear("message", store->queueUrl);
+        }
+        log_debug << "Messages deleted, queue: " << queueUrl << " count: " << count;
+    }
+
+    void SQSMemoryDb::DeleteMessage(const Entity::SQS::Message &message) {
+
+        // Try the queue of the message first
+        std::shared_ptr<MessageStore> store = GetMessageStore(message.queueUrl);
+        if (store) {
+            MemoryDbJournal::Transaction transaction(_journal);
+            std::unique_lock lock(store->mutex);
+            auto it = store->receiptHandles.find(message.receiptHandle);
+            if (it != store->receiptHandles.end()) {
+                std::string oid = it->second;
+                EraseMessage(*store, oid);
+                transaction.Delete("message", oid, store->queueUrl);
+                log_debug << "Messages deleted, receiptHandle: " << message.receiptHandle << " count: 1";
+                return;
             }
         }
-        log_trace << "Message retention reset, deleted: " << count << " queue: " << queueUrl;
+        DeleteMessage(message.receiptHandle);
     }
 
-    long SQSMemoryDb::CountMessages(const std::string &region, const std::string &queueUrl) {
+    void SQSMemoryDb::DeleteMessage(const std::string &receiptHandle) {
 
         long count = 0;
+        std::shared_ptr<MessageStore> store = FindMessageStoreByReceiptHandle(receiptHandle);
+        if (store) {
+            MemoryDbJournal::Transaction transaction(_journal);
+            std::unique_lock lock(store->mutex);
+            auto it = store->receiptHandles.find(receiptHandle);
+            if (it != store->receiptHandles.end()) {
+                std::string oid = it->second;
+                count = EraseMessage(*store, oid) ? 1 : 0;
+                transaction.Delete("message", oid, store->queueUrl);
+            }
+        }
+        log_debug << "Messages deleted, receiptHandle: " << receiptHandle << " count: " << count;
+    }
 
-        if (region.empty() && queueUrl.empty()) {
+    std::vector<std::string> SQSMemoryDb::DeleteMessages(const std::string &queueUrl, const std::vector<std::string> &receiptHandles) {
 
-            count = (long) _messages.size();
+        std::vector<std::string> deleted;
+        MemoryDbJournal::Transaction transaction(_journal);
+        ForEachReceiptHandle(queueUrl, receiptHandles, [&deleted, &transaction](MessageStore &store, const std::string &receiptHandle, const std::string &oid) {
+            EraseMessage(store, oid);
+            transaction.Delete("message", oid, store.queueUrl);
+            deleted.emplace_back(receiptHandle);
+        });
+        log_debug << "Messages deleted, queueUrl: " << queueUrl << " count: " << deleted.size();
+        return deleted;
+    }
 
-        } else if (!region.empty() && !queueUrl.empty()) {
+    std::vector<std::string> SQSMemoryDb::ChangeMessageVisibilities(const std::string &queueUrl, const std::map<std::string, int> &visibilityTimeouts) {
 
-            std::map<std::string, Entity::SQS::Message>::iterator it;
-            for (it = _messages.begin(); it != _messages.end(); it++) {
-                if (it->second.region == region && it->second.queueUrl == queueUrl) {
-                    count++;
+        std::vector<std::string> receiptHandles;
+        for (const auto &[receiptHandle, visibilityTimeout]: visibilityTimeouts) {
+            receiptHandles.emplace_back(receiptHandle);
+        }
+
+        std::vector<std::string> changed;
+        auto now = std::chrono::system_clock::now();
+        MemoryDbJournal::Transaction transaction(_journal);
+        ForEachReceiptHandle(queueUrl, receiptHandles, [&changed, &visibilityTimeouts, &now, &transaction](MessageStore &store, const std::string &receiptHandle, const std::string &oid) {
+            StoredMessage &stored = store.messages[oid];
+            stored.message.reset = now + std::chrono::seconds(visibilityTimeouts.at(receiptHandle));
+
+            // Only in-flight messages have a deadline
+            if (stored.message.status == Entity::SQS::MessageStatus::INVISIBLE) {
+                ScheduleMessage(store, oid, stored);
+            }
+            if (transaction.IsActive()) {
+                JournalMessageState(transaction, store.queueUrl, stored.message);
+            }
+            changed.emplace_back(receiptHandle);
+        });
+        log_debug << "Message visibility changed, queueUrl: " << queueUrl << " count: " << changed.size();
+        return changed;
+    }
+
+    void SQSMemoryDb::DeleteAllMessages() {
+
+        long count = 0;
+        MemoryDbJournal::Transaction transaction(_journal);
+        for (const auto &store: GetMessageStores()) {
+            std::unique_lock lock(store->mutex);
+            count += ClearMessageStore(*store);
+            transaction.Clear("message", store->queueUrl);
+        }
+        log_debug << "All resources deleted, count: " << count;
+    }
+
+    std::shared_ptr<SQSMemoryDb::MessageStore> SQSMemoryDb::GetMessageStore(const std::string &queueUrl, const std::string &region, bool create) {
+
+        // Existing stores only need the shared lock
+        {
+            std::shared_lock lock(_sqsMessageMutex);
+            auto it = _messageStores.find(queueUrl);
+            if (it != _messageStores.end()) {
+                return it->second;
+            }
+            if (!create) {
+                return {};
+            }
+        }
+
+        std::unique_lock lock(_sqsMessageMutex);
+        auto it = _messageStores.find(queueUrl);
+        if (it != _messageStores.end()) {
+            return it->second;
+        }
+
+        auto store = std::make_shared<MessageStore>();
+        store->queueUrl = queueUrl;
+        store->region = region;
+        store->fifo = queueUrl.ends_with(".fifo");
+        store->receiptHandleIndex = &_receiptHandleIndex;
+        _messageStores[queueUrl] = store;
+        return store;
+    }
+
+    void SQSMemoryDb::RemoveMessageStore(const std::string &queueUrl, MemoryDbJournal::Transaction &transaction) {
+
+        std::shared_ptr<MessageStore> store;
+        {
+            std::unique_lock lock(_sqsMessageMutex);
+            auto it = _messageStores.find(queueUrl);
+            if (it == _messageStores.end()) {
+                return;
+            }
+            store = it->second;
+            _messageStores.erase(it);
+        }
+
+        // The map lock is never held together with a store lock
+        std::unique_lock lock(store->mutex);
+        long count = ClearMessageStore(*store);
+        transaction.Clear("message", queueUrl);
+        log_debug << "Message store removed, queueUrl: " << queueUrl << " count: " << count;
+    }
+
+    std::vector<std::shared_ptr<SQSMemoryDb::MessageStore>> SQSMemoryDb::GetMessageStores() {
+        std::shared_lock lock(_sqsMessageMutex);
+
+        std::vector<std::shared_ptr<MessageStore>> stores;
+        stores.reserve(_messageStores.size());
+        for (const auto &[queueUrl, store]: _messageStores) {
+            stores.emplace_back(store);
+        }
+        return stores;
+    }
+
+    std::shared_ptr<SQSMemoryDb::MessageStore> SQSMemoryDb::FindMessageStoreByReceiptHandle(const std::string &receiptHandle) {
+
+        // The callers check the receipt handle again under the store lock
+        std::string queueUrl;
+        {
+            std::shared_lock lock(_receiptHandleIndex.mutex);
+            auto it = _receiptHandleIndex.queueUrls.find(receiptHandle);
+            if (it == _receiptHandleIndex.queueUrls.end()) {
+                return {};
+            }
+            queueUrl = it->second;
+        }
+        return GetMessageStore(queueUrl);
+    }
+
+    void SQSMemoryDb::IndexQueue(const std::string &oid, const Entity::SQS::Queue &queue) {
+
+        _queueUrlIndex.emplace(queue.queueUrl, oid);
+        _queueArnIndex.emplace(queue.queueArn, oid);
+        _queueNameIndex.emplace(QueueNameKey(queue.region, queue.name), oid);
+    }
+
+    void SQSMemoryDb::UnindexQueue(const std::string &oid, const Entity::SQS::Queue &queue) {
+
+        auto erase = [&oid](QueueIndex &index, const std::string &key) {
+            auto [begin, end] = index.equal_range(key);
+            for (auto it = begin; it != end; ++it) {
+                if (it->second == oid) {
+                    index.erase(it);
+                    return;
                 }
             }
-        } else if (region.empty() && !queueUrl.empty()) {
+        };
+        erase(_queueUrlIndex, queue.queueUrl);
+        erase(_queueArnIndex, queue.queueArn);
+        erase(_queueNameIndex, QueueNameKey(queue.region, queue.name));
+    }
 
-            std::map<std::string, Entity::SQS::Message>::iterator it;
-            for (it = _messages.begin(); it != _messages.end(); it++) {
-                if (it->second.queueUrl == queueUrl) {
-                    count++;
+    std::map<std::string, Entity::SQS::Queue>::iterator SQSMemoryDb::FindQueue(const QueueIndex &index, const std::string &key, const std::string &region) {
+
+        auto [begin, end] = index.equal_range(key);
+        for (auto it = begin; it != end; ++it) {
+            auto queueIt = _queues.find(it->second);
+            if (queueIt != _queues.end() && (region.empty() || queueIt->second.region == region)) {
+                return queueIt;
+            }
+        }
+        return _queues.end();
+    }
+
+    std::string SQSMemoryDb::QueueNameKey(const std::string &region, const std::string &name) {
+        return region + '\n' + name;
+    }
+
+    void SQSMemoryDb::ForEachReceiptHandle(const std::string &queueUrl, const std::vector<std::string> &receiptHandles, const std::function<void(MessageStore &, const std::string &, const std::string &)> &function) {
+
+        // One locked pass over the store of the queue
+        std::vector<std::string> missing;
+        std::shared_ptr<MessageStore> store = GetMessageStore(queueUrl);
+        if (store) {
+            std::unique_lock lock(store->mutex);
+            for (const auto &receiptHandle: receiptHandles) {
+                auto it = store->receiptHandles.find(receiptHandle);
+                if (it != store->receiptHandles.end()) {
+                    std::string oid = it->second;
+                    function(*store, receiptHandle, oid);
+                } else {
+                    missing.emplace_back(receiptHandle);
                 }
             }
-        } else if (!region.empty() && queueUrl.empty()) {
+        } else {
+            missing = receiptHandles;
+        }
 
-            std::map<std::string, Entity::SQS::Message>::iterator it;
-            for (it = _messages.begin(); it != _messages.end(); it++) {
-                if (it->second.region == region) {
-                    count++;
+        // Receipt handles of other queues, e.g. a differently spelled queue URL
+        for (const auto &receiptHandle: missing) {
+            if (std::shared_ptr<MessageStore> other = FindMessageStoreByReceiptHandle(receiptHandle)) {
+                std::unique_lock lock(other->mutex);
+                auto it = other->receiptHandles.find(receiptHandle);
+                if (it != other->receiptHandles.end()) {
+                    std::string oid = it->second;
+                    function(*other, receiptHandle, oid);
                 }
             }
         }
-        log_trace << "Count resources, result: " << count;
+    }
+
+    void SQSMemoryDb::AddReceiptHandle(MessageStore &store, const std::string &receiptHandle, const std::string &oid) {
+
+        if (receiptHandle.empty()) {
+            return;
+        }
+        store.receiptHandles[receiptHandle] = oid;
+        if (store.receiptHandleIndex) {
+            std::unique_lock lock(store.receiptHandleIndex->mutex);
+            store.receiptHandleIndex->queueUrls[receiptHandle] = store.queueUrl;
+        }
+    }
+
+    void SQSMemoryDb::RemoveReceiptHandle(MessageStore &store, const std::string &receiptHandle) {
+
+        if (receiptHandle.empty() || store.receiptHandles.erase(receiptHandle) == 0) {
+            return;
+        }
+        if (store.receiptHandleIndex) {
+            std::unique_lock lock(store.receiptHandleIndex->mutex);
+            auto it = store.receiptHandleIndex->queueUrls.find(receiptHandle);
+            if (it != store.receiptHandleIndex->queueUrls.end() && it->second == store.queueUrl) {
+                store.receiptHandleIndex->queueUrls.erase(it);
+            }
+        }
+    }
+
+    SQSMemoryDb::StoredMessage &SQSMemoryDb::InsertMessage(MessageStore &store, const std::string &oid, const Entity::SQS::Message &message) {
+
+        StoredMessage &stored = store.messages[oid];
+        stored.message = message;
+        stored.message.oid = oid;
+        AddReceiptHandle(store, message.receiptHandle, oid);
+        store.created.emplace_back(message.created, oid);
+        store.statusCounts[message.status]++;
+        if (store.fifo) {
+            store.groups[GetMessageGroupId(message)].messages.emplace_back(oid);
+        }
+        return stored;
+    }
+
+    bool SQSMemoryDb::EraseMessage(MessageStore &store, const std::string &oid) {
+
+        auto it = store.messages.find(oid);
+        if (it == store.messages.end()) {
+            return false;
+        }
+
+        auto handleIt = store.receiptHandles.find(it->second.message.receiptHandle);
+        if (handleIt != store.receiptHandles.end() && handleIt->second == oid) {
+            RemoveReceiptHandle(store, it->second.message.receiptHandle);
+        }
+
+        // Deleting an in-flight message might unlock the group
+        if (store.fifo) {
+            QueueMessageGroup(store, GetMessageGroupId(it->second.message));
+        }
+        store.statusCounts[it->second.message.status]--;
+        store.messages.erase(it);
+        return true;
+    }
+
+    long SQSMemoryDb::ClearMessageStore(MessageStore &store) {
+
+        long count = static_cast<long>(store.messages.size());
+        store.messages.clear();
+        store.ready.clear();
+        store.deadlines.clear();
+        if (store.receiptHandleIndex) {
+            std::unique_lock lock(store.receiptHandleIndex->mutex);
+            for (const auto &[receiptHandle, oid]: store.receiptHandles) {
+                auto it = store.receiptHandleIndex->queueUrls.find(receiptHandle);
+                if (it != store.receiptHandleIndex->queueUrls.end() && it->second == store.queueUrl) {
+                    store.receiptHandleIndex->queueUrls.erase(it);
+                }
+            }
+        }
+        store.receiptHandles.clear();
+        store.created.clear();
+        store.redrive.clear();
+        store.statusCounts.clear();
+        store.groups.clear();
+        store.readyGroups.clear();
         return count;
     }
 
-    long SQSMemoryDb::CountMessagesByStatus(const std::string &region, const std::string &queueUrl, Entity::SQS::MessageStatus status) {
+    void SQSMemoryDb::ScheduleMessage(MessageStore &store, const std::string &oid, StoredMessage &stored) {
+
+        stored.sequence++;
+        if (stored.message.status == Entity::SQS::MessageStatus::INITIAL && store.fifo) {
+            QueueMessageGroup(store, GetMessageGroupId(stored.message));
+        } else if (stored.message.status == Entity::SQS::MessageStatus::INITIAL) {
+            store.ready.emplace_back(oid, stored.sequence);
+        } else {
+            store.deadlines.push_back({.due = stored.message.reset, .oid = oid, .sequence = stored.sequence});
+            std::push_heap(store.deadlines.begin(), store.deadlines.end(), std::greater<>());
+        }
+
+        // Every valid message has at most one entry in the ready list or the deadline heap, one in the redrive list and one in the creation list
+        if (store.ready.size() + store.deadlines.size() + store.redrive.size() + store.created.size() > 4 * store.messages.size() + SQS_MESSAGE_STORE_COMPACTION) {
+            CompactMessageStore(store);
+        }
+    }
+
+    void SQSMemoryDb::SetMessageStatus(MessageStore &store, Entity::SQS::Message &message, Entity::SQS::MessageStatus status) {
+
+        store.statusCounts[message.status]--;
+        store.statusCounts[status]++;
+        message.status = status;
+    }
+
+    void SQSMemoryDb::ClaimMessage(MessageStore &store, const std::string &oid, StoredMessage &stored, std::chrono::system_clock::time_point reset) {
+
+        Entity::SQS::Message &message = stored.message;
+        message.retries++;
+        RemoveReceiptHandle(store, message.receiptHandle);
+        message.receiptHandle = Core::AwsUtils::CreateSqsReceiptHandler();
+        AddReceiptHandle(store, message.receiptHandle, oid);
+        SetMessageStatus(store, message, Entity::SQS::MessageStatus::INVISIBLE);
+        message.reset = reset;
+        ScheduleMessage(store, oid, stored);
+    }
+
+    void SQSMemoryDb::ReceiveGroupMessages(MessageStore &store, int maxMessages, std::chrono::system_clock::time_point reset, Entity::SQS::MessageList &messageList) {
+
+        while (!store.readyGroups.empty() && messageList.size() < maxMessages) {
+
+            std::string groupId = std::move(store.readyGroups.front());
+            store.readyGroups.pop_front();
+
+            auto groupIt = store.groups.find(groupId);
+            if (groupIt == store.groups.end()) {
+                continue;
+            }
+            MessageGroup &group = groupIt->second;
+            group.queued = false;
+
+            // Drop deleted messages from the head
+            while (!group.messages.empty() && !store.messages.contains(group.messages.front())) {
+                group.messages.pop_front();
+            }
+            if (group.messages.empty()) {
+                store.groups.erase(groupIt);
+                continue;
+            }
+
+            // Visible messages from the head, an in-flight or delayed message at the head locks the group. The group is queued again, when
+            // one of its messages becomes visible or is deleted.
+            std::vector<std::string> oids;
+            for (const auto &oid: group.messages) {
+                if (messageList.size() + oids.size() >= maxMessages) {
+                    break;
+                }
+                auto it = store.messages.find(oid);
+                if (it == store.messages.end()) {
+                    continue;
+                }
+                if (it->second.message.status != Entity::SQS::MessageStatus::INITIAL) {
+                    break;
+                }
+                oids.emplace_back(oid);
+            }
+
+            // Claiming might compact the store, the group must not be used anymore
+            for (const auto &oid: oids) {
+                StoredMessage &stored = store.messages[oid];
+                ClaimMessage(store, oid, stored, reset);
+                messageList.push_back(stored.message);
+            }
+        }
+    }
+
+    void SQSMemoryDb::QueueMessageGroup(MessageStore &store, const std::string &groupId) {
+
+        auto it = store.groups.find(groupId);
+        if (it != store.groups.end() && !it->second.queued) {
+            it->second.queued = true;
+            store.readyGroups.emplace_back(groupId);
+        }
+    }
+
+    std::string SQSMemoryDb::GetMessageGroupId(const Entity::SQS::Message &message) {
+
+        auto it = message.attributes.find("MessageGroupId");
+        return it == message.attributes.end() ? std::string{} : it->second;
+    }
+
+    long SQSMemoryDb::ProcessDeadlines(MessageStore &store) {
 
         long count = 0;
+        auto now = std::chrono::system_clock::now();
+        while (!store.deadlines.empty() && store.deadlines.front().due <= now) {
 
-        std::map<std::string, Entity::SQS::Message>::iterator it;
-        for (it = _messages.begin(); it != _messages.end(); it++) {
-            if (it->second.region == region && it->second.queueUrl == queueUrl && it->second.status == status) {
-                count++;
+            std::pop_heap(store.deadlines.begin(), store.deadlines.end(), std::greater<>());
+            Deadline deadline = std::move(store.deadlines.back());
+            store.deadlines.pop_back();
+
+            auto it = store.messages.find(deadline.oid);
+            if (it == store.messages.end() || it->second.sequence != deadline.sequence) {
+                continue;
             }
+
+            // Invisible messages lose their receipt handle and are candidates for the dead letter queue
+            Entity::SQS::Message &message = it->second.message;
+            bool received = message.status == Entity::SQS::MessageStatus::INVISIBLE;
+            if (received) {
+                RemoveReceiptHandle(store, message.receiptHandle);
+                message.receiptHandle = "";
+            }
+            SetMessageStatus(store, message, Entity::SQS::MessageStatus::INITIAL);
+            ScheduleMessage(store, deadline.oid, it->second);
+            if (received) {
+                store.redrive.emplace_back(deadline.oid, it->second.sequence);
+            }
+            count++;
         }
-        log_trace << "Count resources by status, result: " << count;
         return count;
     }
 
-    void SQSMemoryDb::DeleteMessages(const std::string &queueUrl) {
-        Poco::ScopedLock lock(_sqsMessageMutex);
+    void SQSMemoryDb::CompactMessageStore(MessageStore &store) {
+
+        auto isStale = [&store](const std::string &oid, long sequence) {
+            auto it = store.messages.find(oid);
+            return it == store.messages.end() || it->second.sequence != sequence;
+        };
+        std::erase_if(store.ready, [&isStale](const auto &entry) { return isStale(entry.first, entry.second); });
+        std::erase_if(store.redrive, [&isStale](const auto &entry) { return isStale(entry.first, entry.second); });
+        std::erase_if(store.deadlines, [&isStale](const Deadline &deadline) { return isStale(deadline.oid, deadline.sequence); });
+        std::make_heap(store.deadlines.begin(), store.deadlines.end(), std::greater<>());
+        std::erase_if(store.created, [&store](const auto &entry) { return !store.messages.contains(entry.second); });
+        for (auto it = store.groups.begin(); it != store.groups.end();) {
+            std::erase_if(it->second.messages, [&store](const std::string &oid) { return !store.messages.contains(oid); });
+            it = it->second.messages.empty() && !it->second.queued ? store.groups.erase(it) : std::next(it);
+        }
+        log_trace << "Message store compacted, messages: " << store.messages.size();
+    }
 
-        const auto count = std::erase_if(_messages, [queueUrl](const auto &item) {
-            auto const &[key, value] = item;
-            return value.queueUrl == queueUrl;
-        });
+    void SQSMemoryDb::ReplayRecord(const bsoncxx::document::view &record) {
 
-        log_debug << "Messages deleted, queue: " << queueUrl << " count: " << count;
-    }
+        std::string op = MemoryDbJournal::GetField(record, "op");
+        std::string type = MemoryDbJournal::GetField(record, "type");
+        std::string key = MemoryDbJournal::GetField(record, "key");
+        std::string scope = MemoryDbJournal::GetField(record, "scope");
 
-    void SQSMemoryDb::DeleteMessage(const Entity::SQS::Message &message) {
-        Poco::ScopedLock lock(_sqsMessageMutex);
+        if (type == "queue") {
 
-        std::string receiptHandle = message.receiptHandle;
-        const auto count = std::erase_if(_messages, [receiptHandle](const auto &item) {
-            auto const &[key, value] = item;
-            return value.receiptHandle == receiptHandle;
-        });
-        log_debug << "Messages deleted, receiptHandle: " << message.receiptHandle << " count: " << count;
+            std::unique_lock lock(sqsQueueMutex);
+            if (op == "put") {
+                Entity::SQS::Queue queue;
+                queue.FromDocument(MemoryDbJournal::GetValue(record));
+                queue.oid = key;
+                auto it = _queues.find(key);
+                if (it != _queues.end()) {
+                    UnindexQueue(key, it->second);
+                }
+                _queues[key] = queue;
+                IndexQueue(key, queue);
+            } else if (op == "delete") {
+                auto it = _queues.find(key);
+                if (it != _queues.end()) {
+                    UnindexQueue(key, it->second);
+                    _queues.erase(it);
+                }
+            } else if (op == "clear") {
+                _queues.clear();
+                _queueUrlIndex.clear();
+                _queueArnIndex.clear();
+                _queueNameIndex.clear();
+            }
+
+        } else if (type == "message") {
+
+            if (op == "clear") {
+                for (const auto &store: GetMessageStores()) {
+                    if (scope.empty() || store->queueUrl == scope) {
+                        std::unique_lock lock(store->mutex);
+                        ClearMessageStore(*store);
+                    }
+                }
+                return;
+            }
+
+            if (op == "put") {
+                Entity::SQS::Message message;
+                message.FromDocument(MemoryDbJournal::GetValue(record));
+                std::shared_ptr<MessageStore> store = GetMessageStore(scope, message.region, true);
+
+                // Received messages, which are visible again, are candidates for the dead letter queue
+                std::unique_lock lock(store->mutex);
+                EraseMessage(*store, key);
+                StoredMessage &stored = InsertMessage(*store, key, message);
+                ScheduleMessage(*store, key, stored);
+                if (stored.message.retries > 0 && stored.message.status == Entity::SQS::MessageStatus::INITIAL) {
+                    store->redrive.emplace_back(key, stored.sequence);
+                }
+                return;
+            }
+
+            std::shared_ptr<MessageStore> store = GetMessageStore(scope);
+            if (!store) {
+                return;
+            }
+            std::unique_lock lock(store->mutex);
+            auto it = store->messages.find(key);
+            if (it == store->messages.end()) {
+                return;
+            }
+            if (op == "delete") {
+                EraseMessage(*store, key);
+            } else if (op == "update") {
+                bsoncxx::document::view fields = MemoryDbJournal::GetValue(record);
+                Entity::SQS::Message &message = it->second.message;
+                RemoveReceiptHandle(*store, message.receiptHandle);
+                message.receiptHandle = bsoncxx::string::to_string(fields["receiptHandle"].get_string().value);
+                AddReceiptHandle(*store, message.receiptHandle, key);
+                message.retries = fields["retries"].get_int32().value;
+                message.reset = bsoncxx::types::b_date(fields["reset"].get_date());
+                SetMessageStatus(*store, message, Entity::SQS::MessageStatusFromString(bsoncxx::string::to_string(fields["status"].get_string().value)));
+                ScheduleMessage(*store, key, it->second);
+            }
+        }
     }
 
-    void SQSMemoryDb::DeleteMessage(const std::string &receiptHandle) {
-        Poco::ScopedLock lock(_sqsMessageMutex);
+    void SQSMemoryDb::WriteSnapshot(const MemoryDbJournal::WriteFunction &write) {
 
-        const auto count = std::erase_if(_messages, [receiptHandle](const auto &item) {
-            auto const &[key, value] = item;
-            return value.receiptHandle == receiptHandle;
-        });
-        log_debug << "Messages deleted, receiptHandle: " << receiptHandle << " count: " << count;
+        // Copy the state, so that the locks are not held while writing
+        std::map<std::string, Entity::SQS::Queue> queues;
+        {
+            std::shared_lock lock(sqsQueueMutex);
+            queues = _queues;
+        }
+        for (const auto &[oid, queue]: queues) {
+            auto document = queue.ToDocument();
+            write(MemoryDbJournal::PutRecord("queue", oid, document.view()));
+        }
+
+        for (const auto &store: GetMessageStores()) {
+
+            // Creation order, the retention relies on it
+            Entity::SQS::MessageList messages;
+            {
+                std::shared_lock lock(store->mutex);
+                messages.reserve(store->messages.size());
+                for (const auto &[oid, stored]: store->messages) {
+                    messages.emplace_back(stored.message);
+                }
+            }
+            std::sort(messages.begin(), messages.end(), [](const Entity::SQS::Message &a, const Entity::SQS::Message &b) { return a.created < b.created; });
+            for (const auto &message: messages) {
+                auto document = message.ToDocument();
+                write(MemoryDbJournal::PutRecord("message", message.oid, document.view(), store->queueUrl));
+            }
+        }
     }
 
-    void SQSMemoryDb::DeleteAllMessages() {
-        Poco::ScopedLock lock(_sqsMessageMutex);
+    void SQSMemoryDb::JournalMessageState(MemoryDbJournal::Transaction &transaction, const std::string &queueUrl, const Entity::SQS::Message &message) {
 
-        log_debug << "All resources deleted, count: " << _messages.size();
-        _messages.clear();
+        transaction.Update("message", message.oid, make_document(kvp("receiptHandle", message.receiptHandle), kvp("retries", message.retries), kvp("status", Entity::SQS::MessageStatusToString(message.status)), kvp("reset", bsoncxx::types::b_date(message.reset))), queueUrl);
     }
-}// namespace AwsMock::Database
\ No newline at end of file
+
+}// namespace AwsMock::Database
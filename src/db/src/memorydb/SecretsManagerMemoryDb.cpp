@@ -6,9 +6,10 @@
 
 namespace AwsMock::Database {
 
-    Poco::Mutex SecretsManagerMemoryDb::_secretMutex;
+    std::shared_mutex SecretsManagerMemoryDb::_secretMutex;
 
     bool SecretsManagerMemoryDb::SecretExists(const std::string &region, const std::string &name) {
+        std::shared_lock lock(_secretMutex);
 
         return find_if(_secrets.begin(),
                        _secrets.end(),
@@ -22,6 +23,7 @@ namespace AwsMock::Database {
     }
 
     bool SecretsManagerMemoryDb::SecretExists(const std::string &secretId) {
+        std::shared_lock lock(_secretMutex);
 
         return find_if(_secrets.begin(),
                        _secrets.end(),
@@ -31,6 +33,7 @@ namespace AwsMock::Database {
     }
 
     Entity::SecretsManager::Secret SecretsManagerMemoryDb::GetSecretById(const std::string &oid) {
+        std::shared_lock lock(_secretMutex);
 
         auto it = find_if(_secrets.begin(),
                           _secrets.end(),
@@ -39,13 +42,13 @@ namespace AwsMock::Database {
                           });
 
         if (it != _secrets.end()) {
-            it->second.oid = oid;
             return it->second;
         }
         return {};
     }
 
     Entity::SecretsManager::Secret SecretsManagerMemoryDb::GetSecretByRegionName(const std::string &region, const std::string &name) {
+        std::shared_lock lock(_secretMutex);
 
         Entity::SecretsManager::Secret result;
 
@@ -56,13 +59,13 @@ namespace AwsMock::Database {
                           });
 
         if (it != _secrets.end()) {
-            it->second.oid = it->first;
             return it->second;
         }
         return {};
     }
 
     Entity::SecretsManager::Secret SecretsManagerMemoryDb::GetSecretBySecretId(const std::string &secretId) {
+        std::shared_lock lock(_secretMutex);
 
         Entity::SecretsManager::Secret result;
 
@@ -73,24 +76,24 @@ namespace AwsMock::Database {
                           });
 
         if (it != _secrets.end()) {
-            it->second.oid = it->first;
             return it->second;
         }
         return {};
     }
 
     Entity::SecretsManager::Secret SecretsManagerMemoryDb::CreateSecret(const Entity::SecretsManager::Secret &secret) {
-        Poco::ScopedLock lock(_secretMutex);
+        std::unique_lock lock(_secretMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _secrets[oid] = secret;
+        _secrets[oid].oid = oid;
         log_trace << "Secret created, oid: " << oid;
-        return GetSecretById(oid);
+        return _secrets[oid];
     }
 
     Entity::SecretsManager::Secret SecretsManagerMemoryDb::UpdateSecret(const Entity::SecretsManager::Secret &secret) {
 
-        Poco::ScopedLock lock(_secretMutex);
+        std::unique_lock lock(_secretMutex);
 
         std::string secretId = secret.secretId;
         auto it = find_if(_secrets.begin(),
@@ -98,11 +101,13 @@ namespace AwsMock::Database {
                           [secretId](const std::pair<std::string, Entity::SecretsManager::Secret> &secret) {
                               return secret.second.secretId == secretId;
                           });
-        _secrets[it->first] = secret;
-        return _secrets[it->first];
+        it->second = secret;
+        it->second.oid = it->first;
+        return it->second;
     }
 
     Entity::SecretsManager::SecretList SecretsManagerMemoryDb::ListSecrets() {
+        std::shared_lock lock(_secretMutex);
 
         Entity::SecretsManager::SecretList secretList;
 
@@ -115,6 +120,7 @@ namespace AwsMock::Database {
     }
 
     long SecretsManagerMemoryDb::CountSecrets(const std::string &region) {
+        std::shared_lock lock(_secretMutex);
 
         long count = 0;
         if (region.empty()) {
@@ -133,7 +139,7 @@ namespace AwsMock::Database {
     }
 
     void SecretsManagerMemoryDb::DeleteSecret(const Entity::SecretsManager::Secret &secret) {
-        Poco::ScopedLock lock(_secretMutex);
+        std::unique_lock lock(_secretMutex);
 
         std::string region = secret.region;
         std::string name = secret.name;
@@ -145,7 +151,7 @@ namespace AwsMock::Database {
     }
 
     void SecretsManagerMemoryDb::DeleteAllSecrets() {
-        Poco::ScopedLock lock(_secretMutex);
+        std::unique_lock lock(_secretMutex);
 
         log_debug << "Secrets deleted, count: " << _secrets.size();
         _secrets.clear();
@@ -6,10 +6,11 @@
 
 namespace AwsMock::Database {
 
-    Poco::Mutex TransferMemoryDb::_transferMutex;
-    Poco::Mutex TransferMemoryDb::_userMutex;
+    std::shared_mutex TransferMemoryDb::_transferMutex;
+    std::shared_mutex TransferMemoryDb::_userMutex;
 
     bool TransferMemoryDb::TransferExists(const std::string &region, const std::string &serverId) {
+        std::shared_lock lock(_transferMutex);
 
         return find_if(_transfers.begin(),
                        _transfers.end(),
@@ -24,6 +25,7 @@ namespace AwsMock::Database {
     }
 
     bool TransferMemoryDb::TransferExists(const std::string &serverId) {
+        std::shared_lock lock(_transferMutex);
 
         return find_if(_transfers.begin(),
                        _transfers.end(),
@@ -33,6 +35,7 @@ namespace AwsMock::Database {
     }
 
     bool TransferMemoryDb::TransferExists(const std::string &region, const std::vector<std::string> &protocols) {
+        std::shared_lock lock(_transferMutex);
 
         return find_if(_transfers.begin(),
                        _transfers.end(),
@@ -42,6 +45,7 @@ namespace AwsMock::Database {
     }
 
     std::vector<Entity::Transfer::Transfer> TransferMemoryDb::ListServers(const std::string &region) {
+        std::shared_lock lock(_transferMutex);
 
         Entity::Transfer::TransferList transferList;
         if (region.empty()) {
@@ -74,16 +78,17 @@ namespace AwsMock::Database {
     }
 
     Entity::Transfer::Transfer TransferMemoryDb::CreateTransfer(const Entity::Transfer::Transfer &transfer) {
-        Poco::ScopedLock lock(_transferMutex);
+        std::unique_lock lock(_transferMutex);
 
         std::string oid = Poco::UUIDGenerator().createRandom().toString();
         _transfers[oid] = transfer;
+        _transfers[oid].oid = oid;
         log_trace << "Transfer created, oid: " << oid;
-        return GetTransferById(oid);
+        return _transfers[oid];
     }
 
     Entity::Transfer::Transfer TransferMemoryDb::UpdateTransfer(const Entity::Transfer::Transfer &transfer) {
-        Poco::ScopedLock lock(_transferMutex);
+        std::unique_lock lock(_transferMutex);
 
         std::string region = transfer.region;
         std::string serverId = transfer.serverId;
@@ -98,11 +103,15 @@ namespace AwsMock::Database {
             throw Core::DatabaseException("Update transfer failed, serverId: " + serverId);
         }
 
-        _transfers[it->first] = transfer;
-        return _transfers[it->first];
+        it->second = transfer;
+
+        it->second.oid = it->first;
+
+        return it->second;
     }
 
     Entity::Transfer::Transfer TransferMemoryDb::GetTransferById(const std::string &oid) {
+        std::shared_lock lock(_transferMutex);
 
         auto it = find_if(_transfers.begin(),
                           _transfers.end(),
@@ -114,12 +123,11 @@ namespace AwsMock::Database {
             log_error << "Get transfer by ID failed, oid: " << oid;
             throw Core::DatabaseException("Get transfer by ID failed, oid: " + oid);
         }
-
-        it->second.oid = oid;
         return it->second;
     }
 
     Entity::Transfer::Transfer TransferMemoryDb::GetTransferByServerId(const std::string &serverId) {
+        std::shared_lock lock(_transferMutex);
 
         auto it = find_if(_transfers.begin(),
                           _transfers.end(),
@@ -131,12 +139,11 @@ namespace AwsMock::Database {
             log_error << "Get transfer by serverId failed, serverId: " << serverId;
             throw Core::DatabaseException("Get transfer by serverId failed, serverId: " + serverId);
         }
-
-        it->second.oid = it->first;
         return it->second;
     }
 
     Entity::Transfer::Transfer TransferMemoryDb::GetTransferByArn(const std::string &arn) {
+        std::shared_lock lock(_transferMutex);
 
         auto it = find_if(_transfers.begin(),
                           _transfers.end(),
@@ -148,12 +155,11 @@ namespace AwsMock::Database {
             log_error << "Get transfer by arn failed, arn: " << arn;
             throw Core::DatabaseException("Get transfer by arn failed, arn: " + arn);
         }
-
-        it->second.oid = it->first;
         return it->second;
     }
 
     long TransferMemoryDb::CountServers(const std::string &region) {
+        std::shared_lock lock(_transferMutex);
 
         long count = 0;
 
@@ -174,7 +180,7 @@ namespace AwsMock::Database {
 
 
     void TransferMemoryDb::DeleteTransfer(const std::string &serverId) {
-        Poco::ScopedLock lock(_transferMutex);
+        std::unique_lock lock(_transferMutex);
 
         const auto count = std::erase_if(_transfers, [serverId](const auto &item) {
             auto const &[key, value] = item;
@@ -184,7 +190,7 @@ namespace AwsMock::Database {
     }
 
     void TransferMemoryDb::DeleteAllTransfers() {
-        Poco::ScopedLock lock(_transferMutex);
+        std::unique_lock lock(_transferMutex);
 
         log_debug << "All transfer servers deleted, count: " << _transfers.size();
         _transfers.clear();
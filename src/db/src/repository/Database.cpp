@@ -81,6 +81,10 @@ namespace AwsMock::Database {
                                                make_document(kvp("name", "s3_idx1")));
             database["s3_object"].create_index(make_document(kvp("region", 1), kvp("bucket", 1), kvp("key", 1)),
                                                make_document(kvp("name", "s3_idx2")));
+            database["s3_object"].create_index(make_document(kvp("bucket", 1), kvp("key", 1)),
+                                               make_document(kvp("name", "s3_idx3")));
+            database["s3_upload"].create_index(make_document(kvp("uploadId", 1)),
+                                               make_document(kvp("name", "s3_idx4"), kvp("unique", true)));
 
             // Module
             database["module"].create_index(make_document(kvp("name", 1), kvp("state", 1)),
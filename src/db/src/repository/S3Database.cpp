@@ -15,7 +15,7 @@ namespace AwsMock::Database {
             {"Created", {"s3:ObjectCreated:Put", "s3:ObjectCreated:Post", "s3:ObjectCreated:Copy", "s3:ObjectCreated:CompleteMultipartUpload"}},
             {"Deleted", {"s3:ObjectRemoved:Delete", "s3:ObjectRemoved:DeleteMarkerCreated"}}};
 
-    S3Database::S3Database() : _memoryDb(S3MemoryDb::instance()), _useDatabase(HasDatabase()), _databaseName(GetDatabaseName()), _bucketCollectionName("s3_bucket"), _objectCollectionName("s3_object") {}
+    S3Database::S3Database() : _memoryDb(S3MemoryDb::instance()), _useDatabase(HasDatabase()), _databaseName(GetDatabaseName()), _bucketCollectionName("s3_bucket"), _objectCollectionName("s3_object"), _uploadCollectionName("s3_upload") {}
 
     bool S3Database::BucketExists(const std::string &region, const std::string &name) {
 
@@ -271,9 +271,13 @@ namespace AwsMock::Database {
 
                 auto client = ConnectionPool::instance().GetConnection();
                 mongocxx::collection _objectCollection = (*client)[_databaseName][_objectCollectionName];
-                auto objectCursor = _objectCollection.find(make_document(kvp("bucket", bucket),
-                                                                         kvp("key",
-                                                                             bsoncxx::types::b_regex{"^" + prefix + ".*"})));
+                std::string successor = Core::StringUtils::PrefixSuccessor(prefix);
+                bsoncxx::builder::basic::document range;
+                range.append(kvp("$gte", prefix));
+                if (!successor.empty()) {
+                    range.append(kvp("$lt", successor));
+                }
+                auto objectCursor = _objectCollection.find(make_document(kvp("bucket", bucket), kvp("key", range.extract())));
                 for (auto object: objectCursor) {
                     Entity::S3::Object result;
                     result.FromDocument(object);
@@ -291,6 +295,90 @@ namespace AwsMock::Database {
         return objectList;
     }
 
+    Entity::S3::ObjectList S3Database::ListBucket(const std::string &bucket, const std::string &prefix, const std::string &delimiter, const std::string &startAfter, long maxKeys, std::vector<std::string> &commonPrefixes, bool &isTruncated) {
+
+        if (_useDatabase) {
+
+            try {
+
+                auto client = ConnectionPool::instance().GetConnection();
+                mongocxx::collection _objectCollection = (*client)[_databaseName][_objectCollectionName];
+
+                mongocxx::options::find opts;
+                opts.sort(make_document(kvp("key", 1)));
+
+                Entity::S3::ObjectList objectList;
+                isTruncated = false;
+                long count = 0;
+
+                // Every common prefix ends the range query, the next query starts behind the common prefix
+                bool inclusive = startAfter < prefix;
+                std::string from = inclusive ? prefix : startAfter;
+                std::string to = Core::StringUtils::PrefixSuccessor(prefix);
+                bool done = false;
+                while (!done) {
+
+                    bsoncxx::builder::basic::document range;
+                    range.append(kvp(inclusive ? "$gte" : "$gt", from));
+                    if (!to.empty()) {
+                        range.append(kvp("$lt", to));
+                    }
+
+                    done = true;
+                    auto objectCursor = _objectCollection.find(make_document(kvp("bucket", bucket), kvp("key", range.extract())), opts);
+                    for (auto document: objectCursor) {
+
+                        Entity::S3::Object object;
+                        object.FromDocument(document);
+
+                        // Versions of the same key, keep the latest
+                        if (!objectList.empty() && objectList.back().key == object.key) {
+                            if (object.modified > objectList.back().modified) {
+                                objectList.back() = object;
+                            }
+                            continue;
+                        }
+
+                        std::string::size_type pos = delimiter.empty() ? std::string::npos : object.key.find(delimiter, prefix.size());
+                        if (pos != std::string::npos) {
+                            std::string commonPrefix = object.key.substr(0, pos + delimiter.size());
+                            if (commonPrefix > startAfter) {
+                                if (count == maxKeys) {
+                                    isTruncated = true;
+                                    break;
+                                }
+                                commonPrefixes.emplace_back(commonPrefix);
+                                count++;
+                            }
+                            from = Core::StringUtils::PrefixSuccessor(commonPrefix);
+                            inclusive = true;
+                            done = from.empty();
+                            break;
+                        }
+
+                        if (count == maxKeys) {
+                            isTruncated = true;
+                            break;
+                        }
+                        objectList.emplace_back(object);
+                        count++;
+                    }
+                }
+
+                log_trace << "Got object page, size: " << objectList.size() << " commonPrefixes: " << commonPrefixes.size() << " truncated: " << std::boolalpha << isTruncated;
+                return objectList;
+
+            } catch (const mongocxx::exception &exc) {
+                log_error << "Database exception " << exc.what();
+                throw Core::DatabaseException(exc.what(), 500);
+            }
+
+        } else {
+
+            return _memoryDb.ListBucket(bucket, prefix, delimiter, startAfter, maxKeys, commonPrefixes, isTruncated);
+        }
+    }
+
     Entity::S3::ObjectList S3Database::ListObjects(const std::string &prefix) {
 
         Entity::S3::ObjectList objectList;
@@ -326,6 +414,41 @@ namespace AwsMock::Database {
         return objectList;
     }
 
+    Entity::S3::ObjectList S3Database::ListObjectsAfter(const std::string &startAfter, long maxKeys) {
+
+        if (_useDatabase) {
+
+            try {
+
+                auto client = ConnectionPool::instance().GetConnection();
+                mongocxx::collection _objectCollection = (*client)[_databaseName][_objectCollectionName];
+
+                mongocxx::options::find opts;
+                opts.sort(make_document(kvp("_id", 1)));
+                opts.limit(maxKeys);
+
+                bsoncxx::document::value query = startAfter.empty() ? make_document() : make_document(kvp("_id", make_document(kvp("$gt", bsoncxx::oid(startAfter)))));
+
+                Entity::S3::ObjectList objectList;
+                for (const auto &object: _objectCollection.find(query.view(), opts)) {
+                    Entity::S3::Object result;
+                    result.FromDocument(object);
+                    objectList.push_back(result);
+                }
+                log_trace << "Got object page, size: " << objectList.size();
+                return objectList;
+
+            } catch (const mongocxx::exception &exc) {
+                log_error << "Database exception " << exc.what();
+                throw Core::DatabaseException(exc.what(), 500);
+            }
+
+        } else {
+
+            return _memoryDb.ListObjectsAfter(startAfter, maxKeys);
+        }
+    }
+
     void S3Database::DeleteBucket(const Entity::S3::Bucket &bucket) {
 
         if (_useDatabase) {
@@ -705,6 +828,38 @@ namespace AwsMock::Database {
         }
     }
 
+    void S3Database::DeleteObjects(const Entity::S3::ObjectList &objects) {
+
+        if (objects.empty()) {
+            return;
+        }
+
+        if (_useDatabase) {
+
+            bsoncxx::builder::basic::array array{};
+            for (const auto &object: objects) {
+                array.append(make_document(kvp("_id", bsoncxx::oid(object.oid)), kvp("internalName", object.internalName)));
+            }
+
+            auto client = ConnectionPool::instance().GetConnection();
+            mongocxx::collection _objectCollection = (*client)[_databaseName][_objectCollectionName];
+
+            try {
+
+                auto result = _objectCollection.delete_many(make_document(kvp("$or", array)));
+                log_debug << "Objects deleted, count: " << result->result().deleted_count();
+
+            } catch (const mongocxx::exception &exc) {
+                log_error << "Database exception " << exc.what();
+                throw Core::DatabaseException(exc.what(), 500);
+            }
+
+        } else {
+
+            _memoryDb.DeleteObjects(objects);
+        }
+    }
+
     void S3Database::DeleteAllObjects() {
 
         if (_useDatabase) {
@@ -732,6 +887,123 @@ namespace AwsMock::Database {
         }
     }
 
+    Entity::S3::MultipartUpload S3Database::CreateMultipartUpload(const Entity::S3::MultipartUpload &upload) {
+
+        if (_useDatabase) {
+
+            try {
+
+                auto client = ConnectionPool::instance().GetConnection();
+                mongocxx::collection _uploadCollection = (*client)[_databaseName][_uploadCollectionName];
+                _uploadCollection.insert_one(upload.ToDocument().view());
+                log_trace << "Multipart upload created, uploadId: " << upload.uploadId;
+                return GetMultipartUpload(upload.uploadId);
+
+            } catch (const mongocxx::exception &exc) {
+                log_error << "Database exception " << exc.what();
+                throw Core::DatabaseException(exc.what(), 500);
+            }
+
+        } else {
+
+            return _memoryDb.CreateMultipartUpload(upload);
+        }
+    }
+
+    Entity::S3::MultipartUpload S3Database::GetMultipartUpload(const std::string &uploadId) {
+
+        if (_useDatabase) {
+
+            try {
+
+                auto client = ConnectionPool::instance().GetConnection();
+                mongocxx::collection _uploadCollection = (*client)[_databaseName][_uploadCollectionName];
+                mongocxx::stdx::optional<bsoncxx::document::value> mResult = _uploadCollection.find_one(make_document(kvp("uploadId", uploadId)));
+
+                if (mResult.operator bool()) {
+                    Entity::S3::MultipartUpload result;
+                    result.FromDocument(mResult->view());
+                    return result;
+                }
+
+            } catch (const mongocxx::exception &exc) {
+                log_error << "Database exception " << exc.what();
+                throw Core::DatabaseException(exc.what(), 500);
+            }
+
+        } else {
+
+            return _memoryDb.GetMultipartUpload(uploadId);
+        }
+        return {};
+    }
+
+    Entity::S3::MultipartPart S3Database::AddMultipartPart(const std::string &uploadId, const Entity::S3::MultipartPart &part) {
+
+        if (_useDatabase) {
+
+            try {
+
+                // Parts are keyed by part number, so that adding or replacing a part is a single atomic update
+                std::string partField = "parts." + std::to_string(part.partNumber);
+                auto client = ConnectionPool::instance().GetConnection();
+                mongocxx::collection _uploadCollection = (*client)[_databaseName][_uploadCollectionName];
+                mongocxx::options::find_one_and_update options;
+                options.projection(make_document(kvp(partField, 1)));
+                mongocxx::stdx::optional<bsoncxx::document::value> mResult = _uploadCollection.find_one_and_update(
+                        make_document(kvp("uploadId", uploadId)),
+                        make_document(kvp("$set", make_document(kvp(partField, part.ToDocument().view()), kvp("modified", bsoncxx::types::b_date(part.modified))))),
+                        options);
+
+                if (!mResult) {
+                    log_error << "Multipart upload not found, uploadId: " << uploadId;
+                    throw Core::DatabaseException("Multipart upload not found, uploadId: " + uploadId);
+                }
+
+                Entity::S3::MultipartPart replaced;
+                bsoncxx::document::view previous = mResult->view();
+                if (previous.find("parts") != previous.end()) {
+                    bsoncxx::document::view parts = previous["parts"].get_document().value;
+                    if (parts.find(std::to_string(part.partNumber)) != parts.end()) {
+                        replaced.FromDocument(parts[std::to_string(part.partNumber)].get_document().value);
+                    }
+                }
+                log_trace << "Multipart part added, uploadId: " << uploadId << " part: " << part.partNumber;
+                return replaced;
+
+            } catch (const mongocxx::exception &exc) {
+                log_error << "Database exception " << exc.what();
+                throw Core::DatabaseException(exc.what(), 500);
+            }
+
+        } else {
+
+            return _memoryDb.AddMultipartPart(uploadId, part);
+        }
+    }
+
+    void S3Database::DeleteMultipartUpload(const std::string &uploadId) {
+
+        if (_useDatabase) {
+
+            try {
+
+                auto client = ConnectionPool::instance().GetConnection();
+                mongocxx::collection _uploadCollection = (*client)[_databaseName][_uploadCollectionName];
+                auto result = _uploadCollection.delete_one(make_document(kvp("uploadId", uploadId)));
+                log_debug << "Multipart upload deleted, uploadId: " << uploadId << " count: " << result->deleted_count();
+
+            } catch (const mongocxx::exception &exc) {
+                log_error << "Database exception " << exc.what();
+                throw Core::DatabaseException(exc.what(), 500);
+            }
+
+        } else {
+
+            _memoryDb.DeleteMultipartUpload(uploadId);
+        }
+    }
+
     Entity::S3::Bucket S3Database::CreateBucketNotification(const Entity::S3::Bucket &bucket, const Entity::S3::BucketNotification &bucketNotification) {
 
         Entity::S3::Bucket internBucket = GetBucketByRegionName(bucket.region, bucket.name);
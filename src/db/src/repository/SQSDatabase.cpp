@@ -409,6 +409,50 @@ namespace AwsMock::Database {
         }
     }
 
+    Entity::SQS::MessageList SQSDatabase::CreateMessages(const Entity::SQS::MessageList &messages) {
+
+        if (messages.empty()) {
+            return {};
+        }
+
+        if (_useDatabase) {
+
+            auto client = ConnectionPool::instance().GetConnection();
+            auto messageCollection = (*client)[_databaseName][_collectionNameMessage];
+            auto session = client->start_session();
+
+            try {
+
+                std::vector<bsoncxx::document::view_or_value> documents;
+                documents.reserve(messages.size());
+                for (const auto &message: messages) {
+                    documents.emplace_back(message.ToDocument());
+                }
+
+                session.start_transaction();
+                auto result = messageCollection.insert_many(documents);
+                session.commit_transaction();
+
+                // Inserted IDs are keyed by the index of the document
+                Entity::SQS::MessageList messageList = messages;
+                for (const auto &[index, id]: result->inserted_ids()) {
+                    messageList[index].oid = id.get_oid().value.to_string();
+                }
+                log_trace << "Messages created, count: " << result->inserted_count();
+                return messageList;
+
+            } catch (const mongocxx::exception &exc) {
+                session.abort_transaction();
+                log_error << "Database exception " << exc.what();
+                throw Core::DatabaseException(exc.what());
+            }
+
+        } else {
+
+            return _memoryDb.CreateMessages(messages);
+        }
+    }
+
     bool SQSDatabase::MessageExists(const std::string &receiptHandle) {
 
         if (_useDatabase) {
@@ -553,55 +597,73 @@ namespace AwsMock::Database {
 
     void SQSDatabase::ReceiveMessages(const std::string &region, const std::string &queueUrl, int visibility, int maxMessages, Entity::SQS::MessageList &messageList) {
 
-        // First rest resources
-        ResetMessages(queueUrl, visibility);
-
-        auto reset = std::chrono::system_clock::now() + std::chrono::seconds(visibility);
-
         if (_useDatabase) {
 
             auto client = ConnectionPool::instance().GetConnection();
             auto messageCollection = (*client)[_databaseName][_collectionNameMessage];
-            auto session = client->start_session();
 
-            try {
+            auto now = std::chrono::system_clock::now();
+            auto reset = now + std::chrono::seconds(visibility);
 
-                session.start_transaction();
+            mongocxx::options::find_one_and_update opts{};
+            opts.return_document(mongocxx::options::return_document::k_after);
 
-                mongocxx::options::find opts;
-                opts.limit(maxMessages);
+            // Visible messages, plus invisible and delayed messages whose deadline has passed, but which have not been reset by the worker
+            bsoncxx::builder::basic::array pending{};
+            pending.append(Entity::SQS::MessageStatusToString(Entity::SQS::MessageStatus::INVISIBLE));
+            pending.append(Entity::SQS::MessageStatusToString(Entity::SQS::MessageStatus::DELAYED));
+            bsoncxx::builder::basic::array claimable{};
+            claimable.append(make_document(kvp("queueUrl", queueUrl),
+                                           kvp("status", Entity::SQS::MessageStatusToString(Entity::SQS::MessageStatus::INITIAL))));
+            claimable.append(make_document(kvp("queueUrl", queueUrl),
+                                           kvp("status", make_document(kvp("$in", pending))),
+                                           kvp("reset", make_document(kvp("$lte", bsoncxx::types::b_date(now))))));
+            bsoncxx::builder::basic::document filter{};
+            filter.append(kvp("$or", claimable));
 
-                // Get the cursor
-                auto messageCursor = messageCollection.find(make_document(kvp("queueUrl", queueUrl),
-                                                                          kvp("status",
-                                                                              Entity::SQS::MessageStatusToString(Entity::SQS::MessageStatus::INITIAL))),
-                                                            opts);
+            try {
 
-                for (auto message: messageCursor) {
+                // FIFO queues, groups with in-flight messages are locked, the messages of a group are received in send order
+                if (queueUrl.ends_with(".fifo")) {
+
+                    bsoncxx::builder::basic::array lockedGroups{};
+                    auto cursor = messageCollection.distinct("attributes.MessageGroupId",
+                                                             make_document(kvp("queueUrl", queueUrl),
+                                                                           kvp("status", Entity::SQS::MessageStatusToString(Entity::SQS::MessageStatus::INVISIBLE)),
+                                                                           kvp("reset", make_document(kvp("$gt", bsoncxx::types::b_date(now))))));
+                    for (auto &&result: cursor) {
+                        for (auto &&groupId: result["values"].get_array().value) {
+                            lockedGroups.append(bsoncxx::string::to_string(groupId.get_string().value));
+                        }
+                    }
+                    filter.append(kvp("attributes.MessageGroupId", make_document(kvp("$nin", lockedGroups))));
+                    opts.sort(make_document(kvp("_id", 1)));
+                }
 
-                    Entity::SQS::Message result;
-                    result.FromDocument(message);
+                // Each message is claimed atomically, concurrent receivers never get the same message and need no transaction
+                while (messageList.size() < maxMessages) {
+
+                    std::string receiptHandle = Core::AwsUtils::CreateSqsReceiptHandler();
+                    auto mResult = messageCollection.find_one_and_update(
+                            filter.view(),
+                            make_document(kvp("$set",
+                                              make_document(kvp("status", Entity::SQS::MessageStatusToString(Entity::SQS::MessageStatus::INVISIBLE)),
+                                                            kvp("reset", bsoncxx::types::b_date(reset)),
+                                                            kvp("receiptHandle", receiptHandle))),
+                                          kvp("$inc", make_document(kvp("retries", 1)))),
+                            opts);
+                    if (!mResult) {
+                        break;
+                    }
 
-                    result.retries++;
-                    result.receiptHandle = Core::AwsUtils::CreateSqsReceiptHandler();
+                    Entity::SQS::Message result;
+                    result.FromDocument(mResult->view());
                     messageList.push_back(result);
-
-                    // Update values
-                    messageCollection.update_one(make_document(kvp("_id", message["_id"].get_oid())),
-                                                 make_document(kvp("$set",
-                                                                   make_document(kvp("status",
-                                                                                     Entity::SQS::MessageStatusToString(Entity::SQS::MessageStatus::INVISIBLE)),
-                                                                                 kvp("reset", bsoncxx::types::b_date(reset)),
-                                                                                 kvp("receiptHandle", result.receiptHandle),
-                                                                                 kvp("retries", result.retries)))));
                 }
 
-                // Commit
-                session.commit_transaction();
-
-            } catch (mongocxx::exception &e) {
-                log_error << "Collection transaction exception: " << e.what();
-                session.abort_transaction();
+            } catch (const mongocxx::exception &e) {
+                log_error << "Database exception " << e.what();
+                throw Core::DatabaseException(e.what());
             }
 
         } else {
@@ -636,7 +698,7 @@ namespace AwsMock::Database {
                                                   kvp("reset", bsoncxx::types::b_null())))));
                 session.commit_transaction();
 
-                log_trace << "Message reset, updated: " << result->upserted_count() << " queue: " << queueUrl;
+                log_trace << "Message reset, updated: " << result->modified_count() << " queue: " << queueUrl;
 
             } catch (mongocxx::exception &e) {
                 log_error << "Collection transaction exception: " << e.what();
@@ -649,6 +711,71 @@ namespace AwsMock::Database {
         }
     }
 
+    std::chrono::system_clock::time_point SQSDatabase::GetNextMessageReset(const std::string &queueUrl) {
+
+        if (_useDatabase) {
+
+            try {
+
+                auto client = ConnectionPool::instance().GetConnection();
+                auto messageCollection = (*client)[_databaseName][_collectionNameMessage];
+
+                mongocxx::options::find opts;
+                opts.sort(make_document(kvp("reset", 1)));
+                opts.projection(make_document(kvp("reset", 1)));
+
+                bsoncxx::builder::basic::array pending{};
+                pending.append(Entity::SQS::MessageStatusToString(Entity::SQS::MessageStatus::INVISIBLE));
+                pending.append(Entity::SQS::MessageStatusToString(Entity::SQS::MessageStatus::DELAYED));
+                auto mResult = messageCollection.find_one(make_document(kvp("queueUrl", queueUrl),
+                                                                        kvp("status", make_document(kvp("$in", pending)))),
+                                                          opts);
+                if (mResult && mResult->view()["reset"].type() == bsoncxx::type::k_date) {
+                    return bsoncxx::types::b_date(mResult->view()["reset"].get_date());
+                }
+
+            } catch (mongocxx::exception &e) {
+                log_error << "Database exception " << e.what();
+                throw Core::DatabaseException(e.what());
+            }
+            return std::chrono::system_clock::time_point::max();
+
+        } else {
+
+            return _memoryDb.GetNextMessageReset(queueUrl);
+        }
+    }
+
+    std::chrono::system_clock::time_point SQSDatabase::GetNextMessageExpiry(const std::string &queueUrl, long retentionPeriod) {
+
+        if (_useDatabase) {
+
+            try {
+
+                auto client = ConnectionPool::instance().GetConnection();
+                auto messageCollection = (*client)[_databaseName][_collectionNameMessage];
+
+                mongocxx::options::find opts;
+                opts.sort(make_document(kvp("created", 1)));
+                opts.projection(make_document(kvp("created", 1)));
+
+                auto mResult = messageCollection.find_one(make_document(kvp("queueUrl", queueUrl)), opts);
+                if (mResult && mResult->view()["created"].type() == bsoncxx::type::k_date) {
+                    return static_cast<std::chrono::system_clock::time_point>(bsoncxx::types::b_date(mResult->view()["created"].get_date())) + std::chrono::seconds{retentionPeriod};
+                }
+
+            } catch (mongocxx::exception &e) {
+                log_error << "Database exception " << e.what();
+                throw Core::DatabaseException(e.what());
+            }
+            return std::chrono::system_clock::time_point::max();
+
+        } else {
+
+            return _memoryDb.GetNextMessageExpiry(queueUrl, retentionPeriod);
+        }
+    }
+
     void SQSDatabase::RedriveMessages(const std::string &queueUrl, const Entity::SQS::RedrivePolicy &redrivePolicy) {
 
         if (_useDatabase) {
@@ -814,6 +941,11 @@ namespace AwsMock::Database {
 
     Entity::SQS::MessageWaitTime SQSDatabase::GetAverageMessageWaitingTime() {
 
+        // The memory database has no aggregation, the wait times are kept by the SQS statistics
+        if (!_useDatabase) {
+            return {};
+        }
+
         auto client = ConnectionPool::instance().GetConnection();
         auto messageCollection = (*client)[_databaseName][_collectionNameMessage];
 
@@ -921,6 +1053,97 @@ namespace AwsMock::Database {
         }
     }
 
+    std::vector<std::string> SQSDatabase::DeleteMessages(const std::string &queueUrl, const std::vector<std::string> &receiptHandles) {
+
+        if (_useDatabase) {
+
+            auto client = ConnectionPool::instance().GetConnection();
+            auto messageCollection = (*client)[_databaseName][_collectionNameMessage];
+
+            try {
+
+                // The delete result has a count only, so the existing receipt handles are looked up first
+                std::vector<std::string> deleted = FindReceiptHandles(messageCollection, receiptHandles);
+                if (!deleted.empty()) {
+
+                    bsoncxx::builder::basic::array array{};
+                    for (const auto &receiptHandle: deleted) {
+                        array.append(receiptHandle);
+                    }
+                    auto result = messageCollection.delete_many(make_document(kvp("receiptHandle", make_document(kvp("$in", array)))));
+                    log_debug << "Messages deleted, queueUrl: " << queueUrl << " count: " << result->deleted_count();
+                }
+                return deleted;
+
+            } catch (const mongocxx::exception &exc) {
+                log_error << "Database exception " << exc.what();
+                throw Core::DatabaseException(exc.what());
+            }
+
+        } else {
+
+            return _memoryDb.DeleteMessages(queueUrl, receiptHandles);
+        }
+    }
+
+    std::vector<std::string> SQSDatabase::ChangeMessageVisibilities(const std::string &queueUrl, const std::map<std::string, int> &visibilityTimeouts) {
+
+        if (_useDatabase) {
+
+            auto client = ConnectionPool::instance().GetConnection();
+            auto messageCollection = (*client)[_databaseName][_collectionNameMessage];
+
+            try {
+
+                std::vector<std::string> receiptHandles;
+                for (const auto &[receiptHandle, visibilityTimeout]: visibilityTimeouts) {
+                    receiptHandles.emplace_back(receiptHandle);
+                }
+
+                // The bulk write result has counts only, so the existing receipt handles are looked up first
+                std::vector<std::string> changed = FindReceiptHandles(messageCollection, receiptHandles);
+                if (!changed.empty()) {
+
+                    auto now = std::chrono::system_clock::now();
+                    std::vector<mongocxx::model::write> updates;
+                    for (const auto &receiptHandle: changed) {
+                        auto reset = now + std::chrono::seconds(visibilityTimeouts.at(receiptHandle));
+                        updates.emplace_back(mongocxx::model::update_one(make_document(kvp("receiptHandle", receiptHandle)),
+                                                                         make_document(kvp("$set", make_document(kvp("reset", bsoncxx::types::b_date(reset)))))));
+                    }
+                    auto result = messageCollection.bulk_write(updates);
+                    log_debug << "Message visibility changed, queueUrl: " << queueUrl << " count: " << result->modified_count();
+                }
+                return changed;
+
+            } catch (const mongocxx::exception &exc) {
+                log_error << "Database exception " << exc.what();
+                throw Core::DatabaseException(exc.what());
+            }
+
+        } else {
+
+            return _memoryDb.ChangeMessageVisibilities(queueUrl, visibilityTimeouts);
+        }
+    }
+
+    std::vector<std::string> SQSDatabase::FindReceiptHandles(mongocxx::collection &messageCollection, const std::vector<std::string> &receiptHandles) {
+
+        bsoncxx::builder::basic::array array{};
+        for (const auto &receiptHandle: receiptHandles) {
+            array.append(receiptHandle);
+        }
+
+        mongocxx::options::find opts;
+        opts.projection(make_document(kvp("receiptHandle", 1)));
+
+        std::vector<std::string> existing;
+        for (auto message: messageCollection.find(make_document(kvp("receiptHandle", make_document(kvp("$in", array)))), opts)) {
+            existing.emplace_back(bsoncxx::string::to_string(message["receiptHandle"].get_string().value));
+        }
+        return existing;
+    }
+
     void SQSDatabase::DeleteAllMessages() {
 
         if (_useDatabase) {
@@ -7,6 +7,7 @@
 
 // C++ standard includes
 #include <iostream>
+#include <thread>
 #include <vector>
 
 // GTest includes
@@ -147,6 +148,67 @@ namespace AwsMock::Database {
         EXPECT_EQ(result2.size(), 1);
     }
 
+    TEST_F(S3MemoryDbTest, BucketListPageTest) {
+
+        // arrange
+        Entity::S3::Bucket bucket = {.region = _region, .name = BUCKET, .owner = OWNER};
+        _servicedatabase.CreateBucket(bucket);
+        for (const auto &key: {"a", "b/1", "b/2", "c", "d/1", "e"}) {
+            _servicedatabase.CreateObject({.bucket = bucket.name, .key = key, .owner = OWNER, .size = 5});
+        }
+
+        // act, pages of two elements
+        std::vector<std::string> firstPrefixes, secondPrefixes, thirdPrefixes;
+        bool firstTruncated, secondTruncated, thirdTruncated;
+        Entity::S3::ObjectList first = _servicedatabase.ListBucket(bucket.name, "", "/", "", 2, firstPrefixes, firstTruncated);
+        Entity::S3::ObjectList second = _servicedatabase.ListBucket(bucket.name, "", "/", "b/", 2, secondPrefixes, secondTruncated);
+        Entity::S3::ObjectList third = _servicedatabase.ListBucket(bucket.name, "", "/", "d/", 2, thirdPrefixes, thirdTruncated);
+
+        // assert
+        ASSERT_EQ(1, first.size());
+        EXPECT_EQ("a", first[0].key);
+        ASSERT_EQ(1, firstPrefixes.size());
+        EXPECT_EQ("b/", firstPrefixes[0]);
+        EXPECT_TRUE(firstTruncated);
+        ASSERT_EQ(1, second.size());
+        EXPECT_EQ("c", second[0].key);
+        ASSERT_EQ(1, secondPrefixes.size());
+        EXPECT_EQ("d/", secondPrefixes[0]);
+        EXPECT_TRUE(secondTruncated);
+        ASSERT_EQ(1, third.size());
+        EXPECT_EQ("e", third[0].key);
+        EXPECT_TRUE(thirdPrefixes.empty());
+        EXPECT_FALSE(thirdTruncated);
+    }
+
+    TEST_F(S3MemoryDbTest, MultipartUploadPartTest) {
+
+        // arrange
+        _servicedatabase.CreateMultipartUpload({.region = _region, .bucket = BUCKET, .key = OBJECT, .owner = OWNER, .uploadId = "upload-1"});
+        std::vector<std::thread> threads;
+        for (int part = 1; part <= 16; part++) {
+            threads.emplace_back([this, part]() {
+                _servicedatabase.AddMultipartPart("upload-1", {.partNumber = part, .size = 5, .md5sum = "md5-" + std::to_string(part), .fileName = "part-" + std::to_string(part)});
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+
+        // act
+        Entity::S3::MultipartPart replaced = _servicedatabase.AddMultipartPart("upload-1", {.partNumber = 3, .size = 7, .md5sum = "md5-3a", .fileName = "part-3a"});
+        Entity::S3::MultipartUpload result = _servicedatabase.GetMultipartUpload("upload-1");
+        _servicedatabase.DeleteMultipartUpload("upload-1");
+
+        // assert
+        EXPECT_EQ("part-3", replaced.fileName);
+        ASSERT_EQ(16, result.parts.size());
+        EXPECT_EQ(7, result.parts[3].size);
+        EXPECT_EQ("part-3a", result.parts[3].fileName);
+        EXPECT_TRUE(_servicedatabase.GetMultipartUpload("upload-1").uploadId.empty());
+        EXPECT_THROW(_servicedatabase.AddMultipartPart("upload-1", {.partNumber = 1}), Core::DatabaseException);
+    }
+
     TEST_F(S3MemoryDbTest, BucketHasObjetsTest) {
 
         // arrange
@@ -329,6 +391,45 @@ namespace AwsMock::Database {
         EXPECT_EQ(0, result);
     }
 
+    TEST_F(S3MemoryDbTest, ObjectListAfterTest) {
+
+        // arrange
+        Entity::S3::Bucket bucket = {.region = _region, .name = BUCKET, .owner = OWNER};
+        bucket = _servicedatabase.CreateBucket(bucket);
+        for (int i = 0; i < 10; i++) {
+            std::string key = std::string(OBJECT) + "-" + std::to_string(i);
+            _servicedatabase.CreateObject({.bucket = bucket.name, .key = key, .owner = OWNER});
+        }
+
+        // act
+        Entity::S3::ObjectList first = _servicedatabase.ListObjectsAfter("", 6);
+        Entity::S3::ObjectList second = _servicedatabase.ListObjectsAfter(first.back().oid, 6);
+
+        // assert
+        EXPECT_EQ(6, first.size());
+        EXPECT_EQ(4, second.size());
+        EXPECT_TRUE(first.back().oid < second.front().oid);
+    }
+
+    TEST_F(S3MemoryDbTest, ObjectDeleteListTest) {
+
+        // arrange
+        Entity::S3::Bucket bucket = {.region = _region, .name = BUCKET, .owner = OWNER};
+        bucket = _servicedatabase.CreateBucket(bucket);
+        Entity::S3::Object object1 = _servicedatabase.CreateObject({.bucket = bucket.name, .key = "key1", .owner = OWNER, .internalName = "file1"});
+        Entity::S3::Object object2 = _servicedatabase.CreateObject({.bucket = bucket.name, .key = "key2", .owner = OWNER, .internalName = "file2"});
+
+        // Object has been overwritten in between
+        object2.internalName = "file3";
+
+        // act
+        EXPECT_NO_THROW({ _servicedatabase.DeleteObjects(Entity::S3::ObjectList{object1, object2}); });
+        long result = _servicedatabase.ObjectCount(bucket.region, bucket.name);
+
+        // assert
+        EXPECT_EQ(1, result);
+    }
+
     TEST_F(S3MemoryDbTest, ObjectDeleteAllTest) {
 
         // arrange
@@ -6,7 +6,10 @@
 #define AWMOCK_CORE_SQSMEMORYDBTEST_H
 
 // C++ includes
+#include <atomic>
 #include <chrono>
+#include <thread>
+#include <vector>
 
 // GTest includes
 #include <gtest/gtest.h>
@@ -175,6 +178,26 @@ namespace AwsMock::Database {
         EXPECT_TRUE(result.owner == queue.owner);
     }
 
+    TEST_F(SQSMemoryDbTest, QueueUpdateIndexTest) {
+
+        // arrange
+        Entity::SQS::Queue queue = {.region = _region, .name = QUEUE_NAME, .owner = OWNER, .queueUrl = _queueUrl, .queueArn = _queueArn};
+        queue = _sqsDatabase.CreateQueue(queue);
+
+        // act
+        queue.queueArn = _queueArn + "-renamed";
+        _sqsDatabase.UpdateQueue(queue);
+        bool oldArnExists = _sqsDatabase.QueueArnExists(_queueArn);
+        Entity::SQS::Queue result = _sqsDatabase.GetQueueByArn(queue.queueArn);
+        _sqsDatabase.DeleteQueue(queue);
+
+        // assert
+        EXPECT_FALSE(oldArnExists);
+        EXPECT_EQ(queue.oid, result.oid);
+        EXPECT_FALSE(_sqsDatabase.QueueUrlExists(_region, _queueUrl));
+        EXPECT_FALSE(_sqsDatabase.QueueArnExists(queue.queueArn));
+    }
+
     TEST_F(SQSMemoryDbTest, QueueCountTest) {
 
         // arrange
@@ -215,6 +238,22 @@ namespace AwsMock::Database {
         EXPECT_FALSE(result);
     }
 
+    TEST_F(SQSMemoryDbTest, QueueDeleteMessageStoreTest) {
+
+        // arrange
+        Entity::SQS::Queue queue = {.region = _region, .name = QUEUE_NAME, .owner = OWNER, .queueUrl = _queueUrl};
+        queue = _sqsDatabase.CreateQueue(queue);
+        Entity::SQS::Message message = {.region = _region, .queueUrl = _queueUrl, .body = BODY};
+        _sqsDatabase.CreateMessage(message);
+
+        // act
+        _sqsDatabase.DeleteQueue(queue);
+        long result = _sqsDatabase.CountMessages();
+
+        // assert
+        EXPECT_EQ(0, result);
+    }
+
     TEST_F(SQSMemoryDbTest, MessageCreateTest) {
 
         // arrange
@@ -276,6 +315,48 @@ namespace AwsMock::Database {
         EXPECT_FALSE(messageList.empty());
     }
 
+    TEST_F(SQSMemoryDbTest, MessageReceiveOrderTest) {
+
+        // arrange
+        Entity::SQS::Queue queue = {.region = _region, .name = QUEUE_NAME, .owner = OWNER, .queueUrl = _queueUrl};
+        queue = _sqsDatabase.CreateQueue(queue);
+        Entity::SQS::Queue dlQueue = {.region = _region, .name = DLQ_NAME, .owner = OWNER, .queueUrl = _dlqueueUrl};
+        dlQueue = _sqsDatabase.CreateQueue(dlQueue);
+        for (int i = 0; i < 5; i++) {
+            _sqsDatabase.CreateMessage({.region = _region, .queueUrl = queue.queueUrl, .body = std::to_string(i)});
+        }
+        _sqsDatabase.CreateMessage({.region = _region, .queueUrl = dlQueue.queueUrl, .body = BODY});
+
+        // act
+        Entity::SQS::MessageList messageList1, messageList2;
+        _sqsDatabase.ReceiveMessages(_region, queue.queueUrl, 30, 3, messageList1);
+        _sqsDatabase.ReceiveMessages(_region, queue.queueUrl, 30, 10, messageList2);
+
+        // assert
+        ASSERT_EQ(3, messageList1.size());
+        ASSERT_EQ(2, messageList2.size());
+        EXPECT_EQ("0", messageList1[0].body);
+        EXPECT_EQ("2", messageList1[2].body);
+        EXPECT_EQ("4", messageList2[1].body);
+        EXPECT_EQ(1, _sqsDatabase.CountMessagesByStatus(_region, dlQueue.queueUrl, Entity::SQS::MessageStatus::INITIAL));
+    }
+
+    TEST_F(SQSMemoryDbTest, MessageRetentionTest) {
+
+        // arrange
+        Entity::SQS::Queue queue = {.region = _region, .name = QUEUE_NAME, .owner = OWNER, .queueUrl = _queueUrl};
+        queue = _sqsDatabase.CreateQueue(queue);
+        _sqsDatabase.CreateMessage({.region = _region, .queueUrl = queue.queueUrl, .body = BODY, .created = system_clock::now() - std::chrono::seconds(120)});
+        _sqsDatabase.CreateMessage({.region = _region, .queueUrl = queue.queueUrl, .body = BODY});
+
+        // act
+        _sqsDatabase.MessageRetention(queue.queueUrl, 60);
+        long result = _sqsDatabase.CountMessages(_region, queue.queueUrl);
+
+        // assert
+        EXPECT_EQ(1, result);
+    }
+
     TEST_F(SQSMemoryDbTest, MessageCountTest) {
 
         // arrange
@@ -458,6 +539,159 @@ namespace AwsMock::Database {
         EXPECT_EQ(0, result);
     }
 
+    TEST_F(SQSMemoryDbTest, MessageBatchTest) {
+
+        // arrange
+        Entity::SQS::Queue queue = {.region = _region, .name = QUEUE_NAME, .owner = OWNER, .queueUrl = _queueUrl};
+        queue = _sqsDatabase.CreateQueue(queue);
+        Entity::SQS::MessageList messages;
+        for (int i = 0; i < 3; i++) {
+            messages.push_back({.region = _region, .queueUrl = queue.queueUrl, .body = std::to_string(i), .receiptHandle = "receipt-" + std::to_string(i)});
+        }
+        messages = _sqsDatabase.CreateMessages(messages);
+        Entity::SQS::MessageList messageList;
+        _sqsDatabase.ReceiveMessages(_region, queue.queueUrl, 30, 3, messageList);
+
+        // act
+        std::vector<std::string> changed = _sqsDatabase.ChangeMessageVisibilities(queue.queueUrl, {{messageList[0].receiptHandle, 0}, {"unknown", 0}});
+        std::vector<std::string> deleted = _sqsDatabase.DeleteMessages(queue.queueUrl, {messageList[1].receiptHandle, messageList[2].receiptHandle, "unknown"});
+        _sqsDatabase.ResetMessages(queue.queueUrl, 30);
+        long visible = _sqsDatabase.CountMessagesByStatus(_region, queue.queueUrl, Entity::SQS::MessageStatus::INITIAL);
+
+        // assert
+        EXPECT_EQ(3, messages.size());
+        EXPECT_FALSE(messages[0].oid.empty());
+        EXPECT_EQ(1, changed.size());
+        EXPECT_EQ(2, deleted.size());
+        EXPECT_EQ(1, _sqsDatabase.CountMessages(_region, queue.queueUrl));
+        EXPECT_EQ(1, visible);
+    }
+
+    TEST_F(SQSMemoryDbTest, MessageFifoGroupTest) {
+
+        // arrange
+        std::string queueUrl = Core::CreateSQSQueueUrl(QUEUE_NAME ".fifo");
+        Entity::SQS::Queue queue = {.region = _region, .name = QUEUE_NAME ".fifo", .owner = OWNER, .queueUrl = queueUrl};
+        queue = _sqsDatabase.CreateQueue(queue);
+        for (const auto &[group, body]: std::vector<std::pair<std::string, std::string>>{{"a", "a1"}, {"b", "b1"}, {"a", "a2"}, {"a", "a3"}}) {
+            _sqsDatabase.CreateMessage({.region = _region, .queueUrl = queueUrl, .body = body, .receiptHandle = Core::AwsUtils::CreateSqsReceiptHandler(), .attributes = {{"MessageGroupId", group}}});
+        }
+
+        // act
+        Entity::SQS::MessageList first, locked, next;
+        _sqsDatabase.ReceiveMessages(_region, queueUrl, 30, 2, first);
+        _sqsDatabase.ReceiveMessages(_region, queueUrl, 30, 10, locked);
+        _sqsDatabase.DeleteMessage(first[0]);
+        _sqsDatabase.DeleteMessage(first[1]);
+        _sqsDatabase.ReceiveMessages(_region, queueUrl, 30, 10, next);
+
+        // assert
+        ASSERT_EQ(2, first.size());
+        EXPECT_EQ("a1", first[0].body);
+        EXPECT_EQ("a2", first[1].body);
+        ASSERT_EQ(1, locked.size());
+        EXPECT_EQ("b1", locked[0].body);
+        ASSERT_EQ(1, next.size());
+        EXPECT_EQ("a3", next[0].body);
+    }
+
+    TEST_F(SQSMemoryDbTest, MessageCountByStatusTest) {
+
+        // arrange
+        Entity::SQS::Queue queue = {.region = _region, .name = QUEUE_NAME, .owner = OWNER, .queueUrl = _queueUrl};
+        queue = _sqsDatabase.CreateQueue(queue);
+        _sqsDatabase.CreateMessage({.region = _region, .queueUrl = queue.queueUrl, .body = BODY});
+        _sqsDatabase.CreateMessage({.region = _region, .queueUrl = queue.queueUrl, .body = BODY});
+        _sqsDatabase.CreateMessage({.region = _region, .queueUrl = queue.queueUrl, .body = BODY, .status = Entity::SQS::MessageStatus::DELAYED, .reset = system_clock::now() + std::chrono::seconds(30)});
+
+        // act
+        Entity::SQS::MessageList messageList;
+        _sqsDatabase.ReceiveMessages(_region, queue.queueUrl, 30, 1, messageList);
+        long visible = _sqsDatabase.CountMessagesByStatus(_region, queue.queueUrl, Entity::SQS::MessageStatus::INITIAL);
+        long invisible = _sqsDatabase.CountMessagesByStatus(_region, queue.queueUrl, Entity::SQS::MessageStatus::INVISIBLE);
+        long delayed = _sqsDatabase.CountMessagesByStatus(_region, queue.queueUrl, Entity::SQS::MessageStatus::DELAYED);
+        _sqsDatabase.DeleteMessage(messageList[0]);
+        long invisibleAfterDelete = _sqsDatabase.CountMessagesByStatus(_region, queue.queueUrl, Entity::SQS::MessageStatus::INVISIBLE);
+
+        // assert
+        EXPECT_EQ(1, visible);
+        EXPECT_EQ(1, invisible);
+        EXPECT_EQ(1, delayed);
+        EXPECT_EQ(0, invisibleAfterDelete);
+        EXPECT_EQ(system_clock::time_point::max(), _sqsDatabase.GetNextMessageExpiry("unknown-queue", 60));
+    }
+
+    TEST_F(SQSMemoryDbTest, MessageBodySharedTest) {
+
+        // arrange
+        Entity::SQS::Queue queue = {.region = _region, .name = QUEUE_NAME, .owner = OWNER, .queueUrl = _queueUrl};
+        queue = _sqsDatabase.CreateQueue(queue);
+        Entity::SQS::Message message = {.region = _region, .queueUrl = queue.queueUrl, .body = std::string(64 * 1024, 'x'), .receiptHandle = Core::AwsUtils::CreateSqsReceiptHandler()};
+        _sqsDatabase.CreateMessage(message);
+
+        // act
+        Entity::SQS::MessageList messageList;
+        _sqsDatabase.ReceiveMessages(_region, queue.queueUrl, 30, 1, messageList);
+
+        // assert
+        ASSERT_EQ(1, messageList.size());
+        EXPECT_EQ(message.body.c_str(), messageList[0].body.c_str());
+    }
+
+
+    TEST_F(SQSMemoryDbTest, MessageReceiptHandleIndexTest) {
+
+        // arrange
+        Entity::SQS::Queue queue = {.region = _region, .name = QUEUE_NAME, .owner = OWNER, .queueUrl = _queueUrl};
+        queue = _sqsDatabase.CreateQueue(queue);
+        Entity::SQS::Message message = {.region = _region, .queueUrl = queue.queueUrl, .body = BODY, .receiptHandle = Core::AwsUtils::CreateSqsReceiptHandler()};
+        _sqsDatabase.CreateMessage(message);
+
+        // act
+        Entity::SQS::MessageList messageList;
+        _sqsDatabase.ReceiveMessages(_region, queue.queueUrl, 30, 1, messageList);
+        bool oldHandleExists = _sqsDatabase.MessageExists(message.receiptHandle);
+        bool newHandleExists = _sqsDatabase.MessageExists(messageList[0].receiptHandle);
+        _sqsDatabase.PurgeQueue(_region, queue.queueUrl);
+
+        // assert
+        EXPECT_FALSE(oldHandleExists);
+        EXPECT_TRUE(newHandleExists);
+        EXPECT_FALSE(_sqsDatabase.MessageExists(messageList[0].receiptHandle));
+    }
+
+    TEST_F(SQSMemoryDbTest, MessageConcurrentReceiveTest) {
+
+        // arrange
+        Entity::SQS::Queue queue = {.region = _region, .name = QUEUE_NAME, .owner = OWNER, .queueUrl = _queueUrl};
+        queue = _sqsDatabase.CreateQueue(queue);
+        for (int i = 0; i < 400; i++) {
+            _sqsDatabase.CreateMessage({.region = _region, .queueUrl = queue.queueUrl, .body = BODY, .receiptHandle = Core::AwsUtils::CreateSqsReceiptHandler()});
+        }
+
+        // act
+        std::atomic<long> received = 0;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; t++) {
+            threads.emplace_back([this, &queue, &received]() {
+                Entity::SQS::MessageList messageList;
+                do {
+                    messageList.clear();
+                    _sqsDatabase.ReceiveMessages(_region, queue.queueUrl, 30, 10, messageList);
+                    received += static_cast<long>(messageList.size());
+                    EXPECT_TRUE(_sqsDatabase.QueueUrlExists(_region, queue.queueUrl));
+                } while (!messageList.empty());
+            });
+        }
+        for (auto &thread: threads) {
+            thread.join();
+        }
+
+        // assert
+        EXPECT_EQ(400, received);
+        EXPECT_EQ(400, _sqsDatabase.CountMessagesByStatus(_region, queue.queueUrl, Entity::SQS::MessageStatus::INVISIBLE));
+    }
+
 }// namespace AwsMock::Database
 
 #endif// AWMOCK_CORE_SQSMEMORYDBTEST_H
\ No newline at end of file
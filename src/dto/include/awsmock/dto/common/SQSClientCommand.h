@@ -38,8 +38,10 @@ namespace AwsMock::Dto::Common {
         LIST_QUEUES,
         DELETE_QUEUE,
         SEND_MESSAGE,
+        SEND_MESSAGE_BATCH,
         RECEIVE_MESSAGE,
         CHANGE_MESSAGE_VISIBILITY,
+        CHANGE_MESSAGE_VISIBILITY_BATCH,
         DELETE_MESSAGE,
         DELETE_MESSAGE_BATCH,
         UNKNOWN
@@ -55,8 +57,10 @@ namespace AwsMock::Dto::Common {
             {SqsCommandType::LIST_QUEUES, "list-queues"},
             {SqsCommandType::DELETE_QUEUE, "delete-queue"},
             {SqsCommandType::SEND_MESSAGE, "send-message"},
+            {SqsCommandType::SEND_MESSAGE_BATCH, "send-message-batch"},
             {SqsCommandType::RECEIVE_MESSAGE, "receive-message"},
             {SqsCommandType::CHANGE_MESSAGE_VISIBILITY, "change-message-visibility"},
+            {SqsCommandType::CHANGE_MESSAGE_VISIBILITY_BATCH, "change-message-visibility-batch"},
             {SqsCommandType::DELETE_MESSAGE, "delete-message"},
             {SqsCommandType::DELETE_MESSAGE_BATCH, "delete-message-batch"},
     };
@@ -8,15 +8,31 @@
 // C++ standard includes
 #include <sstream>
 #include <string>
+#include <vector>
 
 // AwsMock includes
 #include <awsmock/core/JsonUtils.h>
 #include <awsmock/core/LogStream.h>
+#include <awsmock/core/StringUtils.h>
 #include <awsmock/core/XmlUtils.h>
+#include <awsmock/core/exception/BadRequestException.h>
 #include <awsmock/core/exception/JsonException.h>
 
 namespace AwsMock::Dto::S3 {
 
+    struct CompletedPart {
+
+        /**
+         * Part number
+         */
+        int partNumber = 0;
+
+        /**
+         * Part ETag, as returned by the upload of the part
+         */
+        std::string eTag;
+    };
+
     struct CompleteMultipartUploadRequest {
 
         /**
@@ -45,10 +61,15 @@ namespace AwsMock::Dto::S3 {
         std::string uploadId;
 
         /**
-         * AWS upload ID
+         * Checksum algorithm
          */
         std::string checksumAlgorithm;
 
+        /**
+         * Parts of the object, in request order. Empty, if the request has no body.
+         */
+        std::vector<CompletedPart> parts;
+
         /**
          * Convert to a JSON string
          *
@@ -57,9 +78,10 @@ namespace AwsMock::Dto::S3 {
         [[nodiscard]] std::string ToJson() const;
 
         /**
-         * Convert from XML representation
+         * Convert from XML representation, reads the parts of a CompleteMultipartUpload document
          *
          * @param xmlString XML string
+         * @throws Core::BadRequestException if a part number is not a non-negative integer
          */
         void FromXml(const std::string &xmlString);
 
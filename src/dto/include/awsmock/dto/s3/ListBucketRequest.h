@@ -49,6 +49,21 @@ namespace AwsMock::Dto::S3 {
          */
         std::string encodingType;
 
+        /**
+         * Maximal number of keys and common prefixes
+         */
+        int maxKeys = 1000;
+
+        /**
+         * Continuation token of the previous page
+         */
+        std::string continuationToken;
+
+        /**
+         * Start after this key, marker for list type 1
+         */
+        std::string startAfter;
+
         /**
          * Convert to a JSON string
          *
@@ -41,6 +41,11 @@ namespace AwsMock::Dto::S3 {
          */
         std::vector<Content> contents;
 
+        /**
+         * Common prefixes
+         */
+        std::vector<CommonPrefix> commonPrefixes;
+
         /**
          * Name
          */
@@ -86,6 +91,11 @@ namespace AwsMock::Dto::S3 {
          */
         std::string startAfter;
 
+        /**
+         * Next marker, list type 1 only
+         */
+        std::string nextMarker;
+
         /**
          * Convert to a JSON string
          *
@@ -0,0 +1,73 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#ifndef AWSMOCK_DTO_SQS_CHANGE_MESSAGE_VISIBILITY_BATCH_ENTRY_H
+#define AWSMOCK_DTO_SQS_CHANGE_MESSAGE_VISIBILITY_BATCH_ENTRY_H
+
+// C++ standard includes
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Poco includes
+#include <Poco/JSON/JSON.h>
+#include <Poco/JSON/Parser.h>
+
+// AwsMock includes
+#include <awsmock/core/JsonUtils.h>
+#include <awsmock/core/exception/ServiceException.h>
+
+namespace AwsMock::Dto::SQS {
+
+    struct ChangeMessageVisibilityBatchEntry {
+
+        /**
+         * Entry ID, unique within the batch
+         */
+        std::string id;
+
+        /**
+         * Receipt handle
+         */
+        std::string receiptHandle;
+
+        /**
+         * New visibility timeout in seconds
+         */
+        int visibilityTimeout = 0;
+
+        /**
+         * Converts the entry from a JSON object
+         *
+         * @param jsonObject JSON object
+         */
+        void FromJsonObject(const Poco::JSON::Object::Ptr &jsonObject);
+
+        /**
+         * Convert to a JSON object
+         *
+         * @return JSON object
+         */
+        [[nodiscard]] Poco::JSON::Object ToJsonObject() const;
+
+        /**
+         * Converts the DTO to a string representation.
+         *
+         * @return DTO as string for logging.
+         */
+        [[nodiscard]] std::string ToString() const;
+
+        /**
+         * Stream provider.
+         *
+         * @return output stream
+         */
+        friend std::ostream &operator<<(std::ostream &os, const ChangeMessageVisibilityBatchEntry &e);
+    };
+
+    typedef std::vector<ChangeMessageVisibilityBatchEntry> ChangeMessageVisibilityBatchEntries;
+
+}// namespace AwsMock::Dto::SQS
+
+#endif// AWSMOCK_DTO_SQS_CHANGE_MESSAGE_VISIBILITY_BATCH_ENTRY_H
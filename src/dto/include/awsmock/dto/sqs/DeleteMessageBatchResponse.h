@@ -0,0 +1,98 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#ifndef AWSMOCK_DTO_SQS_DELETE_MESSAGE_BATCH_RESPONSE_H
+#define AWSMOCK_DTO_SQS_DELETE_MESSAGE_BATCH_RESPONSE_H
+
+// C++ standard includes
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Poco includes
+#include <Poco/DOM/AutoPtr.h>
+#include <Poco/DOM/Document.h>
+#include <Poco/DOM/Element.h>
+#include <Poco/JSON/Object.h>
+
+// AwsMock includes
+#include <awsmock/core/JsonUtils.h>
+#include <awsmock/core/LogStream.h>
+#include <awsmock/core/XmlUtils.h>
+#include <awsmock/core/exception/ServiceException.h>
+#include <awsmock/dto/sqs/model/BatchResultErrorEntry.h>
+
+namespace AwsMock::Dto::SQS {
+
+    /**
+     * Delete message batch response
+     *
+     * Example:
+     * @code{.json}
+     * {
+     *   "Failed": [
+     *     {
+     *       "Code": "ReceiptHandleIsInvalid",
+     *       "Id": "string",
+     *       "Message": "string",
+     *       "SenderFault": true
+     *     }
+     *   ],
+     *   "Successful": [
+     *     {
+     *       "Id": "string"
+     *     }
+     *   ]
+     * }
+     * @endcode
+     */
+    struct DeleteMessageBatchResponse {
+
+        /**
+         * IDs of the successful entries
+         */
+        std::vector<std::string> successful;
+
+        /**
+         * Failed entries
+         */
+        BatchResultErrorEntries failed;
+
+        /**
+         * Request ID
+         */
+        std::string requestId;
+
+        /**
+         * Convert to JSON representation
+         *
+         * @return JSON string
+         */
+        [[nodiscard]] std::string ToJson() const;
+
+        /**
+         * Convert to XML representation
+         *
+         * @return XML string
+         */
+        [[nodiscard]] std::string ToXml() const;
+
+        /**
+         * Converts the DTO to a string representation.
+         *
+         * @return DTO as string for logging.
+         */
+        [[nodiscard]] std::string ToString() const;
+
+        /**
+         * Stream provider.
+         *
+         * @return output stream
+         */
+        friend std::ostream &operator<<(std::ostream &os, const DeleteMessageBatchResponse &r);
+    };
+
+}// namespace AwsMock::Dto::SQS
+
+#endif// AWSMOCK_DTO_SQS_DELETE_MESSAGE_BATCH_RESPONSE_H
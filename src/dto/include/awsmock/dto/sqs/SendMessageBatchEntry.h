@@ -0,0 +1,91 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#ifndef AWSMOCK_DTO_SQS_SEND_MESSAGE_BATCH_ENTRY_H
+#define AWSMOCK_DTO_SQS_SEND_MESSAGE_BATCH_ENTRY_H
+
+// C++ standard includes
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Poco includes
+#include <Poco/JSON/JSON.h>
+#include <Poco/JSON/Parser.h>
+
+// AwsMock includes
+#include <awsmock/core/JsonUtils.h>
+#include <awsmock/core/SharedString.h>
+#include <awsmock/core/exception/ServiceException.h>
+#include <awsmock/dto/sqs/model/MessageAttribute.h>
+
+namespace AwsMock::Dto::SQS {
+
+    struct SendMessageBatchEntry {
+
+        /**
+         * Entry ID, unique within the batch
+         */
+        std::string id;
+
+        /**
+         * Message body
+         */
+        Core::SharedString body;
+
+        /**
+         * Attributes (system attributes)
+         */
+        std::map<std::string, std::string> attributes;
+
+        /**
+         * Message attributes (user attributes)
+         */
+        MessageAttributeList messageAttributes;
+
+        /**
+         * Message group ID, FIFO queues only
+         */
+        std::string messageGroupId;
+
+        /**
+         * Message deduplication ID, FIFO queues only
+         */
+        std::string messageDeduplicationId;
+
+        /**
+         * Converts the entry from a JSON object
+         *
+         * @param jsonObject JSON object
+         */
+        void FromJsonObject(const Poco::JSON::Object::Ptr &jsonObject);
+
+        /**
+         * Convert to a JSON object
+         *
+         * @return JSON object
+         */
+        [[nodiscard]] Poco::JSON::Object ToJsonObject() const;
+
+        /**
+         * Converts the DTO to a string representation.
+         *
+         * @return DTO as string for logging.
+         */
+        [[nodiscard]] std::string ToString() const;
+
+        /**
+         * Stream provider.
+         *
+         * @return output stream
+         */
+        friend std::ostream &operator<<(std::ostream &os, const SendMessageBatchEntry &e);
+    };
+
+    typedef std::vector<SendMessageBatchEntry> SendMessageBatchEntries;
+
+}// namespace AwsMock::Dto::SQS
+
+#endif// AWSMOCK_DTO_SQS_SEND_MESSAGE_BATCH_ENTRY_H
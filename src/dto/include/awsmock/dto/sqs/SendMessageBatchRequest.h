@@ -0,0 +1,102 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#ifndef AWSMOCK_DTO_SQS_SEND_MESSAGE_BATCH_REQUEST_H
+#define AWSMOCK_DTO_SQS_SEND_MESSAGE_BATCH_REQUEST_H
+
+// C++ standard includes
+#include <sstream>
+#include <string>
+
+// Poco includes
+#include <Poco/JSON/JSON.h>
+#include <Poco/JSON/Parser.h>
+#include <Poco/UUID.h>
+#include <Poco/UUIDGenerator.h>
+
+// AwsMock includes
+#include <awsmock/core/AwsUtils.h>
+#include <awsmock/core/JsonUtils.h>
+#include <awsmock/core/exception/ServiceException.h>
+#include <awsmock/dto/sqs/SendMessageBatchEntry.h>
+
+namespace AwsMock::Dto::SQS {
+
+    /**
+     * Send message batch request
+     *
+     * Example:
+     * @code{.json}
+     * {
+     *   "QueueUrl": "http://localhost:4566/000000000000/test-queue",
+     *   "Entries": [
+     *     {
+     *       "Id": "1",
+     *       "MessageBody": "string",
+     *       "MessageAttributes": {},
+     *       "MessageSystemAttributes": {}
+     *     }
+     *   ]
+     * }
+     * @endcode
+     */
+    struct SendMessageBatchRequest {
+
+        /**
+         * AWS region
+         */
+        std::string region;
+
+        /**
+         * Queue URL
+         */
+        std::string queueUrl;
+
+        /**
+         * Entries
+         */
+        SendMessageBatchEntries entries;
+
+        /**
+         * Sender ID
+         */
+        std::string senderId;
+
+        /**
+         * Request ID
+         */
+        std::string requestId = Poco::UUIDGenerator().createRandom().toString();
+
+        /**
+         * Converts the JSON string to a DTO
+         *
+         * @param jsonString JSON string
+         */
+        void FromJson(const std::string &jsonString);
+
+        /**
+         * Convert to a JSON string
+         *
+         * @return JSON string
+         */
+        [[nodiscard]] std::string ToJson() const;
+
+        /**
+         * Converts the DTO to a string representation.
+         *
+         * @return DTO as string for logging.
+         */
+        [[nodiscard]] std::string ToString() const;
+
+        /**
+         * Stream provider.
+         *
+         * @return output stream
+         */
+        friend std::ostream &operator<<(std::ostream &os, const SendMessageBatchRequest &r);
+    };
+
+}// namespace AwsMock::Dto::SQS
+
+#endif// AWSMOCK_DTO_SQS_SEND_MESSAGE_BATCH_REQUEST_H
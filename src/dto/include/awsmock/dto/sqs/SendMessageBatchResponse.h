@@ -0,0 +1,146 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#ifndef AWSMOCK_DTO_SQS_SEND_MESSAGE_BATCH_RESPONSE_H
+#define AWSMOCK_DTO_SQS_SEND_MESSAGE_BATCH_RESPONSE_H
+
+// C++ standard includes
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Poco includes
+#include <Poco/DOM/AutoPtr.h>
+#include <Poco/DOM/Document.h>
+#include <Poco/DOM/Element.h>
+#include <Poco/JSON/Object.h>
+
+// AwsMock includes
+#include <awsmock/core/JsonUtils.h>
+#include <awsmock/core/LogStream.h>
+#include <awsmock/core/XmlUtils.h>
+#include <awsmock/core/exception/ServiceException.h>
+#include <awsmock/dto/sqs/model/BatchResultErrorEntry.h>
+
+namespace AwsMock::Dto::SQS {
+
+    /**
+     * Successful entry of a send message batch request
+     */
+    struct SendMessageBatchResultEntry {
+
+        /**
+         * Entry ID
+         */
+        std::string id;
+
+        /**
+         * Message ID
+         */
+        std::string messageId;
+
+        /**
+         * MD5 sum of body
+         */
+        std::string md5Body;
+
+        /**
+         * MD5 sum of user attributes
+         */
+        std::string md5UserAttr;
+
+        /**
+         * MD5 sum of system attributes
+         */
+        std::string md5SystemAttr;
+
+        /**
+         * Message sequence number, FIFO queues only
+         */
+        std::string sequenceNumber;
+
+        /**
+         * Convert to a JSON object
+         *
+         * @return JSON object
+         */
+        [[nodiscard]] Poco::JSON::Object ToJsonObject() const;
+    };
+
+    /**
+     * Send message batch response
+     *
+     * Example:
+     * @code{.json}
+     * {
+     *   "Failed": [
+     *     {
+     *       "Code": "string",
+     *       "Id": "string",
+     *       "Message": "string",
+     *       "SenderFault": boolean
+     *     }
+     *   ],
+     *   "Successful": [
+     *     {
+     *       "Id": "string",
+     *       "MD5OfMessageAttributes": "string",
+     *       "MD5OfMessageBody": "string",
+     *       "MD5OfMessageSystemAttributes": "string",
+     *       "MessageId": "string",
+     *       "SequenceNumber": "string"
+     *     }
+     *   ]
+     * }
+     * @endcode
+     */
+    struct SendMessageBatchResponse {
+
+        /**
+         * Successful entries
+         */
+        std::vector<SendMessageBatchResultEntry> successful;
+
+        /**
+         * Failed entries
+         */
+        BatchResultErrorEntries failed;
+
+        /**
+         * Request ID
+         */
+        std::string requestId;
+
+        /**
+         * Convert to JSON representation
+         *
+         * @return JSON string
+         */
+        [[nodiscard]] std::string ToJson() const;
+
+        /**
+         * Convert to XML representation
+         *
+         * @return XML string
+         */
+        [[nodiscard]] std::string ToXml() const;
+
+        /**
+         * Converts the DTO to a string representation.
+         *
+         * @return DTO as string for logging.
+         */
+        [[nodiscard]] std::string ToString() const;
+
+        /**
+         * Stream provider.
+         *
+         * @return output stream
+         */
+        friend std::ostream &operator<<(std::ostream &os, const SendMessageBatchResponse &r);
+    };
+
+}// namespace AwsMock::Dto::SQS
+
+#endif// AWSMOCK_DTO_SQS_SEND_MESSAGE_BATCH_RESPONSE_H
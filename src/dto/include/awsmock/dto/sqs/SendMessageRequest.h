@@ -19,6 +19,7 @@
 #include "awsmock/dto/sqs/model/MessageAttribute.h"
 #include <awsmock/core/AwsUtils.h>
 #include <awsmock/core/JsonUtils.h>
+#include <awsmock/core/SharedString.h>
 #include <awsmock/dto/sqs/SqsCommonRequest.h>
 
 namespace AwsMock::Dto::SQS {
@@ -110,7 +111,7 @@ namespace AwsMock::Dto::SQS {
         /**
          * Message body
          */
-        std::string body;
+        Core::SharedString body;
 
         /**
          * Attributes (system attributes)
@@ -122,6 +123,16 @@ namespace AwsMock::Dto::SQS {
          */
         MessageAttributeList messageAttributes;
 
+        /**
+         * Message group ID, FIFO queues only
+         */
+        std::string messageGroupId;
+
+        /**
+         * Message deduplication ID, FIFO queues only
+         */
+        std::string messageDeduplicationId;
+
         /**
          * Message ID
          */
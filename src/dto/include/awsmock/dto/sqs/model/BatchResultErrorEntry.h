@@ -0,0 +1,95 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#ifndef AWSMOCK_DTO_SQS_BATCH_RESULT_ERROR_ENTRY_H
+#define AWSMOCK_DTO_SQS_BATCH_RESULT_ERROR_ENTRY_H
+
+// C++ standard includes
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Poco includes
+#include <Poco/DOM/AutoPtr.h>
+#include <Poco/DOM/Document.h>
+#include <Poco/DOM/Element.h>
+#include <Poco/JSON/Object.h>
+
+// AwsMock includes
+#include <awsmock/core/JsonUtils.h>
+#include <awsmock/core/XmlUtils.h>
+#include <awsmock/core/exception/ServiceException.h>
+
+namespace AwsMock::Dto::SQS {
+
+    /**
+     * Failed entry of a batch request
+     *
+     * Example:
+     * @code{.json}
+     * {
+     *   "Code": "ReceiptHandleIsInvalid",
+     *   "Id": "string",
+     *   "Message": "string",
+     *   "SenderFault": true
+     * }
+     * @endcode
+     */
+    struct BatchResultErrorEntry {
+
+        /**
+         * Entry ID
+         */
+        std::string id;
+
+        /**
+         * Error code
+         */
+        std::string code;
+
+        /**
+         * Error message
+         */
+        std::string message;
+
+        /**
+         * Error caused by the sender
+         */
+        bool senderFault = true;
+
+        /**
+         * Convert to a JSON object
+         *
+         * @return JSON object
+         */
+        [[nodiscard]] Poco::JSON::Object ToJsonObject() const;
+
+        /**
+         * Appends the entry as 'BatchResultErrorEntry' element to the given XML parent
+         *
+         * @param document XML document
+         * @param parent parent element
+         */
+        void ToXmlElement(Poco::XML::AutoPtr<Poco::XML::Document> &document, Poco::XML::AutoPtr<Poco::XML::Element> &parent) const;
+
+        /**
+         * Converts the DTO to a string representation.
+         *
+         * @return DTO as string for logging.
+         */
+        [[nodiscard]] std::string ToString() const;
+
+        /**
+         * Stream provider.
+         *
+         * @return output stream
+         */
+        friend std::ostream &operator<<(std::ostream &os, const BatchResultErrorEntry &e);
+    };
+
+    typedef std::vector<BatchResultErrorEntry> BatchResultErrorEntries;
+
+}// namespace AwsMock::Dto::SQS
+
+#endif// AWSMOCK_DTO_SQS_BATCH_RESULT_ERROR_ENTRY_H
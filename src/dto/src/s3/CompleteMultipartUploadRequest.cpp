@@ -15,6 +15,16 @@ namespace AwsMock::Dto::S3 {
             rootJson.set("key", key);
             rootJson.set("user", user);
             rootJson.set("uploadId", uploadId);
+            rootJson.set("checksumAlgorithm", checksumAlgorithm);
+
+            Poco::JSON::Array partsArray;
+            for (const auto &part: parts) {
+                Poco::JSON::Object partJson;
+                partJson.set("partNumber", part.partNumber);
+                partJson.set("eTag", part.eTag);
+                partsArray.add(partJson);
+            }
+            rootJson.set("parts", partsArray);
 
             return Core::JsonUtils::ToJsonString(rootJson);
 
@@ -29,8 +39,33 @@ namespace AwsMock::Dto::S3 {
         Poco::XML::DOMParser parser;
         Poco::AutoPtr<Poco::XML::Document> pDoc = parser.parseString(xmlString);
 
-        Poco::XML::Node *node = pDoc->getNodeByPath("/CreateBucketConfiguration/LocationConstraint");
-        region = node->innerText();
+        Poco::XML::Node *completeNode = pDoc->getNodeByPath("/CompleteMultipartUpload");
+        if (completeNode) {
+
+            for (unsigned long i = 0; i < completeNode->childNodes()->length(); i++) {
+                Poco::XML::Node *partNode = completeNode->childNodes()->item(i);
+                if (partNode->nodeName() != "Part") {
+                    continue;
+                }
+                CompletedPart part;
+                Poco::XML::Node *partNumberNode = partNode->getNodeByPath("PartNumber");
+                if (partNumberNode) {
+
+                    // Non-negative and small enough for an int, the range is checked against the uploaded parts
+                    std::string partNumber = Core::StringUtils::Trim(partNumberNode->innerText());
+                    if (!Core::StringUtils::IsNumeric(partNumber) || partNumber.length() > 9) {
+                        log_error << "Invalid part number, partNumber: " << partNumber;
+                        throw Core::BadRequestException("Invalid part number, partNumber: " + partNumber);
+                    }
+                    part.partNumber = std::stoi(partNumber);
+                }
+                Poco::XML::Node *eTagNode = partNode->getNodeByPath("ETag");
+                if (eTagNode) {
+                    part.eTag = Poco::remove(eTagNode->innerText(), '"');
+                }
+                parts.emplace_back(part);
+            }
+        }
     }
 
     std::string CompleteMultipartUploadRequest::ToString() const {
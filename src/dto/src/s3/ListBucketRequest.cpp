@@ -15,6 +15,9 @@ namespace AwsMock::Dto::S3 {
             rootJson.set("listType", listType);
             rootJson.set("delimiter", delimiter);
             rootJson.set("encodingType", encodingType);
+            rootJson.set("maxKeys", maxKeys);
+            rootJson.set("continuationToken", continuationToken);
+            rootJson.set("startAfter", startAfter);
 
             return Core::JsonUtils::ToJsonString(rootJson);
 
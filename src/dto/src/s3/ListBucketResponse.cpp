@@ -42,6 +42,18 @@ namespace AwsMock::Dto::S3 {
             rootJson.set("continuationToken", continuationToken);
             rootJson.set("nextContinuationToken", nextContinuationToken);
             rootJson.set("startAfter", startAfter);
+            rootJson.set("nextMarker", nextMarker);
+
+            // Common prefixes
+            if (!commonPrefixes.empty()) {
+
+                Poco::JSON::Array jsonPrefixArray;
+                for (auto &it: commonPrefixes) {
+                    jsonPrefixArray.add(it._prefix);
+                }
+
+                rootJson.set("commonPrefixes", jsonPrefixArray);
+            }
 
             // Contents
             if (!contents.empty()) {
@@ -159,7 +171,7 @@ namespace AwsMock::Dto::S3 {
 
         // Delimiter
         Poco::XML::AutoPtr<Poco::XML::Element> pDelimiter = pDoc->createElement("Delimiter");
-        pRoot->appendChild(pPrefix);
+        pRoot->appendChild(pDelimiter);
         Poco::XML::AutoPtr<Poco::XML::Text> pDelimiterText = pDoc->createTextNode(delimiter);
         pDelimiter->appendChild(pDelimiterText);
 
@@ -169,7 +181,17 @@ namespace AwsMock::Dto::S3 {
         Poco::XML::AutoPtr<Poco::XML::Text> pMaxKeysText = pDoc->createTextNode(std::to_string(maxKeys));
         pMaxKeys->appendChild(pMaxKeysText);
 
-        // TODO: CommonPrefixes
+        // CommonPrefixes
+        for (auto &it: commonPrefixes) {
+
+            Poco::XML::AutoPtr<Poco::XML::Element> pCommonPrefixes = pDoc->createElement("CommonPrefixes");
+            pRoot->appendChild(pCommonPrefixes);
+
+            Poco::XML::AutoPtr<Poco::XML::Element> pCommonPrefix = pDoc->createElement("Prefix");
+            pCommonPrefixes->appendChild(pCommonPrefix);
+            Poco::XML::AutoPtr<Poco::XML::Text> pCommonPrefixText = pDoc->createTextNode(it._prefix);
+            pCommonPrefix->appendChild(pCommonPrefixText);
+        }
 
         // EncodingType
         Poco::XML::AutoPtr<Poco::XML::Element> pEncodingType = pDoc->createElement("EncodingType");
@@ -201,6 +223,14 @@ namespace AwsMock::Dto::S3 {
         Poco::XML::AutoPtr<Poco::XML::Text> pStartAfterText = pDoc->createTextNode(startAfter);
         pStartAfter->appendChild(pStartAfterText);
 
+        // NextMarker
+        if (!nextMarker.empty()) {
+            Poco::XML::AutoPtr<Poco::XML::Element> pNextMarker = pDoc->createElement("NextMarker");
+            pRoot->appendChild(pNextMarker);
+            Poco::XML::AutoPtr<Poco::XML::Text> pNextMarkerText = pDoc->createTextNode(nextMarker);
+            pNextMarker->appendChild(pNextMarkerText);
+        }
+
         return Core::XmlUtils::ToXmlString(pDoc);
     }
 
@@ -0,0 +1,46 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#include <awsmock/dto/sqs/ChangeMessageVisibilityBatchEntry.h>
+
+namespace AwsMock::Dto::SQS {
+
+    void ChangeMessageVisibilityBatchEntry::FromJsonObject(const Poco::JSON::Object::Ptr &jsonObject) {
+
+        try {
+            Core::JsonUtils::GetJsonValueString("Id", jsonObject, id);
+            Core::JsonUtils::GetJsonValueString("ReceiptHandle", jsonObject, receiptHandle);
+            Core::JsonUtils::GetJsonValueInt("VisibilityTimeout", jsonObject, visibilityTimeout);
+
+        } catch (Poco::Exception &exc) {
+            throw Core::ServiceException(exc.message());
+        }
+    }
+
+    Poco::JSON::Object ChangeMessageVisibilityBatchEntry::ToJsonObject() const {
+
+        try {
+            Poco::JSON::Object rootJson;
+            rootJson.set("Id", id);
+            rootJson.set("ReceiptHandle", receiptHandle);
+            rootJson.set("VisibilityTimeout", visibilityTimeout);
+            return rootJson;
+
+        } catch (Poco::Exception &exc) {
+            throw Core::ServiceException(exc.message());
+        }
+    }
+
+    std::string ChangeMessageVisibilityBatchEntry::ToString() const {
+        std::stringstream ss;
+        ss << (*this);
+        return ss.str();
+    }
+
+    std::ostream &operator<<(std::ostream &os, const ChangeMessageVisibilityBatchEntry &e) {
+        os << "ChangeMessageVisibilityBatchEntry=" << Core::JsonUtils::ToJsonString(e.ToJsonObject());
+        return os;
+    }
+
+}// namespace AwsMock::Dto::SQS
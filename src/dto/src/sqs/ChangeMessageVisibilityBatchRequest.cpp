@@ -0,0 +1,67 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#include <awsmock/dto/sqs/ChangeMessageVisibilityBatchRequest.h>
+
+namespace AwsMock::Dto::SQS {
+
+    void ChangeMessageVisibilityBatchRequest::FromJson(const std::string &jsonString) {
+
+        Poco::JSON::Parser parser;
+        Poco::Dynamic::Var result = parser.parse(jsonString);
+        const auto &rootObject = result.extract<Poco::JSON::Object::Ptr>();
+
+        try {
+
+            // Queue
+            Core::JsonUtils::GetJsonValueString("QueueUrl", rootObject, queueUrl);
+            queueUrl = Core::SanitizeSQSUrl(queueUrl);
+
+            // Entries
+            Poco::JSON::Array::Ptr jsonEntriesArray = rootObject->getArray("Entries");
+            if (!jsonEntriesArray.isNull()) {
+                for (int i = 0; i < jsonEntriesArray->size(); i++) {
+                    ChangeMessageVisibilityBatchEntry entry;
+                    entry.FromJsonObject(jsonEntriesArray->getObject(i));
+                    entries.emplace_back(entry);
+                }
+            }
+
+        } catch (Poco::Exception &exc) {
+            throw Core::ServiceException(exc.message());
+        }
+    }
+
+    std::string ChangeMessageVisibilityBatchRequest::ToJson() const {
+
+        try {
+            Poco::JSON::Object rootJson;
+            rootJson.set("Region", region);
+            rootJson.set("QueueUrl", queueUrl);
+
+            Poco::JSON::Array entriesArray;
+            for (const auto &entry: entries) {
+                entriesArray.add(entry.ToJsonObject());
+            }
+            rootJson.set("Entries", entriesArray);
+
+            return Core::JsonUtils::ToJsonString(rootJson);
+
+        } catch (Poco::Exception &exc) {
+            throw Core::ServiceException(exc.message());
+        }
+    }
+
+    std::string ChangeMessageVisibilityBatchRequest::ToString() const {
+        std::stringstream ss;
+        ss << (*this);
+        return ss.str();
+    }
+
+    std::ostream &operator<<(std::ostream &os, const ChangeMessageVisibilityBatchRequest &r) {
+        os << "ChangeMessageVisibilityBatchRequest=" << r.ToJson();
+        return os;
+    }
+
+}// namespace AwsMock::Dto::SQS
@@ -0,0 +1,77 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#include <awsmock/dto/sqs/DeleteMessageBatchResponse.h>
+
+namespace AwsMock::Dto::SQS {
+
+    std::string DeleteMessageBatchResponse::ToJson() const {
+
+        try {
+            Poco::JSON::Array successfulArray;
+            for (const auto &id: successful) {
+                Poco::JSON::Object entryJson;
+                entryJson.set("Id", id);
+                successfulArray.add(entryJson);
+            }
+
+            Poco::JSON::Array failedArray;
+            for (const auto &entry: failed) {
+                failedArray.add(entry.ToJsonObject());
+            }
+
+            Poco::JSON::Object rootJson;
+            rootJson.set("Successful", successfulArray);
+            rootJson.set("Failed", failedArray);
+
+            return Core::JsonUtils::ToJsonString(rootJson);
+
+        } catch (Poco::Exception &exc) {
+            log_error << exc.message();
+            throw Core::ServiceException(exc.message());
+        }
+    }
+
+    std::string DeleteMessageBatchResponse::ToXml() const {
+
+        try {
+
+            // Root
+            Poco::XML::AutoPtr<Poco::XML::Document> pDoc = Core::XmlUtils::CreateDocument();
+            Poco::XML::AutoPtr<Poco::XML::Element> pRoot = Core::XmlUtils::CreateRootNode(pDoc, "DeleteMessageBatchResponse");
+
+            // DeleteMessageBatchResult
+            Poco::XML::AutoPtr<Poco::XML::Element> pResult = Core::XmlUtils::CreateNode(pDoc, pRoot, "DeleteMessageBatchResult");
+            for (const auto &id: successful) {
+                Poco::XML::AutoPtr<Poco::XML::Element> pEntry = Core::XmlUtils::CreateNode(pDoc, pResult, "DeleteMessageBatchResultEntry");
+                Core::XmlUtils::CreateTextNode(pDoc, pEntry, "Id", id);
+            }
+            for (const auto &entry: failed) {
+                entry.ToXmlElement(pDoc, pResult);
+            }
+
+            // Metadata
+            Poco::XML::AutoPtr<Poco::XML::Element> pMetaData = Core::XmlUtils::CreateNode(pDoc, pRoot, "ResponseMetadata");
+            Core::XmlUtils::CreateTextNode(pDoc, pMetaData, "RequestId", requestId);
+
+            return Core::XmlUtils::ToXmlString(pDoc);
+
+        } catch (Poco::Exception &exc) {
+            log_error << exc.message();
+            throw Core::ServiceException(exc.message());
+        }
+    }
+
+    std::string DeleteMessageBatchResponse::ToString() const {
+        std::stringstream ss;
+        ss << (*this);
+        return ss.str();
+    }
+
+    std::ostream &operator<<(std::ostream &os, const DeleteMessageBatchResponse &r) {
+        os << "DeleteMessageBatchResponse=" << r.ToJson();
+        return os;
+    }
+
+}// namespace AwsMock::Dto::SQS
@@ -16,7 +16,7 @@ namespace AwsMock::Dto::SQS {
             for (const auto &message: messageList) {
 
                 Poco::JSON::Object messageObject;
-                messageObject.set("Body", message.body);
+                messageObject.set("Body", message.body.str());
                 messageObject.set("ReceiptHandle", message.receiptHandle);
                 messageObject.set("MD5OfBody", message.md5Body);
                 messageObject.set("MessageId", message.messageId);
@@ -32,11 +32,11 @@ namespace AwsMock::Dto::SQS {
                     Poco::JSON::Object messageAttributesObject;
                     if (at.attributeType == Database::Entity::SQS::MessageAttributeType::STRING) {
                         messageAttributesObject.set("DataType", "String");
-                        messageAttributesObject.set("StringValue", at.attributeValue);
+                        messageAttributesObject.set("StringValue", at.attributeValue.str());
                         messageAttributeDto.type = MessageAttributeDataType::STRING;
                     } else if (at.attributeType == Database::Entity::SQS::MessageAttributeType::NUMBER) {
                         messageAttributesObject.set("DataType", "Number");
-                        messageAttributesObject.set("StringValue", at.attributeValue);
+                        messageAttributesObject.set("StringValue", at.attributeValue.str());
                         messageAttributeDto.type = MessageAttributeDataType::NUMBER;
                     }
                     messageAttributeListDto[at.attributeName] = messageAttributeDto;
@@ -0,0 +1,84 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#include <awsmock/dto/sqs/SendMessageBatchEntry.h>
+
+namespace AwsMock::Dto::SQS {
+
+    void SendMessageBatchEntry::FromJsonObject(const Poco::JSON::Object::Ptr &jsonObject) {
+
+        try {
+
+            Core::JsonUtils::GetJsonValueString("Id", jsonObject, id);
+            std::string bodyStr;
+            Core::JsonUtils::GetJsonValueString("MessageBody", jsonObject, bodyStr);
+            body = std::move(bodyStr);
+            Core::JsonUtils::GetJsonValueString("MessageGroupId", jsonObject, messageGroupId);
+            Core::JsonUtils::GetJsonValueString("MessageDeduplicationId", jsonObject, messageDeduplicationId);
+
+            // User attributes
+            if (jsonObject->has("MessageAttributes")) {
+
+                Poco::JSON::Object::Ptr attributesObject = jsonObject->getObject("MessageAttributes");
+
+                if (!attributesObject.isNull()) {
+                    for (const auto &attributeName: attributesObject->getNames()) {
+                        MessageAttribute attributeValue;
+                        attributeValue.FromJsonObject(attributesObject->getObject(attributeName));
+                        messageAttributes[attributeName] = attributeValue;
+                    }
+                }
+            }
+
+            // System attributes
+            if (jsonObject->has("MessageSystemAttributes")) {
+
+                Poco::JSON::Object::Ptr attributesObject = jsonObject->getObject("MessageSystemAttributes");
+
+                if (!attributesObject.isNull()) {
+                    for (const auto &name: attributesObject->getNames()) {
+                        attributes[name] = attributesObject->get(name).convert<std::string>();
+                    }
+                }
+            }
+
+        } catch (Poco::Exception &exc) {
+            throw Core::ServiceException(exc.message());
+        }
+    }
+
+    Poco::JSON::Object SendMessageBatchEntry::ToJsonObject() const {
+
+        try {
+            Poco::JSON::Object rootJson;
+            rootJson.set("Id", id);
+            rootJson.set("MessageBody", body.str());
+            rootJson.set("MessageGroupId", messageGroupId);
+            rootJson.set("MessageDeduplicationId", messageDeduplicationId);
+
+            Poco::JSON::Object jsonMessageAttributes;
+            for (const auto &messageAttribute: messageAttributes) {
+                jsonMessageAttributes.set(messageAttribute.first, messageAttribute.second.ToJsonObject());
+            }
+            rootJson.set("MessageAttributes", jsonMessageAttributes);
+            rootJson.set("MessageSystemAttributes", Core::JsonUtils::GetJsonObject(attributes));
+            return rootJson;
+
+        } catch (Poco::Exception &exc) {
+            throw Core::ServiceException(exc.message());
+        }
+    }
+
+    std::string SendMessageBatchEntry::ToString() const {
+        std::stringstream ss;
+        ss << (*this);
+        return ss.str();
+    }
+
+    std::ostream &operator<<(std::ostream &os, const SendMessageBatchEntry &e) {
+        os << "SendMessageBatchEntry=" << Core::JsonUtils::ToJsonString(e.ToJsonObject());
+        return os;
+    }
+
+}// namespace AwsMock::Dto::SQS
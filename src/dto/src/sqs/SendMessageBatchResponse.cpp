@@ -0,0 +1,96 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#include <awsmock/dto/sqs/SendMessageBatchResponse.h>
+
+namespace AwsMock::Dto::SQS {
+
+    Poco::JSON::Object SendMessageBatchResultEntry::ToJsonObject() const {
+
+        Poco::JSON::Object rootJson;
+        rootJson.set("Id", id);
+        rootJson.set("MessageId", messageId);
+        rootJson.set("MD5OfMessageBody", md5Body);
+        rootJson.set("MD5OfMessageAttributes", md5UserAttr);
+        rootJson.set("MD5OfMessageSystemAttributes", md5SystemAttr);
+        if (!sequenceNumber.empty()) {
+            rootJson.set("SequenceNumber", sequenceNumber);
+        }
+        return rootJson;
+    }
+
+    std::string SendMessageBatchResponse::ToJson() const {
+
+        try {
+            Poco::JSON::Array successfulArray;
+            for (const auto &entry: successful) {
+                successfulArray.add(entry.ToJsonObject());
+            }
+
+            Poco::JSON::Array failedArray;
+            for (const auto &entry: failed) {
+                failedArray.add(entry.ToJsonObject());
+            }
+
+            Poco::JSON::Object rootJson;
+            rootJson.set("Successful", successfulArray);
+            rootJson.set("Failed", failedArray);
+
+            return Core::JsonUtils::ToJsonString(rootJson);
+
+        } catch (Poco::Exception &exc) {
+            log_error << exc.message();
+            throw Core::ServiceException(exc.message());
+        }
+    }
+
+    std::string SendMessageBatchResponse::ToXml() const {
+
+        try {
+
+            // Root
+            Poco::XML::AutoPtr<Poco::XML::Document> pDoc = Core::XmlUtils::CreateDocument();
+            Poco::XML::AutoPtr<Poco::XML::Element> pRoot = Core::XmlUtils::CreateRootNode(pDoc, "SendMessageBatchResponse");
+
+            // SendMessageBatchResult
+            Poco::XML::AutoPtr<Poco::XML::Element> pResult = Core::XmlUtils::CreateNode(pDoc, pRoot, "SendMessageBatchResult");
+            for (const auto &entry: successful) {
+                Poco::XML::AutoPtr<Poco::XML::Element> pEntry = Core::XmlUtils::CreateNode(pDoc, pResult, "SendMessageBatchResultEntry");
+                Core::XmlUtils::CreateTextNode(pDoc, pEntry, "Id", entry.id);
+                Core::XmlUtils::CreateTextNode(pDoc, pEntry, "MessageId", entry.messageId);
+                Core::XmlUtils::CreateTextNode(pDoc, pEntry, "MD5OfMessageBody", entry.md5Body);
+                Core::XmlUtils::CreateTextNode(pDoc, pEntry, "MD5OfMessageAttributes", entry.md5UserAttr);
+                Core::XmlUtils::CreateTextNode(pDoc, pEntry, "MD5OfMessageSystemAttributes", entry.md5SystemAttr);
+                if (!entry.sequenceNumber.empty()) {
+                    Core::XmlUtils::CreateTextNode(pDoc, pEntry, "SequenceNumber", entry.sequenceNumber);
+                }
+            }
+            for (const auto &entry: failed) {
+                entry.ToXmlElement(pDoc, pResult);
+            }
+
+            // Metadata
+            Poco::XML::AutoPtr<Poco::XML::Element> pMetaData = Core::XmlUtils::CreateNode(pDoc, pRoot, "ResponseMetadata");
+            Core::XmlUtils::CreateTextNode(pDoc, pMetaData, "RequestId", requestId);
+
+            return Core::XmlUtils::ToXmlString(pDoc);
+
+        } catch (Poco::Exception &exc) {
+            log_error << exc.message();
+            throw Core::ServiceException(exc.message());
+        }
+    }
+
+    std::string SendMessageBatchResponse::ToString() const {
+        std::stringstream ss;
+        ss << (*this);
+        return ss.str();
+    }
+
+    std::ostream &operator<<(std::ostream &os, const SendMessageBatchResponse &r) {
+        os << "SendMessageBatchResponse=" << r.ToJson();
+        return os;
+    }
+
+}// namespace AwsMock::Dto::SQS
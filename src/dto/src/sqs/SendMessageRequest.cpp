@@ -17,7 +17,11 @@ namespace AwsMock::Dto::SQS {
             // General
             Core::JsonUtils::GetJsonValueString("Region", rootObject, queueUrl);
             Core::JsonUtils::GetJsonValueString("QueueUrl", rootObject, queueUrl);
-            Core::JsonUtils::GetJsonValueString("MessageBody", rootObject, body);
+            std::string bodyStr;
+            Core::JsonUtils::GetJsonValueString("MessageBody", rootObject, bodyStr);
+            body = std::move(bodyStr);
+            Core::JsonUtils::GetJsonValueString("MessageGroupId", rootObject, messageGroupId);
+            Core::JsonUtils::GetJsonValueString("MessageDeduplicationId", rootObject, messageDeduplicationId);
 
             // Sanitize
             queueUrl = Core::SanitizeSQSUrl(queueUrl);
@@ -60,7 +64,9 @@ namespace AwsMock::Dto::SQS {
         try {
             Poco::JSON::Object rootJson;
             rootJson.set("QueueUrl", queueUrl);
-            rootJson.set("MessageBody", body);
+            rootJson.set("MessageBody", body.str());
+            rootJson.set("MessageGroupId", messageGroupId);
+            rootJson.set("MessageDeduplicationId", messageDeduplicationId);
 
             Poco::JSON::Array jsonMessageAttributeArray;
             for (const auto &messageAttribute: messageAttributes) {
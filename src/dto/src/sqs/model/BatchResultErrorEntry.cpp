@@ -0,0 +1,44 @@
+//
+// Created by vogje01 on 6/10/24.
+//
+
+#include <awsmock/dto/sqs/model/BatchResultErrorEntry.h>
+
+namespace AwsMock::Dto::SQS {
+
+    Poco::JSON::Object BatchResultErrorEntry::ToJsonObject() const {
+
+        try {
+            Poco::JSON::Object rootJson;
+            rootJson.set("Id", id);
+            rootJson.set("Code", code);
+            rootJson.set("Message", message);
+            rootJson.set("SenderFault", senderFault);
+            return rootJson;
+
+        } catch (Poco::Exception &exc) {
+            throw Core::ServiceException(exc.message());
+        }
+    }
+
+    void BatchResultErrorEntry::ToXmlElement(Poco::XML::AutoPtr<Poco::XML::Document> &document, Poco::XML::AutoPtr<Poco::XML::Element> &parent) const {
+
+        Poco::XML::AutoPtr<Poco::XML::Element> pEntry = Core::XmlUtils::CreateNode(document, parent, "BatchResultErrorEntry");
+        Core::XmlUtils::CreateTextNode(document, pEntry, "Id", id);
+        Core::XmlUtils::CreateTextNode(document, pEntry, "Code", code);
+        Core::XmlUtils::CreateTextNode(document, pEntry, "Message", message);
+        Core::XmlUtils::CreateTextNode(document, pEntry, "SenderFault", senderFault);
+    }
+
+    std::string BatchResultErrorEntry::ToString() const {
+        std::stringstream ss;
+        ss << (*this);
+        return ss.str();
+    }
+
+    std::ostream &operator<<(std::ostream &os, const BatchResultErrorEntry &e) {
+        os << "BatchResultErrorEntry=" << Core::JsonUtils::ToJsonString(e.ToJsonObject());
+        return os;
+    }
+
+}// namespace AwsMock::Dto::SQS
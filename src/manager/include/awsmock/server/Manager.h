@@ -16,6 +16,9 @@
 #include <awsmock/core/LogStream.h>
 #include <awsmock/core/monitoring/MetricService.h>
 #include <awsmock/core/monitoring/MetricSystemCollector.h>
+#include <awsmock/memorydb/S3MemoryDb.h>
+#include <awsmock/memorydb/SNSMemoryDb.h>
+#include <awsmock/memorydb/SQSMemoryDb.h>
 #include <awsmock/server/Handler.h>
 #include <awsmock/server/Listener.h>
 #include <awsmock/server/Monitoring.h>
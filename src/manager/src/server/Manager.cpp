@@ -54,6 +54,10 @@ namespace AwsMock::Manager {
 
         } else {
 
+            // Restore the in-memory databases from their journals
+            Database::SQSMemoryDb::instance().OpenJournal();
+            Database::SNSMemoryDb::instance().OpenJournal();
+            Database::S3MemoryDb::instance().OpenJournal();
             log_info << "In-memory database initialized";
         }
     }
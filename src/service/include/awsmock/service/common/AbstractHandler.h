@@ -7,6 +7,8 @@
 
 // C++ includes
 #include <fstream>
+#include <functional>
+#include <memory>
 #include <streambuf>
 #include <string>
 
@@ -16,8 +18,9 @@
 
 // AwsMock includes
 #include "awsmock/core/exception/ServiceException.h"
+#include <awsmock/core/HashSink.h>
 #include <awsmock/core/LogStream.h>
-#include <awsmock/core/MemoryMappedFile.h>
+#include <awsmock/core/MemoryMappedFileCache.h>
 #include <awsmock/core/StringUtils.h>
 #include <awsmock/core/exception/ForbiddenException.h>
 #include <awsmock/dto/common/S3ClientCommand.h>
@@ -54,6 +57,19 @@ namespace AwsMock::Service {
          */
         virtual http::response<http::dynamic_body> HandleGetRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user);
 
+        /**
+         * @brief Handles the HTTP method GET, returning a type-erased response.
+         *
+         * Allows a handler to answer with a body other than the dynamic body, e.g. a file body, which is read chunk by chunk while it is written
+         * to the socket. Defaults to HandleGetRequest().
+         *
+         * @param request HTTP request
+         * @param region AWS region
+         * @param user current user
+         * @return HTTP response
+         */
+        virtual http::message_generator HandleGetMessage(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user);
+
         /**
          * @brief Handles the HTTP method PUT.
          *
@@ -74,6 +90,25 @@ namespace AwsMock::Service {
          */
         virtual http::response<http::dynamic_body> HandlePostRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user);
 
+        /**
+         * Completion callback of an asynchronous request
+         */
+        typedef std::function<void(http::response<http::dynamic_body>)> ResponseCallback;
+
+        /**
+         * @brief Handles the HTTP method POST asynchronously.
+         *
+         * Called by the gateway before HandlePostRequest(). A handler, which accepts the request, returns true and delivers the response later
+         * through the callback, from any thread. Meanwhile, no thread is blocked. Used for long polling requests.
+         *
+         * @param request HTTP request
+         * @param region AWS region
+         * @param user current user
+         * @param callback completion callback
+         * @return true, if the request is handled asynchronously
+         */
+        virtual bool HandleAsyncPostRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user, const ResponseCallback &callback);
+
         /**
          * @brief Handles the HTTP method DELETE.
          *
@@ -94,6 +129,49 @@ namespace AwsMock::Service {
          */
         virtual http::response<http::dynamic_body> HandleHeadRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user);
 
+        /**
+         * @brief Checks whether the body of the request should be streamed into a file.
+         *
+         * Called by the gateway as soon as the request header has been read. If the handler accepts the request, the body is written chunk by
+         * chunk into a file and the request is passed to HandlePutStreamRequest() instead of HandlePutRequest(). The digests requested in
+         * hashAlgorithms are computed from the chunks, while they are written, so the file does not need to be read again.
+         *
+         * @param request HTTP request, header only
+         * @param region AWS region
+         * @param user current user
+         * @param hashAlgorithms digest algorithms of the body, set by the handler
+         * @return true, if the body should be streamed into a file
+         */
+        virtual bool IsStreamingRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user, std::vector<std::string> &hashAlgorithms);
+
+        /**
+         * @brief Acquires the resources of a streamed request, before its body is read.
+         *
+         * Called by the gateway after IsStreamingRequest() accepted the request, on the worker pool, if there is one, as the call may block.
+         * The permit is held until HandlePutStreamRequest() returns, so a limit covers the whole body transfer. The default holds nothing.
+         *
+         * @param request HTTP request, header only
+         * @param region AWS region
+         * @param user current user
+         * @return permit, released when the last copy is destroyed, null if nothing is held
+         * @throws Core::ServiceException if the permit could not be acquired
+         */
+        virtual std::shared_ptr<void> AcquireStreamPermit(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user);
+
+        /**
+         * @brief Handles the HTTP method PUT, with the body already written to a file.
+         *
+         * The handler takes ownership of the body file.
+         *
+         * @param request HTTP request, header only
+         * @param bodyFile file containing the request body
+         * @param hashSink digests of the request body, computed while streaming
+         * @param region AWS region
+         * @param user current user
+         * @return HTTP response
+         */
+        virtual http::response<http::dynamic_body> HandlePutStreamRequest(const http::request<http::dynamic_body> &request, const std::string &bodyFile, Core::HashSink &hashSink, const std::string &region, const std::string &user);
+
         /**
          * @brief Send a OK response (HTTP state code 200).
          *
@@ -115,6 +193,18 @@ namespace AwsMock::Service {
          */
         static http::response<http::dynamic_body> SendOkResponse(const http::request<http::dynamic_body> &request, const std::string &fileName, long contentLength, const std::map<std::string, std::string> &headers = {});
 
+        /**
+         * @brief Send a OK response (HTTP state code 200) with a file body.
+         *
+         * The file content is not loaded into memory. It is read in small chunks, while the response is written to the client.
+         *
+         * @param request HTTP request object
+         * @param fileName file to send
+         * @param headers HTTP header map values, added to the default headers
+         * @return HTTP response
+         */
+        static http::response<http::file_body> SendFileResponse(const http::request<http::dynamic_body> &request, const std::string &fileName, const std::map<std::string, std::string> &headers = {});
+
         /**
          * @brief Send a bad request response (HTTP state code 400).
          *
@@ -144,6 +234,16 @@ namespace AwsMock::Service {
          */
         static http::response<http::dynamic_body> SendBadRequestError(const http::request<http::dynamic_body> &request, const std::string &body = {}, const std::map<std::string, std::string> &headers = {});
 
+        /**
+         * @brief Send a not found response (HTTP state code 404).
+         *
+         * @param request HTTP request
+         * @param body HTTP body payload
+         * @param headers HTTP header map values, added to the default headers
+         * @return response HTTP response
+         */
+        static http::response<http::dynamic_body> SendNotFoundError(const http::request<http::dynamic_body> &request, const std::string &body = {}, const std::map<std::string, std::string> &headers = {});
+
         /**
          * Send a OK response (HTTP state code 200) with an part of an output.
          *
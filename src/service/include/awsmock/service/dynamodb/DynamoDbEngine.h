@@ -0,0 +1,405 @@
+//
+// Created by vogje01 on 6/8/24.
+//
+
+#ifndef AWSMOCK_SERVICE_DYNAMODB_ENGINE_H
+#define AWSMOCK_SERVICE_DYNAMODB_ENGINE_H
+
+// C++ standard includes
+#include <chrono>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Boost includes
+#include <boost/beast/http/status.hpp>
+#include <boost/thread/mutex.hpp>
+
+// Poco includes
+#include <Poco/JSON/Array.h>
+#include <Poco/JSON/Object.h>
+#include <Poco/JSON/Parser.h>
+
+// AwsMock includes
+#include <awsmock/core/AwsUtils.h>
+#include <awsmock/core/JsonUtils.h>
+#include <awsmock/core/LogStream.h>
+#include <awsmock/core/config/Configuration.h>
+#include <awsmock/dto/dynamodb/DynamoDbResponse.h>
+#include <awsmock/entity/dynamodb/Item.h>
+#include <awsmock/service/dynamodb/DynamoDbExpression.h>
+
+#define DYNAMODB_ENGINE_DOCKER "docker"
+#define DYNAMODB_ENGINE_NATIVE "native"
+
+namespace AwsMock::Service {
+
+    /**
+     * @brief Native in-process DynamoDB storage engine
+     *
+     * @par
+     * Alternative to the dynamodb-local docker container. The engine works directly on the DynamoDB JSON protocol, i.e. it gets the original
+     * request body and returns the response body, so the DynamoDB service can use it as a replacement for the HTTP call to the container.
+     *
+     * @par
+     * Every table keeps its items in hash partitions, addressed by the hash key value. Inside a partition the items are ordered by the range
+     * key, so that a query is a partition lookup followed by a range scan. Local and global secondary indexes are maintained on every write
+     * with the same layout. Indexes are sparse, items without the index key attributes are not part of the index.
+     *
+     * @par
+     * KeyConditionExpression, FilterExpression, ConditionExpression and ProjectionExpression are evaluated natively, see DynamoDbExpression.
+     * Errors are returned as DynamoDB error responses with HTTP status 400.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class DynamoDbEngine {
+
+      public:
+
+        /**
+         * @brief Constructor
+         */
+        DynamoDbEngine() = default;
+
+        /**
+         * @brief Singleton
+         *
+         * @return singleton instance
+         */
+        static DynamoDbEngine &instance() {
+            static DynamoDbEngine dynamoDbEngine;
+            return dynamoDbEngine;
+        }
+
+        /**
+         * @brief Returns true, if the native engine is configured
+         *
+         * @return true, if awsmock.dynamodb.engine is 'native'
+         */
+        static bool IsActive();
+
+        /**
+         * @brief Creates a table
+         *
+         * @param region AWS region
+         * @param body CreateTable request body
+         * @return DynamoDB response
+         */
+        Dto::DynamoDb::DynamoDbResponse CreateTable(const std::string &region, const std::string &body);
+
+        /**
+         * @brief Describes a table
+         *
+         * @param region AWS region
+         * @param body DescribeTable request body
+         * @return DynamoDB response
+         */
+        Dto::DynamoDb::DynamoDbResponse DescribeTable(const std::string &region, const std::string &body);
+
+        /**
+         * @brief Lists the tables of a region
+         *
+         * @param region AWS region
+         * @param body ListTables request body
+         * @return DynamoDB response
+         */
+        Dto::DynamoDb::DynamoDbResponse ListTables(const std::string &region, const std::string &body);
+
+        /**
+         * @brief Deletes a table with all items
+         *
+         * @param region AWS region
+         * @param body DeleteTable request body
+         * @return DynamoDB response
+         */
+        Dto::DynamoDb::DynamoDbResponse DeleteTable(const std::string &region, const std::string &body);
+
+        /**
+         * @brief Puts an item
+         *
+         * @param region AWS region
+         * @param body PutItem request body
+         * @return DynamoDB response
+         */
+        Dto::DynamoDb::DynamoDbResponse PutItem(const std::string &region, const std::string &body);
+
+        /**
+         * @brief Gets an item by primary key
+         *
+         * @param region AWS region
+         * @param body GetItem request body
+         * @return DynamoDB response
+         */
+        Dto::DynamoDb::DynamoDbResponse GetItem(const std::string &region, const std::string &body);
+
+        /**
+         * @brief Deletes an item by primary key
+         *
+         * @param region AWS region
+         * @param body DeleteItem request body
+         * @return DynamoDB response
+         */
+        Dto::DynamoDb::DynamoDbResponse DeleteItem(const std::string &region, const std::string &body);
+
+        /**
+         * @brief Queries a table or a secondary index
+         *
+         * @param region AWS region
+         * @param body Query request body
+         * @return DynamoDB response
+         */
+        Dto::DynamoDb::DynamoDbResponse Query(const std::string &region, const std::string &body);
+
+        /**
+         * @brief Scans a table or a secondary index
+         *
+         * @param region AWS region
+         * @param body Scan request body
+         * @return DynamoDB response
+         */
+        Dto::DynamoDb::DynamoDbResponse Scan(const std::string &region, const std::string &body);
+
+        /**
+         * @brief Checks the existence of a table
+         *
+         * @param region AWS region
+         * @param tableName table name
+         * @return true, if the table exists
+         */
+        bool TableExists(const std::string &region, const std::string &tableName);
+
+        /**
+         * @brief Deletes all tables
+         */
+        void DeleteAllTables();
+
+        /**
+         * @brief Returns the number of tables
+         *
+         * @return number of tables
+         */
+        long CountTables();
+
+        /**
+         * @brief Returns the number of items of all tables
+         *
+         * @return number of items
+         */
+        long CountItems();
+
+        /**
+         * @brief Returns the items of all tables, used by the infrastructure export
+         *
+         * @return list of item entities
+         */
+        Database::Entity::DynamoDb::ItemList ListItems();
+
+      private:
+
+        /**
+         * Scalar key value (S, N or B). Numbers are normalized, binaries decoded.
+         */
+        struct KeyValue {
+            std::string type;
+            std::string value;
+        };
+
+        /**
+         * Strict weak order of key values: numbers numerically, strings and binaries bytewise
+         */
+        static int CompareKeyValues(const KeyValue &left, const KeyValue &right);
+
+        /**
+         * Position of an item inside a partition: range key value and unique primary key. For the table itself the primary key part is empty.
+         */
+        using PartitionKey = std::pair<KeyValue, std::string>;
+
+        /**
+         * Transparent comparator, allows range lookups by the range key value only
+         */
+        struct PartitionKeyLess {
+            using is_transparent = void;
+            bool operator()(const PartitionKey &left, const PartitionKey &right) const;
+            bool operator()(const KeyValue &left, const PartitionKey &right) const;
+            bool operator()(const PartitionKey &left, const KeyValue &right) const;
+        };
+
+        /**
+         * Partition, items ordered by range key
+         */
+        using Partition = std::map<PartitionKey, Poco::JSON::Object::Ptr, PartitionKeyLess>;
+
+        /**
+         * Primary key or secondary index
+         */
+        struct Index {
+
+            /**
+             * Index name, empty for the table itself
+             */
+            std::string name;
+
+            /**
+             * Hash key attribute name
+             */
+            std::string hashKey;
+
+            /**
+             * Range key attribute name, empty if none
+             */
+            std::string rangeKey;
+
+            /**
+             * Local index, i.e. same hash key as the table
+             */
+            bool local = false;
+
+            /**
+             * Projection type: ALL, KEYS_ONLY or INCLUDE
+             */
+            std::string projectionType = "ALL";
+
+            /**
+             * Projected non-key attributes in case of INCLUDE
+             */
+            std::vector<std::string> nonKeyAttributes;
+
+            /**
+             * Original index definition, returned in the table description
+             */
+            Poco::JSON::Object::Ptr definition;
+
+            /**
+             * Partitions by hash key value
+             */
+            std::map<std::string, Partition> partitions;
+
+            /**
+             * Number of indexed items
+             */
+            long itemCount = 0;
+        };
+
+        /**
+         * Table
+         */
+        struct Table {
+
+            /**
+             * Table name
+             */
+            std::string name;
+
+            /**
+             * AWS region
+             */
+            std::string region;
+
+            /**
+             * Table ARN
+             */
+            std::string arn;
+
+            /**
+             * Attribute types by name
+             */
+            std::map<std::string, std::string> attributeTypes;
+
+            /**
+             * Original CreateTable request, returned in the table description
+             */
+            Poco::JSON::Object::Ptr definition;
+
+            /**
+             * Primary key
+             */
+            Index primary;
+
+            /**
+             * Secondary indexes
+             */
+            std::vector<Index> indexes;
+
+            /**
+             * Creation timestamp
+             */
+            std::chrono::system_clock::time_point created = std::chrono::system_clock::now();
+
+            /**
+             * Table mutex
+             */
+            boost::mutex mutex;
+        };
+
+        /**
+         * @brief Returns the table, throws a ResourceNotFoundException if the table does not exist
+         */
+        std::shared_ptr<Table> GetTable(const std::string &region, const Poco::JSON::Object::Ptr &request);
+
+        /**
+         * @brief Returns the key value of an attribute value, if the attribute value is a valid key
+         */
+        static std::optional<KeyValue> GetKeyValue(const Poco::JSON::Object::Ptr &attributeValue);
+
+        /**
+         * @brief Returns the hash key and the range key of an item for the given index, if the item contains the key attributes
+         */
+        static bool GetIndexKey(const Index &index, const Poco::JSON::Object::Ptr &item, KeyValue &hashValue, KeyValue &rangeValue);
+
+        /**
+         * @brief Returns the encoded primary key of an item, throws a ValidationException if the item has no valid primary key
+         */
+        static std::string GetPrimaryKey(const Table &table, const Poco::JSON::Object::Ptr &item, KeyValue &hashValue, KeyValue &rangeValue);
+
+        /**
+         * @brief Encodes a key value as map key
+         */
+        static std::string EncodeKeyValue(const KeyValue &keyValue);
+
+        /**
+         * @brief Returns the item with the given primary key, null if it does not exist
+         */
+        static Poco::JSON::Object::Ptr FindItem(const Table &table, const KeyValue &hashValue, const KeyValue &rangeValue);
+
+        /**
+         * @brief Inserts an item into an index
+         */
+        static void IndexItem(Index &index, const std::string &primaryKey, const Poco::JSON::Object::Ptr &item);
+
+        /**
+         * @brief Removes an item from an index
+         */
+        static void UnindexItem(Index &index, const std::string &primaryKey, const Poco::JSON::Object::Ptr &item);
+
+        /**
+         * @brief Returns the key attributes of an item for the table and the given index
+         */
+        static Poco::JSON::Object::Ptr GetKeyAttributes(const Table &table, const Index &index, const Poco::JSON::Object::Ptr &item);
+
+        /**
+         * @brief Applies the index projection and the projection expression to an item
+         */
+        static Poco::JSON::Object::Ptr Project(const Table &table, const Index &index, const Poco::JSON::Object::Ptr &item, const std::vector<std::string> &attributes);
+
+        /**
+         * @brief Returns the table description in DynamoDB JSON format
+         */
+        static Poco::JSON::Object::Ptr GetTableDescription(const Table &table, const std::string &status);
+
+        /**
+         * Tables by region and name
+         */
+        std::map<std::string, std::shared_ptr<Table>> _tables;
+
+        /**
+         * Table map mutex
+         */
+        boost::mutex _mutex;
+    };
+
+}// namespace AwsMock::Service
+
+#endif// AWSMOCK_SERVICE_DYNAMODB_ENGINE_H
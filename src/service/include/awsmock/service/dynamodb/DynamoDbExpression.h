@@ -0,0 +1,180 @@
+//
+// Created by vogje01 on 6/8/24.
+//
+
+#ifndef AWSMOCK_SERVICE_DYNAMODB_EXPRESSION_H
+#define AWSMOCK_SERVICE_DYNAMODB_EXPRESSION_H
+
+// C++ standard includes
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+// Poco includes
+#include <Poco/JSON/Object.h>
+
+// AwsMock includes
+#include <awsmock/core/CryptoUtils.h>
+#include <awsmock/core/exception/BadRequestException.h>
+
+namespace AwsMock::Service {
+
+    /**
+     * @brief Key condition of a DynamoDB query
+     *
+     * Extracted from a KeyConditionExpression. The hash key value is always set, the range operator is empty, if the expression has no
+     * condition on the range key. Possible range operators are '=', '<', '<=', '>', '>=', 'BETWEEN' and 'begins_with'.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    struct DynamoDbKeyCondition {
+
+        /**
+         * Hash key value
+         */
+        Poco::JSON::Object::Ptr hashValue;
+
+        /**
+         * Range key operator
+         */
+        std::string rangeOperator;
+
+        /**
+         * Range key value, lower bound in case of BETWEEN
+         */
+        Poco::JSON::Object::Ptr rangeValue;
+
+        /**
+         * Upper bound in case of BETWEEN
+         */
+        Poco::JSON::Object::Ptr rangeValueUpper;
+    };
+
+    /**
+     * @brief DynamoDB condition expression
+     *
+     * @par
+     * Parses and evaluates DynamoDB expressions (KeyConditionExpression, FilterExpression, ConditionExpression) against items in DynamoDB JSON
+     * format. Attribute name placeholders (#name) and value placeholders (:value) are resolved once during parsing, so an expression can be
+     * evaluated against many items.
+     *
+     * @par
+     * Supported are the comparators =, <>, <, <=, >, >=, BETWEEN, IN, the logical operators AND, OR, NOT, parentheses and the functions
+     * attribute_exists, attribute_not_exists, attribute_type, begins_with, contains and size. Document paths may contain map (a.b) and list
+     * (a[1]) dereferences. Syntax errors and unknown placeholders throw a BadRequestException.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class DynamoDbExpression {
+
+      public:
+
+        /**
+         * @brief Constructor, parses the expression
+         *
+         * @param expression expression string
+         * @param names ExpressionAttributeNames, may be null
+         * @param values ExpressionAttributeValues, may be null
+         * @throws BadRequestException in case of a syntax error
+         */
+        DynamoDbExpression(const std::string &expression, const Poco::JSON::Object::Ptr &names, const Poco::JSON::Object::Ptr &values);
+
+        /**
+         * @brief Evaluates the expression against an item
+         *
+         * @param item item in DynamoDB JSON format, may be null, for a non-existing item
+         * @return true, if the item matches the expression
+         */
+        [[nodiscard]] bool Evaluate(const Poco::JSON::Object::Ptr &item) const;
+
+        /**
+         * @brief Extracts the key condition
+         *
+         * The expression must be an equality condition on the hash key, optionally combined by AND with a condition on the range key.
+         *
+         * @param hashKey name of the hash key attribute
+         * @param rangeKey name of the range key attribute, empty if the table has no range key
+         * @param keyCondition extracted key condition
+         * @return true, if the expression is a valid key condition
+         */
+        bool GetKeyCondition(const std::string &hashKey, const std::string &rangeKey, DynamoDbKeyCondition &keyCondition) const;
+
+        /**
+         * @brief Returns the top level attribute names of a projection expression
+         *
+         * Nested paths are projected by their top level attribute.
+         *
+         * @param expression projection expression
+         * @param names ExpressionAttributeNames, may be null
+         * @return list of attribute names
+         */
+        static std::vector<std::string> GetProjectionAttributes(const std::string &expression, const Poco::JSON::Object::Ptr &names);
+
+        /**
+         * @brief Returns the type of an attribute value, i.e. S, N, B, BOOL, NULL, SS, NS, BS, L or M
+         *
+         * @param value attribute value
+         * @return type descriptor, empty if the value is invalid
+         */
+        static std::string GetType(const Poco::JSON::Object::Ptr &value);
+
+        /**
+         * @brief Compares two attribute values for equality
+         *
+         * Numbers are compared numerically, sets regardless of the element order.
+         *
+         * @param left attribute value
+         * @param right attribute value
+         * @return true if both values are equal
+         */
+        static bool Equals(const Poco::JSON::Object::Ptr &left, const Poco::JSON::Object::Ptr &right);
+
+        /**
+         * @brief Compares two scalar attribute values (S, N or B) of the same type
+         *
+         * Strings are compared by their UTF-8 bytes, binaries by their decoded bytes and numbers numerically.
+         *
+         * @param left attribute value
+         * @param right attribute value
+         * @param result negative, zero or positive
+         * @return false if the values are not comparable
+         */
+        static bool Compare(const Poco::JSON::Object::Ptr &left, const Poco::JSON::Object::Ptr &right, int &result);
+
+        /**
+         * @brief Compares two DynamoDB numbers
+         *
+         * @param left number string
+         * @param right number string
+         * @return negative, zero or positive
+         */
+        static int CompareNumbers(const std::string &left, const std::string &right);
+
+        /**
+         * @brief Returns the canonical representation of a DynamoDB number, i.e. without plus sign, leading and trailing zeros
+         *
+         * @param number number string
+         * @return canonical number string
+         */
+        static std::string NormalizeNumber(const std::string &number);
+
+        /**
+         * AST node
+         */
+        struct Node;
+
+      private:
+
+        /**
+         * Parsed expression
+         */
+        std::shared_ptr<const Node> _root;
+    };
+
+}// namespace AwsMock::Service
+
+#endif// AWSMOCK_SERVICE_DYNAMODB_EXPRESSION_H
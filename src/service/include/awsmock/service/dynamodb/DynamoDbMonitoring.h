@@ -10,6 +10,7 @@
 #include <awsmock/core/monitoring/MetricDefinition.h>
 #include <awsmock/core/monitoring/MetricService.h>
 #include <awsmock/repository/DynamoDbDatabase.h>
+#include <awsmock/service/dynamodb/DynamoDbEngine.h>
 
 namespace AwsMock::Service {
 
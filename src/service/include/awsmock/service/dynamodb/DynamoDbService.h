@@ -16,7 +16,7 @@
 #include "awsmock/service/docker/DockerService.h"
 #include <awsmock/core/AwsUtils.h>
 #include <awsmock/core/CryptoUtils.h>
-#include <awsmock/core/HttpSocket.h>
+#include <awsmock/core/HttpSocketPool.h>
 #include <awsmock/core/StringUtils.h>
 #include <awsmock/core/SystemUtils.h>
 #include <awsmock/core/TarUtils.h>
@@ -46,6 +46,7 @@
 #include <awsmock/dto/dynamodb/ScanResponse.h>
 #include <awsmock/dto/dynamodb/mapper/Mapper.h>
 #include <awsmock/repository/DynamoDbDatabase.h>
+#include <awsmock/service/dynamodb/DynamoDbEngine.h>
 
 namespace AwsMock::Service {
 
@@ -56,6 +57,8 @@ namespace AwsMock::Service {
      * as soon as the server starts. DynamoDB commands will be send via HTTP to the DynamoDB docker container on port 8000. THe docker posrt can be configured in the
      * AwsMock configuration properties.
      *
+     * With 'awsmock.dynamodb.engine=native' the requests are handled by the in-process DynamoDbEngine instead, no docker container is needed.
+     *
      * @author jens.vogt\@opitz-consulting.com
      */
     class DynamoDbService {
@@ -169,6 +172,11 @@ namespace AwsMock::Service {
          * DynamoDb docker port
          */
         int _dockerPort;
+
+        /**
+         * Use the native engine instead of the docker container
+         */
+        bool _nativeEngine;
     };
 
 }// namespace AwsMock::Service
@@ -13,6 +13,7 @@
 #include <boost/asio/io_context.hpp>
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/strand.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/beast/core/bind_handler.hpp>
 
 // AwsMock includes
@@ -35,8 +36,9 @@ namespace AwsMock::Service {
          *
          * @param ioc Boost IO context
          * @param endpoint HTTP endpoint
+         * @param workerPool handler worker pool, nullptr runs the handlers on the IO threads
          */
-        GatewayListener(boost::asio::io_context &ioc, const boost::asio::ip::tcp::endpoint &endpoint);
+        GatewayListener(boost::asio::io_context &ioc, const boost::asio::ip::tcp::endpoint &endpoint, boost::asio::thread_pool *workerPool = nullptr);
 
         /**
          * @brief Start accepting incoming connections
@@ -70,6 +72,11 @@ namespace AwsMock::Service {
          * Boost acceptor
          */
         boost::asio::ip::tcp::acceptor acceptor_;
+
+        /**
+         * Handler worker pool
+         */
+        boost::asio::thread_pool *_workerPool;
     };
 
 }// namespace AwsMock::Service
@@ -25,6 +25,7 @@
 #define GATEWAY_DEFAULT_ADDRESS "0.0.0.0"
 #define GATEWAY_MAX_QUEUE 250
 #define GATEWAY_MAX_THREADS 50
+#define GATEWAY_WORKER_THREADS 50
 #define GATEWAY_TIMEOUT 900
 
 namespace AwsMock::Service {
@@ -39,6 +40,10 @@ namespace AwsMock::Service {
      * default the server runs with 50 threads, which means 50 connection can be handled simultaneously. If you need more concurrent connection set the
      * ```awsmock.service.gateway.http.max.threads``` in the properties file.
      *
+     * The IO threads only parse requests and write responses. The module handlers run on a separate, bounded worker pool
+     * (```awsmock.service.gateway.http.worker.threads```), so blocking service calls, like SQS long polling or database round trips, do not stall
+     * other connections sharing the same IO thread.
+     *
      * @author jens.vogt\@opitz-consulting.com
      */
     class GatewayServer : public AbstractServer {
@@ -114,6 +119,16 @@ namespace AwsMock::Service {
          */
         int _requestTimeout;
 
+        /**
+         * Number of handler worker threads, 0 runs the handlers on the IO threads
+         */
+        int _workerThreads;
+
+        /**
+         * Handler worker pool
+         */
+        std::unique_ptr<boost::asio::thread_pool> _workerPool;
+
         /**
          * Thread pool
          */
@@ -6,11 +6,15 @@
 #define AWSMOCK_SERVICES_GATEWAY_SESSION_H
 
 // C++ includes
+#include <fstream>
 #include <memory>
 #include <queue>
+#include <vector>
 
 // Boost includes
 #include <boost/asio/dispatch.hpp>
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
 #include <boost/beast.hpp>
 
 // AwsMock includes
@@ -30,6 +34,7 @@
 #define DEFAULT_MAX_BODY_SIZE (100 * 1024 * 1024)
 #define DEFAULT_MAX_QUEUE_SIZE 250
 #define DEFAULT_TIMEOUT 300
+#define DEFAULT_STREAM_CHUNK_SIZE (64 * 1024)
 
 namespace AwsMock::Service {
 
@@ -48,11 +53,13 @@ namespace AwsMock::Service {
         /**
          * @brief HTTP session
          *
-         * Takes ownership of the socket.
+         * Takes ownership of the socket. If a worker pool is given, the module handlers are executed on the pool and the response is posted
+         * back to the session strand. Otherwise, the handlers run directly on the IO thread.
          *
          * @param socket
+         * @param workerPool handler worker pool, might be nullptr
          */
-        explicit GatewaySession(ip::tcp::socket &&socket);
+        explicit GatewaySession(ip::tcp::socket &&socket, boost::asio::thread_pool *workerPool = nullptr);
 
         /**
          * @brief Start the session
@@ -69,16 +76,91 @@ namespace AwsMock::Service {
          */
         void DoRead();
 
+        /**
+         * @brief On read header callback
+         *
+         * Asks the module handler, whether the body should be streamed into a file. Otherwise, the complete message is read into memory.
+         */
+        void OnReadHeader(boost::beast::error_code ec, std::size_t bytes_transferred);
+
         /**
          * @brief On read callback
          */
         void OnRead(boost::beast::error_code ec, std::size_t bytes_transferred);
 
+        /**
+         * @brief Acquires the handler permit of a streamed request, before the body is read.
+         *
+         * The permit is acquired on the worker pool, if there is one, as the handler may wait for it. The body stream is started on the
+         * session strand afterwards. If the permit cannot be acquired, the request is answered with an internal server error without reading
+         * the body.
+         *
+         * @param handler module handler
+         * @param header HTTP request, header only
+         * @param region AWS region
+         * @param hashAlgorithms digest algorithms, which are computed from the body chunks
+         */
+        void AcquireStreamPermit(const std::shared_ptr<AbstractHandler> &handler, http::request<http::dynamic_body> &&header, const std::string &region, const std::vector<std::string> &hashAlgorithms);
+
+        /**
+         * @brief Switches the current request to a buffer body parser and opens the body file.
+         *
+         * @param hashAlgorithms digest algorithms, which are computed from the body chunks
+         */
+        void StartBodyStream(const std::vector<std::string> &hashAlgorithms);
+
+        /**
+         * @brief Reads the next chunk of a streamed body
+         */
+        void DoReadBodyChunk();
+
+        /**
+         * @brief On read body chunk callback
+         *
+         * Writes the chunk to the body file and feeds it into the digests. When the body is complete, the request is handed to the module
+         * handler.
+         */
+        void OnReadBodyChunk(boost::beast::error_code ec, std::size_t bytes_transferred);
+
+        /**
+         * @brief Aborts a streamed body, after the body file could not be written.
+         *
+         * The body file is deleted and the request is answered with an internal server error. The connection is closed after the response,
+         * as the rest of the body is not read anymore.
+         *
+         * @param reason error message
+         */
+        void AbortBodyStream(const std::string &reason);
+
         /**
          * @brief Queue write callback
          */
         void QueueWrite(http::message_generator response);
 
+        /**
+         * @brief Dispatch the request to the handler worker pool
+         *
+         * The handler runs on the worker pool, the response is posted back to the session strand, where it is queued for writing. Reading
+         * the next request is resumed after the response has been queued, so that pipelined responses keep the request order.
+         *
+         * @param request HTTP request
+         * @param bodyFile file containing the streamed body, empty for in-memory bodies
+         * @param hashSink digests of the streamed body, empty for in-memory bodies
+         * @param permit handler permit of the streamed body, released after the handler returned
+         */
+        void DispatchRequest(http::request<http::dynamic_body> &&request, const std::string &bodyFile = {}, const std::shared_ptr<Core::HashSink> &hashSink = {}, const std::shared_ptr<void> &permit = {});
+
+        /**
+         * @brief Offers a POST request to the asynchronous handler interface
+         *
+         * If the module handler accepts the request, e.g. a long polling SQS receive, no thread waits for the response. The response is
+         * queued for writing on the session strand, once the handler completes it.
+         *
+         * @param request HTTP request
+         * @return true, if the request is handled asynchronously
+         */
+        bool HandleAsyncRequest(const http::request<http::dynamic_body> &request);
+
         /**
          * @brief Return a response for the given request.
          *
@@ -87,10 +169,12 @@ namespace AwsMock::Service {
          * @tparam Body HTTP body
          * @tparam Allocator allocator
          * @param request HTTP request
+         * @param bodyFile file containing the streamed body, empty for in-memory bodies
+         * @param hashSink digests of the streamed body, empty for in-memory bodies
          * @return
          */
         template<class Body, class Allocator>
-        http::message_generator HandleRequest(http::request<Body, http::basic_fields<Allocator>> &&request);
+        http::message_generator HandleRequest(http::request<Body, http::basic_fields<Allocator>> &&request, const std::string &bodyFile = {}, const std::shared_ptr<Core::HashSink> &hashSink = {});
 
         /**
          * @brief Called to start/continue the write-loop.
@@ -113,7 +197,13 @@ namespace AwsMock::Service {
          */
         void DoClose();
 
-        static Core::AuthorizationHeaderKeys GetAuthorizationKeys(const std::string &authorizationHeader, const std::string &secretAccessKey);
+        /**
+         * @brief Returns the pieces of the authorization header, needed for the routing.
+         *
+         * @param header authorization header
+         * @return views into the authorization header, empty in case of an invalid header
+         */
+        static Core::AuthorizationHeaderView GetAuthorizationKeys(boost::beast::string_view header);
 
         /**
          * TCP stream
@@ -145,6 +235,11 @@ namespace AwsMock::Service {
          */
         bool _verifySignature;
 
+        /**
+         * Handler worker pool
+         */
+        boost::asio::thread_pool *_workerPool;
+
         /**
          * HTTP request queue
          */
@@ -155,10 +250,40 @@ namespace AwsMock::Service {
          */
         boost::optional<http::request_parser<http::dynamic_body>> _parser;
 
+        /**
+         * Parser for streamed bodies, constructed from the header of _parser
+         */
+        boost::optional<http::request_parser<http::buffer_body>> _streamParser;
+
+        /**
+         * Body chunk buffer for streamed bodies
+         */
+        std::vector<char> _streamBuffer;
+
+        /**
+         * Body file of the current streamed request
+         */
+        std::string _streamFile;
+
+        /**
+         * Body file output stream
+         */
+        std::ofstream _streamOfs;
+
+        /**
+         * Digests of the current streamed request, shared with the worker thread
+         */
+        std::shared_ptr<Core::HashSink> _streamHashSink;
+
+        /**
+         * Handler permit of the current streamed request, held until the handler returns
+         */
+        std::shared_ptr<void> _streamPermit;
+
         /**
          * Routine table
          */
-        typedef std::map<std::string, std::shared_ptr<AbstractHandler>> RoutingTable;
+        typedef std::map<std::string, std::shared_ptr<AbstractHandler>, std::less<>> RoutingTable;
         static RoutingTable _routingTable;
     };
 
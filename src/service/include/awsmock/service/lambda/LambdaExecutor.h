@@ -9,7 +9,7 @@
 #include <utility>
 
 // AwsMock includes
-#include <awsmock/core/HttpSocket.h>
+#include <awsmock/core/HttpSocketPool.h>
 #include <awsmock/core/HttpSocketResponse.h>
 #include <awsmock/core/LogStream.h>
 #include <awsmock/core/Task.h>
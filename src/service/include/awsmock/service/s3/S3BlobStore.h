@@ -0,0 +1,160 @@
+//
+// Created by vogje01 on 6/23/24.
+//
+
+#ifndef AWSMOCK_SERVICE_S3_BLOB_STORE_H
+#define AWSMOCK_SERVICE_S3_BLOB_STORE_H
+
+// C++ includes
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Poco includes
+#include <Poco/Path.h>
+
+// AwsMock includes
+#include <awsmock/core/DirUtils.h>
+#include <awsmock/core/FileUtils.h>
+#include <awsmock/core/LogStream.h>
+#include <awsmock/core/MemoryMappedFileCache.h>
+#include <awsmock/core/StringUtils.h>
+#include <awsmock/core/config/Configuration.h>
+#include <awsmock/core/exception/ServiceException.h>
+
+#define S3_BLOB_DIR "_blobs"
+#define S3_BLOB_LOCK_COUNT 64
+
+namespace AwsMock::Service {
+
+    /**
+     * @brief Content addressed, deduplicating store for S3 object files.
+     *
+     * @par
+     * Object files are stored by the SHA256 hash of their content in a sharded directory tree below the S3 data directory:
+     * ```_blobs/<hash[0:2]>/<hash[2:4]>/<hash>```. Every object references the blob through its own hard link
+     * ```_blobs/<hash[0:2]>/<hash[2:4]>/<hash>-<random>```, which is the internal name of the object. Identical uploads share the blob,
+     * copying an object only adds a link. The link count of the blob is the reference count, so it survives restarts without any additional
+     * bookkeeping. The blob is deleted, when its last reference is released.
+     *
+     * @par
+     * The directory name ```_blobs``` is not a valid bucket name, so it can not collide with bucket directories. The store is activated with
+     * ```awsmock.service.s3.blob.store.active```, objects stored before keep their flat file names and are handled as before.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class S3BlobStore {
+
+      public:
+
+        /**
+         * @brief Checks whether the blob store is active
+         *
+         * @return true, if new object files are stored in the blob store
+         */
+        static bool IsActive();
+
+        /**
+         * @brief Checks whether an internal name refers to the blob store
+         *
+         * @param internalName internal name of an object
+         * @return true, if the object file is a reference to a blob
+         */
+        static bool IsBlob(const std::string &internalName);
+
+        /**
+         * @brief Moves a file into the blob store.
+         *
+         * @par
+         * If a blob with the same content exists already, the file is deleted and a reference to the existing blob is returned.
+         *
+         * @param fileName file name, relative to the S3 data directory
+         * @param sha256 hex encoded SHA256 hash of the file content
+         * @return internal name of the new reference
+         * @throws Core::ServiceException if the file could not be stored
+         */
+        static std::string Store(const std::string &fileName, const std::string &sha256);
+
+        /**
+         * @brief Adds a reference to the blob of an existing reference, no data is copied.
+         *
+         * @param internalName internal name of an existing reference
+         * @return internal name of the new reference
+         * @throws Core::ServiceException if the reference could not be created
+         */
+        static std::string AddReference(const std::string &internalName);
+
+        /**
+         * @brief Releases a reference, the blob is deleted, when the last reference has been released.
+         *
+         * @param internalName internal name of the reference
+         */
+        static void Release(const std::string &internalName);
+
+        /**
+         * @brief Returns the number of references of a blob
+         *
+         * @param internalName internal name of a reference
+         * @return number of references
+         */
+        static long CountReferences(const std::string &internalName);
+
+      private:
+
+        /**
+         * @brief Returns the S3 data directory
+         *
+         * @return S3 data directory
+         */
+        static std::string GetDataS3Dir();
+
+        /**
+         * @brief Returns the blob name of a hash, relative to the S3 data directory
+         *
+         * @param sha256 hex encoded SHA256 hash
+         * @return relative blob name
+         */
+        static std::string GetBlobName(const std::string &sha256);
+
+        /**
+         * @brief Returns the hash of a reference
+         *
+         * @param internalName internal name of a reference
+         * @return hex encoded SHA256 hash
+         */
+        static std::string GetHash(const std::string &internalName);
+
+        /**
+         * @brief Creates a new hard link to a blob
+         *
+         * @param blobPath absolute path of the blob
+         * @param sha256 hex encoded SHA256 hash
+         * @return internal name of the new reference
+         */
+        static std::string Link(const std::string &blobPath, const std::string &sha256);
+
+        /**
+         * @brief Returns the lock of a hash.
+         *
+         * @par
+         * Creating and releasing references of the same blob must not overlap, otherwise the blob could be deleted, while a new reference is
+         * linked. Different blobs mostly use different locks.
+         *
+         * @param sha256 hex encoded SHA256 hash
+         * @return lock of the hash
+         */
+        static std::mutex &GetMutex(const std::string &sha256);
+
+        /**
+         * Striped blob locks
+         */
+        static std::array<std::mutex, S3_BLOB_LOCK_COUNT> _mutexes;
+    };
+
+}// namespace AwsMock::Service
+
+#endif// AWSMOCK_SERVICE_S3_BLOB_STORE_H
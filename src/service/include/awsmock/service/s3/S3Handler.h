@@ -50,6 +50,8 @@ namespace AwsMock::Service {
         /**
          * @brief HTTP GET request.
          *
+         * Object downloads are only handled here for range requests, complete objects are served by HandleGetMessage().
+         *
          * @param request HTTP request
          * @param region AWS region name
          * @param user AWS user
@@ -58,6 +60,19 @@ namespace AwsMock::Service {
          */
         http::response<http::dynamic_body> HandleGetRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) override;
 
+        /**
+         * @brief HTTP GET request, serving complete objects with a file body.
+         *
+         * Object downloads without a range are answered with a file body, so the object is not copied into memory. All other GET requests are
+         * handled by HandleGetRequest().
+         *
+         * @param request HTTP request
+         * @param region AWS region name
+         * @param user AWS user
+         * @return HTTP response
+         */
+        http::message_generator HandleGetMessage(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) override;
+
         /**
          * @brief HTTP PUT request.
          *
@@ -102,6 +117,43 @@ namespace AwsMock::Service {
          */
         http::response<http::dynamic_body> HandleHeadRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) override;
 
+        /**
+         * @brief Checks for object uploads, which are streamed into a file.
+         *
+         * PutObject and UploadPart requests are streamed, except copy requests and aws-chunked encoded bodies.
+         *
+         * @param request HTTP request, header only
+         * @param region AWS region name
+         * @param user AWS user
+         * @param hashAlgorithms digest algorithms of the body, the MD5 ETag and the requested checksum
+         * @return true, if the body should be streamed
+         */
+        bool IsStreamingRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user, std::vector<std::string> &hashAlgorithms) override;
+
+        /**
+         * @brief Acquires the concurrent part slot of a streamed UploadPart request.
+         *
+         * @param request HTTP request, header only
+         * @param region AWS region name
+         * @param user AWS user
+         * @return part permit, null for other requests
+         * @throws Core::ServiceException if no part slot became free in time
+         * @see S3Service::AcquirePartPermit()
+         */
+        std::shared_ptr<void> AcquireStreamPermit(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) override;
+
+        /**
+         * @brief HTTP PUT request with a streamed body.
+         *
+         * @param request HTTP request, header only
+         * @param bodyFile file containing the request body
+         * @param hashSink digests of the request body
+         * @param region AWS region name
+         * @param user AWS user
+         * @return HTTP response
+         */
+        http::response<http::dynamic_body> HandlePutStreamRequest(const http::request<http::dynamic_body> &request, const std::string &bodyFile, Core::HashSink &hashSink, const std::string &region, const std::string &user) override;
+
       private:
 
         /**
@@ -114,6 +166,36 @@ namespace AwsMock::Service {
          */
         static void GetRange(const http::request<http::dynamic_body> &request, long &min, long &max, long &size);
 
+        /**
+         * @brief Get the get object request from the path, the version ID and the range header
+         *
+         * @param request HTTP request
+         * @param clientCommand S3 client command
+         * @return get object request
+         */
+        static Dto::S3::GetObjectRequest GetObjectRequest(const http::request<http::dynamic_body> &request, const Dto::Common::S3ClientCommand &clientCommand);
+
+        /**
+         * @brief Returns an integer query parameter
+         *
+         * @param request HTTP request
+         * @param name parameter name
+         * @param defaultValue value, if the parameter is missing or empty
+         * @return parameter value
+         * @throws Core::BadRequestException if the value is not a non-negative integer
+         */
+        static int GetIntParameter(const http::request<http::dynamic_body> &request, const std::string &name, int defaultValue);
+
+        /**
+         * @brief Get the list bucket request from the query parameters
+         *
+         * @param request HTTP request
+         * @param clientCommand S3 client command
+         * @return list bucket request
+         * @throws Core::BadRequestException if a numeric parameter is invalid
+         */
+        static Dto::S3::ListBucketRequest GetListBucketRequest(const http::request<http::dynamic_body> &request, const Dto::Common::S3ClientCommand &clientCommand);
+
         /**
          * @brief Returns the metadata has string key/value map.
          *
@@ -125,6 +207,14 @@ namespace AwsMock::Service {
          */
         static std::map<std::string, std::string> GetMetadata(const http::request<http::dynamic_body> &request);
 
+        /**
+         * @brief Returns the response headers of a get object request.
+         *
+         * @param s3Response get object response
+         * @return hash map of response headers
+         */
+        static std::map<std::string, std::string> GetObjectHeaders(const Dto::S3::GetObjectResponse &s3Response);
+
         /**
          * S3 service
          */
@@ -21,7 +21,7 @@
 #define S3_DEFAULT_MAX_THREADS 50
 #define S3_DEFAULT_TIMEOUT 900
 #define S3_DEFAULT_MONITORING_PERIOD 300
-#define S3_DEFAULT_WORKER_PERIOD 3600
+#define S3_DEFAULT_WORKER_PERIOD 10
 
 namespace AwsMock::Service {
 
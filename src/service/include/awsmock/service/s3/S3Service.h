@@ -13,11 +13,14 @@
 #include <boost/thread/thread.hpp>
 
 // AwsMock includes
+#include "awsmock/core/exception/BadRequestException.h"
 #include "awsmock/core/exception/NotFoundException.h"
 #include "awsmock/core/exception/ServiceException.h"
 #include <awsmock/core/CryptoUtils.h>
+#include <awsmock/core/HashSink.h>
+#include <awsmock/core/KeyedSemaphore.h>
 #include <awsmock/core/LogStream.h>
-#include <awsmock/core/MemoryMappedFile.h>
+#include <awsmock/core/MemoryMappedFileCache.h>
 #include <awsmock/dto/s3/CompleteMultipartUploadRequest.h>
 #include <awsmock/dto/s3/CompleteMultipartUploadResult.h>
 #include <awsmock/dto/s3/CopyObjectRequest.h>
@@ -60,7 +63,7 @@
 #include <awsmock/service/kms/KMSService.h>
 #include <awsmock/service/lambda/LambdaExecutor.h>
 #include <awsmock/service/lambda/LambdaService.h>
-#include <awsmock/service/s3/S3HashCreator.h>
+#include <awsmock/service/s3/S3BlobStore.h>
 #include <awsmock/service/sns/SNSService.h>
 #include <awsmock/service/sqs/SQSService.h>
 
@@ -69,6 +72,9 @@
 #define DEFAULT_DATA_DIR "/home/awsmock/data"
 #define DEFAULT_TRANSFER_DATA_DIR "/tmp/awsmock/data/transfer"
 #define DEFAULT_TRANSFER_BUCKET_NAME "transfer-server"
+#define S3_MAX_MULTIPART_PARTS 10000
+#define S3_DEFAULT_MULTIPART_CONCURRENCY 16
+#define S3_DEFAULT_MULTIPART_TIMEOUT 300
 
 namespace AwsMock::Service {
 
@@ -154,12 +160,29 @@ namespace AwsMock::Service {
         /**
          * @brief Upload a partial file
          *
+         * @par
+         * The number of parts of an upload, which are processed concurrently, is limited by awsmock.service.s3.multipart.concurrency.
+         *
          * @param stream input stream
          * @param part part number
          * @param updateId upload ID
          * @return ETag
          */
-        static std::string UploadPart(std::istream &stream, int part, const std::string &updateId);
+        std::string UploadPart(std::istream &stream, int part, const std::string &updateId);
+
+        /**
+         * @brief Upload a partial file, which was already streamed into a file.
+         *
+         * The body file is moved into the upload directory, no copy is made. The MD5 digest has been computed while streaming. The caller
+         * holds the part permit from AcquirePartPermit() from the start of the body until this method returns.
+         *
+         * @param bodyFile file containing the part data
+         * @param part part number
+         * @param updateId upload ID
+         * @param hashSink digests of the part data
+         * @return ETag
+         */
+        std::string UploadPart(const std::string &bodyFile, int part, const std::string &updateId, Core::HashSink &hashSink);
 
         /**
          * @brief Upload a partial file copy.
@@ -173,6 +196,19 @@ namespace AwsMock::Service {
          */
         Dto::S3::UploadPartCopyResponse UploadPartCopy(const Dto::S3::UploadPartCopyRequest &request);
 
+        /**
+         * @brief Acquires one of the concurrent part slots of a multipart upload
+         *
+         * @par
+         * The number of parts of an upload, which are processed concurrently, is limited by awsmock.service.s3.multipart.concurrency. A part
+         * waits at most awsmock.service.s3.multipart.timeout for a free slot.
+         *
+         * @param uploadId upload ID
+         * @return permit, the slot is released, when the permit is destroyed
+         * @throws Core::ServiceException if no slot became free in time
+         */
+        static std::shared_ptr<Core::KeyedSemaphore::Permit> AcquirePartPermit(const std::string &uploadId);
+
         /**
          * @brief Completes a multipart upload.
          *
@@ -181,6 +217,13 @@ namespace AwsMock::Service {
          */
         Dto::S3::CompleteMultipartUploadResult CompleteMultipartUpload(const Dto::S3::CompleteMultipartUploadRequest &request);
 
+        /**
+         * @brief Aborts a multipart upload, the uploaded parts are deleted.
+         *
+         * @param uploadId multipart upload ID
+         */
+        void AbortMultipartUpload(const std::string &uploadId);
+
         /**
          * @brief Get object
          *
@@ -199,6 +242,29 @@ namespace AwsMock::Service {
          */
         Dto::S3::PutObjectResponse PutObject(Dto::S3::PutObjectRequest &request, std::istream &stream, bool chunkEncoding);
 
+        /**
+         * @brief Put object, which was already streamed into a file.
+         *
+         * The body file is moved into the S3 data directory, no copy is made. The digests have been computed while streaming, with the
+         * algorithms of GetHashAlgorithms().
+         *
+         * @param request put object request
+         * @param bodyFile file containing the object data
+         * @param hashSink digests of the object data
+         * @return PutObjectResponse
+         */
+        Dto::S3::PutObjectResponse PutObject(Dto::S3::PutObjectRequest &request, const std::string &bodyFile, Core::HashSink &hashSink);
+
+        /**
+         * @brief Returns the hash algorithms for an object upload.
+         *
+         * MD5 is always computed, as it is used as ETag. SHA256 is computed, if the blob store is active, as it is the blob address.
+         *
+         * @param checksumAlgorithm requested checksum algorithm, might be empty
+         * @return list of hash algorithms
+         */
+        static std::vector<std::string> GetHashAlgorithms(const std::string &checksumAlgorithm);
+
         /**
          * @brief Copy object
          *
@@ -274,6 +340,25 @@ namespace AwsMock::Service {
 
       private:
 
+        /**
+         * @brief Returns the continuation token of a bucket listing
+         *
+         * The token is the hex encoded last key or common prefix of the page, so that it needs no URL encoding.
+         *
+         * @param key last key or common prefix
+         * @return continuation token
+         */
+        static std::string EncodeContinuationToken(const std::string &key);
+
+        /**
+         * @brief Returns the last key or common prefix of a continuation token
+         *
+         * @param token continuation token
+         * @return last key or common prefix
+         * @throws Core::ServiceException if the token is invalid
+         */
+        static std::string DecodeContinuationToken(const std::string &token);
+
         /**
          * @brief Sends a message to the corresponding SQS queue.
          *
@@ -341,6 +426,40 @@ namespace AwsMock::Service {
          */
         static std::string GetMultipartUploadDirectory(const std::string &uploadId);
 
+        /**
+         * @brief Returns a unique file name for an uploaded part.
+         *
+         * @param uploadId S3 multipart upload ID
+         * @param part part number
+         * @return file name of the part, relative to the upload directory
+         * @throws Core::BadRequestException if the part number is invalid
+         * @throws Core::NotFoundException if the upload does not exist
+         */
+        static std::string GetPartFileName(const std::string &uploadId, int part);
+
+        /**
+         * @brief Adds an uploaded part to the upload manifest, a replaced part file is deleted.
+         *
+         * @param uploadId S3 multipart upload ID
+         * @param part uploaded part
+         * @throws Core::NotFoundException if the upload does not exist
+         */
+        void AddMultipartPart(const std::string &uploadId, const Database::Entity::S3::MultipartPart &part);
+
+        /**
+         * @brief Returns the maximal number of concurrently processed parts of an upload
+         *
+         * @return maximal number of concurrent parts
+         */
+        static int GetMultipartConcurrency();
+
+        /**
+         * @brief Returns the maximal wait time of a part, before it is rejected
+         *
+         * @return maximal wait time
+         */
+        static std::chrono::milliseconds GetMultipartTimeout();
+
         /**
          * @brief Create a queue notification
          *
@@ -368,6 +487,26 @@ namespace AwsMock::Service {
          */
         void DeleteObject(const std::string &bucket, const std::string &key, const std::string &internalName);
 
+        /**
+         * @brief Deletes the file of an object, references to the blob store are released.
+         *
+         * @param internalName S3 internal name
+         */
+        static void DeleteObjectFile(const std::string &internalName);
+
+        /**
+         * @brief Moves a new object file into the blob store, if the blob store is active.
+         *
+         * @par
+         * Files of encrypted buckets are encrypted in place, they are never shared and keep their own file.
+         *
+         * @param bucket S3 bucket
+         * @param fileName internal name of the new file in the S3 data directory
+         * @param hashSink hash sink, containing the SHA256 hash of the file
+         * @return internal name of the object
+         */
+        static std::string StoreObjectFile(const Database::Entity::S3::Bucket &bucket, const std::string &fileName, Core::HashSink &hashSink);
+
         /**
          * @brief Deletes an bucket
          *
@@ -377,27 +516,37 @@ namespace AwsMock::Service {
          */
         void DeleteBucket(const std::string &bucket);
 
+        /**
+         * @brief Writes the input stream into a new file in the S3 data directory.
+         *
+         * @param stream input stream
+         * @param chunkEncoding chunk encoding settings
+         * @param hashSink hash sink, fed with the bytes written
+         * @return internal file name
+         */
+        static std::string WriteObjectFile(std::istream &stream, bool chunkEncoding, Core::HashSink &hashSink);
+
         /**
          * @brief Save a versioned S3 object.
          *
          * @param request put object request
          * @param bucket S3 bucket
-         * @param stream input stream
-         * @param chunkEncoding chunk encoding settings
+         * @param fileName internal name of the object file in the S3 data directory
+         * @param hashSink hash sink, containing the hashes of the object file
          * @return file name
          */
-        Dto::S3::PutObjectResponse SaveVersionedObject(Dto::S3::PutObjectRequest &request, const Database::Entity::S3::Bucket &bucket, std::istream &stream, bool chunkEncoding);
+        Dto::S3::PutObjectResponse SaveVersionedObject(Dto::S3::PutObjectRequest &request, const Database::Entity::S3::Bucket &bucket, const std::string &fileName, Core::HashSink &hashSink);
 
         /**
          * @brief Save a un-versioned S3 object.
          *
          * @param request put object request
          * @param bucket S3 bucket
-         * @param stream input stream
-         * @param chunkEncoding chunk encoding settings
+         * @param fileName internal name of the object file in the S3 data directory
+         * @param hashSink hash sink, containing the hashes of the object file
          * @return file name
          */
-        Dto::S3::PutObjectResponse SaveUnversionedObject(Dto::S3::PutObjectRequest &request, const Database::Entity::S3::Bucket &bucket, std::istream &stream, bool chunkEncoding);
+        Dto::S3::PutObjectResponse SaveUnversionedObject(Dto::S3::PutObjectRequest &request, const Database::Entity::S3::Bucket &bucket, const std::string &fileName, Core::HashSink &hashSink);
 
         /**
          * @brief Adds the queue notification configuration to the provided bucket.
@@ -428,6 +577,11 @@ namespace AwsMock::Service {
          */
         Database::S3Database &_database;
 
+        /**
+         * Concurrent parts by upload ID
+         */
+        static Core::KeyedSemaphore _partSemaphore;
+
         /**
          * Lambda service
          */
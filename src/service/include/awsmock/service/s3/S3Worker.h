@@ -6,7 +6,11 @@
 #define AWSMOCK_SERVICE_S3_WORKER_H
 
 // C++ includes
+#include <cstdint>
+#include <ctime>
 #include <filesystem>
+#include <sys/stat.h>
+#include <vector>
 
 // Boost includes
 #include <boost/filesystem.hpp>
@@ -14,6 +18,11 @@
 // AwsMock includes
 #include <awsmock/core/Timer.h>
 #include <awsmock/repository/S3Database.h>
+#include <awsmock/service/s3/S3BlobStore.h>
+
+#define S3_DEFAULT_SWEEPER_BUDGET 1000
+#define S3_SWEEPER_PAGE_SIZE 100
+#define S3_SWEEPER_BITMAP_BITS (1 << 24)
 
 namespace AwsMock::Service {
 
@@ -24,6 +33,21 @@ namespace AwsMock::Service {
      *
      * Used as background thread to do maintenance work, like resetting resources, deleted S3 objects not existing in the database anymore.
      *
+     * @par
+     * The consistency sweep is incremental. Every run processes at most ```awsmock.service.s3.sweeper.budget``` objects and files and
+     * continues, where the previous run stopped. The runs are short, therefore the worker period is in the range of seconds, with the
+     * defaults a store of 100k objects is checked in about half an hour. A generation consists of two phases:
+     * <ul>
+     * <li>Mark: walks the object metadata page by page in object ID order. Objects, whose file is missing, are deleted in bulk, the internal
+     * names of all other objects are marked in a bitmap.</li>
+     * <li>Sweep: walks the S3 data directory, including the blob store shards. Files, which are not marked and have not been changed since
+     * the generation started, are deleted.</li>
+     * </ul>
+     *
+     * @par
+     * The bitmap is salted with the generation, so a file, which shares its bit with a marked file, is only kept until a later generation.
+     * No database query is needed per file.
+     *
      * @author jens.vogt\@opitz-consulting.com
      */
     class S3Worker : public Core::Timer {
@@ -53,14 +77,95 @@ namespace AwsMock::Service {
       private:
 
         /**
-         * @brief Synchronize S3 object between filesystem and database.
+         * Sweeper phases
+         */
+        enum class SweepPhase {
+            MARK,
+            SWEEP
+        };
+
+        /**
+         * @brief Synchronize S3 object between filesystem and database, processing at most the configured budget.
+         */
+        void SyncObjects();
+
+        /**
+         * @brief Starts a new generation, with an empty bitmap and the object cursor at the beginning.
+         */
+        void StartGeneration();
+
+        /**
+         * @brief Marks the files of the next objects, objects without file are deleted.
+         *
+         * @param budget maximal number of objects
+         * @return number of processed objects, less than the budget, if all objects have been marked
+         */
+        long MarkObjects(long budget);
+
+        /**
+         * @brief Deletes the next unmarked files.
+         *
+         * @param budget maximal number of directory entries
+         * @return number of processed directory entries, less than the budget, if the directory walk is finished
+         */
+        long SweepFiles(long budget);
+
+        /**
+         * @brief Returns the bitmap index of an internal name in the current generation
+         *
+         * @param internalName internal name of an object file, relative to the S3 data directory
+         * @return bitmap index
+         */
+        [[nodiscard]] size_t GetMarkIndex(const std::string &internalName) const;
+
+        /**
+         * @brief Checks whether a file is an orphan and deletes it
+         *
+         * @param entry directory entry
+         * @param s3DataDir S3 data directory
+         * @return true, if the file has been deleted
          */
-        [[maybe_unused]] void SyncObjects();
+        bool SweepFile(const directory_entry &entry, const std::string &s3DataDir);
 
         /**
          * Database connection
          */
         Database::S3Database &_s3Database = Database::S3Database::instance();
+
+        /**
+         * Current phase
+         */
+        SweepPhase _phase = SweepPhase::MARK;
+
+        /**
+         * Generation counter, used as bitmap salt
+         */
+        uint64_t _generation = 0;
+
+        /**
+         * Start of the current generation, files changed later are never deleted in this generation
+         */
+        time_t _generationStart = 0;
+
+        /**
+         * Object ID of the last marked object
+         */
+        std::string _objectCursor;
+
+        /**
+         * Directory cursor of the sweep phase
+         */
+        recursive_directory_iterator _fileCursor;
+
+        /**
+         * Mark bitmap of the current generation
+         */
+        std::vector<uint64_t> _marks;
+
+        /**
+         * Statistics of the current generation
+         */
+        long _objectsDeleted = 0, _filesDeleted = 0;
     };
 
 }// namespace AwsMock::Service
@@ -0,0 +1,129 @@
+//
+// Created by vogje01 on 6/11/24.
+//
+
+#ifndef AWSMOCK_SERVICE_SQS_DEDUPLICATION_INDEX_H
+#define AWSMOCK_SERVICE_SQS_DEDUPLICATION_INDEX_H
+
+// C++ standard includes
+#include <chrono>
+#include <deque>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+// Boost includes
+#include <boost/thread/mutex.hpp>
+
+// AwsMock includes
+#include <awsmock/core/LogStream.h>
+
+#define SQS_DEDUPLICATION_INTERVAL 300
+
+namespace AwsMock::Service {
+
+    /**
+     * @brief Deduplication window of the FIFO queues
+     *
+     * @par
+     * Keeps the deduplication IDs of the messages sent to FIFO queues during the deduplication interval (5 minutes). A message with a
+     * deduplication ID seen before within the interval is accepted, but not delivered again. The sender gets the message ID and sequence number
+     * of the original message.
+     *
+     * @par
+     * The IDs are kept in a hash index and in a ring in insertion order. Expired IDs are dropped from the head of the ring, so every
+     * operation is amortized O(1).
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class SQSDeduplicationIndex {
+
+      public:
+
+        /**
+         * Original message of a deduplication ID
+         */
+        struct Entry {
+
+            /**
+             * Message ID
+             */
+            std::string messageId;
+
+            /**
+             * Sequence number
+             */
+            std::string sequenceNumber;
+
+            /**
+             * End of the deduplication interval
+             */
+            std::chrono::system_clock::time_point expires;
+        };
+
+        /**
+         * @brief Constructor
+         *
+         * @param interval deduplication interval
+         */
+        explicit SQSDeduplicationIndex(std::chrono::seconds interval = std::chrono::seconds(SQS_DEDUPLICATION_INTERVAL)) : _interval(interval) {}
+
+        /**
+         * @brief Registers a deduplication ID
+         *
+         * @param queueUrl queue URL
+         * @param deduplicationId deduplication ID
+         * @param messageId message ID of the new message
+         * @param sequenceNumber sequence number of the new message
+         * @return original message, if the deduplication ID has been seen within the interval, otherwise empty
+         */
+        std::optional<Entry> Register(const std::string &queueUrl, const std::string &deduplicationId, const std::string &messageId, const std::string &sequenceNumber);
+
+        /**
+         * @brief Removes a deduplication ID, e.g. when the message could not be stored
+         *
+         * @param queueUrl queue URL
+         * @param deduplicationId deduplication ID
+         */
+        void Remove(const std::string &queueUrl, const std::string &deduplicationId);
+
+        /**
+         * @brief Returns the number of deduplication IDs within the interval
+         *
+         * @return number of IDs
+         */
+        long Size();
+
+      private:
+
+        /**
+         * @brief Drops the expired IDs from the head of the ring. Needs the mutex.
+         *
+         * @param now current time
+         */
+        void Expire(std::chrono::system_clock::time_point now);
+
+        /**
+         * Deduplication interval
+         */
+        std::chrono::seconds _interval;
+
+        /**
+         * Original messages by queue URL and deduplication ID
+         */
+        std::unordered_map<std::string, Entry> _entries;
+
+        /**
+         * Keys in insertion order, with the end of their interval
+         */
+        std::deque<std::pair<std::chrono::system_clock::time_point, std::string>> _ring;
+
+        /**
+         * Index mutex
+         */
+        boost::mutex _mutex;
+    };
+
+}// namespace AwsMock::Service
+
+#endif// AWSMOCK_SERVICE_SQS_DEDUPLICATION_INDEX_H
@@ -58,8 +58,39 @@ namespace AwsMock::Service {
          */
         http::response<http::dynamic_body> HandlePostRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) override;
 
+        /**
+         * @brief Asynchronous HTTP POST request.
+         *
+         * Long polling ReceiveMessage requests, i.e. requests with a wait time, are parked in the wait list of the queue, until messages
+         * arrive or the wait time elapses. All other requests are answered right away.
+         *
+         * @param request HTTP request
+         * @param region AWS region
+         * @param user AWS user
+         * @param callback completion callback
+         * @return always true
+         */
+        bool HandleAsyncPostRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user, const ResponseCallback &callback) override;
+
       private:
 
+        /**
+         * Handles a parsed SQS command synchronously.
+         *
+         * @param request HTTP request
+         * @param clientCommand SQS client command
+         * @return HTTP response
+         */
+        http::response<http::dynamic_body> HandleCommand(const http::request<http::dynamic_body> &request, const Dto::Common::SQSClientCommand &clientCommand);
+
+        /**
+         * Get the receive message request from the client command.
+         *
+         * @param clientCommand SQS client command
+         * @return receive message request
+         */
+        static Dto::SQS::ReceiveMessageRequest GetReceiveMessageRequest(const Dto::Common::SQSClientCommand &clientCommand);
+
         /**
          * Get the queue userAttributes.
          *
@@ -88,9 +119,10 @@ namespace AwsMock::Service {
          * Get the message attributes.
          *
          * @param payload HTTP body
+         * @param prefix parameter prefix, e.g. the batch entry prefix
          * @return list of message userAttributes
          */
-        static std::map<std::string, Dto::SQS::MessageAttribute> GetMessageAttributes(const std::string &payload);
+        static std::map<std::string, Dto::SQS::MessageAttribute> GetMessageAttributes(const std::string &payload, const std::string &prefix = {});
 
         /**
          * SQS service
@@ -5,11 +5,14 @@
 #ifndef AWSMOCK_SERVICE_SQS_MONITORING_H
 #define AWSMOCK_SERVICE_SQS_MONITORING_H
 
+// Poco includes
+#include <Poco/String.h>
+
 // AwsMock includes
 #include <awsmock/core/Timer.h>
 #include <awsmock/core/monitoring/MetricDefinition.h>
 #include <awsmock/core/monitoring/MetricService.h>
-#include <awsmock/repository/SQSDatabase.h>
+#include <awsmock/service/sqs/SQSStatistics.h>
 
 namespace AwsMock::Service {
 
@@ -48,12 +51,15 @@ namespace AwsMock::Service {
          * @brief Collect waiting time statistics
          *
          * @par
-         * Collects the average waiting time for messages in that queue.
+         * Publishes the average and the 99th percentile of the time between sending a message and its first receive per queue.
          */
         void CollectWaitingTimeStatistics();
 
         /**
          * @brief Update counters
+         *
+         * @par
+         * The counters are taken from the incrementally maintained queue statistics, the database is not queried.
          */
         void UpdateCounter();
 
@@ -63,9 +69,9 @@ namespace AwsMock::Service {
         Core::MetricService &_metricService = Core::MetricService::instance();
 
         /**
-         * Database connection
+         * SQS queue statistics
          */
-        Database::SQSDatabase &_sqsDatabase = Database::SQSDatabase::instance();
+        SQSStatistics &_sqsStatistics = SQSStatistics::instance();
     };
 
 }// namespace AwsMock::Service
@@ -22,7 +22,7 @@
 #define SQS_DEFAULT_THREADS 50
 #define SQS_DEFAULT_TIMEOUT 120
 #define SQS_DEFAULT_MONITORING_PERIOD 300
-#define SQS_DEFAULT_WORKER_PERIOD 30
+#define SQS_DEFAULT_WORKER_PERIOD 1
 
 namespace AwsMock::Service {
 
@@ -113,6 +113,11 @@ namespace AwsMock::Service {
          * SQS worker period
          */
         int _workerPeriod;
+
+        /**
+         * Worker sweep period in seconds
+         */
+        int _workerSweepPeriod;
     };
 
 }// namespace AwsMock::Service
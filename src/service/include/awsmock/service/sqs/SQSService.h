@@ -7,6 +7,8 @@
 
 // C++ standard includes
 #include <chrono>
+#include <functional>
+#include <future>
 #include <map>
 #include <string>
 
@@ -19,16 +21,22 @@
 // AwsMock includes
 #include <awsmock/core/AwsUtils.h>
 #include <awsmock/core/CryptoUtils.h>
+#include <awsmock/core/DeadlineQueue.h>
 #include <awsmock/core/LogStream.h>
+#include <awsmock/core/SharedString.h>
+#include <awsmock/core/WaitList.h>
 #include <awsmock/core/exception/NotFoundException.h>
 #include <awsmock/core/exception/ServiceException.h>
 #include <awsmock/core/monitoring/MetricDefinition.h>
 #include <awsmock/core/monitoring/MetricService.h>
 #include <awsmock/core/monitoring/MetricServiceTimer.h>
+#include <awsmock/dto/sqs/ChangeMessageVisibilityBatchRequest.h>
+#include <awsmock/dto/sqs/ChangeMessageVisibilityBatchResponse.h>
 #include <awsmock/dto/sqs/ChangeMessageVisibilityRequest.h>
 #include <awsmock/dto/sqs/CreateQueueRequest.h>
 #include <awsmock/dto/sqs/CreateQueueResponse.h>
 #include <awsmock/dto/sqs/DeleteMessageBatchRequest.h>
+#include <awsmock/dto/sqs/DeleteMessageBatchResponse.h>
 #include <awsmock/dto/sqs/DeleteMessageRequest.h>
 #include <awsmock/dto/sqs/DeleteMessageResponse.h>
 #include <awsmock/dto/sqs/DeleteQueueRequest.h>
@@ -41,15 +49,20 @@
 #include <awsmock/dto/sqs/PurgeQueueRequest.h>
 #include <awsmock/dto/sqs/ReceiveMessageRequest.h>
 #include <awsmock/dto/sqs/ReceiveMessageResponse.h>
+#include <awsmock/dto/sqs/SendMessageBatchRequest.h>
+#include <awsmock/dto/sqs/SendMessageBatchResponse.h>
 #include <awsmock/dto/sqs/SendMessageRequest.h>
 #include <awsmock/dto/sqs/SendMessageResponse.h>
 #include <awsmock/dto/sqs/SetQueueAttributesRequest.h>
 #include <awsmock/dto/sqs/SetQueueAttributesResponse.h>
 #include <awsmock/dto/sqs/TagQueueRequest.h>
 #include <awsmock/repository/SQSDatabase.h>
+#include <awsmock/service/sqs/SQSDeduplicationIndex.h>
+#include <awsmock/service/sqs/SQSStatistics.h>
 
 #define SQS_DEFAULT_ACCOUNT_ID "000000000000"
 #define SQS_DEFAULT_VISIBILITY_TIMEOUT 300
+#define SQS_MIN_WAKEUP_DELAY 10
 
 namespace AwsMock::Service {
 
@@ -64,6 +77,11 @@ namespace AwsMock::Service {
 
       public:
 
+        /**
+         * Completion callback of an asynchronous receive
+         */
+        typedef std::function<void(const Dto::SQS::ReceiveMessageResponse &)> ReceiveCallback;
+
         /**
          * @brief Constructor
          */
@@ -130,6 +148,17 @@ namespace AwsMock::Service {
          */
         void SetVisibilityTimeout(Dto::SQS::ChangeMessageVisibilityRequest &request);
 
+        /**
+         * @brief Sets the visibility timeout of a list of messages.
+         *
+         * All entries are written with a single database write. Unknown receipt handles are reported as failed entries.
+         *
+         * @param request change message visibility batch request
+         * @return ChangeMessageVisibilityBatchResponse
+         * @throws ServiceException
+         */
+        Dto::SQS::ChangeMessageVisibilityBatchResponse SetVisibilityTimeoutBatch(const Dto::SQS::ChangeMessageVisibilityBatchRequest &request);
+
         /**
          * @brief Sets tags for a queue.
          *
@@ -159,15 +188,70 @@ namespace AwsMock::Service {
          */
         Dto::SQS::SendMessageResponse SendMessage(const Dto::SQS::SendMessageRequest &request);
 
+        /**
+         * @brief Sends a list of messages to a queue
+         *
+         * All entries are written with a single database write. Entries without body are reported as failed entries.
+         *
+         * @param request send message batch request
+         * @return SendMessageBatchResponse
+         * @throws ServiceException
+         */
+        Dto::SQS::SendMessageBatchResponse SendMessageBatch(const Dto::SQS::SendMessageBatchRequest &request);
+
         /**
          * @brief Receive a list of resources
          *
+         * Blocks the calling thread for at most the wait time of the request, see the asynchronous variant.
+         *
          * @param request receive message request
          * @return ReceiveMessageResponse
          * @throws ServiceException
          */
         Dto::SQS::ReceiveMessageResponse ReceiveMessages(const Dto::SQS::ReceiveMessageRequest &request);
 
+        /**
+         * @brief Receive a list of resources asynchronously
+         *
+         * @par
+         * If no message is available and the request has a wait time, the receiver is parked in the wait list of the queue, without holding a
+         * thread. It is woken up by new messages and by expiring visibility timeouts. The callback is called exactly once, either with the
+         * received messages, or with an empty response after the wait time. It may be called on any thread.
+         *
+         * @param request receive message request
+         * @param callback completion callback
+         * @throws ServiceException, if the queue does not exist
+         */
+        void ReceiveMessages(const Dto::SQS::ReceiveMessageRequest &request, const ReceiveCallback &callback);
+
+        /**
+         * @brief Wakes up the receivers waiting on a queue
+         *
+         * @param queueUrl queue URL
+         */
+        static void NotifyReceivers(const std::string &queueUrl);
+
+        /**
+         * @brief Schedules the maintenance of a queue by the SQS worker
+         *
+         * @par
+         * Queues are maintained, when their messages have changed, and when the next visibility timeout, delay or retention period ends.
+         * Each queue has at most one pending maintenance, the earliest one wins.
+         *
+         * @param region AWS region
+         * @param queueUrl queue URL
+         * @param timePoint time of the maintenance
+         */
+        static void ScheduleMaintenance(const std::string &region, const std::string &queueUrl, system_clock::time_point timePoint = system_clock::now());
+
+        /**
+         * @brief Removes the queues, which are due for maintenance
+         *
+         * @param now current time
+         * @return region and URL of the due queues
+         */
+        static std::vector<std::pair<std::string, std::string>> TakeDueMaintenance(system_clock::time_point now);
+
         /**
          * @brief Deletes a message
          *
@@ -179,13 +263,84 @@ namespace AwsMock::Service {
         /**
          * @brief Deletes a message in a batch
          *
+         * All entries are deleted with a single database write. Unknown receipt handles are reported as failed entries.
+         *
          * @param request delete message batch request DTO
+         * @return DeleteMessageBatchResponse
          * @throws ServiceException
          */
-        void DeleteMessageBatch(const Dto::SQS::DeleteMessageBatchRequest &request);
+        Dto::SQS::DeleteMessageBatchResponse DeleteMessageBatch(const Dto::SQS::DeleteMessageBatchRequest &request);
 
       private:
 
+        /**
+         * @brief Creates a new message entity, including the system attributes, the initial reset time and the MD5 sums
+         *
+         * @param queue queue entity
+         * @param region AWS region
+         * @param body message body, shared with the message entity
+         * @param systemAttributes system attributes of the request
+         * @param userAttributes message attributes of the request
+         * @param senderId sender ID
+         * @return message entity
+         */
+        static Database::Entity::SQS::Message CreateMessageEntity(const Database::Entity::SQS::Queue &queue, const std::string &region, const Core::SharedString &body, const std::map<std::string, std::string> &systemAttributes, const Dto::SQS::MessageAttributeList &userAttributes, const std::string &senderId);
+
+        /**
+         * @brief Sets the message group ID, deduplication ID and sequence number of a FIFO queue message
+         *
+         * @par
+         * Without an explicit deduplication ID, the SHA-256 hash of the body is used, if the queue has content based deduplication enabled.
+         *
+         * @param queue FIFO queue entity
+         * @param messageGroupId message group ID of the request
+         * @param messageDeduplicationId message deduplication ID of the request
+         * @param message message entity
+         * @return effective deduplication ID
+         * @throws Core::ServiceException if the group ID or the deduplication ID is missing
+         */
+        static std::string SetFifoAttributes(const Database::Entity::SQS::Queue &queue, const std::string &messageGroupId, const std::string &messageDeduplicationId, Database::Entity::SQS::Message &message);
+
+        /**
+         * @brief Returns the deduplication window of the FIFO queues, shared by all service instances
+         *
+         * @return deduplication index
+         */
+        static SQSDeduplicationIndex &GetDeduplicationIndex();
+
+        /**
+         * @brief Receives the available messages of a queue
+         *
+         * @param database SQS database
+         * @param queue queue entity
+         * @param request receive message request
+         * @param response receive message response
+         * @return true, if messages have been received
+         */
+        static bool TryReceiveMessages(Database::SQSDatabase &database, const Database::Entity::SQS::Queue &queue, const Dto::SQS::ReceiveMessageRequest &request, Dto::SQS::ReceiveMessageResponse &response);
+
+        /**
+         * @brief Schedules a wake-up of the waiting receivers, when the next invisible message of the queue becomes visible again
+         *
+         * @param database SQS database
+         * @param queueUrl queue URL
+         */
+        static void ScheduleWakeup(Database::SQSDatabase &database, const std::string &queueUrl);
+
+        /**
+         * @brief Returns the wait list of the long polling receivers, shared by all service instances
+         *
+         * @return receiver wait list
+         */
+        static Core::WaitList &GetWaitList();
+
+        /**
+         * @brief Returns the maintenance schedule of the queues, keyed by region and queue URL, shared by all service instances
+         *
+         * @return maintenance schedule
+         */
+        static Core::DeadlineQueue &GetMaintenanceQueue();
+
         /**
          * @brief Checks the attributes for a entry with 'all'. The search is case insensitive.
          *
@@ -0,0 +1,233 @@
+//
+// Created by vogje01 on 6/15/24.
+//
+
+#ifndef AWSMOCK_SERVICE_SQS_STATISTICS_H
+#define AWSMOCK_SERVICE_SQS_STATISTICS_H
+
+// C++ standard includes
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Boost includes
+#include <boost/thread/mutex.hpp>
+
+// AwsMock includes
+#include <awsmock/core/LogStream.h>
+#include <awsmock/entity/sqs/Message.h>
+
+// Number of wait time histogram buckets, bucket i counts wait times below 2^i milliseconds
+#define SQS_WAIT_TIME_BUCKETS 32
+
+namespace AwsMock::Service {
+
+    /**
+     * @brief Incrementally maintained SQS queue statistics
+     *
+     * @par
+     * Keeps per queue atomic counters of the visible, in-flight and delayed messages, and a histogram of the time between sending a message
+     * and its first receive. The counters are updated by the SQS service on send, receive and delete, and reconciled with the database by
+     * the SQS worker, whenever it maintains a queue, e.g. after a visibility timeout. Reading the statistics never touches the database.
+     *
+     * @author jens.vogt\@opitz-consulting.com
+     */
+    class SQSStatistics {
+
+      public:
+
+        /**
+         * Statistics of a single queue
+         */
+        struct QueueStatistics {
+
+            /**
+             * Queue URL
+             */
+            std::string queueUrl;
+
+            /**
+             * Queue name
+             */
+            std::string name;
+
+            /**
+             * Visible messages
+             */
+            long visible = 0;
+
+            /**
+             * Received, but not yet deleted messages
+             */
+            long inFlight = 0;
+
+            /**
+             * Delayed messages
+             */
+            long delayed = 0;
+
+            /**
+             * Average wait time in milliseconds
+             */
+            double averageWaitTime = 0;
+
+            /**
+             * 99th percentile of the wait time in milliseconds, upper bound of the histogram bucket
+             */
+            double p99WaitTime = 0;
+        };
+
+        /**
+         * @brief Singleton instance
+         */
+        static SQSStatistics &instance() {
+            static SQSStatistics sqsStatistics;
+            return sqsStatistics;
+        }
+
+        /**
+         * @brief Counts sent messages
+         *
+         * @param queueUrl queue URL
+         * @param name queue name
+         * @param count number of messages
+         * @param delayed messages are delayed
+         */
+        void MessagesSent(const std::string &queueUrl, const std::string &name, long count, bool delayed);
+
+        /**
+         * @brief Counts received messages and records the wait time of the messages, which are received the first time
+         *
+         * @param queueUrl queue URL
+         * @param messages received messages
+         */
+        void MessagesReceived(const std::string &queueUrl, const Database::Entity::SQS::MessageList &messages);
+
+        /**
+         * @brief Counts deleted messages
+         *
+         * @param queueUrl queue URL
+         * @param count number of messages
+         */
+        void MessagesDeleted(const std::string &queueUrl, long count);
+
+        /**
+         * @brief Sets the counters of a queue to the values of the database
+         *
+         * @param queueUrl queue URL
+         * @param name queue name
+         * @param visible visible messages
+         * @param inFlight in-flight messages
+         * @param delayed delayed messages
+         */
+        void Reconcile(const std::string &queueUrl, const std::string &name, long visible, long inFlight, long delayed);
+
+        /**
+         * @brief Removes the statistics of a deleted queue
+         *
+         * @param queueUrl queue URL
+         */
+        void RemoveQueue(const std::string &queueUrl);
+
+        /**
+         * @brief Returns the statistics of a queue
+         *
+         * @param queueUrl queue URL
+         * @return queue statistics, all zero for an unknown queue
+         */
+        QueueStatistics GetQueueStatistics(const std::string &queueUrl);
+
+        /**
+         * @brief Returns the statistics of all queues
+         *
+         * @return list of queue statistics
+         */
+        std::vector<QueueStatistics> ListQueueStatistics();
+
+      private:
+
+        /**
+         * Atomic counters of a queue
+         */
+        struct QueueCounters {
+
+            /**
+             * Queue name
+             */
+            std::string name;
+
+            /**
+             * Visible messages
+             */
+            std::atomic<long> visible = 0;
+
+            /**
+             * In-flight messages
+             */
+            std::atomic<long> inFlight = 0;
+
+            /**
+             * Delayed messages
+             */
+            std::atomic<long> delayed = 0;
+
+            /**
+             * Number of wait time samples
+             */
+            std::atomic<long> waitTimeCount = 0;
+
+            /**
+             * Sum of the wait times in milliseconds
+             */
+            std::atomic<long> waitTimeSum = 0;
+
+            /**
+             * Wait time histogram, logarithmic buckets
+             */
+            std::array<std::atomic<long>, SQS_WAIT_TIME_BUCKETS> waitTimeBuckets{};
+        };
+
+        /**
+         * @brief Returns the counters of a queue, they are created on first use
+         *
+         * @param queueUrl queue URL
+         * @param name queue name, taken from the URL, if empty
+         * @return queue counters
+         */
+        std::shared_ptr<QueueCounters> GetCounters(const std::string &queueUrl, const std::string &name = {});
+
+        /**
+         * @brief Decrements a counter, it never falls below zero
+         *
+         * @param counter atomic counter
+         * @param count decrement
+         */
+        static void Decrement(std::atomic<long> &counter, long count);
+
+        /**
+         * @brief Converts the counters to a statistics snapshot
+         *
+         * @param queueUrl queue URL
+         * @param counters queue counters
+         * @return queue statistics
+         */
+        static QueueStatistics ToStatistics(const std::string &queueUrl, const QueueCounters &counters);
+
+        /**
+         * Counters by queue URL
+         */
+        std::map<std::string, std::shared_ptr<QueueCounters>> _queues;
+
+        /**
+         * Queue map mutex, the counters itself are atomic
+         */
+        boost::mutex _mutex;
+    };
+
+}// namespace AwsMock::Service
+
+#endif// AWSMOCK_SERVICE_SQS_STATISTICS_H
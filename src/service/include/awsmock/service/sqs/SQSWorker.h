@@ -5,9 +5,18 @@
 #ifndef AWSMOCK_SERVICE_SQS_WORKER_H
 #define AWSMOCK_SERVICE_SQS_WORKER_H
 
+// C++ includes
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
 // AwsMock includes
 #include <awsmock/core/Timer.h>
 #include <awsmock/repository/SQSDatabase.h>
+#include <awsmock/service/sqs/SQSService.h>
+
+#define SQS_DEFAULT_WORKER_SWEEP_PERIOD 300
 
 namespace AwsMock::Service {
 
@@ -16,6 +25,11 @@ namespace AwsMock::Service {
      *
      * Used as background thread to do maintenance work, like resetting resources, deleted old message etc.
      *
+     * @par
+     * The worker does not scan all queues on every run. The SQS service schedules a queue, when its messages change, and the worker schedules
+     * it again for the next visibility timeout, delay or retention deadline. A run maintains only the due queues. All queues are swept once
+     * at startup and then every sweep period.
+     *
      * @author jens.vogt\@opitz-consulting.com
      */
     class SQSWorker : public Core::Timer {
@@ -24,8 +38,11 @@ namespace AwsMock::Service {
 
         /**
          * @brief Constructor
+         *
+         * @param timeout worker period in seconds
+         * @param sweepPeriod period of the sweep over all queues in seconds
          */
-        explicit SQSWorker(int timeout) : Core::Timer("sqs-worker", timeout) {}
+        explicit SQSWorker(int timeout, int sweepPeriod = SQS_DEFAULT_WORKER_SWEEP_PERIOD) : Core::Timer("sqs-worker", timeout), _sweepPeriod(sweepPeriod) {}
 
         /**
          * @brief Initialization
@@ -48,17 +65,37 @@ namespace AwsMock::Service {
          * @brief Reset resources
          *
          * @par
-         * Loops over all SQS queues and sets the state to INITIAL in case the visibilityTimeout timeout has been reached. Also the retry count in increased by one.
+         * Maintains the SQS queues, which are due.
+         */
+        [[maybe_unused]] void ResetMessages();
+
+        /**
+         * @brief Maintains a single queue
          *
          * @par
-         * Checks also the expiration date and removed the resources, which are older than the max retention period.
+         * Sets the state to INITIAL in case the visibilityTimeout timeout has been reached, removes the messages, which are older than the max
+         * retention period, and moves messages, which have been received too often, to the dead letter queue. Finally, updates the counters
+         * of the queue and schedules the next maintenance.
+         *
+         * @param region AWS region
+         * @param queueUrl queue URL
          */
-        [[maybe_unused]] void ResetMessages();
+        void MaintainQueue(const std::string &region, const std::string &queueUrl);
 
         /**
          * Database connection
          */
         Database::SQSDatabase &_sqsDatabase = Database::SQSDatabase::instance();
+
+        /**
+         * Sweep period in seconds
+         */
+        int _sweepPeriod;
+
+        /**
+         * Time of the next sweep over all queues
+         */
+        system_clock::time_point _nextSweep = system_clock::time_point::min();
     };
 
 }// namespace AwsMock::Service
@@ -8,6 +8,10 @@ namespace AwsMock::Service {
         return {};
     }
 
+    http::message_generator AbstractHandler::HandleGetMessage(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) {
+        return HandleGetRequest(request, region, user);
+    }
+
     http::response<http::dynamic_body> AbstractHandler::HandlePutRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) {
         log_error << "Real method not implemented";
         return {};
@@ -18,6 +22,10 @@ namespace AwsMock::Service {
         return {};
     }
 
+    bool AbstractHandler::HandleAsyncPostRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user, const ResponseCallback &callback) {
+        return false;
+    }
+
     http::response<http::dynamic_body> AbstractHandler::HandleDeleteRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) {
         log_error << "Real method not implemented";
         return {};
@@ -28,6 +36,19 @@ namespace AwsMock::Service {
         return {};
     }
 
+    bool AbstractHandler::IsStreamingRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user, std::vector<std::string> &hashAlgorithms) {
+        return false;
+    }
+
+    std::shared_ptr<void> AbstractHandler::AcquireStreamPermit(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) {
+        return {};
+    }
+
+    http::response<http::dynamic_body> AbstractHandler::HandlePutStreamRequest(const http::request<http::dynamic_body> &request, const std::string &bodyFile, Core::HashSink &hashSink, const std::string &region, const std::string &user) {
+        log_error << "Real method not implemented";
+        return {};
+    }
+
     http::response<http::dynamic_body> AbstractHandler::SendOkResponse(const http::request<http::dynamic_body> &request, const std::string &body, const std::map<std::string, std::string> &headers) {
 
         // Prepare the response message
@@ -128,32 +149,84 @@ namespace AwsMock::Service {
         return response;
     }
 
+    http::response<http::dynamic_body> AbstractHandler::SendNotFoundError(const http::request<http::dynamic_body> &request, const std::string &body, const std::map<std::string, std::string> &headers) {
+
+        // Prepare the response message
+        http::response<http::dynamic_body> response;
+        response.version(request.version());
+        response.result(http::status::not_found);
+        response.set(http::field::server, "awsmock");
+        response.set(http::field::content_type, "application/json");
+
+        // Body
+        boost::beast::ostream(response.body()) << body;
+        response.prepare_payload();
+
+        // Copy headers
+        if (!headers.empty()) {
+            for (const auto &header: headers) {
+                response.set(header.first, header.second);
+            }
+        }
+
+        // Send the response to the client
+        return response;
+    }
+
+    http::response<http::file_body> AbstractHandler::SendFileResponse(const http::request<http::dynamic_body> &request, const std::string &fileName, const std::map<std::string, std::string> &headers) {
+        log_trace << "Sending file response, state: 200, filename: " << fileName;
+
+        // Open the file, content is read while writing the response
+        boost::beast::error_code ec;
+        http::file_body::value_type body;
+        body.open(fileName.c_str(), boost::beast::file_mode::scan, ec);
+        if (ec) {
+            log_error << "Could not open file, filename: " << fileName << " error: " << ec.message();
+            throw Core::ServiceException("Could not open file, filename: " + fileName);
+        }
+
+        // Prepare the response message
+        http::response<http::file_body> response{std::piecewise_construct, std::make_tuple(std::move(body)), std::make_tuple(http::status::ok, request.version())};
+        response.set(http::field::server, "awsmock");
+        response.set(http::field::content_type, "application/octet-stream");
+
+        // Copy headers
+        if (!headers.empty()) {
+            for (const auto &header: headers) {
+                response.set(header.first, header.second);
+            }
+        }
+
+        // Content length from the file size
+        response.prepare_payload();
+
+        // Send the response to the client
+        return response;
+    }
+
     http::response<http::dynamic_body> AbstractHandler::SendRangeResponse(const http::request<http::dynamic_body> &request, const std::string &fileName, long min, long max, long size, long totalSize, const std::map<std::string, std::string> &headers) {
         log_trace << "Sending OK response, state: 200, filename: " << fileName << " min: " << min << " max: " << max << " size: " << size;
 
-        if (!Core::MemoryMappedFile::instance().IsMapped()) {
-            if (!Core::MemoryMappedFile::instance().OpenFile(fileName)) {
-                log_error << "Could not open memory mapped file, filename: " << fileName;
-                throw Core::ServiceException("Could not open memory mapped file, filename: " + fileName);
-            }
+        // Shared, read-only mapping, reads do not need a lock
+        std::shared_ptr<const Core::MemoryMappedFile> mappedFile = Core::MemoryMappedFileCache::instance().GetFile(fileName);
+        if (!mappedFile) {
+            log_error << "Could not open memory mapped file, filename: " << fileName;
+            throw Core::ServiceException("Could not open memory mapped file, filename: " + fileName);
         }
 
         try {
 
             // Prepare the response message
             http::response<http::dynamic_body> response;
-            response.content_length(size);
             response.version(request.version());
             response.result(http::status::partial_content);
             response.set(http::field::server, "awsmock");
             response.set(http::field::content_type, "application/octet-stream");
 
-            // Body
-            char *buffer = new char[size];
-            Core::MemoryMappedFile::instance().ReadChunk(min, size, (char *) buffer);
-            boost::beast::ostream(response.body()) << buffer;
+            // Body, copied directly from the mapping
+            long length = std::max(0L, std::min(size, mappedFile->GetSize() - min));
+            response.body().commit(boost::asio::buffer_copy(response.body().prepare(length), boost::asio::buffer(mappedFile->GetData() + min, length)));
             response.prepare_payload();
-            delete[] buffer;
 
             // Copy headers
             if (!headers.empty()) {
@@ -162,12 +235,6 @@ namespace AwsMock::Service {
                 }
             }
 
-            // Close file
-            if (max == totalSize - 1) {
-                Core::MemoryMappedFile::instance().CloseFile();
-                log_debug << "Memory mapped file closed, filename: " << fileName;
-            }
-
             // Send the response to the client
             return response;
 
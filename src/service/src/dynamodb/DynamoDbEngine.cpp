@@ -0,0 +1,872 @@
+//
+// Created by vogje01 on 6/8/24.
+//
+
+#include <awsmock/service/dynamodb/DynamoDbEngine.h>
+
+namespace AwsMock::Service {
+
+    namespace {
+
+        const std::string DYNAMODB_ERROR_PREFIX = "com.amazonaws.dynamodb.v20120810#";
+        const std::string VALIDATION_EXCEPTION = "com.amazon.coral.validate#ValidationException";
+
+        /**
+         * DynamoDB error, converted to an error response at the API boundary
+         */
+        struct DynamoDbError : std::runtime_error {
+            DynamoDbError(std::string type, const std::string &message) : std::runtime_error(message), type(std::move(type)) {}
+            std::string type;
+        };
+
+        DynamoDbError ValidationError(const std::string &message) {
+            return {VALIDATION_EXCEPTION, message};
+        }
+
+        Dto::DynamoDb::DynamoDbResponse CreateResponse(const Poco::JSON::Object &body) {
+            return {.body = Core::JsonUtils::ToJsonString(body), .headers = {{"Content-Type", "application/x-amz-json-1.0"}}, .status = boost::beast::http::status::ok};
+        }
+
+        Dto::DynamoDb::DynamoDbResponse CreateErrorResponse(const std::string &type, const std::string &message) {
+            Poco::JSON::Object body;
+            body.set("__type", type);
+            body.set("message", message);
+            log_debug << "DynamoDB request failed, type: " << type << " message: " << message;
+            return {.body = Core::JsonUtils::ToJsonString(body), .headers = {{"Content-Type", "application/x-amz-json-1.0"}}, .status = boost::beast::http::status::bad_request};
+        }
+
+        template<typename Function>
+        Dto::DynamoDb::DynamoDbResponse Execute(Function &&function) {
+            try {
+                return CreateResponse(function());
+            } catch (DynamoDbError &exc) {
+                return CreateErrorResponse(exc.type, exc.what());
+            } catch (Poco::Exception &exc) {
+                return CreateErrorResponse(VALIDATION_EXCEPTION, exc.message());
+            } catch (std::exception &exc) {
+                return CreateErrorResponse(VALIDATION_EXCEPTION, exc.what());
+            }
+        }
+
+        Poco::JSON::Object::Ptr ParseRequest(const std::string &body) {
+            Poco::JSON::Parser parser;
+            Poco::JSON::Object::Ptr request = parser.parse(body.empty() ? "{}" : body).extract<Poco::JSON::Object::Ptr>();
+            return request;
+        }
+
+        std::string GetString(const Poco::JSON::Object::Ptr &object, const std::string &name, const std::string &defaultValue = {}) {
+            return object->has(name) && !object->get(name).isEmpty() ? object->getValue<std::string>(name) : defaultValue;
+        }
+
+        Poco::JSON::Object::Ptr GetObject(const Poco::JSON::Object::Ptr &object, const std::string &name) {
+            return object->isObject(name) ? object->getObject(name) : Poco::JSON::Object::Ptr();
+        }
+
+        void GetKeySchema(const Poco::JSON::Array::Ptr &keySchema, std::string &hashKey, std::string &rangeKey) {
+            if (keySchema.isNull()) {
+                throw ValidationError("No KeySchema specified");
+            }
+            for (unsigned int i = 0; i < keySchema->size(); i++) {
+                Poco::JSON::Object::Ptr element = keySchema->getObject(i);
+                if (GetString(element, "KeyType") == "HASH") {
+                    hashKey = GetString(element, "AttributeName");
+                } else if (GetString(element, "KeyType") == "RANGE") {
+                    rangeKey = GetString(element, "AttributeName");
+                }
+            }
+            if (hashKey.empty()) {
+                throw ValidationError("No Hash Key specified in schema. All Dynamo DB tables must have exactly one hash key");
+            }
+        }
+
+        /**
+         * Smallest string greater than all strings with the given prefix, empty if there is none
+         */
+        std::string GetPrefixSuccessor(std::string prefix) {
+            while (!prefix.empty()) {
+                if (static_cast<unsigned char>(prefix.back()) != 0xff) {
+                    prefix.back() = static_cast<char>(static_cast<unsigned char>(prefix.back()) + 1);
+                    return prefix;
+                }
+                prefix.pop_back();
+            }
+            return prefix;
+        }
+
+    }// namespace
+
+    int DynamoDbEngine::CompareKeyValues(const KeyValue &left, const KeyValue &right) {
+        if (left.type != right.type) {
+            return left.type < right.type ? -1 : 1;
+        }
+        if (left.type == "N") {
+            return DynamoDbExpression::CompareNumbers(left.value, right.value);
+        }
+        int result = left.value.compare(right.value);
+        return result < 0 ? -1 : (result > 0 ? 1 : 0);
+    }
+
+    bool DynamoDbEngine::PartitionKeyLess::operator()(const PartitionKey &left, const PartitionKey &right) const {
+        int result = CompareKeyValues(left.first, right.first);
+        return result < 0 || (result == 0 && left.second < right.second);
+    }
+
+    bool DynamoDbEngine::PartitionKeyLess::operator()(const KeyValue &left, const PartitionKey &right) const {
+        return CompareKeyValues(left, right.first) < 0;
+    }
+
+    bool DynamoDbEngine::PartitionKeyLess::operator()(const PartitionKey &left, const KeyValue &right) const {
+        return CompareKeyValues(left.first, right) < 0;
+    }
+
+    bool DynamoDbEngine::IsActive() {
+        return Core::Configuration::instance().getString("awsmock.dynamodb.engine", DYNAMODB_ENGINE_DOCKER) == DYNAMODB_ENGINE_NATIVE;
+    }
+
+    Dto::DynamoDb::DynamoDbResponse DynamoDbEngine::CreateTable(const std::string &region, const std::string &body) {
+
+        return Execute([&]() {
+            Poco::JSON::Object::Ptr request = ParseRequest(body);
+
+            auto table = std::make_shared<Table>();
+            table->name = GetString(request, "TableName");
+            table->region = region;
+            table->definition = request;
+            if (table->name.empty()) {
+                throw ValidationError("TableName must be specified");
+            }
+            std::string accountId = Core::Configuration::instance().getString("awsmock.account.userPoolId", "000000000000");
+            table->arn = Core::CreateArn("dynamodb", region, accountId, "table/" + table->name);
+
+            // Attribute types
+            Poco::JSON::Array::Ptr attributeDefinitions = request->getArray("AttributeDefinitions");
+            if (!attributeDefinitions.isNull()) {
+                for (unsigned int i = 0; i < attributeDefinitions->size(); i++) {
+                    Poco::JSON::Object::Ptr attribute = attributeDefinitions->getObject(i);
+                    table->attributeTypes[GetString(attribute, "AttributeName")] = GetString(attribute, "AttributeType");
+                }
+            }
+
+            // Primary key
+            GetKeySchema(request->getArray("KeySchema"), table->primary.hashKey, table->primary.rangeKey);
+
+            // Secondary indexes
+            for (const std::string indexType: {"LocalSecondaryIndexes", "GlobalSecondaryIndexes"}) {
+                Poco::JSON::Array::Ptr indexes = request->getArray(indexType);
+                for (unsigned int i = 0; !indexes.isNull() && i < indexes->size(); i++) {
+                    Poco::JSON::Object::Ptr definition = indexes->getObject(i);
+                    Index index{.name = GetString(definition, "IndexName"), .local = indexType == "LocalSecondaryIndexes", .definition = definition};
+                    GetKeySchema(definition->getArray("KeySchema"), index.hashKey, index.rangeKey);
+                    if (index.local && (index.hashKey != table->primary.hashKey || index.rangeKey.empty())) {
+                        throw ValidationError("Local secondary index " + index.name + " must have the same hash key as the table and a range key");
+                    }
+                    Poco::JSON::Object::Ptr projection = GetObject(definition, "Projection");
+                    if (!projection.isNull()) {
+                        index.projectionType = GetString(projection, "ProjectionType", "ALL");
+                        Poco::JSON::Array::Ptr nonKeyAttributes = projection->getArray("NonKeyAttributes");
+                        for (unsigned int j = 0; !nonKeyAttributes.isNull() && j < nonKeyAttributes->size(); j++) {
+                            index.nonKeyAttributes.emplace_back(nonKeyAttributes->get(j).convert<std::string>());
+                        }
+                    }
+                    table->indexes.emplace_back(std::move(index));
+                }
+            }
+
+            // Key attributes must be defined
+            std::vector<const Index *> indexes = {&table->primary};
+            for (const auto &index: table->indexes) {
+                indexes.emplace_back(&index);
+            }
+            for (const Index *index: indexes) {
+                for (const std::string &key: {index->hashKey, index->rangeKey}) {
+                    if (!key.empty() && !table->attributeTypes.contains(key)) {
+                        throw ValidationError("One or more parameter values were invalid: Some index key attributes are not defined in AttributeDefinitions, key: " + key);
+                    }
+                }
+            }
+
+            boost::mutex::scoped_lock lock(_mutex);
+            if (_tables.contains(region + ":" + table->name)) {
+                throw DynamoDbError(DYNAMODB_ERROR_PREFIX + "ResourceInUseException", "Table already exists: " + table->name);
+            }
+            _tables[region + ":" + table->name] = table;
+            log_debug << "DynamoDB table created, region: " << region << " name: " << table->name;
+
+            Poco::JSON::Object response;
+            response.set("TableDescription", GetTableDescription(*table, "ACTIVE"));
+            return response;
+        });
+    }
+
+    Dto::DynamoDb::DynamoDbResponse DynamoDbEngine::DescribeTable(const std::string &region, const std::string &body) {
+
+        return Execute([&]() {
+            std::shared_ptr<Table> table = GetTable(region, ParseRequest(body));
+
+            boost::mutex::scoped_lock lock(table->mutex);
+            Poco::JSON::Object response;
+            response.set("Table", GetTableDescription(*table, "ACTIVE"));
+            return response;
+        });
+    }
+
+    Dto::DynamoDb::DynamoDbResponse DynamoDbEngine::ListTables(const std::string &region, const std::string &body) {
+
+        return Execute([&]() {
+            Poco::JSON::Object::Ptr request = ParseRequest(body);
+            std::string exclusiveStartTableName = GetString(request, "ExclusiveStartTableName");
+            long limit = request->has("Limit") ? request->getValue<long>("Limit") : 100;
+
+            boost::mutex::scoped_lock lock(_mutex);
+
+            Poco::JSON::Array tableNames;
+            std::string prefix = region + ":";
+            auto it = exclusiveStartTableName.empty() ? _tables.lower_bound(prefix) : _tables.upper_bound(prefix + exclusiveStartTableName);
+            for (; it != _tables.end() && it->first.starts_with(prefix); ++it) {
+                if (static_cast<long>(tableNames.size()) == limit) {
+                    break;
+                }
+                tableNames.add(it->second->name);
+            }
+
+            Poco::JSON::Object response;
+            response.set("TableNames", tableNames);
+            if (it != _tables.end() && it->first.starts_with(prefix) && tableNames.size() > 0) {
+                response.set("LastEvaluatedTableName", tableNames.get(static_cast<unsigned int>(tableNames.size() - 1)));
+            }
+            return response;
+        });
+    }
+
+    Dto::DynamoDb::DynamoDbResponse DynamoDbEngine::DeleteTable(const std::string &region, const std::string &body) {
+
+        return Execute([&]() {
+            std::shared_ptr<Table> table = GetTable(region, ParseRequest(body));
+            {
+                boost::mutex::scoped_lock lock(_mutex);
+                _tables.erase(region + ":" + table->name);
+            }
+            log_debug << "DynamoDB table deleted, region: " << region << " name: " << table->name;
+
+            boost::mutex::scoped_lock lock(table->mutex);
+            Poco::JSON::Object response;
+            response.set("TableDescription", GetTableDescription(*table, "DELETING"));
+            return response;
+        });
+    }
+
+    Dto::DynamoDb::DynamoDbResponse DynamoDbEngine::PutItem(const std::string &region, const std::string &body) {
+
+        return Execute([&]() {
+            Poco::JSON::Object::Ptr request = ParseRequest(body);
+            std::shared_ptr<Table> table = GetTable(region, request);
+
+            Poco::JSON::Object::Ptr item = GetObject(request, "Item");
+            if (item.isNull()) {
+                throw ValidationError("Item must be specified");
+            }
+
+            KeyValue hashValue, rangeValue;
+            std::string primaryKey = GetPrimaryKey(*table, item, hashValue, rangeValue);
+
+            std::optional<DynamoDbExpression> condition;
+            if (request->has("ConditionExpression")) {
+                condition.emplace(GetString(request, "ConditionExpression"), GetObject(request, "ExpressionAttributeNames"), GetObject(request, "ExpressionAttributeValues"));
+            }
+
+            boost::mutex::scoped_lock lock(table->mutex);
+
+            Poco::JSON::Object::Ptr oldItem = FindItem(*table, hashValue, rangeValue);
+            if (condition && !condition->Evaluate(oldItem)) {
+                throw DynamoDbError(DYNAMODB_ERROR_PREFIX + "ConditionalCheckFailedException", "The conditional request failed");
+            }
+
+            // Replace the item in the table and in all indexes
+            if (!oldItem.isNull()) {
+                UnindexItem(table->primary, primaryKey, oldItem);
+                for (auto &index: table->indexes) {
+                    UnindexItem(index, primaryKey, oldItem);
+                }
+            }
+            IndexItem(table->primary, primaryKey, item);
+            for (auto &index: table->indexes) {
+                IndexItem(index, primaryKey, item);
+            }
+            log_trace << "DynamoDB item stored, table: " << table->name << " key: " << primaryKey;
+
+            Poco::JSON::Object response;
+            if (GetString(request, "ReturnValues") == "ALL_OLD" && !oldItem.isNull()) {
+                response.set("Attributes", oldItem);
+            }
+            return response;
+        });
+    }
+
+    Dto::DynamoDb::DynamoDbResponse DynamoDbEngine::GetItem(const std::string &region, const std::string &body) {
+
+        return Execute([&]() {
+            Poco::JSON::Object::Ptr request = ParseRequest(body);
+            std::shared_ptr<Table> table = GetTable(region, request);
+
+            Poco::JSON::Object::Ptr key = GetObject(request, "Key");
+            KeyValue hashValue, rangeValue;
+            if (key.isNull() || key->size() != (table->primary.rangeKey.empty() ? 1 : 2)) {
+                throw ValidationError("The provided key element does not match the schema");
+            }
+            GetPrimaryKey(*table, key, hashValue, rangeValue);
+
+            std::vector<std::string> attributes;
+            if (request->has("ProjectionExpression")) {
+                attributes = DynamoDbExpression::GetProjectionAttributes(GetString(request, "ProjectionExpression"), GetObject(request, "ExpressionAttributeNames"));
+            }
+
+            boost::mutex::scoped_lock lock(table->mutex);
+
+            Poco::JSON::Object response;
+            Poco::JSON::Object::Ptr item = FindItem(*table, hashValue, rangeValue);
+            if (!item.isNull()) {
+                response.set("Item", Project(*table, table->primary, item, attributes));
+            }
+            return response;
+        });
+    }
+
+    Dto::DynamoDb::DynamoDbResponse DynamoDbEngine::DeleteItem(const std::string &region, const std::string &body) {
+
+        return Execute([&]() {
+            Poco::JSON::Object::Ptr request = ParseRequest(body);
+            std::shared_ptr<Table> table = GetTable(region, request);
+
+            Poco::JSON::Object::Ptr key = GetObject(request, "Key");
+            KeyValue hashValue, rangeValue;
+            if (key.isNull() || key->size() != (table->primary.rangeKey.empty() ? 1 : 2)) {
+                throw ValidationError("The provided key element does not match the schema");
+            }
+            std::string primaryKey = GetPrimaryKey(*table, key, hashValue, rangeValue);
+
+            std::optional<DynamoDbExpression> condition;
+            if (request->has("ConditionExpression")) {
+                condition.emplace(GetString(request, "ConditionExpression"), GetObject(request, "ExpressionAttributeNames"), GetObject(request, "ExpressionAttributeValues"));
+            }
+
+            boost::mutex::scoped_lock lock(table->mutex);
+
+            Poco::JSON::Object::Ptr oldItem = FindItem(*table, hashValue, rangeValue);
+            if (condition && !condition->Evaluate(oldItem)) {
+                throw DynamoDbError(DYNAMODB_ERROR_PREFIX + "ConditionalCheckFailedException", "The conditional request failed");
+            }
+
+            Poco::JSON::Object response;
+            if (!oldItem.isNull()) {
+                UnindexItem(table->primary, primaryKey, oldItem);
+                for (auto &index: table->indexes) {
+                    UnindexItem(index, primaryKey, oldItem);
+                }
+                if (GetString(request, "ReturnValues") == "ALL_OLD") {
+                    response.set("Attributes", oldItem);
+                }
+            }
+            return response;
+        });
+    }
+
+    Dto::DynamoDb::DynamoDbResponse DynamoDbEngine::Query(const std::string &region, const std::string &body) {
+
+        return Execute([&]() {
+            Poco::JSON::Object::Ptr request = ParseRequest(body);
+            std::shared_ptr<Table> table = GetTable(region, request);
+
+            Poco::JSON::Object::Ptr names = GetObject(request, "ExpressionAttributeNames");
+            Poco::JSON::Object::Ptr values = GetObject(request, "ExpressionAttributeValues");
+            if (!request->has("KeyConditionExpression")) {
+                throw ValidationError("Either the KeyConditions or KeyConditionExpression parameter must be specified in the request");
+            }
+            DynamoDbExpression keyExpression(GetString(request, "KeyConditionExpression"), names, values);
+            std::optional<DynamoDbExpression> filter;
+            if (request->has("FilterExpression")) {
+                filter.emplace(GetString(request, "FilterExpression"), names, values);
+            }
+            std::vector<std::string> attributes;
+            if (request->has("ProjectionExpression")) {
+                attributes = DynamoDbExpression::GetProjectionAttributes(GetString(request, "ProjectionExpression"), names);
+            }
+            std::string indexName = GetString(request, "IndexName");
+            bool forward = !request->has("ScanIndexForward") || request->get("ScanIndexForward").convert<bool>();
+            long limit = request->has("Limit") ? request->getValue<long>("Limit") : 0;
+            bool countOnly = GetString(request, "Select") == "COUNT";
+            Poco::JSON::Object::Ptr exclusiveStartKey = GetObject(request, "ExclusiveStartKey");
+
+            boost::mutex::scoped_lock lock(table->mutex);
+
+            const Index *index = &table->primary;
+            if (!indexName.empty()) {
+                auto it = std::find_if(table->indexes.begin(), table->indexes.end(), [&indexName](const Index &i) { return i.name == indexName; });
+                if (it == table->indexes.end()) {
+                    throw ValidationError("The table does not have the specified index: " + indexName);
+                }
+                index = &*it;
+            }
+
+            DynamoDbKeyCondition keyCondition;
+            if (!keyExpression.GetKeyCondition(index->hashKey, index->rangeKey, keyCondition)) {
+                throw ValidationError("Query condition missed key schema element");
+            }
+            std::optional<KeyValue> hashValue = GetKeyValue(keyCondition.hashValue);
+            if (!hashValue) {
+                throw ValidationError("One or more parameter values were invalid: Condition parameter type does not match schema type");
+            }
+
+            Poco::JSON::Array items;
+            long count = 0, scannedCount = 0;
+            Poco::JSON::Object::Ptr lastEvaluatedKey;
+
+            auto partitionIt = index->partitions.find(EncodeKeyValue(*hashValue));
+            if (partitionIt != index->partitions.end()) {
+                const Partition &partition = partitionIt->second;
+                PartitionKeyLess less;
+
+                // Range of the range key condition
+                auto first = partition.begin(), last = partition.end();
+                if (!keyCondition.rangeOperator.empty()) {
+                    std::optional<KeyValue> rangeValue = GetKeyValue(keyCondition.rangeValue);
+                    if (!rangeValue) {
+                        throw ValidationError("One or more parameter values were invalid: Condition parameter type does not match schema type");
+                    }
+                    const std::string &op = keyCondition.rangeOperator;
+                    if (op == "=") {
+                        first = partition.lower_bound(*rangeValue);
+                        last = partition.upper_bound(*rangeValue);
+                    } else if (op == "<") {
+                        last = partition.lower_bound(*rangeValue);
+                    } else if (op == "<=") {
+                        last = partition.upper_bound(*rangeValue);
+                    } else if (op == ">") {
+                        first = partition.upper_bound(*rangeValue);
+                    } else if (op == ">=") {
+                        first = partition.lower_bound(*rangeValue);
+                    } else if (op == "BETWEEN") {
+                        std::optional<KeyValue> upperValue = GetKeyValue(keyCondition.rangeValueUpper);
+                        if (!upperValue || CompareKeyValues(*rangeValue, *upperValue) > 0) {
+                            throw ValidationError("Invalid KeyConditionExpression: The BETWEEN operator requires upper bound to be greater than or equal to lower bound");
+                        }
+                        first = partition.lower_bound(*rangeValue);
+                        last = partition.upper_bound(*upperValue);
+                    } else if (op == "begins_with") {
+                        if (rangeValue->type == "N") {
+                            throw ValidationError("Invalid KeyConditionExpression: Incorrect operand type for operator or function; operator or function: begins_with, operand type: N");
+                        }
+                        first = partition.lower_bound(*rangeValue);
+                        std::string successor = GetPrefixSuccessor(rangeValue->value);
+                        last = successor.empty() ? partition.end() : partition.lower_bound(KeyValue{.type = rangeValue->type, .value = successor});
+                    }
+                }
+
+                // Continue after the exclusive start key
+                if (!exclusiveStartKey.isNull() && first != last) {
+                    KeyValue startHash, startRange, tableHash, tableRange;
+                    if (!GetIndexKey(*index, exclusiveStartKey, startHash, startRange)) {
+                        throw ValidationError("The provided starting key is invalid");
+                    }
+                    PartitionKey startKey = {startRange, index == &table->primary ? std::string() : GetPrimaryKey(*table, exclusiveStartKey, tableHash, tableRange)};
+                    if (forward) {
+                        auto start = partition.upper_bound(startKey);
+                        if (start == partition.end() || (last != partition.end() && !less(start->first, last->first))) {
+                            first = last;
+                        } else if (less(first->first, start->first)) {
+                            first = start;
+                        }
+                    } else {
+                        auto stop = partition.lower_bound(startKey);
+                        if (stop != partition.end() && !less(first->first, stop->first)) {
+                            last = first;
+                        } else if (stop != partition.end() && (last == partition.end() || less(stop->first, last->first))) {
+                            last = stop;
+                        }
+                    }
+                }
+
+                auto process = [&](const Poco::JSON::Object::Ptr &item) {
+                    scannedCount++;
+                    if (!filter || filter->Evaluate(item)) {
+                        count++;
+                        if (!countOnly) {
+                            items.add(Project(*table, *index, item, attributes));
+                        }
+                    }
+                };
+
+                if (forward) {
+                    for (auto it = first; it != last; ++it) {
+                        if (limit > 0 && scannedCount == limit) {
+                            lastEvaluatedKey = GetKeyAttributes(*table, *index, std::prev(it)->second);
+                            break;
+                        }
+                        process(it->second);
+                    }
+                } else {
+                    for (auto it = last; it != first;) {
+                        --it;
+                        if (limit > 0 && scannedCount == limit) {
+                            lastEvaluatedKey = GetKeyAttributes(*table, *index, std::next(it)->second);
+                            break;
+                        }
+                        process(it->second);
+                    }
+                }
+            }
+
+            Poco::JSON::Object response;
+            if (!countOnly) {
+                response.set("Items", items);
+            }
+            response.set("Count", count);
+            response.set("ScannedCount", scannedCount);
+            if (!lastEvaluatedKey.isNull()) {
+                response.set("LastEvaluatedKey", lastEvaluatedKey);
+            }
+            return response;
+        });
+    }
+
+    Dto::DynamoDb::DynamoDbResponse DynamoDbEngine::Scan(const std::string &region, const std::string &body) {
+
+        return Execute([&]() {
+            Poco::JSON::Object::Ptr request = ParseRequest(body);
+            std::shared_ptr<Table> table = GetTable(region, request);
+
+            Poco::JSON::Object::Ptr names = GetObject(request, "ExpressionAttributeNames");
+            std::optional<DynamoDbExpression> filter;
+            if (request->has("FilterExpression")) {
+                filter.emplace(GetString(request, "FilterExpression"), names, GetObject(request, "ExpressionAttributeValues"));
+            }
+            std::vector<std::string> attributes;
+            if (request->has("ProjectionExpression")) {
+                attributes = DynamoDbExpression::GetProjectionAttributes(GetString(request, "ProjectionExpression"), names);
+            }
+            std::string indexName = GetString(request, "IndexName");
+            long limit = request->has("Limit") ? request->getValue<long>("Limit") : 0;
+            bool countOnly = GetString(request, "Select") == "COUNT";
+            Poco::JSON::Object::Ptr exclusiveStartKey = GetObject(request, "ExclusiveStartKey");
+
+            boost::mutex::scoped_lock lock(table->mutex);
+
+            const Index *index = &table->primary;
+            if (!indexName.empty()) {
+                auto it = std::find_if(table->indexes.begin(), table->indexes.end(), [&indexName](const Index &i) { return i.name == indexName; });
+                if (it == table->indexes.end()) {
+                    throw ValidationError("The table does not have the specified index: " + indexName);
+                }
+                index = &*it;
+            }
+
+            // Start position
+            auto partitionIt = index->partitions.begin();
+            std::optional<PartitionKey> startKey;
+            if (!exclusiveStartKey.isNull()) {
+                KeyValue startHash, startRange, tableHash, tableRange;
+                if (!GetIndexKey(*index, exclusiveStartKey, startHash, startRange)) {
+                    throw ValidationError("The provided starting key is invalid");
+                }
+                partitionIt = index->partitions.lower_bound(EncodeKeyValue(startHash));
+                if (partitionIt != index->partitions.end() && partitionIt->first == EncodeKeyValue(startHash)) {
+                    startKey = {startRange, index == &table->primary ? std::string() : GetPrimaryKey(*table, exclusiveStartKey, tableHash, tableRange)};
+                }
+            }
+
+            Poco::JSON::Array items;
+            long count = 0, scannedCount = 0;
+            Poco::JSON::Object::Ptr lastEvaluatedKey, lastItem;
+            for (; partitionIt != index->partitions.end() && lastEvaluatedKey.isNull(); ++partitionIt) {
+                const Partition &partition = partitionIt->second;
+                auto it = startKey ? partition.upper_bound(*startKey) : partition.begin();
+                startKey.reset();
+                for (; it != partition.end(); ++it) {
+                    if (limit > 0 && scannedCount == limit) {
+                        lastEvaluatedKey = GetKeyAttributes(*table, *index, lastItem);
+                        break;
+                    }
+                    scannedCount++;
+                    lastItem = it->second;
+                    if (!filter || filter->Evaluate(it->second)) {
+                        count++;
+                        if (!countOnly) {
+                            items.add(Project(*table, *index, it->second, attributes));
+                        }
+                    }
+                }
+            }
+
+            Poco::JSON::Object response;
+            if (!countOnly) {
+                response.set("Items", items);
+            }
+            response.set("Count", count);
+            response.set("ScannedCount", scannedCount);
+            if (!lastEvaluatedKey.isNull()) {
+                response.set("LastEvaluatedKey", lastEvaluatedKey);
+            }
+            return response;
+        });
+    }
+
+    bool DynamoDbEngine::TableExists(const std::string &region, const std::string &tableName) {
+        boost::mutex::scoped_lock lock(_mutex);
+        return _tables.contains(region + ":" + tableName);
+    }
+
+    void DynamoDbEngine::DeleteAllTables() {
+        boost::mutex::scoped_lock lock(_mutex);
+        _tables.clear();
+        log_debug << "DynamoDB tables deleted";
+    }
+
+    long DynamoDbEngine::CountTables() {
+        boost::mutex::scoped_lock lock(_mutex);
+        return static_cast<long>(_tables.size());
+    }
+
+    long DynamoDbEngine::CountItems() {
+
+        std::vector<std::shared_ptr<Table>> tables;
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            for (const auto &[name, table]: _tables) {
+                tables.emplace_back(table);
+            }
+        }
+
+        long count = 0;
+        for (const auto &table: tables) {
+            boost::mutex::scoped_lock lock(table->mutex);
+            count += table->primary.itemCount;
+        }
+        return count;
+    }
+
+    Database::Entity::DynamoDb::ItemList DynamoDbEngine::ListItems() {
+
+        std::vector<std::shared_ptr<Table>> tables;
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            for (const auto &[name, table]: _tables) {
+                tables.emplace_back(table);
+            }
+        }
+
+        Database::Entity::DynamoDb::ItemList itemList;
+        for (const auto &table: tables) {
+            boost::mutex::scoped_lock lock(table->mutex);
+            for (const auto &[hashValue, partition]: table->primary.partitions) {
+                for (const auto &[partitionKey, item]: partition) {
+
+                    Database::Entity::DynamoDb::Item entity = {.region = table->region, .tableName = table->name};
+                    for (const auto &name: item->getNames()) {
+                        Database::Entity::DynamoDb::AttributeValue attributeValue;
+                        attributeValue.FromJsonObject(item->getObject(name));
+                        entity.attributes[name] = attributeValue;
+                        if (name == table->primary.hashKey || name == table->primary.rangeKey) {
+                            entity.keys[name] = attributeValue;
+                        }
+                    }
+                    itemList.emplace_back(entity);
+                }
+            }
+        }
+        log_trace << "DynamoDB items listed, count: " << itemList.size();
+        return itemList;
+    }
+
+    std::shared_ptr<DynamoDbEngine::Table> DynamoDbEngine::GetTable(const std::string &region, const Poco::JSON::Object::Ptr &request) {
+
+        std::string tableName = GetString(request, "TableName");
+        if (tableName.empty()) {
+            throw ValidationError("TableName must be specified");
+        }
+
+        boost::mutex::scoped_lock lock(_mutex);
+        auto it = _tables.find(region + ":" + tableName);
+        if (it == _tables.end()) {
+            throw DynamoDbError(DYNAMODB_ERROR_PREFIX + "ResourceNotFoundException", "Requested resource not found: Table: " + tableName + " not found");
+        }
+        return it->second;
+    }
+
+    std::optional<DynamoDbEngine::KeyValue> DynamoDbEngine::GetKeyValue(const Poco::JSON::Object::Ptr &attributeValue) {
+
+        std::string type = DynamoDbExpression::GetType(attributeValue);
+        if (type == "S") {
+            return KeyValue{.type = type, .value = attributeValue->getValue<std::string>(type)};
+        } else if (type == "N") {
+            return KeyValue{.type = type, .value = DynamoDbExpression::NormalizeNumber(attributeValue->getValue<std::string>(type))};
+        } else if (type == "B") {
+            return KeyValue{.type = type, .value = Core::Crypto::Base64Decode(attributeValue->getValue<std::string>(type))};
+        }
+        return std::nullopt;
+    }
+
+    bool DynamoDbEngine::GetIndexKey(const Index &index, const Poco::JSON::Object::Ptr &item, KeyValue &hashValue, KeyValue &rangeValue) {
+
+        std::optional<KeyValue> hash = GetKeyValue(GetObject(item, index.hashKey));
+        if (!hash) {
+            return false;
+        }
+        hashValue = *hash;
+
+        if (!index.rangeKey.empty()) {
+            std::optional<KeyValue> range = GetKeyValue(GetObject(item, index.rangeKey));
+            if (!range) {
+                return false;
+            }
+            rangeValue = *range;
+        }
+        return true;
+    }
+
+    std::string DynamoDbEngine::GetPrimaryKey(const Table &table, const Poco::JSON::Object::Ptr &item, KeyValue &hashValue, KeyValue &rangeValue) {
+
+        if (!GetIndexKey(table.primary, item, hashValue, rangeValue)) {
+            std::string missing = GetKeyValue(GetObject(item, table.primary.hashKey)) ? table.primary.rangeKey : table.primary.hashKey;
+            throw ValidationError("One or more parameter values were invalid: Missing the key " + missing + " in the item");
+        }
+        if (hashValue.type != table.attributeTypes.at(table.primary.hashKey)) {
+            throw ValidationError("One or more parameter values were invalid: Type mismatch for key " + table.primary.hashKey + " expected: " + table.attributeTypes.at(table.primary.hashKey) + " actual: " + hashValue.type);
+        }
+        if (!table.primary.rangeKey.empty() && rangeValue.type != table.attributeTypes.at(table.primary.rangeKey)) {
+            throw ValidationError("One or more parameter values were invalid: Type mismatch for key " + table.primary.rangeKey + " expected: " + table.attributeTypes.at(table.primary.rangeKey) + " actual: " + rangeValue.type);
+        }
+
+        std::string hash = EncodeKeyValue(hashValue);
+        return std::to_string(hash.size()) + ":" + hash + EncodeKeyValue(rangeValue);
+    }
+
+    std::string DynamoDbEngine::EncodeKeyValue(const KeyValue &keyValue) {
+        return keyValue.type + ":" + keyValue.value;
+    }
+
+    Poco::JSON::Object::Ptr DynamoDbEngine::FindItem(const Table &table, const KeyValue &hashValue, const KeyValue &rangeValue) {
+
+        auto partitionIt = table.primary.partitions.find(EncodeKeyValue(hashValue));
+        if (partitionIt == table.primary.partitions.end()) {
+            return {};
+        }
+        auto it = partitionIt->second.find(PartitionKey{rangeValue, {}});
+        return it == partitionIt->second.end() ? Poco::JSON::Object::Ptr() : it->second;
+    }
+
+    void DynamoDbEngine::IndexItem(Index &index, const std::string &primaryKey, const Poco::JSON::Object::Ptr &item) {
+
+        KeyValue hashValue, rangeValue;
+        if (!GetIndexKey(index, item, hashValue, rangeValue)) {
+            return;
+        }
+        Partition &partition = index.partitions[EncodeKeyValue(hashValue)];
+        if (partition.insert_or_assign(PartitionKey{rangeValue, index.name.empty() ? std::string() : primaryKey}, item).second) {
+            index.itemCount++;
+        }
+    }
+
+    void DynamoDbEngine::UnindexItem(Index &index, const std::string &primaryKey, const Poco::JSON::Object::Ptr &item) {
+
+        KeyValue hashValue, rangeValue;
+        if (!GetIndexKey(index, item, hashValue, rangeValue)) {
+            return;
+        }
+        auto partitionIt = index.partitions.find(EncodeKeyValue(hashValue));
+        if (partitionIt == index.partitions.end()) {
+            return;
+        }
+        if (partitionIt->second.erase(PartitionKey{rangeValue, index.name.empty() ? std::string() : primaryKey}) > 0) {
+            index.itemCount--;
+        }
+        if (partitionIt->second.empty()) {
+            index.partitions.erase(partitionIt);
+        }
+    }
+
+    Poco::JSON::Object::Ptr DynamoDbEngine::GetKeyAttributes(const Table &table, const Index &index, const Poco::JSON::Object::Ptr &item) {
+
+        Poco::JSON::Object::Ptr keys = new Poco::JSON::Object();
+        for (const std::string &key: {table.primary.hashKey, table.primary.rangeKey, index.hashKey, index.rangeKey}) {
+            if (!key.empty() && item->has(key)) {
+                keys->set(key, item->get(key));
+            }
+        }
+        return keys;
+    }
+
+    Poco::JSON::Object::Ptr DynamoDbEngine::Project(const Table &table, const Index &index, const Poco::JSON::Object::Ptr &item, const std::vector<std::string> &attributes) {
+
+        if (attributes.empty() && index.projectionType == "ALL") {
+            return item;
+        }
+
+        std::vector<std::string> projected = attributes;
+        if (projected.empty()) {
+            projected = {table.primary.hashKey, table.primary.rangeKey, index.hashKey, index.rangeKey};
+            if (index.projectionType == "INCLUDE") {
+                projected.insert(projected.end(), index.nonKeyAttributes.begin(), index.nonKeyAttributes.end());
+            }
+        }
+
+        Poco::JSON::Object::Ptr result = new Poco::JSON::Object();
+        for (const auto &attribute: projected) {
+            if (!attribute.empty() && item->has(attribute)) {
+                result->set(attribute, item->get(attribute));
+            }
+        }
+        return result;
+    }
+
+    Poco::JSON::Object::Ptr DynamoDbEngine::GetTableDescription(const Table &table, const std::string &status) {
+
+        Poco::JSON::Object::Ptr description = new Poco::JSON::Object();
+        description->set("TableName", table.name);
+        description->set("TableArn", table.arn);
+        description->set("TableStatus", status);
+        description->set("CreationDateTime", std::chrono::duration<double>(table.created.time_since_epoch()).count());
+        description->set("ItemCount", table.primary.itemCount);
+        description->set("TableSizeBytes", 0);
+        description->set("AttributeDefinitions", table.definition->getArray("AttributeDefinitions"));
+        description->set("KeySchema", table.definition->getArray("KeySchema"));
+
+        Poco::JSON::Object provisionedThroughput;
+        Poco::JSON::Object::Ptr definedThroughput = GetObject(table.definition, "ProvisionedThroughput");
+        provisionedThroughput.set("ReadCapacityUnits", definedThroughput.isNull() ? 0L : definedThroughput->getValue<long>("ReadCapacityUnits"));
+        provisionedThroughput.set("WriteCapacityUnits", definedThroughput.isNull() ? 0L : definedThroughput->getValue<long>("WriteCapacityUnits"));
+        provisionedThroughput.set("NumberOfDecreasesToday", 0);
+        description->set("ProvisionedThroughput", provisionedThroughput);
+        if (GetString(table.definition, "BillingMode") == "PAY_PER_REQUEST") {
+            Poco::JSON::Object billingModeSummary;
+            billingModeSummary.set("BillingMode", "PAY_PER_REQUEST");
+            description->set("BillingModeSummary", billingModeSummary);
+        }
+
+        Poco::JSON::Array localIndexes, globalIndexes;
+        for (const auto &index: table.indexes) {
+            Poco::JSON::Object indexDescription;
+            indexDescription.set("IndexName", index.name);
+            indexDescription.set("IndexArn", table.arn + "/index/" + index.name);
+            indexDescription.set("KeySchema", index.definition->getArray("KeySchema"));
+            indexDescription.set("Projection", index.definition->get("Projection"));
+            indexDescription.set("ItemCount", index.itemCount);
+            indexDescription.set("IndexSizeBytes", 0);
+            if (index.local) {
+                localIndexes.add(indexDescription);
+            } else {
+                indexDescription.set("IndexStatus", "ACTIVE");
+                if (index.definition->has("ProvisionedThroughput")) {
+                    indexDescription.set("ProvisionedThroughput", index.definition->get("ProvisionedThroughput"));
+                }
+                globalIndexes.add(indexDescription);
+            }
+        }
+        if (localIndexes.size() > 0) {
+            description->set("LocalSecondaryIndexes", localIndexes);
+        }
+        if (globalIndexes.size() > 0) {
+            description->set("GlobalSecondaryIndexes", globalIndexes);
+        }
+        return description;
+    }
+
+}// namespace AwsMock::Service
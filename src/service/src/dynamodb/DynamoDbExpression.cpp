@@ -0,0 +1,713 @@
+//
+// Created by vogje01 on 6/8/24.
+//
+
+#include <awsmock/service/dynamodb/DynamoDbExpression.h>
+
+namespace AwsMock::Service {
+
+    struct DynamoDbExpression::Node {
+
+        enum class Type { Or,
+                          And,
+                          Not,
+                          Compare,
+                          Between,
+                          In,
+                          Function,
+                          Path,
+                          Value,
+                          Size };
+
+        /**
+         * Path element, either an attribute name or a list index
+         */
+        struct PathElement {
+            std::string name;
+            long index = -1;
+        };
+
+        Type type;
+        std::string op;
+        std::vector<PathElement> path;
+        Poco::JSON::Object::Ptr value;
+        std::vector<std::shared_ptr<const Node>> children;
+    };
+
+    namespace {
+
+        using Node = DynamoDbExpression::Node;
+        using NodePtr = std::shared_ptr<const Node>;
+
+        struct Token {
+            enum class Kind { Name,
+                              NamePlaceholder,
+                              ValuePlaceholder,
+                              Number,
+                              Symbol,
+                              End };
+            Kind kind;
+            std::string text;
+        };
+
+        bool IsNameChar(char c) {
+            return std::isalnum(static_cast<unsigned char>(c)) || c == '_';
+        }
+
+        bool EqualsIgnoreCase(const std::string &left, const std::string &right) {
+            return left.size() == right.size() && std::equal(left.begin(), left.end(), right.begin(), [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == std::tolower(static_cast<unsigned char>(b)); });
+        }
+
+        std::vector<Token> Tokenize(const std::string &expression) {
+
+            std::vector<Token> tokens;
+            std::size_t i = 0;
+            while (i < expression.size()) {
+                char c = expression[i];
+                if (std::isspace(static_cast<unsigned char>(c))) {
+                    i++;
+                } else if (c == '#' || c == ':') {
+                    std::size_t start = i++;
+                    while (i < expression.size() && IsNameChar(expression[i])) i++;
+                    if (i == start + 1) {
+                        throw Core::BadRequestException("Invalid expression, empty placeholder at position " + std::to_string(start));
+                    }
+                    tokens.push_back({c == '#' ? Token::Kind::NamePlaceholder : Token::Kind::ValuePlaceholder, expression.substr(start, i - start)});
+                } else if (std::isdigit(static_cast<unsigned char>(c))) {
+                    std::size_t start = i;
+                    while (i < expression.size() && std::isdigit(static_cast<unsigned char>(expression[i]))) i++;
+                    tokens.push_back({Token::Kind::Number, expression.substr(start, i - start)});
+                } else if (IsNameChar(c)) {
+                    std::size_t start = i;
+                    while (i < expression.size() && IsNameChar(expression[i])) i++;
+                    tokens.push_back({Token::Kind::Name, expression.substr(start, i - start)});
+                } else if ((c == '<' || c == '>') && i + 1 < expression.size() && (expression[i + 1] == '=' || (c == '<' && expression[i + 1] == '>'))) {
+                    tokens.push_back({Token::Kind::Symbol, expression.substr(i, 2)});
+                    i += 2;
+                } else if (std::string("()[],.=<>").find(c) != std::string::npos) {
+                    tokens.push_back({Token::Kind::Symbol, std::string(1, c)});
+                    i++;
+                } else {
+                    throw Core::BadRequestException("Invalid expression, unexpected character '" + std::string(1, c) + "' at position " + std::to_string(i));
+                }
+            }
+            tokens.push_back({Token::Kind::End, {}});
+            return tokens;
+        }
+
+        /**
+         * Recursive descent parser:
+         *
+         * condition := and (OR and)*
+         * and       := not (AND not)*
+         * not       := NOT not | primary
+         * primary   := '(' condition ')' | function '(' operand (',' operand)* ')'
+         *            | operand (comparator operand | BETWEEN operand AND operand | IN '(' operand (',' operand)* ')')
+         * operand   := value | size '(' path ')' | path
+         * path      := name ('.' name | '[' number ']')*
+         */
+        class Parser {
+
+          public:
+
+            Parser(const std::string &expression, const Poco::JSON::Object::Ptr &names, const Poco::JSON::Object::Ptr &values) : _tokens(Tokenize(expression)), _names(names), _values(values) {}
+
+            NodePtr Parse() {
+                NodePtr root = ParseOr();
+                if (Peek().kind != Token::Kind::End) {
+                    throw Core::BadRequestException("Invalid expression, unexpected token: " + Peek().text);
+                }
+                return root;
+            }
+
+          private:
+
+            const Token &Peek() const {
+                return _tokens[_position];
+            }
+
+            const Token &Next() {
+                const Token &token = _tokens[_position];
+                if (token.kind != Token::Kind::End) {
+                    _position++;
+                }
+                return token;
+            }
+
+            bool AcceptKeyword(const std::string &keyword) {
+                if (Peek().kind == Token::Kind::Name && EqualsIgnoreCase(Peek().text, keyword)) {
+                    _position++;
+                    return true;
+                }
+                return false;
+            }
+
+            bool AcceptSymbol(const std::string &symbol) {
+                if (Peek().kind == Token::Kind::Symbol && Peek().text == symbol) {
+                    _position++;
+                    return true;
+                }
+                return false;
+            }
+
+            void ExpectSymbol(const std::string &symbol) {
+                if (!AcceptSymbol(symbol)) {
+                    throw Core::BadRequestException("Invalid expression, expected '" + symbol + "' but found: '" + Peek().text + "'");
+                }
+            }
+
+            NodePtr ParseOr() {
+                NodePtr left = ParseAnd();
+                while (AcceptKeyword("OR")) {
+                    left = std::make_shared<const Node>(Node{.type = Node::Type::Or, .children = {left, ParseAnd()}});
+                }
+                return left;
+            }
+
+            NodePtr ParseAnd() {
+                NodePtr left = ParseNot();
+                while (AcceptKeyword("AND")) {
+                    left = std::make_shared<const Node>(Node{.type = Node::Type::And, .children = {left, ParseNot()}});
+                }
+                return left;
+            }
+
+            NodePtr ParseNot() {
+                if (AcceptKeyword("NOT")) {
+                    return std::make_shared<const Node>(Node{.type = Node::Type::Not, .children = {ParseNot()}});
+                }
+                return ParsePrimary();
+            }
+
+            NodePtr ParsePrimary() {
+
+                if (AcceptSymbol("(")) {
+                    NodePtr node = ParseOr();
+                    ExpectSymbol(")");
+                    return node;
+                }
+
+                // Functions
+                if (Peek().kind == Token::Kind::Name && _tokens[_position + 1].text == "(" && !EqualsIgnoreCase(Peek().text, "size")) {
+                    std::string function = Next().text;
+                    if (function != "attribute_exists" && function != "attribute_not_exists" && function != "attribute_type" && function != "begins_with" && function != "contains") {
+                        throw Core::BadRequestException("Invalid expression, unknown function: " + function);
+                    }
+                    ExpectSymbol("(");
+                    Node node{.type = Node::Type::Function, .op = function, .children = {ParseOperand()}};
+                    while (AcceptSymbol(",")) {
+                        node.children.push_back(ParseOperand());
+                    }
+                    ExpectSymbol(")");
+                    std::size_t arguments = function == "attribute_exists" || function == "attribute_not_exists" ? 1 : 2;
+                    if (node.children.size() != arguments || node.children[0]->type != Node::Type::Path) {
+                        throw Core::BadRequestException("Invalid expression, wrong arguments for function: " + function);
+                    }
+                    return std::make_shared<const Node>(std::move(node));
+                }
+
+                NodePtr left = ParseOperand();
+                if (AcceptKeyword("BETWEEN")) {
+                    NodePtr lower = ParseOperand();
+                    if (!AcceptKeyword("AND")) {
+                        throw Core::BadRequestException("Invalid expression, BETWEEN without AND");
+                    }
+                    return std::make_shared<const Node>(Node{.type = Node::Type::Between, .children = {left, lower, ParseOperand()}});
+                }
+                if (AcceptKeyword("IN")) {
+                    ExpectSymbol("(");
+                    Node node{.type = Node::Type::In, .children = {left, ParseOperand()}};
+                    while (AcceptSymbol(",")) {
+                        node.children.push_back(ParseOperand());
+                    }
+                    ExpectSymbol(")");
+                    return std::make_shared<const Node>(std::move(node));
+                }
+
+                const Token &token = Peek();
+                if (token.kind == Token::Kind::Symbol && (token.text == "=" || token.text == "<>" || token.text == "<" || token.text == "<=" || token.text == ">" || token.text == ">=")) {
+                    std::string op = Next().text;
+                    return std::make_shared<const Node>(Node{.type = Node::Type::Compare, .op = op, .children = {left, ParseOperand()}});
+                }
+                throw Core::BadRequestException("Invalid expression, expected comparator but found: '" + token.text + "'");
+            }
+
+            NodePtr ParseOperand() {
+
+                const Token &token = Peek();
+                if (token.kind == Token::Kind::ValuePlaceholder) {
+                    Next();
+                    if (_values.isNull() || !_values->isObject(token.text)) {
+                        throw Core::BadRequestException("Value provided in ExpressionAttributeValues unused in expressions or undefined: " + token.text);
+                    }
+                    return std::make_shared<const Node>(Node{.type = Node::Type::Value, .value = _values->getObject(token.text)});
+                }
+                if (token.kind == Token::Kind::Name && EqualsIgnoreCase(token.text, "size") && _tokens[_position + 1].text == "(") {
+                    Next();
+                    ExpectSymbol("(");
+                    NodePtr path = ParsePath();
+                    ExpectSymbol(")");
+                    return std::make_shared<const Node>(Node{.type = Node::Type::Size, .children = {path}});
+                }
+                return ParsePath();
+            }
+
+            NodePtr ParsePath() {
+
+                Node node{.type = Node::Type::Path};
+                node.path.push_back({.name = ParseName()});
+                while (true) {
+                    if (AcceptSymbol(".")) {
+                        node.path.push_back({.name = ParseName()});
+                    } else if (AcceptSymbol("[")) {
+                        if (Peek().kind != Token::Kind::Number) {
+                            throw Core::BadRequestException("Invalid expression, list index expected");
+                        }
+                        node.path.push_back({.index = std::stol(Next().text)});
+                        ExpectSymbol("]");
+                    } else {
+                        break;
+                    }
+                }
+                return std::make_shared<const Node>(std::move(node));
+            }
+
+            std::string ParseName() {
+
+                const Token &token = Next();
+                if (token.kind == Token::Kind::Name) {
+                    return token.text;
+                }
+                if (token.kind == Token::Kind::NamePlaceholder) {
+                    if (_names.isNull() || !_names->has(token.text)) {
+                        throw Core::BadRequestException("An expression attribute name used in the document path is not defined: " + token.text);
+                    }
+                    return _names->getValue<std::string>(token.text);
+                }
+                throw Core::BadRequestException("Invalid expression, attribute name expected but found: '" + token.text + "'");
+            }
+
+            std::vector<Token> _tokens;
+            std::size_t _position = 0;
+            Poco::JSON::Object::Ptr _names;
+            Poco::JSON::Object::Ptr _values;
+        };
+
+        Poco::JSON::Object::Ptr ResolvePath(const Node &node, const Poco::JSON::Object::Ptr &item) {
+
+            if (item.isNull()) {
+                return {};
+            }
+
+            Poco::JSON::Object::Ptr value = item->getObject(node.path[0].name);
+            for (std::size_t i = 1; i < node.path.size() && !value.isNull(); i++) {
+                const Node::PathElement &element = node.path[i];
+                if (element.index >= 0) {
+                    Poco::JSON::Array::Ptr list = value->getArray("L");
+                    value = list.isNull() ? Poco::JSON::Object::Ptr() : list->getObject(static_cast<unsigned int>(element.index));
+                } else {
+                    Poco::JSON::Object::Ptr map = value->getObject("M");
+                    value = map.isNull() ? Poco::JSON::Object::Ptr() : map->getObject(element.name);
+                }
+            }
+            return value;
+        }
+
+        std::string GetBinary(const Poco::JSON::Object::Ptr &value) {
+            return Core::Crypto::Base64Decode(value->getValue<std::string>("B"));
+        }
+
+        Poco::JSON::Object::Ptr ResolveOperand(const Node &node, const Poco::JSON::Object::Ptr &item) {
+
+            switch (node.type) {
+                case Node::Type::Value:
+                    return node.value;
+                case Node::Type::Path:
+                    return ResolvePath(node, item);
+                case Node::Type::Size: {
+                    Poco::JSON::Object::Ptr value = ResolvePath(*node.children[0], item);
+                    if (value.isNull()) {
+                        return {};
+                    }
+                    std::string type = DynamoDbExpression::GetType(value);
+                    std::size_t size;
+                    if (type == "S") {
+                        size = value->getValue<std::string>("S").size();
+                    } else if (type == "B") {
+                        size = GetBinary(value).size();
+                    } else if (type == "M") {
+                        size = value->getObject("M")->size();
+                    } else if (type == "SS" || type == "NS" || type == "BS" || type == "L") {
+                        size = value->getArray(type)->size();
+                    } else {
+                        return {};
+                    }
+                    Poco::JSON::Object::Ptr result = new Poco::JSON::Object();
+                    result->set("N", std::to_string(size));
+                    return result;
+                }
+                default:
+                    return {};
+            }
+        }
+
+        bool Contains(const Poco::JSON::Object::Ptr &value, const Poco::JSON::Object::Ptr &operand) {
+
+            std::string type = DynamoDbExpression::GetType(value);
+            std::string operandType = DynamoDbExpression::GetType(operand);
+            if (type == "S" && operandType == "S") {
+                return value->getValue<std::string>("S").find(operand->getValue<std::string>("S")) != std::string::npos;
+            }
+            if (type == "B" && operandType == "B") {
+                return GetBinary(value).find(GetBinary(operand)) != std::string::npos;
+            }
+            if ((type == "SS" && operandType == "S") || (type == "NS" && operandType == "N") || (type == "BS" && operandType == "B")) {
+                for (const auto &element: *value->getArray(type)) {
+                    Poco::JSON::Object::Ptr elementValue = new Poco::JSON::Object();
+                    elementValue->set(operandType, element);
+                    if (DynamoDbExpression::Equals(elementValue, operand)) {
+                        return true;
+                    }
+                }
+                return false;
+            }
+            if (type == "L") {
+                Poco::JSON::Array::Ptr list = value->getArray("L");
+                for (unsigned int i = 0; i < list->size(); i++) {
+                    if (DynamoDbExpression::Equals(list->getObject(i), operand)) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+
+        bool EvaluateNode(const Node &node, const Poco::JSON::Object::Ptr &item) {
+
+            switch (node.type) {
+
+                case Node::Type::Or:
+                    return EvaluateNode(*node.children[0], item) || EvaluateNode(*node.children[1], item);
+
+                case Node::Type::And:
+                    return EvaluateNode(*node.children[0], item) && EvaluateNode(*node.children[1], item);
+
+                case Node::Type::Not:
+                    return !EvaluateNode(*node.children[0], item);
+
+                case Node::Type::Compare: {
+                    Poco::JSON::Object::Ptr left = ResolveOperand(*node.children[0], item);
+                    Poco::JSON::Object::Ptr right = ResolveOperand(*node.children[1], item);
+                    if (left.isNull() || right.isNull()) {
+                        return node.op == "<>" && left.isNull() != right.isNull();
+                    }
+                    if (node.op == "=") {
+                        return DynamoDbExpression::Equals(left, right);
+                    }
+                    if (node.op == "<>") {
+                        return !DynamoDbExpression::Equals(left, right);
+                    }
+                    int result;
+                    if (!DynamoDbExpression::Compare(left, right, result)) {
+                        return false;
+                    }
+                    return (node.op == "<" && result < 0) || (node.op == "<=" && result <= 0) || (node.op == ">" && result > 0) || (node.op == ">=" && result >= 0);
+                }
+
+                case Node::Type::Between: {
+                    Poco::JSON::Object::Ptr value = ResolveOperand(*node.children[0], item);
+                    Poco::JSON::Object::Ptr lower = ResolveOperand(*node.children[1], item);
+                    Poco::JSON::Object::Ptr upper = ResolveOperand(*node.children[2], item);
+                    if (value.isNull() || lower.isNull() || upper.isNull()) {
+                        return false;
+                    }
+                    int lowerResult, upperResult;
+                    return DynamoDbExpression::Compare(value, lower, lowerResult) && DynamoDbExpression::Compare(value, upper, upperResult) && lowerResult >= 0 && upperResult <= 0;
+                }
+
+                case Node::Type::In: {
+                    Poco::JSON::Object::Ptr value = ResolveOperand(*node.children[0], item);
+                    if (value.isNull()) {
+                        return false;
+                    }
+                    for (std::size_t i = 1; i < node.children.size(); i++) {
+                        Poco::JSON::Object::Ptr candidate = ResolveOperand(*node.children[i], item);
+                        if (!candidate.isNull() && DynamoDbExpression::Equals(value, candidate)) {
+                            return true;
+                        }
+                    }
+                    return false;
+                }
+
+                case Node::Type::Function: {
+                    Poco::JSON::Object::Ptr value = ResolvePath(*node.children[0], item);
+                    if (node.op == "attribute_exists") {
+                        return !value.isNull();
+                    }
+                    if (node.op == "attribute_not_exists") {
+                        return value.isNull();
+                    }
+                    Poco::JSON::Object::Ptr operand = ResolveOperand(*node.children[1], item);
+                    if (value.isNull() || operand.isNull()) {
+                        return false;
+                    }
+                    if (node.op == "attribute_type") {
+                        return DynamoDbExpression::GetType(operand) == "S" && DynamoDbExpression::GetType(value) == operand->getValue<std::string>("S");
+                    }
+                    if (node.op == "begins_with") {
+                        std::string type = DynamoDbExpression::GetType(value);
+                        if (type != DynamoDbExpression::GetType(operand) || (type != "S" && type != "B")) {
+                            return false;
+                        }
+                        std::string string = type == "S" ? value->getValue<std::string>("S") : GetBinary(value);
+                        std::string prefix = type == "S" ? operand->getValue<std::string>("S") : GetBinary(operand);
+                        return string.starts_with(prefix);
+                    }
+                    return Contains(value, operand);
+                }
+
+                default:
+                    throw Core::BadRequestException("Invalid expression, operand used as condition");
+            }
+        }
+
+        bool IsKeyPath(const Node &node, const std::string &name) {
+            return node.type == Node::Type::Path && node.path.size() == 1 && node.path[0].index < 0 && node.path[0].name == name;
+        }
+
+        void CollectConjuncts(const NodePtr &node, std::vector<NodePtr> &conjuncts) {
+            if (node->type == Node::Type::And) {
+                CollectConjuncts(node->children[0], conjuncts);
+                CollectConjuncts(node->children[1], conjuncts);
+            } else {
+                conjuncts.push_back(node);
+            }
+        }
+
+        struct Decimal {
+            bool negative = false;
+            std::string integer;
+            std::string fraction;
+        };
+
+        bool ParseDecimal(const std::string &number, Decimal &decimal) {
+
+            std::size_t i = 0;
+            if (i < number.size() && (number[i] == '-' || number[i] == '+')) {
+                decimal.negative = number[i] == '-';
+                i++;
+            }
+            std::size_t start = i;
+            while (i < number.size() && std::isdigit(static_cast<unsigned char>(number[i]))) i++;
+            decimal.integer = number.substr(start, i - start);
+            if (i < number.size() && number[i] == '.') {
+                start = ++i;
+                while (i < number.size() && std::isdigit(static_cast<unsigned char>(number[i]))) i++;
+                decimal.fraction = number.substr(start, i - start);
+            }
+            if (i != number.size() || (decimal.integer.empty() && decimal.fraction.empty())) {
+                return false;
+            }
+
+            decimal.integer.erase(0, decimal.integer.find_first_not_of('0') == std::string::npos ? decimal.integer.size() : decimal.integer.find_first_not_of('0'));
+            decimal.fraction.erase(decimal.fraction.find_last_not_of('0') + 1);
+            if (decimal.integer.empty() && decimal.fraction.empty()) {
+                decimal.negative = false;
+            }
+            return true;
+        }
+
+    }// namespace
+
+    DynamoDbExpression::DynamoDbExpression(const std::string &expression, const Poco::JSON::Object::Ptr &names, const Poco::JSON::Object::Ptr &values) {
+        Parser parser(expression, names, values);
+        _root = parser.Parse();
+    }
+
+    bool DynamoDbExpression::Evaluate(const Poco::JSON::Object::Ptr &item) const {
+        return EvaluateNode(*_root, item);
+    }
+
+    bool DynamoDbExpression::GetKeyCondition(const std::string &hashKey, const std::string &rangeKey, DynamoDbKeyCondition &keyCondition) const {
+
+        std::vector<NodePtr> conjuncts;
+        CollectConjuncts(_root, conjuncts);
+        if (conjuncts.size() > 2) {
+            return false;
+        }
+
+        for (const auto &node: conjuncts) {
+
+            if (node->type == Node::Type::Compare && node->children[1]->type == Node::Type::Value && IsKeyPath(*node->children[0], hashKey) && node->op == "=" && keyCondition.hashValue.isNull()) {
+                keyCondition.hashValue = node->children[1]->value;
+            } else if (node->type == Node::Type::Compare && node->children[0]->type == Node::Type::Value && IsKeyPath(*node->children[1], hashKey) && node->op == "=" && keyCondition.hashValue.isNull()) {
+                keyCondition.hashValue = node->children[0]->value;
+            } else if (rangeKey.empty() || !keyCondition.rangeOperator.empty()) {
+                return false;
+            } else if (node->type == Node::Type::Compare && node->op != "<>" && node->children[1]->type == Node::Type::Value && IsKeyPath(*node->children[0], rangeKey)) {
+                keyCondition.rangeOperator = node->op;
+                keyCondition.rangeValue = node->children[1]->value;
+            } else if (node->type == Node::Type::Compare && node->op != "<>" && node->children[0]->type == Node::Type::Value && IsKeyPath(*node->children[1], rangeKey)) {
+
+                // :value < key is key > :value
+                static const std::map<std::string, std::string> mirrored = {{"=", "="}, {"<", ">"}, {"<=", ">="}, {">", "<"}, {">=", "<="}};
+                keyCondition.rangeOperator = mirrored.at(node->op);
+                keyCondition.rangeValue = node->children[0]->value;
+            } else if (node->type == Node::Type::Between && IsKeyPath(*node->children[0], rangeKey) && node->children[1]->type == Node::Type::Value && node->children[2]->type == Node::Type::Value) {
+                keyCondition.rangeOperator = "BETWEEN";
+                keyCondition.rangeValue = node->children[1]->value;
+                keyCondition.rangeValueUpper = node->children[2]->value;
+            } else if (node->type == Node::Type::Function && node->op == "begins_with" && IsKeyPath(*node->children[0], rangeKey) && node->children[1]->type == Node::Type::Value) {
+                keyCondition.rangeOperator = "begins_with";
+                keyCondition.rangeValue = node->children[1]->value;
+            } else {
+                return false;
+            }
+        }
+        return !keyCondition.hashValue.isNull();
+    }
+
+    std::vector<std::string> DynamoDbExpression::GetProjectionAttributes(const std::string &expression, const Poco::JSON::Object::Ptr &names) {
+
+        std::vector<std::string> attributes;
+        std::size_t start = 0;
+        while (start <= expression.size()) {
+            std::size_t end = expression.find(',', start);
+            if (end == std::string::npos) {
+                end = expression.size();
+            }
+
+            std::string path = expression.substr(start, end - start);
+            path.erase(0, path.find_first_not_of(" \t\n"));
+            std::string name = path.substr(0, path.find_first_of(".[ \t\n"));
+            if (name.starts_with("#")) {
+                if (names.isNull() || !names->has(name)) {
+                    throw Core::BadRequestException("An expression attribute name used in the document path is not defined: " + name);
+                }
+                name = names->getValue<std::string>(name);
+            }
+            if (!name.empty() && std::find(attributes.begin(), attributes.end(), name) == attributes.end()) {
+                attributes.push_back(name);
+            }
+            start = end + 1;
+        }
+        return attributes;
+    }
+
+    std::string DynamoDbExpression::GetType(const Poco::JSON::Object::Ptr &value) {
+        if (value.isNull() || value->size() != 1) {
+            return {};
+        }
+        return value->begin()->first;
+    }
+
+    bool DynamoDbExpression::Equals(const Poco::JSON::Object::Ptr &left, const Poco::JSON::Object::Ptr &right) {
+
+        std::string type = GetType(left);
+        if (type.empty() || type != GetType(right)) {
+            return false;
+        }
+
+        if (type == "N") {
+            return CompareNumbers(left->getValue<std::string>("N"), right->getValue<std::string>("N")) == 0;
+        }
+        if (type == "S" || type == "B") {
+            return left->getValue<std::string>(type) == right->getValue<std::string>(type);
+        }
+        if (type == "BOOL" || type == "NULL") {
+            return left->get(type).convert<bool>() == right->get(type).convert<bool>();
+        }
+        if (type == "SS" || type == "NS" || type == "BS") {
+            std::set<std::string> leftSet, rightSet;
+            for (const auto &element: *left->getArray(type)) {
+                leftSet.insert(type == "NS" ? NormalizeNumber(element.convert<std::string>()) : element.convert<std::string>());
+            }
+            for (const auto &element: *right->getArray(type)) {
+                rightSet.insert(type == "NS" ? NormalizeNumber(element.convert<std::string>()) : element.convert<std::string>());
+            }
+            return leftSet == rightSet;
+        }
+        if (type == "L") {
+            Poco::JSON::Array::Ptr leftList = left->getArray("L");
+            Poco::JSON::Array::Ptr rightList = right->getArray("L");
+            if (leftList->size() != rightList->size()) {
+                return false;
+            }
+            for (unsigned int i = 0; i < leftList->size(); i++) {
+                if (!Equals(leftList->getObject(i), rightList->getObject(i))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        if (type == "M") {
+            Poco::JSON::Object::Ptr leftMap = left->getObject("M");
+            Poco::JSON::Object::Ptr rightMap = right->getObject("M");
+            if (leftMap->size() != rightMap->size()) {
+                return false;
+            }
+            for (const auto &[name, value]: *leftMap) {
+                if (!rightMap->has(name) || !Equals(leftMap->getObject(name), rightMap->getObject(name))) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        return false;
+    }
+
+    bool DynamoDbExpression::Compare(const Poco::JSON::Object::Ptr &left, const Poco::JSON::Object::Ptr &right, int &result) {
+
+        std::string type = GetType(left);
+        if (type != GetType(right)) {
+            return false;
+        }
+
+        if (type == "N") {
+            result = CompareNumbers(left->getValue<std::string>("N"), right->getValue<std::string>("N"));
+        } else if (type == "S") {
+            result = left->getValue<std::string>("S").compare(right->getValue<std::string>("S"));
+        } else if (type == "B") {
+            result = GetBinary(left).compare(GetBinary(right));
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    int DynamoDbExpression::CompareNumbers(const std::string &left, const std::string &right) {
+
+        Decimal leftDecimal, rightDecimal;
+        if (!ParseDecimal(left, leftDecimal) || !ParseDecimal(right, rightDecimal)) {
+
+            // Exponent notation
+            long double leftValue = std::stold(left), rightValue = std::stold(right);
+            return leftValue < rightValue ? -1 : (leftValue > rightValue ? 1 : 0);
+        }
+
+        if (leftDecimal.negative != rightDecimal.negative) {
+            return leftDecimal.negative ? -1 : 1;
+        }
+
+        int result;
+        if (leftDecimal.integer.size() != rightDecimal.integer.size()) {
+            result = leftDecimal.integer.size() < rightDecimal.integer.size() ? -1 : 1;
+        } else if (int integerResult = leftDecimal.integer.compare(rightDecimal.integer); integerResult != 0) {
+            result = integerResult;
+        } else {
+            result = leftDecimal.fraction.compare(rightDecimal.fraction);
+        }
+        result = result < 0 ? -1 : (result > 0 ? 1 : 0);
+        return leftDecimal.negative ? -result : result;
+    }
+
+    std::string DynamoDbExpression::NormalizeNumber(const std::string &number) {
+
+        Decimal decimal;
+        if (!ParseDecimal(number, decimal)) {
+            return number;
+        }
+        return (decimal.negative ? "-" : "") + (decimal.integer.empty() ? "0" : decimal.integer) + (decimal.fraction.empty() ? "" : "." + decimal.fraction);
+    }
+
+}// namespace AwsMock::Service
@@ -32,6 +32,8 @@ namespace AwsMock::Service {
 
                     if (tableResponse.status == http::status::ok) {
                         return SendOkResponse(request, tableResponse.body, tableResponse.headers);
+                    } else if (tableResponse.status == http::status::bad_request) {
+                        return SendBadRequestError(request, tableResponse.body, tableResponse.headers);
                     } else {
                         return SendInternalServerError(request, tableResponse.body, tableResponse.headers);
                     }
@@ -50,6 +52,8 @@ namespace AwsMock::Service {
                     Dto::DynamoDb::ListTableResponse tableResponse = _dynamoDbService.ListTables(tableRequest);
                     if (tableResponse.status == http::status::ok) {
                         return SendOkResponse(request, tableResponse.body, tableResponse.headers);
+                    } else if (tableResponse.status == http::status::bad_request) {
+                        return SendBadRequestError(request, tableResponse.body, tableResponse.headers);
                     } else {
                         return SendInternalServerError(request, tableResponse.body, tableResponse.headers);
                     }
@@ -68,6 +72,8 @@ namespace AwsMock::Service {
                     Dto::DynamoDb::DescribeTableResponse tableResponse = _dynamoDbService.DescribeTable(tableRequest);
                     if (tableResponse.status == http::status::ok) {
                         return SendOkResponse(request, tableResponse.body, tableResponse.headers);
+                    } else if (tableResponse.status == http::status::bad_request) {
+                        return SendBadRequestError(request, tableResponse.body, tableResponse.headers);
                     } else {
                         return SendInternalServerError(request, tableResponse.body, tableResponse.headers);
                     }
@@ -87,6 +93,8 @@ namespace AwsMock::Service {
                     Dto::DynamoDb::DeleteTableResponse tableResponse = _dynamoDbService.DeleteTable(tableRequest);
                     if (tableResponse.status == http::status::ok) {
                         return SendOkResponse(request, tableResponse.body, tableResponse.headers);
+                    } else if (tableResponse.status == http::status::bad_request) {
+                        return SendBadRequestError(request, tableResponse.body, tableResponse.headers);
                     } else {
                         return SendInternalServerError(request, tableResponse.body, tableResponse.headers);
                     }
@@ -106,6 +114,8 @@ namespace AwsMock::Service {
                     Dto::DynamoDb::GetItemResponse itemResponse = _dynamoDbService.GetItem(itemRequest);
                     if (itemResponse.status == http::status::ok) {
                         return SendOkResponse(request, itemResponse.body, itemResponse.headers);
+                    } else if (itemResponse.status == http::status::bad_request) {
+                        return SendBadRequestError(request, itemResponse.body, itemResponse.headers);
                     } else {
                         return SendInternalServerError(request, itemResponse.body, itemResponse.headers);
                     }
@@ -125,6 +135,8 @@ namespace AwsMock::Service {
                     Dto::DynamoDb::PutItemResponse itemResponse = _dynamoDbService.PutItem(itemRequest);
                     if (itemResponse.status == http::status::ok) {
                         return SendOkResponse(request, itemResponse.body, itemResponse.headers);
+                    } else if (itemResponse.status == http::status::bad_request) {
+                        return SendBadRequestError(request, itemResponse.body, itemResponse.headers);
                     } else {
                         return SendInternalServerError(request, itemResponse.body, itemResponse.headers);
                     }
@@ -144,6 +156,8 @@ namespace AwsMock::Service {
                     Dto::DynamoDb::QueryResponse queryResponse = _dynamoDbService.Query(queryRequest);
                     if (queryResponse.status == http::status::ok) {
                         return SendOkResponse(request, queryResponse.body, queryResponse.headers);
+                    } else if (queryResponse.status == http::status::bad_request) {
+                        return SendBadRequestError(request, queryResponse.body, queryResponse.headers);
                     } else {
                         return SendInternalServerError(request, queryResponse.body, queryResponse.headers);
                     }
@@ -163,6 +177,8 @@ namespace AwsMock::Service {
                     Dto::DynamoDb::ScanResponse scanResponse = _dynamoDbService.Scan(scanRequest);
                     if (scanResponse.status == http::status::ok) {
                         return SendOkResponse(request, scanResponse.body, scanResponse.headers);
+                    } else if (scanResponse.status == http::status::bad_request) {
+                        return SendBadRequestError(request, scanResponse.body, scanResponse.headers);
                     } else {
                         return SendInternalServerError(request, scanResponse.body, scanResponse.headers);
                     }
@@ -182,6 +198,8 @@ namespace AwsMock::Service {
                     Dto::DynamoDb::DeleteItemResponse dynamoDbResponse = _dynamoDbService.DeleteItem(dynamoDbRequest);
                     if (dynamoDbResponse.status == http::status::ok) {
                         return SendOkResponse(request, dynamoDbResponse.body, dynamoDbResponse.headers);
+                    } else if (dynamoDbResponse.status == http::status::bad_request) {
+                        return SendBadRequestError(request, dynamoDbResponse.body, dynamoDbResponse.headers);
                     } else {
                         return SendInternalServerError(request, dynamoDbResponse.body, dynamoDbResponse.headers);
                     }
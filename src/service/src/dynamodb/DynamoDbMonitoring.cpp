@@ -23,8 +23,9 @@ namespace AwsMock::Service {
     void DynamoDbMonitoring::UpdateCounter() {
         log_trace << "Dynamodb monitoring starting";
 
-        long tables = _dynamoDbDatabase.CountTables();
-        long items = _dynamoDbDatabase.CountItems();
+        bool nativeEngine = DynamoDbEngine::IsActive();
+        long tables = nativeEngine ? DynamoDbEngine::instance().CountTables() : _dynamoDbDatabase.CountTables();
+        long items = nativeEngine ? DynamoDbEngine::instance().CountItems() : _dynamoDbDatabase.CountItems();
         _metricService.SetGauge(DYNAMODB_TABLE_COUNT, tables);
         _metricService.SetGauge(DYNAMODB_ITEM_COUNT, items);
 
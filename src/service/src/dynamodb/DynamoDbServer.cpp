@@ -33,8 +33,10 @@ namespace AwsMock::Service {
         // Worker
         _dynamoDbWorker = std::make_shared<DynamoDbWorker>(_workerPeriod);
 
-        // Start DynamoDb docker image
-        StartLocalDynamoDb();
+        // Start DynamoDb docker image, not needed by the native engine
+        if (!DynamoDbEngine::IsActive()) {
+            StartLocalDynamoDb();
+        }
     }
 
     void DynamoDbServer::Initialize() {
@@ -50,7 +52,9 @@ namespace AwsMock::Service {
         //StartHttpServer(_maxQueueLength, _maxThreads, _requestTimeout, _host, _port, new DynamoDbRequestHandlerFactory(_configuration));
 
         // Cleanup
-        CleanupContainers();
+        if (!DynamoDbEngine::IsActive()) {
+            CleanupContainers();
+        }
 
         // Set running
         SetRunning();
@@ -11,13 +11,16 @@ namespace AwsMock::Service {
         // DynamoDB docker host, port
         _dockerHost = "localhost";
         _dockerPort = Core::Configuration::instance().getInt("awsmock.dynamodb.port", 8000);
+
+        // Native engine or docker container
+        _nativeEngine = DynamoDbEngine::IsActive();
     }
 
     Dto::DynamoDb::CreateTableResponse DynamoDbService::CreateTable(const Dto::DynamoDb::CreateTableRequest &request) {
         Core::MetricServiceTimer measure(DYNAMODB_SERVICE_TIMER, "method", "create_table");
         log_debug << "Start creating a new DynamoDb table, region: " << request.region << " name: " << request.tableName;
 
-        if (_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
+        if (!_nativeEngine && _dynamoDbDatabase.TableExists(request.region, request.tableName)) {
             log_warning << "DynamoDb table exists already, region: " << request.region << " name: " << request.tableName;
             throw Core::BadRequestException("DynamoDb table exists already");
         }
@@ -33,12 +36,14 @@ namespace AwsMock::Service {
                     .keySchemas = request.keySchemas};
 
             // Send request to DynamoDB docker container
-            Dto::DynamoDb::DynamoDbResponse response = SendDynamoDbRequest(request.body, request.headers);
+            Dto::DynamoDb::DynamoDbResponse response = _nativeEngine ? DynamoDbEngine::instance().CreateTable(request.region, request.body) : SendDynamoDbRequest(request.body, request.headers);
             createTableResponse = {.body = response.body, .headers = response.headers, .status = response.status};
 
             // Update database
-            table = _dynamoDbDatabase.CreateTable(table);
-            log_info << "DynamoDb table created, name: " << table.name;
+            if (response.status == boost::beast::http::status::ok && !_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
+                table = _dynamoDbDatabase.CreateTable(table);
+                log_info << "DynamoDb table created, name: " << table.name;
+            }
 
         } catch (Poco::Exception &exc) {
             log_error << "DynamoDbd create table failed, error: " << exc.message();
@@ -56,7 +61,7 @@ namespace AwsMock::Service {
         try {
 
             // Send request to docker container
-            Dto::DynamoDb::DynamoDbResponse response = SendDynamoDbRequest(request.body, request.headers);
+            Dto::DynamoDb::DynamoDbResponse response = _nativeEngine ? DynamoDbEngine::instance().ListTables(request.region, request.body) : SendDynamoDbRequest(request.body, request.headers);
             listTableResponse = {.body = response.body, .headers = response.headers, .status = response.status};
             log_info << "DynamoDb list tables, region: " << request.region;
 
@@ -79,7 +84,7 @@ namespace AwsMock::Service {
 
         try {
             // Send request to docker container
-            Dto::DynamoDb::DynamoDbResponse response = SendDynamoDbRequest(request.body, request.headers);
+            Dto::DynamoDb::DynamoDbResponse response = _nativeEngine ? DynamoDbEngine::instance().DescribeTable(request.region, request.body) : SendDynamoDbRequest(request.body, request.headers);
             describeTableResponse = {.body = response.body, .headers = response.headers, .status = response.status};
             log_info << "DynamoDb describe table, name: " << request.tableName;
 
@@ -95,7 +100,7 @@ namespace AwsMock::Service {
         Core::MetricServiceTimer measure(DYNAMODB_SERVICE_TIMER, "method", "delete_table");
         log_debug << "Start creating a new DynamoDb table, region: " << request.region << " name: " << request.tableName;
 
-        if (!_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
+        if (!_nativeEngine && !_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
             log_warning << "DynamoDb table does not exist, region: " << request.region << " name: " << request.tableName;
             throw Core::BadRequestException("DynamoDb table does not exist, region: " + request.region + " name: " + request.tableName);
         }
@@ -104,12 +109,14 @@ namespace AwsMock::Service {
         try {
 
             // Send request to DynamoDB docker container
-            Dto::DynamoDb::DynamoDbResponse response = SendDynamoDbRequest(request.body, request.headers);
+            Dto::DynamoDb::DynamoDbResponse response = _nativeEngine ? DynamoDbEngine::instance().DeleteTable(request.region, request.body) : SendDynamoDbRequest(request.body, request.headers);
             deleteTableResponse = {.body = response.body, .headers = response.headers, .status = response.status};
 
             // Delete table in database
-            _dynamoDbDatabase.DeleteTable(request.region, request.tableName);
-            log_info << "DynamoDb table deleted, name: " << request.tableName;
+            if (response.status == boost::beast::http::status::ok) {
+                _dynamoDbDatabase.DeleteTable(request.region, request.tableName);
+                log_info << "DynamoDb table deleted, name: " << request.tableName;
+            }
 
         } catch (Poco::Exception &exc) {
             log_error << "DynamoDbd delete table failed, error: " << exc.message();
@@ -125,17 +132,25 @@ namespace AwsMock::Service {
 
         try {
 
-            // Delete all tables from DynamoDB
-            for (auto &table: _dynamoDbDatabase.ListTables()) {
+            if (_nativeEngine) {
+
+                // Delete all tables from the native engine
+                DynamoDbEngine::instance().DeleteAllTables();
+
+            } else {
 
-                Dto::DynamoDb::DeleteTableRequest dynamoDeleteRequest;
-                dynamoDeleteRequest.tableName = table.name;
-                dynamoDeleteRequest.body = dynamoDeleteRequest.ToJson();
-                dynamoDeleteRequest.headers["Region"] = "eu-central-1";
-                dynamoDeleteRequest.headers["X-Amz-Target"] = "DynamoDB_20120810.DeleteTable";
-                dynamoDeleteRequest.headers["User-Agent"] = "aws-cli/2.15.23 Python/3.11.6 Linux/6.1.0-18-amd64 exe/x86_64.debian.12 prompt/off command/dynamodb.delete-table";
+                // Delete all tables from DynamoDB
+                for (auto &table: _dynamoDbDatabase.ListTables()) {
 
-                SendDynamoDbRequest(dynamoDeleteRequest.body, dynamoDeleteRequest.headers);
+                    Dto::DynamoDb::DeleteTableRequest dynamoDeleteRequest;
+                    dynamoDeleteRequest.tableName = table.name;
+                    dynamoDeleteRequest.body = dynamoDeleteRequest.ToJson();
+                    dynamoDeleteRequest.headers["Region"] = "eu-central-1";
+                    dynamoDeleteRequest.headers["X-Amz-Target"] = "DynamoDB_20120810.DeleteTable";
+                    dynamoDeleteRequest.headers["User-Agent"] = "aws-cli/2.15.23 Python/3.11.6 Linux/6.1.0-18-amd64 exe/x86_64.debian.12 prompt/off command/dynamodb.delete-table";
+
+                    SendDynamoDbRequest(dynamoDeleteRequest.body, dynamoDeleteRequest.headers);
+                }
             }
 
             // Delete table in database
@@ -152,7 +167,7 @@ namespace AwsMock::Service {
         Core::MetricServiceTimer measure(DYNAMODB_SERVICE_TIMER, "method", "get_item");
         log_debug << "Start get item, region: " << request.region << " name: " << request.tableName;
 
-        if (!_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
+        if (!_nativeEngine && !_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
             log_warning << "DynamoDb table does not exist, region: " << request.region << " name: " << request.tableName;
             throw Core::BadRequestException("DynamoDb table exists already, region: " + request.region + " name: " + request.tableName);
         }
@@ -161,7 +176,7 @@ namespace AwsMock::Service {
         try {
 
             // Send request to docker container
-            Dto::DynamoDb::DynamoDbResponse response = SendDynamoDbRequest(request.body, request.headers);
+            Dto::DynamoDb::DynamoDbResponse response = _nativeEngine ? DynamoDbEngine::instance().GetItem(request.region, request.body) : SendDynamoDbRequest(request.body, request.headers);
             getItemResponse = {.body = response.body, .headers = response.headers, .status = response.status};
             log_info << "DynamoDb get item, name: " << request.tableName;
 
@@ -177,7 +192,7 @@ namespace AwsMock::Service {
         Core::MetricServiceTimer measure(DYNAMODB_SERVICE_TIMER, "method", "put_item");
         log_debug << "Start put item, region: " << request.region << " name: " << request.tableName;
 
-        if (!_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
+        if (!_nativeEngine && !_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
             log_warning << "DynamoDb table does not exist, region: " << request.region << " name: " << request.tableName;
             throw Core::BadRequestException("DynamoDb table exists already, region: " + request.region + " name: " + request.tableName);
         }
@@ -186,15 +201,23 @@ namespace AwsMock::Service {
         try {
 
             // Send request to docker container
-            Dto::DynamoDb::DynamoDbResponse response = SendDynamoDbRequest(request.body, request.headers);
-            putItemResponse = {.body = response.body, .headers = response.headers, .status = response.status};
+            if (_nativeEngine) {
+
+                // The native engine is the item store, no copy in the database
+                Dto::DynamoDb::DynamoDbResponse response = DynamoDbEngine::instance().PutItem(request.region, request.body);
+                putItemResponse = {.body = response.body, .headers = response.headers, .status = response.status};
 
-            // Convert to entity and save to database. If no exception is thrown by the HTTP call to the
-            // docker image, seems to be ok.
-            Database::Entity::DynamoDb::Item item = Dto::DynamoDb::Mapper::map(request);
-            item = _dynamoDbDatabase.CreateOrUpdateItem(item);
+            } else {
 
-            log_info << "DynamoDb put item, region: " << item.region << " tableName: " << item.tableName;
+                Dto::DynamoDb::DynamoDbResponse response = SendDynamoDbRequest(request.body, request.headers);
+                putItemResponse = {.body = response.body, .headers = response.headers, .status = response.status};
+
+                // Convert to entity and save to database. If no exception is thrown by the HTTP call to the
+                // docker image, seems to be ok.
+                Database::Entity::DynamoDb::Item item = Dto::DynamoDb::Mapper::map(request);
+                item = _dynamoDbDatabase.CreateOrUpdateItem(item);
+            }
+            log_info << "DynamoDb put item, region: " << request.region << " tableName: " << request.tableName;
 
         } catch (Poco::Exception &exc) {
             log_error << "DynamoDb put item failed, error: " << exc.message();
@@ -208,7 +231,7 @@ namespace AwsMock::Service {
         Core::MetricServiceTimer measure(DYNAMODB_SERVICE_TIMER, "method", "query");
         log_debug << "Start query, region: " << request.region << " name: " << request.tableName;
 
-        if (!_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
+        if (!_nativeEngine && !_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
             log_warning << "DynamoDb table does not exist, region: " << request.region << " name: " << request.tableName;
             throw Core::BadRequestException("DynamoDb table exists already, region: " + request.region + " name: " + request.tableName);
         }
@@ -217,7 +240,7 @@ namespace AwsMock::Service {
         try {
 
             // Send request to docker container
-            Dto::DynamoDb::DynamoDbResponse response = SendDynamoDbRequest(request.body, request.headers);
+            Dto::DynamoDb::DynamoDbResponse response = _nativeEngine ? DynamoDbEngine::instance().Query(request.region, request.body) : SendDynamoDbRequest(request.body, request.headers);
             queryResponse = {.body = response.body, .headers = response.headers, .status = response.status};
             log_info << "DynamoDb query item, name: " << request.tableName;
 
@@ -233,7 +256,7 @@ namespace AwsMock::Service {
         Core::MetricServiceTimer measure(DYNAMODB_SERVICE_TIMER, "method", "scan");
         log_debug << "Start scan, region: " << request.region << " name: " << request.tableName;
 
-        if (!_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
+        if (!_nativeEngine && !_dynamoDbDatabase.TableExists(request.region, request.tableName)) {
             log_warning << "DynamoDb table does not exist, region: " << request.region << " name: " << request.tableName;
             throw Core::BadRequestException("DynamoDb table exists already, region: " + request.region + " name: " + request.tableName);
         }
@@ -242,7 +265,7 @@ namespace AwsMock::Service {
         try {
 
             // Send request to docker container
-            Dto::DynamoDb::DynamoDbResponse response = SendDynamoDbRequest(request.body, request.headers);
+            Dto::DynamoDb::DynamoDbResponse response = _nativeEngine ? DynamoDbEngine::instance().Scan(request.region, request.body) : SendDynamoDbRequest(request.body, request.headers);
             scanResponse = {.body = response.body, .headers = response.headers, .status = response.status};
             log_info << "DynamoDb query item, name: " << request.tableName;
 
@@ -260,7 +283,7 @@ namespace AwsMock::Service {
 
         Database::Entity::DynamoDb::Item item = Dto::DynamoDb::Mapper::map(request);
 
-        if (!_dynamoDbDatabase.ItemExists(item)) {
+        if (!_nativeEngine && !_dynamoDbDatabase.ItemExists(item)) {
             log_warning << "DynamoDb item does not exist, region: " << request.region << " name: " << request.tableName;
             throw Core::BadRequestException("DynamoDb table exists already, region: " + request.region + " name: " + request.tableName);
         }
@@ -269,10 +292,12 @@ namespace AwsMock::Service {
         try {
 
             // Delete item in database
-            _dynamoDbDatabase.DeleteItem(request.region, request.tableName, "");
+            if (!_nativeEngine) {
+                _dynamoDbDatabase.DeleteItem(request.region, request.tableName, "");
+            }
 
             // Send request to docker container
-            Dto::DynamoDb::DynamoDbResponse response = SendDynamoDbRequest(request.body, request.headers);
+            Dto::DynamoDb::DynamoDbResponse response = _nativeEngine ? DynamoDbEngine::instance().DeleteItem(request.region, request.body) : SendDynamoDbRequest(request.body, request.headers);
             deleteItemResponse = {.body = response.body, .headers = response.headers, .status = response.status};
             log_info << "DynamoDb item deleted, table: " << request.tableName;
 
@@ -301,7 +326,7 @@ namespace AwsMock::Service {
     Dto::DynamoDb::DynamoDbResponse DynamoDbService::SendDynamoDbRequest(const std::string &body, const std::map<std::string, std::string> &headers) {
         log_debug << "Sending DynamoDB container request, endpoint: " << _dockerHost << ":" << _dockerPort;
 
-        Core::HttpSocketResponse response = Core::HttpSocket::SendJson(boost::beast::http::verb::post, _dockerHost, _dockerPort, "/", body, headers);
+        Core::HttpSocketResponse response = Core::HttpSocketPool::instance().SendJson(boost::beast::http::verb::post, _dockerHost, _dockerPort, "/", body, headers);
         if (response.statusCode != boost::beast::http::status::ok) {
             log_error << "HTTP error, status: " << response.statusCode << " body: " << response.body;
             throw Core::ServiceException("HTTP error, status: " + boost::lexical_cast<std::string>(response.statusCode) + " reason: " + response.body);
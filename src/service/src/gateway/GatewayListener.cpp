@@ -6,7 +6,7 @@
 
 namespace AwsMock::Service {
 
-    GatewayListener::GatewayListener(boost::asio::io_context &ioc, const boost::asio::ip::tcp::endpoint &endpoint) : ioc_(ioc), acceptor_(boost::asio::make_strand(ioc)) {
+    GatewayListener::GatewayListener(boost::asio::io_context &ioc, const boost::asio::ip::tcp::endpoint &endpoint, boost::asio::thread_pool *workerPool) : ioc_(ioc), acceptor_(boost::asio::make_strand(ioc)), _workerPool(workerPool) {
 
         boost::beast::error_code ec;
 
@@ -52,7 +52,7 @@ namespace AwsMock::Service {
             log_error << ec.message();
         } else {
             // Create the http session and run it
-            std::make_shared<GatewaySession>(std::move(socket))->Run();
+            std::make_shared<GatewaySession>(std::move(socket), _workerPool)->Run();
         }
 
         // Accept another connection
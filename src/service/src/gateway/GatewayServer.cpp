@@ -16,6 +16,7 @@ namespace AwsMock::Service {
         _maxQueueLength = configuration.getInt("awsmock.service.gateway.http.max.queue", GATEWAY_MAX_QUEUE);
         _maxThreads = configuration.getInt("awsmock.service.gateway.http.max.threads", GATEWAY_MAX_THREADS);
         _requestTimeout = configuration.getInt("awsmock.service.gateway.http.timeout", GATEWAY_TIMEOUT);
+        _workerThreads = configuration.getInt("awsmock.service.gateway.http.worker.threads", GATEWAY_WORKER_THREADS);
 
         // Sleeping period
         _period = configuration.getInt("awsmock.worker.gateway.period", 10000);
@@ -47,9 +48,15 @@ namespace AwsMock::Service {
         // The io_context is required for all I/O
         boost::asio::io_context ioc{_maxThreads};
 
+        // Handler worker pool, keeps blocking service calls off the IO threads
+        if (_workerThreads > 0) {
+            _workerPool = std::make_unique<boost::asio::thread_pool>(_workerThreads);
+            log_info << "Gateway handler worker pool started, threads: " << _workerThreads;
+        }
+
         // Create and launch a listening port
         auto address = ip::make_address(_address);
-        std::make_shared<GatewayListener>(ioc, ip::tcp::endpoint{address, _port})->Run();
+        std::make_shared<GatewayListener>(ioc, ip::tcp::endpoint{address, _port}, _workerPool.get())->Run();
 
         // Run the I/O service on the requested number of threads
         _threads.reserve(_maxThreads - 1);
@@ -62,6 +69,10 @@ namespace AwsMock::Service {
     }
 
     void GatewayServer::Shutdown() {
+        if (_workerPool) {
+            _workerPool->stop();
+            _workerPool->join();
+        }
         StopHttpServer();
     }
 
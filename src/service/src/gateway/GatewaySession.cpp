@@ -19,7 +19,7 @@ namespace AwsMock::Service {
             {"kms", std::make_shared<KMSHandler>()},
             {"dynamodb", std::make_shared<DynamoDbHandler>()}};
 
-    GatewaySession::GatewaySession(ip::tcp::socket &&socket) : stream_(std::move(socket)) {
+    GatewaySession::GatewaySession(ip::tcp::socket &&socket, boost::asio::thread_pool *workerPool) : stream_(std::move(socket)), _workerPool(workerPool) {
         Core::Configuration &configuration = Core::Configuration::instance();
         _queueLimit = configuration.getInt("awsmock.service.gateway.http.max.queue", DEFAULT_MAX_QUEUE_SIZE);
         _bodyLimit = configuration.getInt("awsmock.service.gateway.http.max.body", DEFAULT_MAX_BODY_SIZE);
@@ -43,10 +43,178 @@ namespace AwsMock::Service {
         // Set the timeout.
         stream_.expires_after(std::chrono::seconds(_timeout));
 
-        // Read a request using the parser-oriented interface
+        // Read the request header first, the handler decides how to read the body
+        http::async_read_header(stream_, buffer_, *_parser, boost::beast::bind_front_handler(&GatewaySession::OnReadHeader, this->shared_from_this()));
+    }
+
+    void GatewaySession::OnReadHeader(boost::beast::error_code ec, std::size_t bytes_transferred) {
+
+        boost::ignore_unused(bytes_transferred);
+
+        // This means they closed the connection
+        if (ec == http::error::end_of_stream)
+            return DoClose();
+
+        if (ec) {
+            log_error << ec.message();
+            return;
+        }
+
+        // Signature verification runs before the dispatch and hashes the payload of the in-memory request, therefore
+        // signed requests are read completely, if verification is enabled
+        if (!_verifySignature && _parser->get().method() == http::verb::put) {
+
+            http::request<http::dynamic_body> header(_parser->get().base());
+            Core::AuthorizationHeaderView authKey = GetAuthorizationKeys(header[http::field::authorization]);
+            auto it = _routingTable.find(authKey.module);
+            std::vector<std::string> hashAlgorithms;
+            std::string region(authKey.region);
+            if (it != _routingTable.end() && it->second->IsStreamingRequest(header, region, "none", hashAlgorithms)) {
+                return AcquireStreamPermit(it->second, std::move(header), region, hashAlgorithms);
+            }
+        }
+
+        // Read the rest of the message
         http::async_read(stream_, buffer_, *_parser, boost::beast::bind_front_handler(&GatewaySession::OnRead, this->shared_from_this()));
     }
 
+    void GatewaySession::AcquireStreamPermit(const std::shared_ptr<AbstractHandler> &handler, http::request<http::dynamic_body> &&header, const std::string &region, const std::vector<std::string> &hashAlgorithms) {
+
+        // Waiting for the permit may block, the body is read on the session strand again
+        auto acquire = [self = shared_from_this(), handler, header = std::move(header), region, hashAlgorithms]() {
+            std::shared_ptr<void> permit;
+            std::string error;
+            try {
+                permit = handler->AcquireStreamPermit(header, region, "none");
+            } catch (Poco::Exception &exc) {
+                error = exc.message();
+            } catch (std::exception &exc) {
+                error = exc.what();
+            }
+
+            boost::asio::post(self->stream_.get_executor(), [self, permit = std::move(permit), error, hashAlgorithms]() mutable {
+                if (!error.empty()) {
+
+                    // The body is not read, so the connection is closed after the response
+                    log_error << error;
+                    http::request<http::dynamic_body> request(self->_parser->release().base());
+                    http::response<http::dynamic_body> response = Core::HttpUtils::InternalServerError(request, error);
+                    response.keep_alive(false);
+                    return self->QueueWrite(std::move(response));
+                }
+
+                // The wait for the permit does not count against the body timeout
+                self->stream_.expires_after(std::chrono::seconds(self->_timeout));
+                self->_streamPermit = std::move(permit);
+                self->StartBodyStream(hashAlgorithms);
+            });
+        };
+
+        if (_workerPool) {
+            boost::asio::post(*_workerPool, std::move(acquire));
+            return;
+        }
+        acquire();
+    }
+
+    void GatewaySession::StartBodyStream(const std::vector<std::string> &hashAlgorithms) {
+
+        // Take over the header, the body goes to disk, so no body limit applies
+        _streamParser.emplace(std::move(*_parser));
+        _streamParser->body_limit(boost::none);
+
+        // Body file, on the same filesystem as the data directory, so it can be moved without copying
+        std::string tmpDir = Core::Configuration::instance().getString("awsmock.data.dir", DEFAULT_DATA_DIR) + "/tmp";
+        Core::DirUtils::EnsureDirectory(tmpDir);
+        _streamFile = tmpDir + "/" + Core::AwsUtils::CreateS3FileName();
+        _streamOfs.open(_streamFile, std::ios::binary | std::ios::trunc);
+        if (!_streamOfs) {
+            return AbortBodyStream("Could not open body file, file: " + _streamFile);
+        }
+        _streamBuffer.resize(DEFAULT_STREAM_CHUNK_SIZE);
+        _streamHashSink = std::make_shared<Core::HashSink>(hashAlgorithms);
+        log_debug << "Streaming request body, file: " << _streamFile;
+
+        DoReadBodyChunk();
+    }
+
+    void GatewaySession::DoReadBodyChunk() {
+        _streamParser->get().body().data = _streamBuffer.data();
+        _streamParser->get().body().size = _streamBuffer.size();
+        http::async_read(stream_, buffer_, *_streamParser, boost::beast::bind_front_handler(&GatewaySession::OnReadBodyChunk, this->shared_from_this()));
+    }
+
+    void GatewaySession::OnReadBodyChunk(boost::beast::error_code ec, std::size_t bytes_transferred) {
+
+        boost::ignore_unused(bytes_transferred);
+
+        // A full chunk buffer is reported as need_buffer
+        if (ec == http::error::need_buffer)
+            ec = {};
+
+        if (ec) {
+            log_error << ec.message();
+            _streamOfs.close();
+            Core::FileUtils::DeleteFile(_streamFile);
+            _streamPermit.reset();
+            return;
+        }
+
+        // Write the received part of the chunk buffer, the digests are computed from the same buffer
+        std::size_t count = _streamBuffer.size() - _streamParser->get().body().size;
+        _streamOfs.write(_streamBuffer.data(), static_cast<std::streamsize>(count));
+        if (!_streamOfs) {
+            return AbortBodyStream("Could not write body file, file: " + _streamFile);
+        }
+        _streamHashSink->Update(_streamBuffer.data(), count);
+        if (!_streamParser->is_done())
+            return DoReadBodyChunk();
+
+        _streamOfs.close();
+        if (!_streamOfs) {
+            return AbortBodyStream("Could not close body file, file: " + _streamFile);
+        }
+        log_debug << "Request body streamed, file: " << _streamFile;
+
+        // The handler gets the header, the body is in the file
+        http::request<http::dynamic_body> request(_streamParser->release().base());
+        _streamParser.reset();
+        _streamBuffer.clear();
+        _streamBuffer.shrink_to_fit();
+        std::shared_ptr<Core::HashSink> hashSink = std::move(_streamHashSink);
+        std::shared_ptr<void> permit = std::move(_streamPermit);
+
+        if (_workerPool) {
+            return DispatchRequest(std::move(request), _streamFile, hashSink, permit);
+        }
+
+        QueueWrite(HandleRequest(std::move(request), _streamFile, hashSink));
+        permit.reset();
+
+        if (response_queue_.size() < _queueLimit)
+            DoRead();
+    }
+
+    void GatewaySession::AbortBodyStream(const std::string &reason) {
+
+        log_error << reason;
+        _streamOfs.close();
+        _streamOfs.clear();
+        Core::FileUtils::DeleteFile(_streamFile);
+
+        // The rest of the body is not read anymore, so the connection is closed after the response
+        http::request<http::dynamic_body> request(_streamParser->release().base());
+        _streamParser.reset();
+        _streamBuffer.clear();
+        _streamBuffer.shrink_to_fit();
+        _streamHashSink.reset();
+        _streamPermit.reset();
+
+        http::response<http::dynamic_body> response = Core::HttpUtils::InternalServerError(request, reason);
+        response.keep_alive(false);
+        QueueWrite(std::move(response));
+    }
+
     void GatewaySession::OnRead(boost::beast::error_code ec, std::size_t bytes_transferred) {
 
         boost::ignore_unused(bytes_transferred);
@@ -60,14 +228,79 @@ namespace AwsMock::Service {
             return;
         }
 
+        // Hand over to the worker pool, reading is resumed, once the response is queued
+        if (_workerPool) {
+            return DispatchRequest(_parser->release());
+        }
+
+        // Long polling requests are parked, reading is resumed, once the response is queued
+        http::request<http::dynamic_body> request = _parser->release();
+        if (HandleAsyncRequest(request)) {
+            return;
+        }
+
         // Send the response
-        QueueWrite(HandleRequest(_parser->release()));
+        QueueWrite(HandleRequest(std::move(request)));
 
         // If we aren't at the queue limit, try to pipeline another request
         if (response_queue_.size() < _queueLimit)
             DoRead();
     }
 
+    void GatewaySession::DispatchRequest(http::request<http::dynamic_body> &&request, const std::string &bodyFile, const std::shared_ptr<Core::HashSink> &hashSink, const std::shared_ptr<void> &permit) {
+
+        boost::asio::post(*_workerPool, [self = shared_from_this(), request = std::move(request), bodyFile, hashSink, permit]() mutable {
+            // Long polling requests do not block the worker thread
+            if (bodyFile.empty() && self->HandleAsyncRequest(request)) {
+                return;
+            }
+
+            // Run the handler on the worker thread
+            http::message_generator response = self->HandleRequest(std::move(request), bodyFile, hashSink);
+            permit.reset();
+
+            // Back to the session strand for the write loop
+            boost::asio::post(self->stream_.get_executor(), [self, response = std::move(response)]() mutable {
+                self->QueueWrite(std::move(response));
+
+                // If we aren't at the queue limit, try to pipeline another request
+                if (self->response_queue_.size() < self->_queueLimit)
+                    self->DoRead();
+            });
+        });
+    }
+
+    bool GatewaySession::HandleAsyncRequest(const http::request<http::dynamic_body> &request) {
+
+        // Only POST requests are candidates, anything invalid is answered by HandleRequest()
+        if (request.method() != http::verb::post || (_verifySignature && !Core::AwsUtils::VerifySignature(request, "none"))) {
+            return false;
+        }
+
+        Core::AuthorizationHeaderView authKey = GetAuthorizationKeys(request[http::field::authorization]);
+        auto it = _routingTable.find(authKey.module);
+        if (it == _routingTable.end()) {
+            return false;
+        }
+
+        // The callback may run on any thread, the response goes back to the session strand for the write loop
+        bool handled = it->second->HandleAsyncPostRequest(request, std::string(authKey.region), "none", [self = shared_from_this()](http::response<http::dynamic_body> response) {
+            boost::asio::post(self->stream_.get_executor(), [self, response = std::move(response)]() mutable {
+                self->QueueWrite(std::move(response));
+
+                // If we aren't at the queue limit, try to pipeline another request
+                if (self->response_queue_.size() < self->_queueLimit)
+                    self->DoRead();
+            });
+        });
+
+        if (handled) {
+            log_debug << "Handle async POST request";
+            Core::MetricService::instance().IncrementCounter(GATEWAY_HTTP_COUNTER, "method", "POST");
+        }
+        return handled;
+    }
+
     void GatewaySession::QueueWrite(http::message_generator response) {
 
         // Allocate and store the work
@@ -83,7 +316,7 @@ namespace AwsMock::Service {
     // The concrete type of the response message (which depends on the
     // request), is type-erased in message_generator.
     template<class Body, class Allocator>
-    http::message_generator GatewaySession::HandleRequest(http::request<Body, http::basic_fields<Allocator>> &&request) {
+    http::message_generator GatewaySession::HandleRequest(http::request<Body, http::basic_fields<Allocator>> &&request, const std::string &bodyFile, const std::shared_ptr<Core::HashSink> &hashSink) {
 
         // Make sure we can handle the method
         if (request.method() != http::verb::get && request.method() != http::verb::put &&
@@ -103,41 +336,48 @@ namespace AwsMock::Service {
             return Core::HttpUtils::Unauthorized(request, "AWS signature could not be verified");
         }
 
-        Core::AuthorizationHeaderKeys authKey = GetAuthorizationKeys(request["Authorization"], {});
+        // Views into the authorization header, only valid as long as the request lives
+        Core::AuthorizationHeaderView authKey = GetAuthorizationKeys(request[http::field::authorization]);
+        std::string region(authKey.region);
 
-        std::shared_ptr<AbstractHandler> handler = _routingTable[authKey.module];
-        if (handler) {
+        // Lookup only, the routing table is shared by all IO and worker threads
+        auto it = _routingTable.find(authKey.module);
+        if (it != _routingTable.end()) {
+            std::shared_ptr<AbstractHandler> handler = it->second;
 
             switch (request.method()) {
                 case http::verb::get: {
                     log_debug << "Handle GET request";
                     Core::MetricServiceTimer getTimer(GATEWAY_HTTP_TIMER, "method", "GET");
                     Core::MetricService::instance().IncrementCounter(GATEWAY_HTTP_COUNTER, "method", "GET");
-                    return handler->HandleGetRequest(request, authKey.region, "none");
+                    return handler->HandleGetMessage(request, region, "none");
                 }
                 case http::verb::put: {
                     log_debug << "Handle PUT request";
                     Core::MetricServiceTimer putTimer(GATEWAY_HTTP_TIMER, "method", "PUT");
                     Core::MetricService::instance().IncrementCounter(GATEWAY_HTTP_COUNTER, "method", "PUT");
-                    return handler->HandlePutRequest(request, authKey.region, "none");
+                    if (!bodyFile.empty()) {
+                        return handler->HandlePutStreamRequest(request, bodyFile, *hashSink, region, "none");
+                    }
+                    return handler->HandlePutRequest(request, region, "none");
                 }
                 case http::verb::post: {
                     log_debug << "Handle POST request";
                     Core::MetricServiceTimer postTimer(GATEWAY_HTTP_TIMER, "method", "POST");
                     Core::MetricService::instance().IncrementCounter(GATEWAY_HTTP_COUNTER, "method", "POST");
-                    return handler->HandlePostRequest(request, authKey.region, "none");
+                    return handler->HandlePostRequest(request, region, "none");
                 }
                 case http::verb::delete_: {
                     log_debug << "Handle DELETE request";
                     Core::MetricServiceTimer deleteTimer(GATEWAY_HTTP_TIMER, "method", "DELETE");
                     Core::MetricService::instance().IncrementCounter(GATEWAY_HTTP_COUNTER, "method", "DELETE");
-                    return handler->HandleDeleteRequest(request, authKey.region, "none");
+                    return handler->HandleDeleteRequest(request, region, "none");
                 }
                 case http::verb::head: {
                     log_debug << "Handle HEAD request";
                     Core::MetricServiceTimer headTimer(GATEWAY_HTTP_TIMER, "method", "HEAD");
                     Core::MetricService::instance().IncrementCounter(GATEWAY_HTTP_COUNTER, "method", "HEAD");
-                    return handler->HandleHeadRequest(request, authKey.region, "none");
+                    return handler->HandleHeadRequest(request, region, "none");
                 }
             }
         }
@@ -184,33 +424,13 @@ namespace AwsMock::Service {
         // At this point the connection is closed gracefully
     }
 
-    Core::AuthorizationHeaderKeys GatewaySession::GetAuthorizationKeys(const std::string &authorizationHeader, const std::string &secretAccessKey) {
-
-        // Get signing version
-        Core::AuthorizationHeaderKeys authKeys;
-        authKeys.signingVersion = Core::StringUtils::Split(authorizationHeader, ' ')[0];
+    Core::AuthorizationHeaderView GatewaySession::GetAuthorizationKeys(boost::beast::string_view header) {
 
-        try {
-            Poco::RegularExpression::MatchVec posVec;
-            Poco::RegularExpression pattern(R"(Credential=([a-zA-Z0-9]+)\/([0-9]{8})\/([a-zA-Z0-9\-]+)\/([a-zA-Z0-9\-]+)\/(aws4_request),\ ?SignedHeaders=(.*),\ ?Signature=(.*)$)");
-            if (!pattern.match(authorizationHeader, 0, posVec)) {
-                log_error << "Could not extract authorization, authorization: " << authorizationHeader;
-                throw Core::UnauthorizedException("Could not extract authorization, authorization: " + authorizationHeader);
-            }
-            authKeys.secretAccessKey = secretAccessKey.empty() ? "none" : secretAccessKey;
-            authKeys.dateTime = authorizationHeader.substr(posVec[2].offset, posVec[2].length);
-            authKeys.region = authorizationHeader.substr(posVec[3].offset, posVec[3].length);
-            authKeys.module = authorizationHeader.substr(posVec[4].offset, posVec[4].length);
-            authKeys.requestVersion = authorizationHeader.substr(posVec[5].offset, posVec[5].length);
-            authKeys.signedHeaders = authorizationHeader.substr(posVec[6].offset, posVec[6].length);
-            authKeys.signature = authorizationHeader.substr(posVec[7].offset, posVec[7].length);
-            authKeys.scope = authKeys.dateTime + "/" + authKeys.region + "/" + authKeys.module + "/" + authKeys.requestVersion;
-            //authKeys.isoDateTime = request.has("x-amz-date") ? request.get("x-amz-date") : GetISODateString();
-            return authKeys;
-
-        } catch (Poco::Exception &e) {
-            log_error << e.message();
-        }
-        return {};
+        Core::AuthorizationHeaderView authKeys;
+        if (!Core::AwsUtils::ParseAuthorizationHeader(std::string_view(header.data(), header.size()), authKeys)) {
+            log_error << "Could not extract authorization, authorization: " << header;
+            return {};
+        }
+        return authKeys;
     }
 }// namespace AwsMock::Service
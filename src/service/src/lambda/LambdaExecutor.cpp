@@ -16,7 +16,7 @@ namespace AwsMock::Service {
         Database::LambdaDatabase::instance().SetInstanceStatus(containerId, Database::Entity::Lambda::InstanceRunning);
 
         // Send request to lambda docker container
-        Core::HttpSocketResponse response = Core::HttpSocket::SendJson(http::verb::post, host, port, "/2015-03-31/functions/function/invocations", payload, {});
+        Core::HttpSocketResponse response = Core::HttpSocketPool::instance().SendJson(http::verb::post, host, port, "/2015-03-31/functions/function/invocations", payload, {});
         if (response.statusCode != http::status::ok) {
             log_debug << "HTTP error, httpStatus: " << response.statusCode << " body: " << response.body;
             Database::LambdaDatabase::instance().SetInstanceStatus(containerId, Database::Entity::Lambda::InstanceFailed);
@@ -261,7 +261,7 @@ namespace AwsMock::Service {
         Core::MetricService::instance().IncrementCounter(LAMBDA_INVOCATION_COUNT);
         log_debug << "Sending lambda invocation request, endpoint: " << host << ":" << port;
 
-        Core::HttpSocketResponse response = Core::HttpSocket::SendJson(http::verb::post, host, port, "/", payload, {});
+        Core::HttpSocketResponse response = Core::HttpSocketPool::instance().SendJson(http::verb::post, host, port, "/", payload, {});
         if (response.statusCode != http::status::ok) {
             log_debug << "HTTP error, httpStatus: " << response.statusCode << " body: " << response.body;
         }
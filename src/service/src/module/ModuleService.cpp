@@ -129,12 +129,13 @@ namespace AwsMock::Service {
                 infrastructure.cognitoUserGroups = _cognitoDatabase.ListGroups();
                 infrastructure.cognitoUsers = _cognitoDatabase.ListUsers();
 
-            } else if (module.name == "dynanomdb") {
+            } else if (module.name == "dynamodb") {
 
+                // The native engine keeps the items itself, the tables are in the database for both engines
                 Database::DynamoDbDatabase &_dynamoDbDatabase = Database::DynamoDbDatabase::instance();
                 infrastructure.dynamoDbTables = _dynamoDbDatabase.ListTables();
                 if (includeObjects) {
-                    infrastructure.dynamoDbItems = _dynamoDbDatabase.ListItems();
+                    infrastructure.dynamoDbItems = DynamoDbEngine::IsActive() ? DynamoDbEngine::instance().ListItems() : _dynamoDbDatabase.ListItems();
                 }
 
             } else if (module.name == "secretsmanager") {
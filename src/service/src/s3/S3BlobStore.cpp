@@ -0,0 +1,125 @@
+//
+// Created by vogje01 on 6/23/24.
+//
+
+#include <awsmock/service/s3/S3BlobStore.h>
+
+namespace AwsMock::Service {
+
+    std::array<std::mutex, S3_BLOB_LOCK_COUNT> S3BlobStore::_mutexes;
+
+    bool S3BlobStore::IsActive() {
+        return Core::Configuration::instance().getBool("awsmock.service.s3.blob.store.active", false);
+    }
+
+    bool S3BlobStore::IsBlob(const std::string &internalName) {
+        return internalName.starts_with(S3_BLOB_DIR "/");
+    }
+
+    std::string S3BlobStore::Store(const std::string &fileName, const std::string &sha256) {
+
+        if (sha256.length() < 4) {
+            log_error << "Invalid blob hash, fileName: " << fileName << " hash: " << sha256;
+            throw Core::ServiceException("Invalid blob hash, fileName: " + fileName);
+        }
+
+        std::string dataS3Dir = GetDataS3Dir();
+        std::string filePath = dataS3Dir + Poco::Path::separator() + fileName;
+        std::string blobPath = dataS3Dir + Poco::Path::separator() + GetBlobName(sha256);
+        Core::DirUtils::EnsureDirectory(blobPath.substr(0, blobPath.find_last_of('/')));
+
+        std::scoped_lock lock(GetMutex(sha256));
+
+        // Same content is stored only once
+        if (Core::FileUtils::FileExists(blobPath)) {
+            Core::FileUtils::DeleteFile(filePath);
+            log_debug << "Blob exists already, hash: " << sha256;
+        } else if (rename(filePath.c_str(), blobPath.c_str()) != 0) {
+            log_error << "Could not store blob, fileName: " << fileName << " error: " << strerror(errno);
+            throw Core::ServiceException("Could not store blob, fileName: " + fileName + " error: " + strerror(errno));
+        }
+        return Link(blobPath, sha256);
+    }
+
+    std::string S3BlobStore::AddReference(const std::string &internalName) {
+
+        std::string sha256 = GetHash(internalName);
+        std::string blobPath = GetDataS3Dir() + Poco::Path::separator() + GetBlobName(sha256);
+
+        std::scoped_lock lock(GetMutex(sha256));
+
+        if (!Core::FileUtils::FileExists(blobPath)) {
+            log_error << "Blob does not exist, internalName: " << internalName;
+            throw Core::ServiceException("Blob does not exist, internalName: " + internalName);
+        }
+        return Link(blobPath, sha256);
+    }
+
+    void S3BlobStore::Release(const std::string &internalName) {
+
+        std::string sha256 = GetHash(internalName);
+        std::string dataS3Dir = GetDataS3Dir();
+        std::string referencePath = dataS3Dir + Poco::Path::separator() + internalName;
+        std::string blobPath = dataS3Dir + Poco::Path::separator() + GetBlobName(sha256);
+
+        std::scoped_lock lock(GetMutex(sha256));
+
+        Core::MemoryMappedFileCache::instance().RemoveFile(referencePath);
+        if (unlink(referencePath.c_str()) != 0 && errno != ENOENT) {
+            log_error << "Could not release blob reference, internalName: " << internalName << " error: " << strerror(errno);
+            return;
+        }
+
+        // Only the blob itself is left
+        struct stat st {};
+        if (stat(blobPath.c_str(), &st) == 0 && st.st_nlink <= 1) {
+            unlink(blobPath.c_str());
+            log_debug << "Blob deleted, hash: " << sha256;
+        }
+    }
+
+    long S3BlobStore::CountReferences(const std::string &internalName) {
+
+        std::string sha256 = GetHash(internalName);
+        std::string blobPath = GetDataS3Dir() + Poco::Path::separator() + GetBlobName(sha256);
+
+        std::scoped_lock lock(GetMutex(sha256));
+
+        struct stat st {};
+        if (stat(blobPath.c_str(), &st) != 0) {
+            return 0;
+        }
+        return static_cast<long>(st.st_nlink) - 1;
+    }
+
+    std::string S3BlobStore::GetDataS3Dir() {
+        std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir", "/home/awsmock/data");
+        return dataDir + Poco::Path::separator() + "s3";
+    }
+
+    std::string S3BlobStore::GetBlobName(const std::string &sha256) {
+        return std::string(S3_BLOB_DIR) + "/" + sha256.substr(0, 2) + "/" + sha256.substr(2, 2) + "/" + sha256;
+    }
+
+    std::string S3BlobStore::GetHash(const std::string &internalName) {
+        std::string referenceName = internalName.substr(internalName.find_last_of('/') + 1);
+        return referenceName.substr(0, referenceName.find('-'));
+    }
+
+    std::string S3BlobStore::Link(const std::string &blobPath, const std::string &sha256) {
+
+        std::string internalName = GetBlobName(sha256) + "-" + Core::StringUtils::GenerateRandomHexString(16);
+        std::string referencePath = GetDataS3Dir() + Poco::Path::separator() + internalName;
+        if (link(blobPath.c_str(), referencePath.c_str()) != 0) {
+            log_error << "Could not create blob reference, hash: " << sha256 << " error: " << strerror(errno);
+            throw Core::ServiceException("Could not create blob reference, hash: " + sha256 + " error: " + strerror(errno));
+        }
+        log_trace << "Blob reference created, internalName: " << internalName;
+        return internalName;
+    }
+
+    std::mutex &S3BlobStore::GetMutex(const std::string &sha256) {
+        return _mutexes[std::hash<std::string>{}(sha256) % S3_BLOB_LOCK_COUNT];
+    }
+
+}// namespace AwsMock::Service
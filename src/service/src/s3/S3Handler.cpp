@@ -23,44 +23,7 @@ namespace AwsMock::Service {
                 }
 
                 case Dto::Common::S3CommandType::LIST_OBJECTS: {
-                    Dto::S3::ListBucketRequest s3Request;
-
-                    if (Core::HttpUtils::HasQueryParameter(request.target(), "list-type")) {
-
-                        int listType = std::stoi(Core::HttpUtils::GetQueryParameterValueByName(request.target(), "list-type"));
-
-                        std::string delimiter;
-                        if (Core::HttpUtils::HasQueryParameter(request.target(), "delimiter")) {
-                            delimiter = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "delimiter");
-                        }
-
-                        std::string prefix;
-                        if (Core::HttpUtils::HasQueryParameter(request.target(), "prefix")) {
-                            prefix = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "prefix");
-                        }
-
-                        std::string encodingType = "url";
-                        if (Core::HttpUtils::HasQueryParameter(request.target(), "encoding_type")) {
-                            encodingType = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "encoding_type");
-                        }
-
-                        // Return object list
-                        s3Request = {
-                                .region = clientCommand.region,
-                                .name = clientCommand.bucket,
-                                .listType = listType,
-                                .prefix = prefix,
-                                .delimiter = delimiter,
-                                .encodingType = encodingType};
-
-                    } else {
-                        s3Request = {
-                                .region = clientCommand.region,
-                                .name = clientCommand.bucket,
-                                .listType = 1,
-                                .encodingType = "url"};
-                    }
-
+                    Dto::S3::ListBucketRequest s3Request = GetListBucketRequest(request, clientCommand);
                     Dto::S3::ListBucketResponse s3Response = _s3Service.ListBucket(s3Request);
 
                     log_info << "List objects, bucket: " << clientCommand.bucket;
@@ -69,50 +32,21 @@ namespace AwsMock::Service {
 
                 case Dto::Common::S3CommandType::GET_OBJECT: {
 
-                    // Get object request
-                    log_debug << "S3 get object request, bucket: " << clientCommand.bucket << " key: " << clientCommand.key;
-                    Dto::S3::GetObjectRequest s3Request = {
-                            .region = clientCommand.region,
-                            .bucket = clientCommand.bucket,
-                            .key = clientCommand.key};
-
-                    // Get version ID
-                    std::string versionId = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "versionId");
-                    if (!versionId.empty()) {
-                        s3Request.versionId = versionId;
-                    }
-
-                    // Get range
-                    long size;
-                    GetRange(request, s3Request.min, s3Request.max, size);
+                    // Range request, complete objects are served by HandleGetMessage()
+                    Dto::S3::GetObjectRequest s3Request = GetObjectRequest(request, clientCommand);
+                    long size = s3Request.max - s3Request.min + 1;
 
                     // Get object
                     Dto::S3::GetObjectResponse s3Response = _s3Service.GetObject(s3Request);
 
-                    std::map<std::string, std::string> headerMap;
-                    headerMap["ETag"] = Core::StringUtils::Quoted(s3Response.md5sum);
-                    headerMap["Content-Type"] = s3Response.contentType;
-                    headerMap["Last-Modified"] = Core::DateTimeUtils::HttpFormat(s3Response.modified);
-
-                    // Set user headers
-                    for (const auto &m: s3Response.metadata) {
-                        headerMap["x-amz-meta-" + m.first] = m.second;
-                    }
-
-                    if (Core::HttpUtils::HasHeader(request, "Range")) {
-                        headerMap["Accept-Ranges"] = "bytes";
-                        headerMap["Content-Range"] = "bytes " + std::to_string(s3Request.min) + "-" + std::to_string(s3Request.max) + "/" + std::to_string(s3Response.size);
-                        headerMap["Content-Length"] = std::to_string(size);
-                        log_info << "Multi-part download progress: " << std::to_string(s3Request.min) << "-" << std::to_string(s3Request.max) << "/" << std::to_string(s3Response.size);
-                        log_info << "Multi-part download request range, bucket: " << clientCommand.bucket << " key: " << clientCommand.key;
-
-                        return SendRangeResponse(request, s3Response.filename, s3Request.min, s3Request.max, size, s3Response.size, headerMap);
-
-                    } else {
+                    std::map<std::string, std::string> headerMap = GetObjectHeaders(s3Response);
+                    headerMap["Accept-Ranges"] = "bytes";
+                    headerMap["Content-Range"] = "bytes " + std::to_string(s3Request.min) + "-" + std::to_string(s3Request.max) + "/" + std::to_string(s3Response.size);
+                    headerMap["Content-Length"] = std::to_string(size);
+                    log_info << "Multi-part download progress: " << std::to_string(s3Request.min) << "-" << std::to_string(s3Request.max) << "/" << std::to_string(s3Response.size);
+                    log_info << "Multi-part download request range, bucket: " << clientCommand.bucket << " key: " << clientCommand.key;
 
-                        log_info << "Get object, bucket: " << clientCommand.bucket << " key: " << clientCommand.key;
-                        return SendOkResponse(request, s3Response.filename, s3Response.size, headerMap);
-                    }
+                    return SendRangeResponse(request, s3Response.filename, s3Request.min, s3Request.max, size, s3Response.size, headerMap);
                 }
 
                 case Dto::Common::S3CommandType::LIST_OBJECT_VERSIONS: {
@@ -124,13 +58,7 @@ namespace AwsMock::Service {
                     std::string encodingType = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "encoding-type");
                     std::string keyMarker = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "key-marker");
                     std::string versionIdMarker = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "version-id-marker");
-                    std::string sPageSize = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "max-keys");
-
-                    // Convert maxKeys
-                    int pageSize = 1000;
-                    if (!sPageSize.empty()) {
-                        pageSize = std::stoi(sPageSize);
-                    }
+                    int pageSize = GetIntParameter(request, "max-keys", 1000);
 
                     // Build request
                     Dto::S3::ListObjectVersionsRequest s3Request = {
@@ -152,44 +80,7 @@ namespace AwsMock::Service {
                     // Delete object (rm) with recursive option, issues first a list request
                 case Dto::Common::S3CommandType::DELETE_OBJECT: {
 
-                    Dto::S3::ListBucketRequest s3Request;
-
-                    if (Core::HttpUtils::HasQueryParameter(request.target(), "list-type")) {
-
-                        int listType = std::stoi(Core::HttpUtils::GetQueryParameterValueByName(request.target(), "list-type"));
-
-                        std::string delimiter;
-                        if (Core::HttpUtils::HasQueryParameter(request.target(), "delimiter")) {
-                            delimiter = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "delimiter");
-                        }
-
-                        std::string prefix;
-                        if (Core::HttpUtils::HasQueryParameter(request.target(), "prefix")) {
-                            prefix = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "prefix");
-                        }
-
-                        std::string encodingType = "url";
-                        if (Core::HttpUtils::HasQueryParameter(request.target(), "encoding_type")) {
-                            encodingType = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "encoding_type");
-                        }
-
-                        // Return object list
-                        s3Request = {
-                                .region = clientCommand.region,
-                                .name = clientCommand.bucket,
-                                .listType = listType,
-                                .prefix = prefix,
-                                .delimiter = delimiter,
-                                .encodingType = encodingType};
-
-                    } else {
-                        s3Request = {
-                                .region = clientCommand.region,
-                                .name = clientCommand.bucket,
-                                .listType = 1,
-                                .encodingType = "url"};
-                    }
-
+                    Dto::S3::ListBucketRequest s3Request = GetListBucketRequest(request, clientCommand);
                     Dto::S3::ListBucketResponse s3Response = _s3Service.ListBucket(s3Request);
                     log_info << "List objects, bucket: " << clientCommand.bucket;
                     return SendOkResponse(request, s3Response.ToXml());
@@ -215,6 +106,12 @@ namespace AwsMock::Service {
                     return SendBadRequestError(request, "Unknown method");
             }
 
+        } catch (Core::BadRequestException &exc) {
+            log_error << exc.message();
+            return SendBadRequestError(request, exc.message());
+        } catch (Core::NotFoundException &exc) {
+            log_error << exc.message();
+            return SendNotFoundError(request, exc.message());
         } catch (Poco::Exception &exc) {
             log_error << exc.message();
             return SendInternalServerError(request, exc.message());
@@ -225,6 +122,41 @@ namespace AwsMock::Service {
         return SendBadRequestError(request, "Unknown method");
     }
 
+    http::message_generator S3Handler::HandleGetMessage(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) {
+
+        Dto::Common::S3ClientCommand clientCommand;
+        clientCommand.FromRequest(request, region, user);
+
+        // Range requests and all other commands use the dynamic body
+        if (clientCommand.command != Dto::Common::S3CommandType::GET_OBJECT || Core::HttpUtils::HasHeader(request, "Range")) {
+            return HandleGetRequest(request, region, user);
+        }
+
+        try {
+
+            Dto::S3::GetObjectRequest s3Request = GetObjectRequest(request, clientCommand);
+
+            // Get object
+            Dto::S3::GetObjectResponse s3Response = _s3Service.GetObject(s3Request);
+
+            log_info << "Get object, bucket: " << clientCommand.bucket << " key: " << clientCommand.key;
+            return SendFileResponse(request, s3Response.filename, GetObjectHeaders(s3Response));
+
+        } catch (Core::ServiceException &exc) {
+            log_error << exc.message();
+            return SendInternalServerError(request, exc.message());
+        } catch (Core::NotFoundException &exc) {
+            log_error << exc.message();
+            return SendNotFoundError(request, exc.message());
+        } catch (Poco::Exception &exc) {
+            log_error << exc.message();
+            return SendInternalServerError(request, exc.message());
+        } catch (std::exception &exc) {
+            log_error << exc.what();
+            return SendInternalServerError(request, exc.what());
+        }
+    }
+
     http::response<http::dynamic_body> S3Handler::HandlePutRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) {
         Core::MetricServiceTimer measure(S3_SERVICE_TIMER);
         log_debug << "S3 PUT request, URI: " << request.target() << " region: " << region << " user: " << user;
@@ -343,7 +275,7 @@ namespace AwsMock::Service {
                     sb.commit(boost::beast::net::buffer_copy(sb.prepare(request.body().size()), request.body().cdata()));
                     std::istream stream(&sb);
 
-                    std::string eTag = _s3Service.UploadPart(stream, std::stoi(partNumber), uploadId);
+                    std::string eTag = _s3Service.UploadPart(stream, GetIntParameter(request, "partNumber", 0), uploadId);
                     stream.clear();
 
                     std::map<std::string, std::string> headerMap;
@@ -362,7 +294,7 @@ namespace AwsMock::Service {
                     Dto::S3::UploadPartCopyRequest s3Request;
                     s3Request.region = region;
                     s3Request.uploadId = uploadId;
-                    s3Request.partNumber = std::stoi(partNumber);
+                    s3Request.partNumber = GetIntParameter(request, "partNumber", 0);
                     s3Request.targetBucket = clientCommand.bucket;
                     s3Request.targetKey = clientCommand.key;
 
@@ -476,6 +408,12 @@ namespace AwsMock::Service {
         } catch (Core::JsonException &exc) {
             log_error << exc.message();
             return SendInternalServerError(request, exc.message());
+        } catch (Core::BadRequestException &exc) {
+            log_error << exc.message();
+            return SendBadRequestError(request, exc.message());
+        } catch (Core::NotFoundException &exc) {
+            log_error << exc.message();
+            return SendNotFoundError(request, exc.message());
         } catch (Poco::Exception &exc) {
             log_error << exc.message();
             return SendInternalServerError(request, exc.message());
@@ -486,6 +424,111 @@ namespace AwsMock::Service {
         return SendBadRequestError(request, "Unknown method");
     }
 
+    bool S3Handler::IsStreamingRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user, std::vector<std::string> &hashAlgorithms) {
+
+        // aws-chunked bodies contain the chunk signatures, which are stripped while reading the stream
+        if (Core::StringUtils::ContainsIgnoreCase(Core::HttpUtils::GetHeaderValue(request, "Content-Encoding"), "aws-chunked")) {
+            return false;
+        }
+
+        Dto::Common::S3ClientCommand clientCommand;
+        clientCommand.FromRequest(request, region, user);
+
+        if (clientCommand.command == Dto::Common::S3CommandType::PUT_OBJECT && !clientCommand.copyRequest) {
+            hashAlgorithms = S3Service::GetHashAlgorithms(Core::HttpUtils::GetHeaderValue(request, "x-amz-sdk-checksum-algorithm"));
+            return true;
+        }
+        if (clientCommand.command == Dto::Common::S3CommandType::UPLOAD_PART) {
+            hashAlgorithms = {"MD5"};
+            return true;
+        }
+        return false;
+    }
+
+    std::shared_ptr<void> S3Handler::AcquireStreamPermit(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) {
+
+        Dto::Common::S3ClientCommand clientCommand;
+        clientCommand.FromRequest(request, region, user);
+
+        if (clientCommand.command == Dto::Common::S3CommandType::UPLOAD_PART) {
+            return S3Service::AcquirePartPermit(Core::HttpUtils::GetQueryParameterValueByName(request.target(), "uploadId"));
+        }
+        return {};
+    }
+
+    http::response<http::dynamic_body> S3Handler::HandlePutStreamRequest(const http::request<http::dynamic_body> &request, const std::string &bodyFile, Core::HashSink &hashSink, const std::string &region, const std::string &user) {
+        Core::MetricServiceTimer measure(S3_SERVICE_TIMER);
+        log_debug << "S3 PUT stream request, URI: " << request.target() << " region: " << region << " user: " << user << " bodyFile: " << bodyFile;
+
+        Dto::Common::S3ClientCommand clientCommand;
+        clientCommand.FromRequest(request, region, user);
+
+        try {
+
+            switch (clientCommand.command) {
+
+                case Dto::Common::S3CommandType::PUT_OBJECT: {
+
+                    // S3 put object request
+                    Dto::S3::PutObjectRequest putObjectRequest = {
+                            .region = clientCommand.region,
+                            .bucket = clientCommand.bucket,
+                            .key = clientCommand.key,
+                            .owner = clientCommand.user,
+                            .md5Sum = request["Content-MD5"],
+                            .contentType = request["Content-Type"],
+                            .checksumAlgorithm = Core::HttpUtils::GetHeaderValue(request, "x-amz-sdk-checksum-algorithm"),
+                            .metadata = GetMetadata(request)};
+
+                    Dto::S3::PutObjectResponse putObjectResponse = _s3Service.PutObject(putObjectRequest, bodyFile, hashSink);
+
+                    log_info << "Put object, bucket: " << clientCommand.bucket << " key: " << clientCommand.key << " size: " << putObjectResponse.contentLength;
+                    return SendOkResponse(request);
+                }
+
+                case Dto::Common::S3CommandType::UPLOAD_PART: {
+
+                    std::string partNumber = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "partNumber");
+                    std::string uploadId = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "uploadId");
+                    log_debug << "S3 multipart upload part: " << partNumber << " bodyFile: " << bodyFile;
+
+                    std::string eTag = _s3Service.UploadPart(bodyFile, GetIntParameter(request, "partNumber", 0), uploadId, hashSink);
+
+                    std::map<std::string, std::string> headerMap;
+                    headerMap["ETag"] = Core::StringUtils::Quoted(eTag);
+                    log_debug << "Finished S3 multipart upload part: " << partNumber;
+
+                    return SendOkResponse(request, {}, headerMap);
+                }
+
+                default:
+                    Core::FileUtils::DeleteFile(bodyFile);
+                    return SendBadRequestError(request, "Unknown method");
+            }
+
+        } catch (Core::ServiceException &exc) {
+            log_error << exc.message();
+            Core::FileUtils::DeleteFile(bodyFile);
+            return SendInternalServerError(request, exc.message());
+        } catch (Core::BadRequestException &exc) {
+            log_error << exc.message();
+            Core::FileUtils::DeleteFile(bodyFile);
+            return SendBadRequestError(request, exc.message());
+        } catch (Core::NotFoundException &exc) {
+            log_error << exc.message();
+            Core::FileUtils::DeleteFile(bodyFile);
+            return SendNotFoundError(request, exc.message());
+        } catch (Poco::Exception &exc) {
+            log_error << exc.message();
+            Core::FileUtils::DeleteFile(bodyFile);
+            return SendInternalServerError(request, exc.message());
+        } catch (std::exception &exc) {
+            log_error << exc.what();
+            Core::FileUtils::DeleteFile(bodyFile);
+            return SendInternalServerError(request, exc.what());
+        }
+    }
+
     http::response<http::dynamic_body> S3Handler::HandlePostRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user) {
         log_debug << "S3 POST request, URI: " << request.target() << " region: " << region << " user: " << user;
 
@@ -513,6 +556,10 @@ namespace AwsMock::Service {
                         log_debug << "Finish multipart upload request, uploadId: " << uploadId;
 
                         Dto::S3::CompleteMultipartUploadRequest s3Request = {.region = clientCommand.region, .bucket = clientCommand.bucket, .key = clientCommand.key, .user = clientCommand.user, .uploadId = uploadId};
+                        const std::string &payload = Core::HttpUtils::GetBodyAsString(request);
+                        if (!payload.empty()) {
+                            s3Request.FromXml(payload);
+                        }
                         Dto::S3::CompleteMultipartUploadResult result = _s3Service.CompleteMultipartUpload(s3Request);
 
                         std::map<std::string, std::string> headers;
@@ -562,6 +609,10 @@ namespace AwsMock::Service {
                     //Core::HttpUtils::DumpHeaders(request);
                     std::string uploadId = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "uploadId");
                     Dto::S3::CompleteMultipartUploadRequest s3Request = {.region = clientCommand.region, .bucket = clientCommand.bucket, .key = clientCommand.key, .user = clientCommand.user, .uploadId = uploadId};
+                    const std::string &payload = Core::HttpUtils::GetBodyAsString(request);
+                    if (!payload.empty()) {
+                        s3Request.FromXml(payload);
+                    }
                     Dto::S3::CompleteMultipartUploadResult s3Response = _s3Service.CompleteMultipartUpload(s3Request);
 
                     std::map<std::string, std::string> headers;
@@ -604,6 +655,15 @@ namespace AwsMock::Service {
         } catch (Core::JsonException &exc) {
             log_error << exc.message();
             return SendInternalServerError(request, exc.message());
+        } catch (Core::BadRequestException &exc) {
+            log_error << exc.message();
+            return SendBadRequestError(request, exc.message());
+        } catch (Core::NotFoundException &exc) {
+            log_error << exc.message();
+            return SendNotFoundError(request, exc.message());
+        } catch (Poco::Exception &exc) {
+            log_error << exc.message();
+            return SendInternalServerError(request, exc.message());
         } catch (std::exception &exc) {
             log_error << exc.what();
             return SendInternalServerError(request, exc.what());
@@ -641,6 +701,9 @@ namespace AwsMock::Service {
 
                 case Dto::Common::S3CommandType::ABORT_MULTIPART_UPLOAD: {
 
+                    std::string uploadId = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "uploadId");
+                    _s3Service.AbortMultipartUpload(uploadId);
+
                     log_info << "Abort multipart upload request, bucket: " << clientCommand.bucket << " key: " << clientCommand.key;
                     return SendNoContentResponse(request);
                 }
@@ -675,6 +738,15 @@ namespace AwsMock::Service {
         } catch (Core::JsonException &exc) {
             log_error << exc.message();
             return SendInternalServerError(request, exc.message());
+        } catch (Core::BadRequestException &exc) {
+            log_error << exc.message();
+            return SendBadRequestError(request, exc.message());
+        } catch (Core::NotFoundException &exc) {
+            log_error << exc.message();
+            return SendNotFoundError(request, exc.message());
+        } catch (Poco::Exception &exc) {
+            log_error << exc.message();
+            return SendInternalServerError(request, exc.message());
         } catch (std::exception &exc) {
             log_error << exc.what();
             return SendInternalServerError(request, exc.what());
@@ -744,6 +816,73 @@ namespace AwsMock::Service {
         log_info << "Requested range: " << std::to_string(min) << "-" << std::to_string(max);
     }
 
+    Dto::S3::GetObjectRequest S3Handler::GetObjectRequest(const http::request<http::dynamic_body> &request, const Dto::Common::S3ClientCommand &clientCommand) {
+        log_debug << "S3 get object request, bucket: " << clientCommand.bucket << " key: " << clientCommand.key;
+
+        Dto::S3::GetObjectRequest s3Request = {
+                .region = clientCommand.region,
+                .bucket = clientCommand.bucket,
+                .key = clientCommand.key,
+                .min = 0,
+                .max = 0};
+
+        // Get version ID
+        std::string versionId = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "versionId");
+        if (!versionId.empty()) {
+            s3Request.versionId = versionId;
+        }
+
+        // Get range
+        long size = 0;
+        GetRange(request, s3Request.min, s3Request.max, size);
+        return s3Request;
+    }
+
+    int S3Handler::GetIntParameter(const http::request<http::dynamic_body> &request, const std::string &name, int defaultValue) {
+
+        std::string value = Core::HttpUtils::GetQueryParameterValueByName(request.target(), name);
+        if (value.empty()) {
+            return defaultValue;
+        }
+
+        // Non-negative and small enough for an int
+        if (!Core::StringUtils::IsNumeric(value) || value.length() > 9) {
+            log_error << "Invalid query parameter, name: " << name << " value: " << value;
+            throw Core::BadRequestException("Invalid query parameter, name: " + name + " value: " + value);
+        }
+        return std::stoi(value);
+    }
+
+    Dto::S3::ListBucketRequest S3Handler::GetListBucketRequest(const http::request<http::dynamic_body> &request, const Dto::Common::S3ClientCommand &clientCommand) {
+
+        Dto::S3::ListBucketRequest s3Request = {
+                .region = clientCommand.region,
+                .name = clientCommand.bucket,
+                .listType = 1,
+                .encodingType = "url"};
+
+        s3Request.listType = GetIntParameter(request, "list-type", 1);
+        if (Core::HttpUtils::HasQueryParameter(request.target(), "prefix")) {
+            s3Request.prefix = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "prefix");
+        }
+        if (Core::HttpUtils::HasQueryParameter(request.target(), "delimiter")) {
+            s3Request.delimiter = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "delimiter");
+        }
+        if (Core::HttpUtils::HasQueryParameter(request.target(), "encoding_type")) {
+            s3Request.encodingType = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "encoding_type");
+        }
+        s3Request.maxKeys = GetIntParameter(request, "max-keys", s3Request.maxKeys);
+
+        // List type 2 pages with continuation tokens, list type 1 with markers
+        if (s3Request.listType == 2) {
+            s3Request.continuationToken = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "continuation-token");
+            s3Request.startAfter = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "start-after");
+        } else {
+            s3Request.startAfter = Core::HttpUtils::GetQueryParameterValueByName(request.target(), "marker");
+        }
+        return s3Request;
+    }
+
     std::map<std::string, std::string> S3Handler::GetMetadata(const http::request<http::dynamic_body> &request) {
 
         std::map<std::string, std::string> metadata;
@@ -757,4 +896,18 @@ namespace AwsMock::Service {
         return metadata;
     }
 
+    std::map<std::string, std::string> S3Handler::GetObjectHeaders(const Dto::S3::GetObjectResponse &s3Response) {
+
+        std::map<std::string, std::string> headerMap;
+        headerMap["ETag"] = Core::StringUtils::Quoted(s3Response.md5sum);
+        headerMap["Content-Type"] = s3Response.contentType;
+        headerMap["Last-Modified"] = Core::DateTimeUtils::HttpFormat(s3Response.modified);
+
+        // Set user headers
+        for (const auto &m: s3Response.metadata) {
+            headerMap["x-amz-meta-" + m.first] = m.second;
+        }
+        return headerMap;
+    }
+
 }// namespace AwsMock::Service
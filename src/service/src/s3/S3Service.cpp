@@ -6,6 +6,8 @@
 
 namespace AwsMock::Service {
 
+    Core::KeyedSemaphore S3Service::_partSemaphore;
+
     bool S3Service::BucketExists(const std::string &region, const std::string &bucket) {
         return _database.BucketExists({.region = region, .name = bucket});
     }
@@ -189,11 +191,45 @@ namespace AwsMock::Service {
     Dto::S3::ListBucketResponse S3Service::ListBucket(const Dto::S3::ListBucketRequest &request) {
         log_trace << "List bucket request: " + request.ToString();
 
+        // The continuation token is the last key or common prefix of the previous page
+        std::string startAfter = request.startAfter;
+        if (!request.continuationToken.empty()) {
+            startAfter = DecodeContinuationToken(request.continuationToken);
+        }
+
         try {
 
-            Database::Entity::S3::ObjectList objectList = _database.ListBucket(request.name, request.prefix);
+            std::vector<std::string> commonPrefixes;
+            bool isTruncated = false;
+            long maxKeys = std::clamp(request.maxKeys, 0, 1000);
+            Database::Entity::S3::ObjectList objectList = _database.ListBucket(request.name, request.prefix, request.delimiter, startAfter, maxKeys, commonPrefixes, isTruncated);
+
             Dto::S3::ListBucketResponse listBucketResponse = Dto::S3::ListBucketResponse(request.name, objectList);
-            log_debug << "Bucket list returned, count: " << objectList.size();
+            listBucketResponse.prefix = request.prefix;
+            listBucketResponse.delimiter = request.delimiter;
+            listBucketResponse.maxKeys = static_cast<int>(maxKeys);
+            listBucketResponse.encodingType = request.encodingType;
+            listBucketResponse.continuationToken = request.continuationToken;
+            listBucketResponse.startAfter = request.startAfter;
+            listBucketResponse.isTruncated = isTruncated;
+            for (const auto &commonPrefix: commonPrefixes) {
+                listBucketResponse.commonPrefixes.push_back({._prefix = commonPrefix});
+            }
+            listBucketResponse.keyCount = static_cast<int>(objectList.size() + commonPrefixes.size());
+
+            // Keys and common prefixes are both in key order, the next page starts after the greater one
+            if (isTruncated) {
+                std::string last = objectList.empty() ? std::string() : objectList.back().key;
+                if (!commonPrefixes.empty() && commonPrefixes.back() > last) {
+                    last = commonPrefixes.back();
+                }
+                if (request.listType == 2) {
+                    listBucketResponse.nextContinuationToken = EncodeContinuationToken(last);
+                } else {
+                    listBucketResponse.nextMarker = last;
+                }
+            }
+            log_debug << "Bucket list returned, count: " << objectList.size() << " commonPrefixes: " << commonPrefixes.size() << " truncated: " << std::boolalpha << isTruncated;
 
             return listBucketResponse;
 
@@ -203,6 +239,25 @@ namespace AwsMock::Service {
         }
     }
 
+    std::string S3Service::EncodeContinuationToken(const std::string &key) {
+
+        return Core::Crypto::HexEncode(std::vector<unsigned char>(key.begin(), key.end()));
+    }
+
+    std::string S3Service::DecodeContinuationToken(const std::string &token) {
+
+        if (token.size() % 2 != 0 || token.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos) {
+            log_error << "Invalid continuation token, token: " << token;
+            throw Core::BadRequestException("Invalid continuation token");
+        }
+        std::string key;
+        key.reserve(token.size() / 2);
+        for (size_t i = 0; i < token.size(); i += 2) {
+            key.push_back(static_cast<char>(std::stoi(token.substr(i, 2), nullptr, 16)));
+        }
+        return key;
+    }
+
     void S3Service::PutBucketVersioning(const Dto::S3::PutBucketVersioningRequest &request) {
         log_trace << "Put bucket versioning request: " << request.ToString();
 
@@ -234,12 +289,13 @@ namespace AwsMock::Service {
         std::string uploadDir = GetMultipartUploadDirectory(uploadId);
         Core::DirUtils::EnsureDirectory(uploadDir);
 
-        // Create database object
-        Database::Entity::S3::Object object = _database.CreateOrUpdateObject(
+        // Create the upload manifest, the object is created, when the upload is completed
+        _database.CreateMultipartUpload(
                 {.region = request.region,
                  .bucket = request.bucket,
                  .key = request.key,
                  .owner = request.user,
+                 .uploadId = uploadId,
                  .metadata = request.metadata});
 
         log_info << "Multipart upload started, bucket: " << request.bucket << " key: " << request.key << " uploadId: " << uploadId;
@@ -249,17 +305,34 @@ namespace AwsMock::Service {
     std::string S3Service::UploadPart(std::istream &stream, int part, const std::string &uploadId) {
         log_trace << "UploadPart request, part: " << part << " updateId: " << uploadId;
 
-        std::string uploadDir = GetMultipartUploadDirectory(uploadId);
-        log_trace << "Using uploadDir: " << uploadDir;
+        std::shared_ptr<Core::KeyedSemaphore::Permit> permit = AcquirePartPermit(uploadId);
 
-        std::string fileName = uploadDir + Poco::Path::separator() + uploadId + "-" + std::to_string(part);
-        std::ofstream ofs(fileName, std::ios::binary);
-        std::copy(std::istream_iterator<unsigned char>(stream), std::istream_iterator<unsigned char>(), std::ostream_iterator<unsigned char>(ofs));
+        std::string fileName = GetPartFileName(uploadId, part);
+        Core::HashSink hashSink({"MD5"});
+        std::ofstream ofs(GetMultipartUploadDirectory(uploadId) + Poco::Path::separator() + fileName, std::ios::binary);
+        long size = hashSink.CopyStream(stream, ofs);
         ofs.close();
-        log_trace << "Part uploaded, part: " << part << " dir: " << uploadDir;
+        log_trace << "Part uploaded, part: " << part << " fileName: " << fileName << " size: " << size;
 
         // Get md5sum as ETag
-        std::string eTag = Core::Crypto::GetMd5FromFile(fileName);
+        std::string eTag = hashSink.GetHash("MD5");
+        AddMultipartPart(uploadId, {.partNumber = part, .size = size, .md5sum = eTag, .fileName = fileName});
+        log_info << "Upload part succeeded, part: " << part << " filename: " << fileName;
+        return eTag;
+    }
+
+    std::string S3Service::UploadPart(const std::string &bodyFile, int part, const std::string &uploadId, Core::HashSink &hashSink) {
+        log_trace << "UploadPart request, part: " << part << " updateId: " << uploadId << " bodyFile: " << bodyFile;
+
+        // The part permit has been acquired by the caller, before the body was streamed
+        std::string fileName = GetPartFileName(uploadId, part);
+        std::string partFile = GetMultipartUploadDirectory(uploadId) + Poco::Path::separator() + fileName;
+        Core::FileUtils::MoveTo(bodyFile, partFile, false);
+        log_trace << "Part uploaded, part: " << part << " fileName: " << fileName;
+
+        // Get md5sum as ETag
+        std::string eTag = hashSink.GetHash("MD5");
+        AddMultipartPart(uploadId, {.partNumber = part, .size = hashSink.GetSize(), .md5sum = eTag, .fileName = fileName});
         log_info << "Upload part succeeded, part: " << part << " filename: " << fileName;
         return eTag;
     }
@@ -267,27 +340,38 @@ namespace AwsMock::Service {
     Dto::S3::UploadPartCopyResponse S3Service::UploadPartCopy(const Dto::S3::UploadPartCopyRequest &request) {
         log_trace << "UploadPart copy request, part: " << request.partNumber << " updateId: " << request.uploadId;
 
+        std::shared_ptr<Core::KeyedSemaphore::Permit> permit = AcquirePartPermit(request.uploadId);
+
         std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir");
         std::string s3DataDir = dataDir + "/s3/";
         Database::Entity::S3::Object sourceObject = _database.GetObject(request.region, request.sourceBucket, request.sourceKey);
 
         std::string sourceFile = s3DataDir + sourceObject.internalName;
-        std::string uploadDir = GetMultipartUploadDirectory(request.uploadId);
-        log_trace << "Using uploadDir: " << uploadDir;
+        std::string fileName = GetPartFileName(request.uploadId, request.partNumber);
+        std::string destFile = GetMultipartUploadDirectory(request.uploadId) + Poco::Path::separator() + fileName;
 
         long start = request.min;
         long length = request.max - request.min + 1;
-        std::string destFile = uploadDir + Poco::Path::separator() + request.uploadId + "-" + std::to_string(request.partNumber);
-        int dest = open(destFile.c_str(), O_WRONLY | O_CREAT, 0644);
+        int dest = open(destFile.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
         int source = open(sourceFile.c_str(), O_RDONLY, 0);
-        long copied = sendfile(dest, source, &start, length);
+        long copied;
+        try {
+            copied = Core::FileUtils::CopyFileRange(source, start, dest, 0, length);
+        } catch (Core::CoreException &exc) {
+            close(source);
+            close(dest);
+            Core::FileUtils::DeleteFile(destFile);
+            log_error << "Upload part copy failed, part: " << request.partNumber << " error: " << exc.message();
+            throw;
+        }
         close(source);
         close(dest);
 
         // Get md5sum as ETag
         Dto::S3::UploadPartCopyResponse response;
         response.eTag = Core::Crypto::GetMd5FromFile(destFile);
-        log_info << "Upload part copy succeeded, part: " << request.partNumber << " filename: " << destFile << " length: " << length;
+        AddMultipartPart(request.uploadId, {.partNumber = request.partNumber, .size = copied, .md5sum = response.eTag, .fileName = fileName});
+        log_info << "Upload part copy succeeded, part: " << request.partNumber << " filename: " << destFile << " length: " << copied;
 
         return response;
     }
@@ -295,58 +379,120 @@ namespace AwsMock::Service {
     Dto::S3::CompleteMultipartUploadResult S3Service::CompleteMultipartUpload(const Dto::S3::CompleteMultipartUploadRequest &request) {
         log_trace << "CompleteMultipartUpload request, uploadId: " << request.uploadId << " bucket: " << request.bucket << " key: " << request.key << " region: " << request.region << " user: " << request.user;
 
+        Database::Entity::S3::MultipartUpload upload = _database.GetMultipartUpload(request.uploadId);
+        if (upload.uploadId.empty()) {
+            log_error << "Multipart upload does not exist, uploadId: " << request.uploadId;
+            throw Core::NotFoundException("Multipart upload does not exist, uploadId: " + request.uploadId);
+        }
+
+        // Parts of the object, either the listed parts in ascending order with matching ETags, or all uploaded parts
+        std::vector<Database::Entity::S3::MultipartPart> parts;
+        if (request.parts.empty()) {
+            for (const auto &[partNumber, part]: upload.parts) {
+                parts.emplace_back(part);
+            }
+        } else {
+            int previousPartNumber = 0;
+            for (const auto &completedPart: request.parts) {
+                if (completedPart.partNumber <= previousPartNumber) {
+                    log_error << "Invalid part order, part: " << completedPart.partNumber << " uploadId: " << request.uploadId;
+                    throw Core::BadRequestException("Invalid part order, part: " + std::to_string(completedPart.partNumber));
+                }
+                auto it = upload.parts.find(completedPart.partNumber);
+                if (it == upload.parts.end() || (!completedPart.eTag.empty() && completedPart.eTag != it->second.md5sum)) {
+                    log_error << "Invalid part, part: " << completedPart.partNumber << " eTag: " << completedPart.eTag << " uploadId: " << request.uploadId;
+                    throw Core::BadRequestException("Invalid part, part: " + std::to_string(completedPart.partNumber));
+                }
+                parts.emplace_back(it->second);
+                previousPartNumber = completedPart.partNumber;
+            }
+        }
+        if (parts.empty()) {
+            log_error << "Multipart upload has no parts, uploadId: " << request.uploadId;
+            throw Core::BadRequestException("Multipart upload has no parts, uploadId: " + request.uploadId);
+        }
+
         std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir", DEFAULT_DATA_DIR);
         std::string dataS3Dir = dataDir + Poco::Path::separator() + "s3";
         Core::DirUtils::EnsureDirectory(dataS3Dir);
 
-        // Get all file parts
-        std::string uploadDir = GetMultipartUploadDirectory(request.uploadId);
-        std::vector<std::string> files = Core::DirUtils::ListFilesByPrefix(uploadDir, request.uploadId);
-
         // Output file
+        std::string uploadDir = GetMultipartUploadDirectory(request.uploadId);
         std::string filename = Core::AwsUtils::CreateS3FileName();
         std::string outFile = dataS3Dir + Poco::Path::separator() + filename;
         log_debug << "Output file, outFile: " << outFile;
 
-        // Append all parts to the output file
+        // Append all parts to the output file, parts are cloned, if the filesystem supports reflinks
+        std::vector<std::string> files;
+        std::vector<std::string> partMd5Sums;
+        long expectedSize = 0;
+        for (const auto &part: parts) {
+            files.emplace_back(part.fileName);
+            partMd5Sums.emplace_back(part.md5sum);
+            expectedSize += part.size;
+        }
         long fileSize = 0;
         try {
 
             fileSize = Core::FileUtils::AppendBinaryFiles(outFile, uploadDir, files);
             log_debug << "Input files appended to outfile, outFile: " << outFile << " size: " << fileSize;
 
-        } catch (Poco::Exception &exc) {
+        } catch (Core::CoreException &exc) {
+            Core::FileUtils::DeleteFile(outFile);
             log_error << "Append to binary file failed, error: " << exc.message();
+            throw Core::ServiceException("Append to binary file failed, uploadId: " + request.uploadId);
+        }
+        if (fileSize != expectedSize) {
+            Core::FileUtils::DeleteFile(outFile);
+            log_error << "Multipart upload size mismatch, uploadId: " << request.uploadId << " expected: " << expectedSize << " actual: " << fileSize;
+            throw Core::ServiceException("Multipart upload size mismatch, uploadId: " + request.uploadId);
         }
 
-        // Get file size, MD5 sum
-        std::string md5sum = Core::Crypto::GetMd5FromFile(outFile);
-        log_debug << "Metadata, bucket: " << request.bucket << " key: " << request.key << " md5: " << md5sum;
+        // Multipart ETag from the part hashes, md5(concat(part md5s))-N
+        std::string md5sum = Core::Crypto::GetMultipartEtag(partMd5Sums);
+        log_debug << "Metadata, bucket: " << request.bucket << " key: " << request.key << " etag: " << md5sum;
 
-        // Update database object
-        Database::Entity::S3::Object object = _database.GetObject(request.region, request.bucket, request.key);
-        object.size = fileSize;
-        object.md5sum = md5sum;
-        object.internalName = filename;
-        object = _database.UpdateObject(object);
+        // The object is only read again, if a checksum was requested or the blob store is active
+        std::vector<std::string> algorithms = GetHashAlgorithms(request.checksumAlgorithm);
+        algorithms.erase(algorithms.begin());
+        Core::HashSink hashSink(algorithms);
+        if (!algorithms.empty()) {
+            hashSink.UpdateFromFile(outFile);
+        }
 
-        // Calculate the hashes asynchronously
-        if (!request.checksumAlgorithm.empty()) {
+        // Shared blob, if the blob store is active
+        Database::Entity::S3::Bucket bucket = _database.GetBucketByRegionName(upload.region, upload.bucket);
+        filename = StoreObjectFile(bucket, filename, hashSink);
 
-            S3HashCreator s3HashCreator;
-            std::vector<std::string> algorithms = {request.checksumAlgorithm};
-            boost::thread t(boost::ref(s3HashCreator), algorithms, object);
-            t.detach();
-            log_debug << "Checksums, bucket: " << request.bucket << " key: " << request.key << " sha1: " << object.sha1sum << " sha256: " << object.sha256sum;
+        // Create or update the database object, the file of an overwritten object is released
+        Database::Entity::S3::Object existingObject;
+        if (_database.ObjectExists({.region = upload.region, .bucket = upload.bucket, .key = upload.key})) {
+            existingObject = _database.GetObject(upload.region, upload.bucket, upload.key);
+        }
+        Database::Entity::S3::Object object = _database.CreateOrUpdateObject(
+                {.region = upload.region,
+                 .bucket = upload.bucket,
+                 .key = upload.key,
+                 .owner = upload.owner,
+                 .size = fileSize,
+                 .md5sum = md5sum,
+                 .sha1sum = hashSink.GetHash("SHA1"),
+                 .sha256sum = request.checksumAlgorithm == "SHA256" ? hashSink.GetHash("SHA256") : std::string{},
+                 .metadata = upload.metadata,
+                 .internalName = filename});
+        if (!existingObject.internalName.empty() && existingObject.internalName != object.internalName) {
+            DeleteObjectFile(existingObject.internalName);
         }
+        log_debug << "Checksums, bucket: " << request.bucket << " key: " << request.key << " sha1: " << object.sha1sum << " sha256: " << object.sha256sum;
 
         // Cleanup
         Core::DirUtils::DeleteDirectory(uploadDir);
+        _database.DeleteMultipartUpload(request.uploadId);
 
         // Check notifications
         CheckNotifications(request.region, request.bucket, request.key, object.size, "ObjectCreated");
 
-        log_info << "Multipart upload finished, bucket: " << request.bucket << " key: " << request.key;
+        log_info << "Multipart upload finished, bucket: " << request.bucket << " key: " << request.key << " parts: " << parts.size();
         return {
                 .location = request.region,
                 .bucket = request.bucket,
@@ -355,6 +501,20 @@ namespace AwsMock::Service {
                 .md5sum = md5sum};
     }
 
+    void S3Service::AbortMultipartUpload(const std::string &uploadId) {
+        log_trace << "AbortMultipartUpload request, uploadId: " << uploadId;
+
+        Database::Entity::S3::MultipartUpload upload = _database.GetMultipartUpload(uploadId);
+        if (upload.uploadId.empty()) {
+            log_error << "Multipart upload does not exist, uploadId: " << uploadId;
+            throw Core::NotFoundException("Multipart upload does not exist, uploadId: " + uploadId);
+        }
+
+        Core::DirUtils::DeleteDirectory(GetMultipartUploadDirectory(uploadId));
+        _database.DeleteMultipartUpload(uploadId);
+        log_info << "Multipart upload aborted, bucket: " << upload.bucket << " key: " << upload.key << " uploadId: " << uploadId;
+    }
+
     Dto::S3::PutObjectResponse S3Service::PutObject(Dto::S3::PutObjectRequest &request, std::istream &stream, bool chunkEncoding) {
         log_trace << "Put object request: " << request.ToString();
 
@@ -368,10 +528,48 @@ namespace AwsMock::Service {
             // Get bucket
             Database::Entity::S3::Bucket bucket = _database.GetBucketByRegionName(request.region, request.bucket);
 
+            // Write file, hashing while writing
+            Core::HashSink hashSink(GetHashAlgorithms(request.checksumAlgorithm));
+            std::string fileName = WriteObjectFile(stream, chunkEncoding, hashSink);
+
+            if (bucket.IsVersioned()) {
+                return SaveVersionedObject(request, bucket, fileName, hashSink);
+            } else {
+                return SaveUnversionedObject(request, bucket, fileName, hashSink);
+            }
+
+        } catch (Poco::Exception &ex) {
+            log_error << "S3 put object failed, message: " << ex.what() << " key: " << request.key;
+            throw Core::ServiceException(ex.message());
+        }
+    }
+
+    Dto::S3::PutObjectResponse S3Service::PutObject(Dto::S3::PutObjectRequest &request, const std::string &bodyFile, Core::HashSink &hashSink) {
+        log_trace << "Put object request: " << request.ToString() << " bodyFile: " << bodyFile;
+
+        // Check existence
+        if (!_database.BucketExists({.region = request.region, .name = request.bucket})) {
+            log_error << "Bucket does not exist, region: " << request.region + " bucket: " << request.bucket;
+            throw Core::NotFoundException("Bucket does not exist");
+        }
+
+        try {
+            // Get bucket
+            Database::Entity::S3::Bucket bucket = _database.GetBucketByRegionName(request.region, request.bucket);
+
+            // Move the streamed body into the data directory
+            std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir", DEFAULT_DATA_DIR);
+            std::string dataS3Dir = dataDir + Poco::Path::separator() + "s3";
+            Core::DirUtils::EnsureDirectory(dataS3Dir);
+
+            std::string fileName = Core::AwsUtils::CreateS3FileName();
+            std::string filePath = dataS3Dir + Poco::Path::separator() + fileName;
+            Core::FileUtils::MoveTo(bodyFile, filePath);
+
             if (bucket.IsVersioned()) {
-                return SaveVersionedObject(request, bucket, stream, chunkEncoding);
+                return SaveVersionedObject(request, bucket, fileName, hashSink);
             } else {
-                return SaveUnversionedObject(request, bucket, stream, chunkEncoding);
+                return SaveUnversionedObject(request, bucket, fileName, hashSink);
             }
 
         } catch (Poco::Exception &ex) {
@@ -413,11 +611,16 @@ namespace AwsMock::Service {
             Database::Entity::S3::Bucket targetBucket = _database.GetBucketByRegionName(request.region, request.targetBucket);
             sourceObject = _database.GetObject(request.region, request.sourceBucket, request.sourceKey);
 
-            // Copy physical file
-            std::string targetFile = Core::AwsUtils::CreateS3FileName();
-            std::string sourcePath = dataS3Dir + Poco::Path::separator() + sourceObject.internalName;
-            std::string targetPath = dataS3Dir + Poco::Path::separator() + targetFile;
-            Core::FileUtils::CopyTo(sourcePath, targetPath);
+            // Copy physical file, blobs only get a new reference
+            std::string targetFile;
+            if (S3BlobStore::IsBlob(sourceObject.internalName)) {
+                targetFile = S3BlobStore::AddReference(sourceObject.internalName);
+            } else {
+                targetFile = Core::AwsUtils::CreateS3FileName();
+                std::string sourcePath = dataS3Dir + Poco::Path::separator() + sourceObject.internalName;
+                std::string targetPath = dataS3Dir + Poco::Path::separator() + targetFile;
+                Core::FileUtils::CopyTo(sourcePath, targetPath);
+            }
 
             // Update database
             targetObject = {
@@ -489,11 +692,16 @@ namespace AwsMock::Service {
             Database::Entity::S3::Bucket targetBucket = _database.GetBucketByRegionName(request.region, request.targetBucket);
             sourceObject = _database.GetObject(request.region, request.sourceBucket, request.sourceKey);
 
-            // Copy physical file
-            std::string targetFile = Core::AwsUtils::CreateS3FileName();
-            std::string sourcePath = dataS3Dir + Poco::Path::separator() + sourceObject.internalName;
-            std::string targetPath = dataS3Dir + Poco::Path::separator() + targetFile;
-            Core::FileUtils::CopyTo(sourcePath, targetPath);
+            // Copy physical file, blobs only get a new reference
+            std::string targetFile;
+            if (S3BlobStore::IsBlob(sourceObject.internalName)) {
+                targetFile = S3BlobStore::AddReference(sourceObject.internalName);
+            } else {
+                targetFile = Core::AwsUtils::CreateS3FileName();
+                std::string sourcePath = dataS3Dir + Poco::Path::separator() + sourceObject.internalName;
+                std::string targetPath = dataS3Dir + Poco::Path::separator() + targetFile;
+                Core::FileUtils::CopyTo(sourcePath, targetPath);
+            }
 
             // Update database
             targetObject = {
@@ -853,18 +1061,39 @@ namespace AwsMock::Service {
         Core::DirUtils::EnsureDirectory(dataS3Dir);
         Core::DirUtils::EnsureDirectory(transferDir);
 
-        std::string filename = dataS3Dir + Poco::Path::separator() + internalName;
-        Core::FileUtils::DeleteFile(filename);
-        log_debug << "File system object deleted, filename: " << filename;
+        DeleteObjectFile(internalName);
 
         std::string transferBucket = Core::Configuration::instance().getString("awsmock.service.transfer.bucket", DEFAULT_TRANSFER_BUCKET_NAME);
         if (bucket == transferBucket) {
-            filename = transferDir + Poco::Path::separator() + key;
+            std::string filename = transferDir + Poco::Path::separator() + key;
             Core::FileUtils::DeleteFile(filename);
             log_debug << "Transfer file system object deleted, filename: " << filename;
         }
     }
 
+    void S3Service::DeleteObjectFile(const std::string &internalName) {
+
+        if (S3BlobStore::IsBlob(internalName)) {
+            S3BlobStore::Release(internalName);
+            log_debug << "Blob reference released, internalName: " << internalName;
+            return;
+        }
+
+        std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir", DEFAULT_DATA_DIR);
+        std::string filename = dataDir + Poco::Path::separator() + "s3" + Poco::Path::separator() + internalName;
+        Core::MemoryMappedFileCache::instance().RemoveFile(filename);
+        Core::FileUtils::DeleteFile(filename);
+        log_debug << "File system object deleted, filename: " << filename;
+    }
+
+    std::string S3Service::StoreObjectFile(const Database::Entity::S3::Bucket &bucket, const std::string &fileName, Core::HashSink &hashSink) {
+
+        if (!S3BlobStore::IsActive() || bucket.HasEncryption()) {
+            return fileName;
+        }
+        return S3BlobStore::Store(fileName, hashSink.GetHash("SHA256"));
+    }
+
     void S3Service::DeleteBucket(const std::string &name) {
 
         std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir", DEFAULT_DATA_DIR);
@@ -885,6 +1114,57 @@ namespace AwsMock::Service {
         return tempDir + Poco::Path::separator() + uploadId;
     }
 
+    std::string S3Service::GetPartFileName(const std::string &uploadId, int part) {
+
+        if (part < 1 || part > S3_MAX_MULTIPART_PARTS) {
+            log_error << "Invalid part number, part: " << part << " uploadId: " << uploadId;
+            throw Core::BadRequestException("Invalid part number, part: " + std::to_string(part));
+        }
+        if (!Core::DirUtils::DirectoryExists(GetMultipartUploadDirectory(uploadId))) {
+            log_error << "Multipart upload does not exist, uploadId: " << uploadId;
+            throw Core::NotFoundException("Multipart upload does not exist, uploadId: " + uploadId);
+        }
+
+        // Each attempt gets its own file, so that a retried part never overwrites a part, which is still being written
+        return "part-" + std::to_string(part) + "-" + Core::StringUtils::GenerateRandomHexString(8);
+    }
+
+    void S3Service::AddMultipartPart(const std::string &uploadId, const Database::Entity::S3::MultipartPart &part) {
+
+        std::string uploadDir = GetMultipartUploadDirectory(uploadId);
+        try {
+
+            Database::Entity::S3::MultipartPart replaced = _database.AddMultipartPart(uploadId, part);
+            if (!replaced.fileName.empty()) {
+                Core::FileUtils::DeleteFile(uploadDir + Poco::Path::separator() + replaced.fileName);
+                log_debug << "Part replaced, part: " << part.partNumber << " uploadId: " << uploadId;
+            }
+
+        } catch (Core::DatabaseException &exc) {
+            Core::FileUtils::DeleteFile(uploadDir + Poco::Path::separator() + part.fileName);
+            log_error << "Add part failed, part: " << part.partNumber << " uploadId: " << uploadId << " error: " << exc.message();
+            throw Core::NotFoundException("Multipart upload does not exist, uploadId: " + uploadId);
+        }
+    }
+
+    std::shared_ptr<Core::KeyedSemaphore::Permit> S3Service::AcquirePartPermit(const std::string &uploadId) {
+
+        auto permit = std::make_shared<Core::KeyedSemaphore::Permit>(_partSemaphore, uploadId, GetMultipartConcurrency(), GetMultipartTimeout());
+        if (!*permit) {
+            log_error << "Too many concurrent parts, uploadId: " << uploadId;
+            throw Core::ServiceException("Too many concurrent parts, uploadId: " + uploadId);
+        }
+        return permit;
+    }
+
+    int S3Service::GetMultipartConcurrency() {
+        return Core::Configuration::instance().getInt("awsmock.service.s3.multipart.concurrency", S3_DEFAULT_MULTIPART_CONCURRENCY);
+    }
+
+    std::chrono::milliseconds S3Service::GetMultipartTimeout() {
+        return std::chrono::seconds(Core::Configuration::instance().getInt("awsmock.service.s3.multipart.timeout", S3_DEFAULT_MULTIPART_TIMEOUT));
+    }
+
     void S3Service::SendQueueNotificationRequest(const Dto::S3::EventNotification &eventNotification, const Database::Entity::S3::QueueNotification &queueNotification) {
 
         std::string region = Core::Configuration::instance().getString("awsmock.region", DEFAULT_REGION);
@@ -921,7 +1201,18 @@ namespace AwsMock::Service {
         log_debug << "Lambda invocation finished send";
     }
 
-    Dto::S3::PutObjectResponse S3Service::SaveUnversionedObject(Dto::S3::PutObjectRequest &request, const Database::Entity::S3::Bucket &bucket, std::istream &stream, bool chunkEncoding) {
+    std::vector<std::string> S3Service::GetHashAlgorithms(const std::string &checksumAlgorithm) {
+        std::vector<std::string> algorithms = {"MD5"};
+        if (!checksumAlgorithm.empty() && checksumAlgorithm != "MD5") {
+            algorithms.emplace_back(checksumAlgorithm);
+        }
+        if (S3BlobStore::IsActive() && checksumAlgorithm != "SHA256") {
+            algorithms.emplace_back("SHA256");
+        }
+        return algorithms;
+    }
+
+    std::string S3Service::WriteObjectFile(std::istream &stream, bool chunkEncoding, Core::HashSink &hashSink) {
 
         std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir", DEFAULT_DATA_DIR);
         std::string dataS3Dir = dataDir + Poco::Path::separator() + "s3";
@@ -937,20 +1228,27 @@ namespace AwsMock::Service {
             getline(stream, firstLine);
             int size = Core::NumberUtils::HexToInt(Core::StringUtils::StripLineEndings(firstLine));
 
-            char buffer[size];
-            stream.readsome(buffer, size);
-            buffer[size] = '\0';
+            std::vector<char> buffer(size);
+            std::streamsize count = stream.readsome(buffer.data(), size);
 
             std::ofstream ofs(filePath, std::ios::binary | std::ios::trunc);
-            ofs << buffer;
+            hashSink.Update(buffer.data(), count);
+            ofs.write(buffer.data(), count);
             ofs.close();
 
         } else {
 
             std::ofstream ofs(filePath, std::ios::binary | std::ios::trunc);
-            ofs << stream.rdbuf();
+            hashSink.CopyStream(stream, ofs);
             ofs.close();
         }
+        return fileName;
+    }
+
+    Dto::S3::PutObjectResponse S3Service::SaveUnversionedObject(Dto::S3::PutObjectRequest &request, const Database::Entity::S3::Bucket &bucket, const std::string &fileName, Core::HashSink &hashSink) {
+
+        std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir", DEFAULT_DATA_DIR);
+        std::string filePath = dataDir + Poco::Path::separator() + "s3" + Poco::Path::separator() + fileName;
 
         long size = Core::FileUtils::FileSize(filePath);
         log_debug << "File received, fileName: " << filePath << " size: " << size;
@@ -968,19 +1266,23 @@ namespace AwsMock::Service {
                 .internalName = fileName};
 
         // Meta data
-        object.md5sum = Core::Crypto::GetMd5FromFile(filePath);
-        log_debug << "Checksum, bucket: " << request.bucket << " key: " << request.key << " md5: " << object.md5sum;
-        if (!request.checksumAlgorithm.empty()) {
-            S3HashCreator s3HashCreator;
-            std::vector<std::string> algorithms = {request.checksumAlgorithm};
-            boost::thread t(boost::ref(s3HashCreator), algorithms, object);
-            t.detach();
-            //Core::TaskPool::instance().Add<std::string, S3HashCreator>("s3-hashing", S3HashCreator({request.checksumAlgorithm}, object));
-            log_debug << "Checksums, bucket: " << request.bucket << " key: " << request.key << " sha1: " << object.sha1sum << " sha256: " << object.sha256sum;
+        object.md5sum = hashSink.GetHash("MD5");
+        object.sha1sum = hashSink.GetHash("SHA1");
+        object.sha256sum = request.checksumAlgorithm == "SHA256" ? hashSink.GetHash("SHA256") : std::string{};
+        log_debug << "Checksums, bucket: " << request.bucket << " key: " << request.key << " md5: " << object.md5sum << " sha1: " << object.sha1sum << " sha256: " << object.sha256sum;
+
+        // Shared blob, if the blob store is active
+        object.internalName = StoreObjectFile(bucket, fileName, hashSink);
+
+        // Update database, the file of an overwritten object is released
+        Database::Entity::S3::Object existingObject;
+        if (_database.ObjectExists(object)) {
+            existingObject = _database.GetObject(request.region, request.bucket, request.key);
         }
-
-        // Update database
         object = _database.CreateOrUpdateObject(object);
+        if (!existingObject.internalName.empty() && existingObject.internalName != object.internalName) {
+            DeleteObjectFile(existingObject.internalName);
+        }
         log_debug << "Database updated, bucket: " << object.bucket << " key: " << object.key;
 
         // Check encryption
@@ -1002,19 +1304,9 @@ namespace AwsMock::Service {
                 .metadata = request.metadata};
     }
 
-    Dto::S3::PutObjectResponse S3Service::SaveVersionedObject(Dto::S3::PutObjectRequest &request, const Database::Entity::S3::Bucket &bucket, std::istream &stream, bool chunkEncoding) {
+    Dto::S3::PutObjectResponse S3Service::SaveVersionedObject(Dto::S3::PutObjectRequest &request, const Database::Entity::S3::Bucket &bucket, const std::string &fileName, Core::HashSink &hashSink) {
         std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir", DEFAULT_DATA_DIR);
-        std::string dataS3Dir = dataDir + Poco::Path::separator() + "s3";
-        Core::DirUtils::EnsureDirectory(dataS3Dir);
-
-        // Write file
-        std::string fileName = Core::AwsUtils::CreateS3FileName();
-        std::string filePath = dataS3Dir + Poco::Path::separator() + fileName;
-
-        std::ofstream ofs(filePath, std::ios::out | std::ios::trunc | std::ios::binary);
-        ofs << stream.rdbuf();
-        //long size = Poco::StreamCopier::copyStream(stream, ofs);
-        ofs.close();
+        std::string filePath = dataDir + Poco::Path::separator() + "s3" + Poco::Path::separator() + fileName;
 
         // Get size
         long size = Core::FileUtils::FileSize(filePath);
@@ -1044,23 +1336,18 @@ namespace AwsMock::Service {
             };
 
             // Checksums
-            object.md5sum = Core::Crypto::GetMd5FromFile(filePath);
-            log_debug << "Checksum, bucket: " << request.bucket << " key: " << request.key << " md5: " << object.md5sum;
+            object.md5sum = hashSink.GetHash("MD5");
+            object.sha1sum = hashSink.GetHash("SHA1");
+            object.sha256sum = request.checksumAlgorithm == "SHA256" ? hashSink.GetHash("SHA256") : std::string{};
+            log_debug << "Checksums, bucket: " << request.bucket << " key: " << request.key << " md5: " << object.md5sum << " sha1: " << object.sha1sum << " sha256: " << object.sha256sum;
+
+            // Shared blob, if the blob store is active
+            object.internalName = StoreObjectFile(bucket, fileName, hashSink);
 
             // Create new version in database
             object = _database.CreateObject(object);
             log_debug << "Database updated, bucket: " << object.bucket << " key: " << object.key;
 
-            // Checksums
-            if (!request.checksumAlgorithm.empty()) {
-                S3HashCreator s3HashCreator;
-                std::vector<std::string> algorithms = {request.checksumAlgorithm};
-                boost::thread t(boost::ref(s3HashCreator), algorithms, object);
-                t.detach();
-                //Core::TaskPool::instance().Add<std::string, S3HashCreator>("s3-hashing", S3HashCreator({request.checksumAlgorithm}, object));
-                log_debug << "Checksums, bucket: " << request.bucket << " key: " << request.key << " sha1: " << object.sha1sum << " sha256: " << object.sha256sum;
-            }
-
             // Check encryption
             CheckEncryption(bucket, object);
             log_info << "Put object succeeded, bucket: " << request.bucket << " key: " << request.key;
@@ -1075,17 +1362,11 @@ namespace AwsMock::Service {
             Core::FileUtils::DeleteFile(filePath);
         }
 
-        // Meta data
-        object.md5sum = Core::Crypto::GetMd5FromFile(filePath);
-        log_info << "Checksum, bucket: " << request.bucket << " key: " << request.key << "md5: " << object.md5sum;
-        if (request.checksumAlgorithm == "SHA1") {
-            object.sha1sum = Core::Crypto::GetSha1FromFile(filePath);
-            log_debug << "Checksum SHA1, bucket: " << request.bucket << " key: " << request.key << " sha1: " << object.sha1sum;
-        }
-        if (request.checksumAlgorithm == "SHA256") {
-            object.sha256sum = Core::Crypto::GetSha256FromFile(filePath);
-            log_debug << "Checksum SHA256, bucket: " << request.bucket << " key: " << request.key << " sha256: " << object.sha256sum;
-        }
+        // Meta data, computed while the file was written
+        object.md5sum = hashSink.GetHash("MD5");
+        object.sha1sum = hashSink.GetHash("SHA1");
+        object.sha256sum = request.checksumAlgorithm == "SHA256" ? hashSink.GetHash("SHA256") : std::string{};
+        log_debug << "Checksum, bucket: " << request.bucket << " key: " << request.key << " md5: " << object.md5sum;
 
         return {
                 .bucket = request.bucket,
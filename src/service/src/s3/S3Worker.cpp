@@ -7,11 +7,11 @@
 namespace AwsMock::Service {
 
     void S3Worker::Initialize() {
+        StartGeneration();
         log_debug << "S3Worker initialized";
     }
 
     void S3Worker::Run() {
-        //TODO: fix, there seems to be some confusion when services are running.
         SyncObjects();
     }
 
@@ -19,43 +19,159 @@ namespace AwsMock::Service {
 
     void S3Worker::SyncObjects() {
 
-        std::string region = Core::Configuration::instance().getString("awsmock.region");
-        std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir");
-        std::string s3DataDir = dataDir + "/s3/";
+        long budget = Core::Configuration::instance().getInt("awsmock.service.s3.sweeper.budget", S3_DEFAULT_SWEEPER_BUDGET);
+        log_trace << "S3 worker starting, generation: " << _generation << " budget: " << budget;
+
+        try {
 
-        Database::Entity::S3::BucketList buckets = _s3Database.ListBuckets();
-        log_trace << "S3 worker starting, bucketCount: " << buckets.size();
+            while (budget > 0) {
+                if (_phase == SweepPhase::MARK) {
+                    budget -= MarkObjects(budget);
+                } else {
+                    budget -= SweepFiles(budget);
+
+                    // At most one generation per run
+                    if (_phase == SweepPhase::MARK) {
+                        break;
+                    }
+                }
+            }
 
-        if (buckets.empty()) {
-            return;
+        } catch (Core::DatabaseException &exc) {
+            log_error << "S3 worker failed, the next run continues at the cursor, error: " << exc.message();
         }
+    }
+
+    void S3Worker::StartGeneration() {
+
+        _generation++;
+        _generationStart = time(nullptr);
+        _phase = SweepPhase::MARK;
+        _objectCursor.clear();
+        _fileCursor = recursive_directory_iterator();
+        _marks.assign(S3_SWEEPER_BITMAP_BITS / 64, 0);
+        _objectsDeleted = 0;
+        _filesDeleted = 0;
+    }
 
-        // Loop over buckets and do some maintenance work
-        int filesDeleted = 0, objectsDeleted = 0;
-        for (auto &bucket: buckets) {
+    long S3Worker::MarkObjects(long budget) {
 
-            // Get objects and delete object, where the file is not existing anymore
-            std::vector objects = _s3Database.GetBucketObjectList(region, bucket.name, 1000);
+        std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir");
+        std::string s3DataDir = dataDir + "/s3/";
+
+        long processed = 0;
+        while (processed < budget) {
+
+            long pageSize = std::min(budget - processed, static_cast<long>(S3_SWEEPER_PAGE_SIZE));
+            Database::Entity::S3::ObjectList objects = _s3Database.ListObjectsAfter(_objectCursor, pageSize);
+
+            // Mark existing files, objects without file are deleted in a single request
+            Database::Entity::S3::ObjectList missing;
             for (const auto &object: objects) {
-                if (!Core::FileUtils::FileExists(s3DataDir + object.internalName)) {
-                    _s3Database.DeleteObject(object);
-                    log_debug << "Object deleted, internalName: " << object.internalName;
-                    objectsDeleted++;
+                if (Core::FileUtils::FileExists(s3DataDir + object.internalName)) {
+                    size_t index = GetMarkIndex(object.internalName);
+                    _marks[index / 64] |= uint64_t{1} << (index % 64);
+                } else {
+                    missing.emplace_back(object);
                 }
             }
+            _s3Database.DeleteObjects(missing);
+            _objectsDeleted += static_cast<long>(missing.size());
+
+            processed += static_cast<long>(objects.size());
+            if (!objects.empty()) {
+                _objectCursor = objects.back().oid;
+            }
+
+            // All objects marked, continue with the files
+            if (static_cast<long>(objects.size()) < pageSize) {
+                boost::system::error_code ec;
+                _fileCursor = recursive_directory_iterator(s3DataDir, ec);
+                _phase = SweepPhase::SWEEP;
+                log_debug << "S3 objects marked, generation: " << _generation << " objectsDeleted: " << _objectsDeleted;
+                break;
+            }
         }
+        return processed;
+    }
+
+    long S3Worker::SweepFiles(long budget) {
+
+        std::string dataDir = Core::Configuration::instance().getString("awsmock.data.dir");
+        std::string s3DataDir = dataDir + "/s3/";
+
+        long processed = 0;
+        while (processed < budget && _fileCursor != recursive_directory_iterator()) {
+
+            directory_entry entry = *_fileCursor;
+            if (is_directory(entry.status())) {
 
-        boost::filesystem::path p(s3DataDir);
-        if (is_directory(p)) {
-            for (auto &entry: boost::make_iterator_range(directory_iterator(p), {})) {
-                if (!_s3Database.ObjectExists(Core::FileUtils::GetBasename(entry.path().string()))) {
-                    Core::FileUtils::DeleteFile(entry.path().string());
-                    log_debug << "File deleted, filename: " << entry.path().string();
-                    filesDeleted++;
+                // Only the blob store contains object files, bucket directories are removed with the bucket
+                if (_fileCursor.depth() == 0 && entry.path().filename() != S3_BLOB_DIR) {
+                    _fileCursor.disable_recursion_pending();
                 }
             }
+            processed++;
+
+            // The cursor is moved before the file is deleted, as it can not be moved from a deleted entry
+            boost::system::error_code ec;
+            _fileCursor.increment(ec);
+            if (ec) {
+                log_warning << "S3 directory walk failed, error: " << ec.message();
+                _fileCursor = recursive_directory_iterator();
+            }
+
+            if (is_regular_file(entry.status()) && SweepFile(entry, s3DataDir)) {
+                _filesDeleted++;
+            }
+        }
+
+        if (_fileCursor == recursive_directory_iterator()) {
+            log_debug << "S3 generation synchronized, generation: " << _generation << " objectsDeleted: " << _objectsDeleted << " filesDeleted: " << _filesDeleted;
+            StartGeneration();
         }
-        log_debug << "Bucket synchronized, bucketCount: " << buckets.size() << " fileDeleted: " << filesDeleted << " objectsDeleted: " << objectsDeleted;
+        return processed;
+    }
+
+    bool S3Worker::SweepFile(const directory_entry &entry, const std::string &s3DataDir) {
+
+        std::string fileName = entry.path().string();
+        std::string internalName = fileName.substr(s3DataDir.length());
+
+        // Blobs itself are deleted with their last reference
+        if (S3BlobStore::IsBlob(internalName) && entry.path().filename().string().find('-') == std::string::npos) {
+            return false;
+        }
+
+        size_t index = GetMarkIndex(internalName);
+        if (_marks[index / 64] & (uint64_t{1} << (index % 64))) {
+            return false;
+        }
+
+        // Files changed during the generation might belong to objects, which were created behind the object cursor
+        struct stat st {};
+        if (lstat(fileName.c_str(), &st) != 0 || st.st_ctime >= _generationStart) {
+            return false;
+        }
+
+        if (S3BlobStore::IsBlob(internalName)) {
+            S3BlobStore::Release(internalName);
+        } else {
+            Core::MemoryMappedFileCache::instance().RemoveFile(fileName);
+            Core::FileUtils::DeleteFile(fileName);
+        }
+        log_debug << "File deleted, filename: " << fileName;
+        return true;
+    }
+
+    size_t S3Worker::GetMarkIndex(const std::string &internalName) const {
+
+        // Mix the generation into the hash, so that different names share a bit only by chance in a single generation
+        uint64_t x = std::hash<std::string>{}(internalName) + _generation * 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        x ^= x >> 31;
+        return x % S3_SWEEPER_BITMAP_BITS;
     }
 
-}// namespace AwsMock::Service
\ No newline at end of file
+}// namespace AwsMock::Service
@@ -0,0 +1,53 @@
+//
+// Created by vogje01 on 6/11/24.
+//
+
+#include <awsmock/service/sqs/SQSDeduplicationIndex.h>
+
+namespace AwsMock::Service {
+
+    std::optional<SQSDeduplicationIndex::Entry> SQSDeduplicationIndex::Register(const std::string &queueUrl, const std::string &deduplicationId, const std::string &messageId, const std::string &sequenceNumber) {
+
+        auto now = std::chrono::system_clock::now();
+        std::string key = queueUrl + '\n' + deduplicationId;
+
+        boost::mutex::scoped_lock lock(_mutex);
+        Expire(now);
+
+        auto [it, inserted] = _entries.try_emplace(key, Entry{.messageId = messageId, .sequenceNumber = sequenceNumber, .expires = now + _interval});
+        if (!inserted) {
+            log_debug << "Duplicate message, queueUrl: " << queueUrl << " deduplicationId: " << deduplicationId << " messageId: " << it->second.messageId;
+            return it->second;
+        }
+        _ring.emplace_back(it->second.expires, key);
+        return {};
+    }
+
+    void SQSDeduplicationIndex::Remove(const std::string &queueUrl, const std::string &deduplicationId) {
+
+        // The ring entry goes, when it expires
+        boost::mutex::scoped_lock lock(_mutex);
+        _entries.erase(queueUrl + '\n' + deduplicationId);
+    }
+
+    long SQSDeduplicationIndex::Size() {
+
+        boost::mutex::scoped_lock lock(_mutex);
+        Expire(std::chrono::system_clock::now());
+        return static_cast<long>(_entries.size());
+    }
+
+    void SQSDeduplicationIndex::Expire(std::chrono::system_clock::time_point now) {
+
+        while (!_ring.empty() && _ring.front().first <= now) {
+
+            // A removed and registered again ID has a later expiry
+            auto it = _entries.find(_ring.front().second);
+            if (it != _entries.end() && it->second.expires == _ring.front().first) {
+                _entries.erase(it);
+            }
+            _ring.pop_front();
+        }
+    }
+
+}// namespace AwsMock::Service
@@ -9,6 +9,45 @@ namespace AwsMock::Service {
         Dto::Common::SQSClientCommand clientCommand;
         clientCommand.FromRequest(request, region, user);
 
+        return HandleCommand(request, clientCommand);
+    }
+
+    bool SQSHandler::HandleAsyncPostRequest(const http::request<http::dynamic_body> &request, const std::string &region, const std::string &user, const ResponseCallback &callback) {
+        log_debug << "SQS POST request, URI: " << request.target() << " region: " << region << " user: " << user;
+
+        Dto::Common::SQSClientCommand clientCommand;
+        clientCommand.FromRequest(request, region, user);
+
+        // Everything except long polling receives is answered right away, so the request is parsed only once
+        if (clientCommand.command != Dto::Common::SqsCommandType::RECEIVE_MESSAGE) {
+            callback(HandleCommand(request, clientCommand));
+            return true;
+        }
+
+        try {
+
+            Dto::SQS::ReceiveMessageRequest sqsRequest = GetReceiveMessageRequest(clientCommand);
+            if (sqsRequest.waitTimeSeconds <= 0) {
+                callback(HandleCommand(request, clientCommand));
+                return true;
+            }
+
+            // The request itself is gone, when the callback is called
+            http::request<http::dynamic_body> header(request.base());
+            bool json = clientCommand.contentType == "json";
+            _sqsService.ReceiveMessages(sqsRequest, [header, json, callback, queueUrl = sqsRequest.queueUrl](const Dto::SQS::ReceiveMessageResponse &sqsResponse) {
+                callback(SendOkResponse(header, json ? sqsResponse.ToJson() : sqsResponse.ToXml()));
+                log_info << "Receive message, count: " << sqsResponse.messageList.size() << " queueUrl: " << queueUrl;
+            });
+
+        } catch (Poco::Exception &e) {
+            callback(Core::HttpUtils::InternalServerError(request, e.message()));
+        }
+        return true;
+    }
+
+    http::response<http::dynamic_body> SQSHandler::HandleCommand(const http::request<http::dynamic_body> &request, const Dto::Common::SQSClientCommand &clientCommand) {
+
         try {
             switch (clientCommand.command) {
 
@@ -212,9 +251,11 @@ namespace AwsMock::Service {
 
                         std::string queueUrl = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, "QueueUrl");
                         std::string body = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, "MessageBody");
+                        std::string messageGroupId = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, "MessageGroupId");
+                        std::string messageDeduplicationId = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, "MessageDeduplicationId");
                         std::map<std::string, Dto::SQS::MessageAttribute> attributes = GetMessageAttributes(clientCommand.payload);
 
-                        sqsRequest = {.region = clientCommand.region, .queueUrl = queueUrl, .body = body, .messageAttributes = attributes, .messageId = Core::AwsUtils::CreateRequestId()};
+                        sqsRequest = {.region = clientCommand.region, .queueUrl = queueUrl, .body = std::move(body), .messageAttributes = attributes, .messageGroupId = messageGroupId, .messageDeduplicationId = messageDeduplicationId, .messageId = Core::AwsUtils::CreateRequestId()};
                     }
 
                     // Call service
@@ -224,22 +265,42 @@ namespace AwsMock::Service {
                     log_info << "Send message, queueUrl: " << sqsRequest.queueUrl;
                 }
 
-                case Dto::Common::SqsCommandType::RECEIVE_MESSAGE: {
+                case Dto::Common::SqsCommandType::SEND_MESSAGE_BATCH: {
 
-                    Dto::SQS::ReceiveMessageRequest sqsRequest;
+                    Dto::SQS::SendMessageBatchRequest sqsRequest;
                     if (clientCommand.contentType == "json") {
 
                         sqsRequest.FromJson(clientCommand.payload);
-                        sqsRequest.region = clientCommand.region;
 
                     } else {
 
-                        std::string queueUrl = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, "QueueUrl");
-                        int maxMessages = Core::HttpUtils::GetIntParameter(clientCommand.payload, "MaxNumberOfMessages", 1, 10, 3);
-                        int waitTimeSeconds = Core::HttpUtils::GetIntParameter(clientCommand.payload, "WaitTimeSeconds", 1, 900, 5);
-                        int visibility = Core::HttpUtils::GetIntParameter(clientCommand.payload, "VisibilityTimeout", 1, 900, 30);
-                        sqsRequest = {.region = clientCommand.region, .queueUrl = queueUrl, .maxMessages = maxMessages, .visibilityTimeout = visibility, .waitTimeSeconds = waitTimeSeconds, .requestId = Core::AwsUtils::CreateRequestId()};
+                        sqsRequest.queueUrl = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, "QueueUrl");
+                        for (int i = 1;; i++) {
+                            std::string prefix = "SendMessageBatchRequestEntry." + std::to_string(i) + ".";
+                            std::string id = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, prefix + "Id");
+                            if (id.empty()) {
+                                break;
+                            }
+                            std::string body = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, prefix + "MessageBody");
+                            sqsRequest.entries.push_back({.id = id,
+                                                          .body = std::move(body),
+                                                          .messageAttributes = GetMessageAttributes(clientCommand.payload, prefix),
+                                                          .messageGroupId = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, prefix + "MessageGroupId"),
+                                                          .messageDeduplicationId = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, prefix + "MessageDeduplicationId")});
+                        }
                     }
+                    sqsRequest.region = clientCommand.region;
+                    sqsRequest.senderId = clientCommand.user;
+
+                    // Call service
+                    Dto::SQS::SendMessageBatchResponse sqsResponse = _sqsService.SendMessageBatch(sqsRequest);
+                    log_info << "Send message batch, queueUrl: " << sqsRequest.queueUrl << " count: " << sqsRequest.entries.size();
+                    return SendOkResponse(request, clientCommand.contentType == "json" ? sqsResponse.ToJson() : sqsResponse.ToXml());
+                }
+
+                case Dto::Common::SqsCommandType::RECEIVE_MESSAGE: {
+
+                    Dto::SQS::ReceiveMessageRequest sqsRequest = GetReceiveMessageRequest(clientCommand);
                     Dto::SQS::ReceiveMessageResponse sqsResponse = _sqsService.ReceiveMessages(sqsRequest);
 
                     // Add message attribute headers
@@ -272,6 +333,34 @@ namespace AwsMock::Service {
                     log_info << "Change visibility, queueUrl: " << sqsRequest.queueUrl << " timeout: " << sqsRequest.visibilityTimeout;
                 }
 
+                case Dto::Common::SqsCommandType::CHANGE_MESSAGE_VISIBILITY_BATCH: {
+
+                    Dto::SQS::ChangeMessageVisibilityBatchRequest sqsRequest;
+                    if (clientCommand.contentType == "json") {
+
+                        sqsRequest.FromJson(clientCommand.payload);
+
+                    } else {
+
+                        sqsRequest.queueUrl = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, "QueueUrl");
+                        for (int i = 1;; i++) {
+                            std::string prefix = "ChangeMessageVisibilityBatchRequestEntry." + std::to_string(i) + ".";
+                            std::string id = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, prefix + "Id");
+                            if (id.empty()) {
+                                break;
+                            }
+                            std::string receiptHandle = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, prefix + "ReceiptHandle");
+                            int visibilityTimeout = Core::HttpUtils::GetIntParameter(clientCommand.payload, prefix + "VisibilityTimeout", 0, 12 * 3600, 30);
+                            sqsRequest.entries.push_back({.id = id, .receiptHandle = receiptHandle, .visibilityTimeout = visibilityTimeout});
+                        }
+                    }
+                    sqsRequest.region = clientCommand.region;
+
+                    Dto::SQS::ChangeMessageVisibilityBatchResponse sqsResponse = _sqsService.SetVisibilityTimeoutBatch(sqsRequest);
+                    log_info << "Change visibility batch, queueUrl: " << sqsRequest.queueUrl << " count: " << sqsRequest.entries.size();
+                    return SendOkResponse(request, clientCommand.contentType == "json" ? sqsResponse.ToJson() : sqsResponse.ToXml());
+                }
+
                 case Dto::Common::SqsCommandType::DELETE_MESSAGE: {
 
                     Dto::SQS::DeleteMessageRequest sqsRequest;
@@ -318,9 +407,9 @@ namespace AwsMock::Service {
                             sqsRequest.deleteMessageBatchEntries.emplace_back(entry);
                         }
                     }
-                    _sqsService.DeleteMessageBatch(sqsRequest);
-                    return SendOkResponse(request);
+                    Dto::SQS::DeleteMessageBatchResponse sqsResponse = _sqsService.DeleteMessageBatch(sqsRequest);
                     log_info << "Delete message batch, queueUrl: " << sqsRequest.queueUrl;
+                    return SendOkResponse(request, clientCommand.contentType == "json" ? sqsResponse.ToJson() : sqsResponse.ToXml());
                 }
 
                 case Dto::Common::SqsCommandType::UNKNOWN: {
@@ -338,6 +427,25 @@ namespace AwsMock::Service {
         }
     }
 
+    Dto::SQS::ReceiveMessageRequest SQSHandler::GetReceiveMessageRequest(const Dto::Common::SQSClientCommand &clientCommand) {
+
+        Dto::SQS::ReceiveMessageRequest sqsRequest;
+        if (clientCommand.contentType == "json") {
+
+            sqsRequest.FromJson(clientCommand.payload);
+            sqsRequest.region = clientCommand.region;
+
+        } else {
+
+            std::string queueUrl = Core::HttpUtils::GetQueryParameterValueByName(clientCommand.payload, "QueueUrl");
+            int maxMessages = Core::HttpUtils::GetIntParameter(clientCommand.payload, "MaxNumberOfMessages", 1, 10, 3);
+            int waitTimeSeconds = Core::HttpUtils::GetIntParameter(clientCommand.payload, "WaitTimeSeconds", 1, 900, 5);
+            int visibility = Core::HttpUtils::GetIntParameter(clientCommand.payload, "VisibilityTimeout", 1, 900, 30);
+            sqsRequest = {.region = clientCommand.region, .queueUrl = queueUrl, .maxMessages = maxMessages, .visibilityTimeout = visibility, .waitTimeSeconds = waitTimeSeconds, .requestId = Core::AwsUtils::CreateRequestId()};
+        }
+        return sqsRequest;
+    }
+
     std::vector<Dto::SQS::QueueAttribute> SQSHandler::GetQueueAttributes(const std::string &payload) {
 
         std::vector<Dto::SQS::QueueAttribute> queueAttributes;
@@ -383,20 +491,20 @@ namespace AwsMock::Service {
         return attributeNames;
     }
 
-    std::map<std::string, Dto::SQS::MessageAttribute> SQSHandler::GetMessageAttributes(const std::string &payload) {
+    std::map<std::string, Dto::SQS::MessageAttribute> SQSHandler::GetMessageAttributes(const std::string &payload, const std::string &prefix) {
 
-        int attributeCount = Core::HttpUtils::CountQueryParametersByPrefix(payload, "MessageAttribute");
+        int attributeCount = Core::HttpUtils::CountQueryParametersByPrefix(payload, prefix + "MessageAttribute");
         log_debug << "Got message attribute count: " << attributeCount;
 
         std::map<std::string, Dto::SQS::MessageAttribute> messageAttributes;
         for (int i = 1; i <= attributeCount / 3; i++) {
 
-            std::string attributeName = Core::HttpUtils::GetQueryParameterValueByName(payload, "MessageAttribute." + std::to_string(i) + ".Name");
-            std::string attributeType = Core::HttpUtils::GetQueryParameterValueByName(payload, "MessageAttribute." + std::to_string(i) + ".Value.DataType");
+            std::string attributeName = Core::HttpUtils::GetQueryParameterValueByName(payload, prefix + "MessageAttribute." + std::to_string(i) + ".Name");
+            std::string attributeType = Core::HttpUtils::GetQueryParameterValueByName(payload, prefix + "MessageAttribute." + std::to_string(i) + ".Value.DataType");
 
             std::string attributeValue;
             if (attributeType == "String" || attributeType == "Number") {
-                attributeValue = Core::HttpUtils::GetQueryParameterValueByName(payload, "MessageAttribute." + std::to_string(i) + ".Value.StringValue");
+                attributeValue = Core::HttpUtils::GetQueryParameterValueByName(payload, prefix + "MessageAttribute." + std::to_string(i) + ".Value.StringValue");
             }
             Dto::SQS::MessageAttribute messageAttribute = {.name = attributeName, .stringValue = attributeValue, .type = Dto::SQS::MessageAttributeDataTypeFromString(attributeType)};
             messageAttributes[attributeName] = messageAttribute;
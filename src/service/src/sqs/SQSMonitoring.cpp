@@ -25,31 +25,29 @@ namespace AwsMock::Service {
     void SQSMonitoring::UpdateCounter() {
         log_trace << "SQS counter update starting";
 
-        // Get total counts
-        long queues = _sqsDatabase.CountQueues();
-        long messages = _sqsDatabase.CountMessages();
-        _metricService.SetGauge(SQS_QUEUE_COUNT, static_cast<double>(queues));
-        _metricService.SetGauge(SQS_MESSAGE_COUNT, static_cast<double>(messages));
-
         // Count resources per queue
-        for (const auto &queue: _sqsDatabase.ListQueues()) {
-            std::string labelValue = Poco::replace(queue.name, "-", "_");
-            long messagesPerQueue = _sqsDatabase.CountMessages(queue.region, queue.queueUrl);
-            _metricService.SetGauge(SQS_MESSAGE_BY_QUEUE_COUNT, "queue", labelValue, messagesPerQueue);
+        long messages = 0;
+        std::vector<SQSStatistics::QueueStatistics> queueStatistics = _sqsStatistics.ListQueueStatistics();
+        for (const auto &statistics: queueStatistics) {
+            std::string labelValue = Poco::replace(statistics.name, "-", "_");
+            long messagesPerQueue = statistics.visible + statistics.inFlight + statistics.delayed;
+            _metricService.SetGauge(SQS_MESSAGE_BY_QUEUE_COUNT, "queue", labelValue, static_cast<double>(messagesPerQueue));
+            messages += messagesPerQueue;
         }
+
+        // Total counts
+        _metricService.SetGauge(SQS_QUEUE_COUNT, static_cast<double>(queueStatistics.size()));
+        _metricService.SetGauge(SQS_MESSAGE_COUNT, static_cast<double>(messages));
         log_trace << "SQS counter update finished";
     }
 
     void SQSMonitoring::CollectWaitingTimeStatistics() {
         log_trace << "SQS message wait time starting";
 
-        Database::Entity::SQS::MessageWaitTime waitingTime = _sqsDatabase.GetAverageMessageWaitingTime();
-        log_trace << "SQS worker starting, count: " << waitingTime.waitTime.size();
-
-        if (!waitingTime.waitTime.empty()) {
-            for (auto &w: waitingTime.waitTime) {
-                _metricService.SetGauge(SQS_MESSAGE_WAIT_TIME, "queue", w.first, w.second);
-            }
+        for (const auto &statistics: _sqsStatistics.ListQueueStatistics()) {
+            std::string labelValue = Poco::replace(statistics.name, "-", "_");
+            _metricService.SetGauge(SQS_MESSAGE_WAIT_TIME, "queue", labelValue, statistics.averageWaitTime);
+            _metricService.SetGauge(SQS_MESSAGE_WAIT_TIME_P99, "queue", labelValue, statistics.p99WaitTime);
         }
         log_trace << "SQS wait time update finished";
     }
@@ -16,13 +16,14 @@ namespace AwsMock::Service {
         _requestTimeout = _configuration.getInt("awsmock.service.sqs.http.timeout", SQS_DEFAULT_TIMEOUT);
         _monitoringPeriod = _configuration.getInt("awsmock.service.sqs.monitoring.period", SQS_DEFAULT_MONITORING_PERIOD);
         _workerPeriod = _configuration.getInt("awsmock.service.sqs.worker.period", SQS_DEFAULT_WORKER_PERIOD);
+        _workerSweepPeriod = _configuration.getInt("awsmock.service.sqs.worker.sweep", SQS_DEFAULT_WORKER_SWEEP_PERIOD);
         log_debug << "SQS rest module initialized, endpoint: " << _host << ":" << _port;
 
         // Monitoring
         _sqsMonitoring = std::make_unique<SQSMonitoring>(_monitoringPeriod);
 
         // Worker thread
-        _sqsWorker = std::make_unique<SQSWorker>(_workerPeriod);
+        _sqsWorker = std::make_unique<SQSWorker>(_workerPeriod, _workerSweepPeriod);
         log_debug << "SQSServer initialized";
     }
 
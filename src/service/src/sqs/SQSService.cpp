@@ -52,9 +52,23 @@ namespace AwsMock::Service {
                 if (a.attributeName == "QueueArn") {
                     attributes.queueArn = a.attributeValue;
                 }
+                if (a.attributeName == "FifoQueue") {
+                    attributes.fifoQueue = a.attributeValue == "true";
+                }
+                if (a.attributeName == "ContentBasedDeduplication") {
+                    attributes.contentBasedDeduplication = a.attributeValue == "true";
+                }
             }
             attributes.queueArn = queueArn;
 
+            // FIFO queue names must have the '.fifo' suffix
+            if (request.queueName.ends_with(".fifo")) {
+                attributes.fifoQueue = true;
+            } else if (attributes.fifoQueue) {
+                log_error << "FIFO queue names must end with '.fifo', queueName: " << request.queueName;
+                throw Core::ServiceException("FIFO queue names must end with '.fifo', queueName: " + request.queueName);
+            }
+
             // Update database
             Database::Entity::SQS::Queue queue = _database.CreateQueue({.region = request.region,
                                                                         .name = request.queueName,
@@ -63,6 +77,7 @@ namespace AwsMock::Service {
                                                                         .queueArn = queueArn,
                                                                         .attributes = attributes,
                                                                         .tags = request.tags});
+            SQSStatistics::instance().Reconcile(queue.queueUrl, queue.name, 0, 0, 0);
             log_trace << "SQS queue created: " << queue.ToString();
 
             return {
@@ -109,6 +124,8 @@ namespace AwsMock::Service {
         try {
 
             _database.PurgeQueue(request.region, request.queueUrl);
+            SQSStatistics::instance().Reconcile(request.queueUrl, {}, 0, 0, 0);
+            ScheduleMaintenance(request.region, request.queueUrl);
             log_trace << "SQS queue purged, region: " << request.region << " queueUrl: " << request.queueUrl;
 
         } catch (Poco::Exception &ex) {
@@ -155,11 +172,14 @@ namespace AwsMock::Service {
         Database::Entity::SQS::Queue queue = _database.GetQueueByUrl(request.region, request.queueUrl);
         log_debug << "Got queue: " << queue.queueUrl;
 
+        // Message counters, maintained incrementally
+        SQSStatistics::QueueStatistics statistics = SQSStatistics::instance().GetQueueStatistics(queue.queueUrl);
+
         Dto::SQS::GetQueueAttributesResponse response;
         if (CheckAttribute(request.attributeNames, "all")) {
-            response.attributes.emplace_back("ApproximateNumberOfMessages", std::to_string(queue.attributes.approximateNumberOfMessages));
-            response.attributes.emplace_back("ApproximateNumberOfMessagesDelayed", std::to_string(queue.attributes.approximateNumberOfMessagesDelayed));
-            response.attributes.emplace_back("ApproximateNumberOfMessagesNotVisible", std::to_string(queue.attributes.approximateNumberOfMessagesNotVisible));
+            response.attributes.emplace_back("ApproximateNumberOfMessages", std::to_string(statistics.visible));
+            response.attributes.emplace_back("ApproximateNumberOfMessagesDelayed", std::to_string(statistics.delayed));
+            response.attributes.emplace_back("ApproximateNumberOfMessagesNotVisible", std::to_string(statistics.inFlight));
             response.attributes.emplace_back("CreatedTimestamp", std::to_string(queue.created.timestamp().epochTime()));
             response.attributes.emplace_back("DelaySeconds", std::to_string(queue.attributes.delaySeconds));
             response.attributes.emplace_back("LastModifiedTimestamp", std::to_string(queue.modified.timestamp().epochTime()));
@@ -169,6 +189,10 @@ namespace AwsMock::Service {
             response.attributes.emplace_back("QueueArn", queue.queueArn);
             response.attributes.emplace_back("ReceiveMessageWaitTimeSeconds", std::to_string(queue.attributes.receiveMessageWaitTime));
             response.attributes.emplace_back("VisibilityTimeout", std::to_string(queue.attributes.visibilityTimeout));
+            if (queue.attributes.fifoQueue) {
+                response.attributes.emplace_back("FifoQueue", "true");
+                response.attributes.emplace_back("ContentBasedDeduplication", queue.attributes.contentBasedDeduplication ? "true" : "false");
+            }
         } else {
             if (CheckAttribute(request.attributeNames, "Policy")) {
                 response.attributes.emplace_back("Policy", queue.attributes.policy);
@@ -183,10 +207,10 @@ namespace AwsMock::Service {
                 response.attributes.emplace_back("MessageRetentionPeriod", std::to_string(queue.attributes.messageRetentionPeriod));
             }
             if (CheckAttribute(request.attributeNames, "ApproximateNumberOfMessages")) {
-                response.attributes.emplace_back("ApproximateNumberOfMessages", std::to_string(queue.attributes.approximateNumberOfMessages));
+                response.attributes.emplace_back("ApproximateNumberOfMessages", std::to_string(statistics.visible));
             }
             if (CheckAttribute(request.attributeNames, "ApproximateNumberOfMessagesNotVisible")) {
-                response.attributes.emplace_back("ApproximateNumberOfMessagesNotVisible", std::to_string(queue.attributes.approximateNumberOfMessagesNotVisible));
+                response.attributes.emplace_back("ApproximateNumberOfMessagesNotVisible", std::to_string(statistics.inFlight));
             }
             if (CheckAttribute(request.attributeNames, "CreatedTimestamp")) {
                 response.attributes.emplace_back("CreatedTimestamp", Poco::DateTimeFormatter::format(queue.created, Poco::DateTimeFormat::HTTP_FORMAT));
@@ -194,8 +218,8 @@ namespace AwsMock::Service {
             if (CheckAttribute(request.attributeNames, "LastModifiedTimestamp")) {
                 response.attributes.emplace_back("LastModifiedTimestamp", Poco::DateTimeFormatter::format(queue.modified, Poco::DateTimeFormat::HTTP_FORMAT));
             }
-            if (CheckAttribute(request.attributeNames, "ApproximateNumberOfMessagesNotVisible")) {
-                response.attributes.emplace_back("ApproximateNumberOfMessagesNotVisible", std::to_string(queue.attributes.approximateNumberOfMessagesDelayed));
+            if (CheckAttribute(request.attributeNames, "ApproximateNumberOfMessagesDelayed")) {
+                response.attributes.emplace_back("ApproximateNumberOfMessagesDelayed", std::to_string(statistics.delayed));
             }
             if (CheckAttribute(request.attributeNames, "DelaySeconds")) {
                 response.attributes.emplace_back("DelaySeconds", std::to_string(queue.attributes.delaySeconds));
@@ -206,6 +230,12 @@ namespace AwsMock::Service {
             if (CheckAttribute(request.attributeNames, "RedrivePolicy")) {
                 response.attributes.emplace_back("RedrivePolicy", queue.attributes.redrivePolicy.ToJson());
             }
+            if (CheckAttribute(request.attributeNames, "FifoQueue") && queue.attributes.fifoQueue) {
+                response.attributes.emplace_back("FifoQueue", "true");
+            }
+            if (CheckAttribute(request.attributeNames, "ContentBasedDeduplication") && queue.attributes.fifoQueue) {
+                response.attributes.emplace_back("ContentBasedDeduplication", queue.attributes.contentBasedDeduplication ? "true" : "false");
+            }
         }
         log_debug << response.ToString();
         return response;
@@ -243,6 +273,9 @@ namespace AwsMock::Service {
             if (!request.attributes["VisibilityTimeout"].empty()) {
                 queue.attributes.visibilityTimeout = std::stoi(request.attributes["VisibilityTimeout"]);
             }
+            if (!request.attributes["ContentBasedDeduplication"].empty() && queue.attributes.fifoQueue) {
+                queue.attributes.contentBasedDeduplication = request.attributes["ContentBasedDeduplication"] == "true";
+            }
             if (!request.attributes["QueueArn"].empty()) {
                 queue.attributes.queueArn = request.attributes["QueueArn"];
             } else {
@@ -285,6 +318,47 @@ namespace AwsMock::Service {
             message = _database.UpdateMessage(message);
             log_trace << "Message updated: " << message.ToString();
 
+            // The message might become visible earlier than before
+            ScheduleWakeup(_database, message.queueUrl);
+            ScheduleMaintenance(request.region, message.queueUrl, message.reset);
+
+        } catch (Poco::Exception &ex) {
+            log_error << ex.message();
+            throw Core::ServiceException(ex.message());
+        }
+    }
+
+    Dto::SQS::ChangeMessageVisibilityBatchResponse SQSService::SetVisibilityTimeoutBatch(const Dto::SQS::ChangeMessageVisibilityBatchRequest &request) {
+        Core::MetricServiceTimer measure(SQS_SERVICE_TIMER, "method", "set_visibility_timeout_batch");
+        log_trace << "Change message visibility batch request, queue: " << request.queueUrl << " size: " << request.entries.size();
+
+        try {
+
+            std::map<std::string, int> visibilityTimeouts;
+            for (const auto &entry: request.entries) {
+                visibilityTimeouts[entry.receiptHandle] = entry.visibilityTimeout;
+            }
+
+            // Update database, single write for all entries
+            std::vector<std::string> changed = _database.ChangeMessageVisibilities(request.queueUrl, visibilityTimeouts);
+
+            Dto::SQS::ChangeMessageVisibilityBatchResponse response = {.requestId = request.requestId};
+            for (const auto &entry: request.entries) {
+                if (std::find(changed.begin(), changed.end(), entry.receiptHandle) != changed.end()) {
+                    response.successful.emplace_back(entry.id);
+                } else {
+                    response.failed.push_back({.id = entry.id, .code = "ReceiptHandleIsInvalid", .message = "Message does not exist, receiptHandle: " + entry.receiptHandle});
+                }
+            }
+            log_debug << "Message visibility batch changed, successful: " << response.successful.size() << " failed: " << response.failed.size();
+
+            // Messages might become visible earlier than before
+            if (!changed.empty()) {
+                ScheduleWakeup(_database, request.queueUrl);
+                ScheduleMaintenance(request.region, request.queueUrl, _database.GetNextMessageReset(request.queueUrl));
+            }
+            return response;
+
         } catch (Poco::Exception &ex) {
             log_error << ex.message();
             throw Core::ServiceException(ex.message());
@@ -336,6 +410,7 @@ namespace AwsMock::Service {
 
             // Update database
             _database.DeleteQueue({.region = request.region, .queueUrl = request.queueUrl});
+            SQSStatistics::instance().RemoveQueue(request.queueUrl);
 
             return {.region = request.region, .queueUrl = request.queueUrl, .requestId = request.requestId};
 
@@ -359,62 +434,46 @@ namespace AwsMock::Service {
             // Get queue by URL
             Database::Entity::SQS::Queue queue = _database.GetQueueByUrl(request.region, request.queueUrl);
 
-            // System attributes
-            std::map<std::string, std::string> attributes = request.attributes;
-            attributes["SentTimestamp"] = std::to_string(static_cast<long>(std::chrono::seconds(std::time(NULL)).count()));
-            attributes["ApproximateFirstReceivedTimestamp"] = std::to_string(static_cast<long>(std::chrono::seconds(std::time(NULL)).count()));
-            attributes["ApproximateReceivedCount"] = std::to_string(0);
-            attributes["VisibilityTimeout"] = std::to_string(queue.attributes.visibilityTimeout);
-            attributes["SenderId"] = request.senderId;
-
-            // Set userAttributes
-            Database::Entity::SQS::MessageAttributeList messageAttributes;
-            for (const auto &attribute: request.messageAttributes) {
-                messageAttributes.push_back({.attributeName = attribute.first,
-                                             .attributeValue = attribute.second.stringValue,
-                                             .attributeType = Database::Entity::SQS::MessageAttributeTypeFromString(Dto::SQS::MessageAttributeDataTypeToString(attribute.second.type))});
-            }
-
-            // Set delay
-            system_clock::time_point reset = system_clock::now();
-            if (queue.attributes.delaySeconds > 0) {
-                reset += std::chrono::seconds(queue.attributes.delaySeconds);
-            } else {
-                reset += std::chrono::seconds(queue.attributes.visibilityTimeout);
-            }
+            Database::Entity::SQS::Message message = CreateMessageEntity(queue, request.region, request.body, request.attributes, request.messageAttributes, request.senderId);
 
-            // Set parameters
-            std::string messageId = Core::AwsUtils::CreateMessageId();
-            std::string receiptHandle = Core::AwsUtils::CreateSqsReceiptHandler();
-            std::string md5Body = Core::Crypto::GetMd5FromString(request.body);
-            std::string md5UserAttr = Dto::SQS::MessageAttribute::GetMd5MessageAttributes(request.messageAttributes);
-            std::string md5SystemAttr = Dto::SQS::MessageAttribute::GetMd5Attributes(request.attributes);
+            // FIFO queues, a message with a known deduplication ID is accepted, but not stored again
+            std::string deduplicationId;
+            if (queue.attributes.fifoQueue) {
+                deduplicationId = SetFifoAttributes(queue, request.messageGroupId, request.messageDeduplicationId, message);
+                if (auto original = GetDeduplicationIndex().Register(queue.queueUrl, deduplicationId, message.messageId, message.attributes["SequenceNumber"])) {
+                    log_debug << "Duplicate message, queueName: " << queue.name << " deduplicationId: " << deduplicationId;
+                    return {.queueUrl = queue.queueUrl, .messageId = original->messageId, .md5Body = message.md5Body, .md5UserAttr = message.md5UserAttr, .md5SystemAttr = message.md5SystemAttr, .sequenceNumber = original->sequenceNumber, .requestId = request.requestId};
+                }
+            }
 
             // Update database
-            Database::Entity::SQS::Message message = _database.CreateMessage(
-                    {.region = request.region,
-                     .queueUrl = queue.queueUrl,
-                     .queueName = queue.name,
-                     .body = request.body,
-                     .status = Database::Entity::SQS::MessageStatus::INITIAL,
-                     .reset = reset,
-                     .messageId = messageId,
-                     .receiptHandle = receiptHandle,
-                     .md5Body = md5Body,
-                     .md5UserAttr = md5UserAttr,
-                     .md5SystemAttr = md5SystemAttr,
-                     .attributes = attributes,
-                     .messageAttributes = messageAttributes});
-            log_info << "Message send, queueName: " << queue.name << " messageId: " << request.messageId << " md5Body: " << request.md5sum;
+            try {
+                message = _database.CreateMessage(message);
+            } catch (Core::DatabaseException &exc) {
+                if (!deduplicationId.empty()) {
+                    GetDeduplicationIndex().Remove(queue.queueUrl, deduplicationId);
+                }
+                throw Core::ServiceException(exc.message());
+            }
+            log_info << "Message send, queueName: " << queue.name << " messageId: " << message.messageId << " md5Body: " << message.md5Body;
 
-            return {
+            // Wake up the waiting receivers
+            SQSStatistics::instance().MessagesSent(queue.queueUrl, queue.name, 1, message.status == Database::Entity::SQS::MessageStatus::DELAYED);
+            NotifyReceivers(queue.queueUrl);
+            ScheduleMaintenance(queue.region, queue.queueUrl);
+
+            Dto::SQS::SendMessageResponse response = {
                     .queueUrl = message.queueUrl,
                     .messageId = message.messageId,
                     .receiptHandle = message.receiptHandle,
-                    .md5Body = md5Body,
-                    .md5UserAttr = md5UserAttr,
-                    .md5SystemAttr = md5SystemAttr,
+                    .md5Body = message.md5Body,
+                    .md5UserAttr = message.md5UserAttr,
+                    .md5SystemAttr = message.md5SystemAttr,
                     .requestId = request.requestId};
+            if (queue.attributes.fifoQueue) {
+                response.sequenceNumber = message.attributes["SequenceNumber"];
+            }
+            return response;
 
         } catch (Poco::Exception &ex) {
             log_error << ex.message();
@@ -422,9 +481,9 @@ namespace AwsMock::Service {
         }
     }
 
-    Dto::SQS::ReceiveMessageResponse SQSService::ReceiveMessages(const Dto::SQS::ReceiveMessageRequest &request) {
-        Core::MetricServiceTimer measure(SQS_SERVICE_TIMER, "method", "receive_message");
-        log_debug << "Receive message request: " << request.ToString();
+    Dto::SQS::SendMessageBatchResponse SQSService::SendMessageBatch(const Dto::SQS::SendMessageBatchRequest &request) {
+        Core::MetricServiceTimer measure(SQS_SERVICE_TIMER, "method", "send_message_batch");
+        log_trace << "Send message batch request, size: " << request.entries.size();
 
         if (!request.queueUrl.empty() && !_database.QueueUrlExists(request.region, request.queueUrl)) {
             log_error << "Queue does not exist, region: " << request.region << " queueUrl: " << request.queueUrl;
@@ -432,52 +491,270 @@ namespace AwsMock::Service {
         }
 
         try {
-            Database::Entity::SQS::MessageList messageList;
-            Database::Entity::SQS::Queue queue = _database.GetQueueByUrl(request.region, request.queueUrl);
-
-            long elapsed = 0;
-            auto begin = system_clock::now();
-            while (elapsed < request.waitTimeSeconds) {
 
-                _database.ReceiveMessages(queue.region, queue.queueUrl, queue.attributes.visibilityTimeout, request.maxMessages, messageList);
-                log_trace << "Messages in database, url: " << queue.queueUrl << " count: " << messageList.size();
+            // Get queue by URL, once for the whole batch
+            Database::Entity::SQS::Queue queue = _database.GetQueueByUrl(request.region, request.queueUrl);
 
-                if (!messageList.empty()) {
-                    break;
+            Dto::SQS::SendMessageBatchResponse response = {.requestId = request.requestId};
+            Database::Entity::SQS::MessageList messages;
+            std::vector<std::string> entryIds;
+            std::vector<std::string> deduplicationIds;
+            for (const auto &entry: request.entries) {
+                if (entry.body.empty()) {
+                    response.failed.push_back({.id = entry.id, .code = "MissingParameter", .message = "The request must contain the parameter MessageBody."});
+                    continue;
                 }
+                Database::Entity::SQS::Message message = CreateMessageEntity(queue, request.region, entry.body, entry.attributes, entry.messageAttributes, request.senderId);
+
+                // FIFO queues, entries with a known deduplication ID are successful, but not stored again
+                if (queue.attributes.fifoQueue) {
+                    std::string deduplicationId;
+                    try {
+                        deduplicationId = SetFifoAttributes(queue, entry.messageGroupId, entry.messageDeduplicationId, message);
+                    } catch (Core::ServiceException &exc) {
+                        response.failed.push_back({.id = entry.id, .code = "MissingParameter", .message = exc.message()});
+                        continue;
+                    }
+                    if (auto original = GetDeduplicationIndex().Register(queue.queueUrl, deduplicationId, message.messageId, message.attributes["SequenceNumber"])) {
+                        response.successful.push_back({.id = entry.id,
+                                                       .messageId = original->messageId,
+                                                       .md5Body = message.md5Body,
+                                                       .md5UserAttr = message.md5UserAttr,
+                                                       .md5SystemAttr = message.md5SystemAttr,
+                                                       .sequenceNumber = original->sequenceNumber});
+                        continue;
+                    }
+                    deduplicationIds.emplace_back(deduplicationId);
+                }
+                messages.emplace_back(message);
+                entryIds.emplace_back(entry.id);
+            }
 
-                elapsed = std::chrono::duration_cast<std::chrono::seconds>(system_clock::now() - begin).count();
+            // Update database, single write for all entries
+            try {
+                messages = _database.CreateMessages(messages);
+            } catch (Core::DatabaseException &exc) {
+                for (const auto &deduplicationId: deduplicationIds) {
+                    GetDeduplicationIndex().Remove(queue.queueUrl, deduplicationId);
+                }
+                throw Core::ServiceException(exc.message());
+            }
+            for (size_t i = 0; i < messages.size(); i++) {
+                response.successful.push_back({.id = entryIds[i],
+                                               .messageId = messages[i].messageId,
+                                               .md5Body = messages[i].md5Body,
+                                               .md5UserAttr = messages[i].md5UserAttr,
+                                               .md5SystemAttr = messages[i].md5SystemAttr,
+                                               .sequenceNumber = messages[i].attributes["SequenceNumber"]});
+            }
+            log_info << "Message batch send, queueName: " << queue.name << " successful: " << response.successful.size() << " failed: " << response.failed.size();
 
-                std::this_thread::sleep_for(std::chrono::milliseconds(500));
+            // Wake up the waiting receivers
+            if (!messages.empty()) {
+                SQSStatistics::instance().MessagesSent(queue.queueUrl, queue.name, static_cast<long>(messages.size()), messages.front().status == Database::Entity::SQS::MessageStatus::DELAYED);
+                NotifyReceivers(queue.queueUrl);
+                ScheduleMaintenance(queue.region, queue.queueUrl);
             }
+            return response;
 
-            // TODO: Check
-            // Reduce attributes, the response contains only the requested attributes. The MD5 of the attributes in the response is only calculated on the requested attributes
-            /*for (auto &message: messageList) {
-                for (auto &attributeName: request.attributeName) {
-                    message.messageAttributes.erase(std::remove_if(message.attributes.begin(),
-                                                            message.attributes.end(),
-                                                            [attributeName](const Database::Entity::SQS::MessageAttribute &attribute) {
-                                                                return attributeName == attribute.attributeName;
-                                                            }),
-                                             message.attributes.end());
-                }
-            }*/
+        } catch (Poco::Exception &ex) {
+            log_error << ex.message();
+            throw Core::ServiceException(ex.message());
+        }
+    }
+
+    Database::Entity::SQS::Message SQSService::CreateMessageEntity(const Database::Entity::SQS::Queue &queue, const std::string &region, const Core::SharedString &body, const std::map<std::string, std::string> &systemAttributes, const Dto::SQS::MessageAttributeList &userAttributes, const std::string &senderId) {
+
+        // System attributes
+        std::map<std::string, std::string> attributes = systemAttributes;
+        attributes["SentTimestamp"] = std::to_string(static_cast<long>(std::chrono::seconds(std::time(NULL)).count()));
+        attributes["ApproximateFirstReceivedTimestamp"] = std::to_string(static_cast<long>(std::chrono::seconds(std::time(NULL)).count()));
+        attributes["ApproximateReceivedCount"] = std::to_string(0);
+        attributes["VisibilityTimeout"] = std::to_string(queue.attributes.visibilityTimeout);
+        attributes["SenderId"] = senderId;
+
+        // Set userAttributes
+        Database::Entity::SQS::MessageAttributeList messageAttributes;
+        for (const auto &attribute: userAttributes) {
+            messageAttributes.push_back({.attributeName = attribute.first,
+                                         .attributeValue = attribute.second.stringValue,
+                                         .attributeType = Database::Entity::SQS::MessageAttributeTypeFromString(Dto::SQS::MessageAttributeDataTypeToString(attribute.second.type))});
+        }
 
-            Dto::SQS::ReceiveMessageResponse response;
-            if (!messageList.empty()) {
-                response.messageList = messageList;
-                response.requestId = request.requestId;
-                log_info << "Messages received, count: " << messageList.size() << " requestId: " << request.requestId;
+        // Set delay, delayed messages become visible, when the delay has passed
+        system_clock::time_point reset = system_clock::now();
+        Database::Entity::SQS::MessageStatus status = Database::Entity::SQS::MessageStatus::INITIAL;
+        if (queue.attributes.delaySeconds > 0) {
+            reset += std::chrono::seconds(queue.attributes.delaySeconds);
+            status = Database::Entity::SQS::MessageStatus::DELAYED;
+        } else {
+            reset += std::chrono::seconds(queue.attributes.visibilityTimeout);
+        }
+
+        return {.region = region,
+                .queueUrl = queue.queueUrl,
+                .queueName = queue.name,
+                .body = body,
+                .status = status,
+                .reset = reset,
+                .messageId = Core::AwsUtils::CreateMessageId(),
+                .receiptHandle = Core::AwsUtils::CreateSqsReceiptHandler(),
+                .md5Body = Core::Crypto::GetMd5FromString(body),
+                .md5UserAttr = Dto::SQS::MessageAttribute::GetMd5MessageAttributes(userAttributes),
+                .md5SystemAttr = Dto::SQS::MessageAttribute::GetMd5Attributes(systemAttributes),
+                .attributes = attributes,
+                .messageAttributes = messageAttributes};
+    }
+
+    std::string SQSService::SetFifoAttributes(const Database::Entity::SQS::Queue &queue, const std::string &messageGroupId, const std::string &messageDeduplicationId, Database::Entity::SQS::Message &message) {
+
+        if (messageGroupId.empty()) {
+            log_error << "FIFO queue message without message group ID, queueUrl: " << queue.queueUrl;
+            throw Core::ServiceException("The request must contain the parameter MessageGroupId.");
+        }
+
+        // Explicit deduplication ID first, otherwise the SHA-256 hash of the body
+        std::string deduplicationId = messageDeduplicationId;
+        if (deduplicationId.empty()) {
+            if (!queue.attributes.contentBasedDeduplication) {
+                log_error << "FIFO queue message without deduplication ID, queueUrl: " << queue.queueUrl;
+                throw Core::ServiceException("The queue should either have ContentBasedDeduplication enabled or MessageDeduplicationId provided explicitly.");
             }
-            log_trace << "Messages in response: " << messageList.size();
+            deduplicationId = Core::Crypto::GetSha256FromString(message.body);
+        }
 
-            return response;
+        message.attributes["MessageGroupId"] = messageGroupId;
+        message.attributes["MessageDeduplicationId"] = deduplicationId;
+        message.attributes["SequenceNumber"] = Core::AwsUtils::CreateSqsSequenceNumber();
+        return deduplicationId;
+    }
+
+    SQSDeduplicationIndex &SQSService::GetDeduplicationIndex() {
+        static SQSDeduplicationIndex deduplicationIndex;
+        return deduplicationIndex;
+    }
+
+    Dto::SQS::ReceiveMessageResponse SQSService::ReceiveMessages(const Dto::SQS::ReceiveMessageRequest &request) {
+
+        // Wait for the asynchronous receive
+        auto promise = std::make_shared<std::promise<Dto::SQS::ReceiveMessageResponse>>();
+        std::future<Dto::SQS::ReceiveMessageResponse> future = promise->get_future();
+        ReceiveMessages(request, [promise](const Dto::SQS::ReceiveMessageResponse &response) { promise->set_value(response); });
+        return future.get();
+    }
+
+    void SQSService::ReceiveMessages(const Dto::SQS::ReceiveMessageRequest &request, const ReceiveCallback &callback) {
+        Core::MetricServiceTimer measure(SQS_SERVICE_TIMER, "method", "receive_message");
+        log_debug << "Receive message request: " << request.ToString();
+
+        if (!request.queueUrl.empty() && !_database.QueueUrlExists(request.region, request.queueUrl)) {
+            log_error << "Queue does not exist, region: " << request.region << " queueUrl: " << request.queueUrl;
+            throw Core::ServiceException("Queue does not exist, region: " + request.region + " queueUrl: " + request.queueUrl);
+        }
+
+        Database::Entity::SQS::Queue queue;
+        Dto::SQS::ReceiveMessageResponse response;
+        try {
+
+            queue = _database.GetQueueByUrl(request.region, request.queueUrl);
+            if (TryReceiveMessages(_database, queue, request, response) || request.waitTimeSeconds <= 0) {
+                callback(response);
+                return;
+            }
 
         } catch (Poco::Exception &ex) {
             log_error << ex.message();
             throw Core::ServiceException(ex.message());
         }
+
+        // Park the receiver, it is woken up by new messages and expiring visibility timeouts
+        Database::SQSDatabase &database = _database;
+        GetWaitList().Wait(
+                queue.queueUrl, std::chrono::seconds(request.waitTimeSeconds),
+                [&database, queue, request, callback]() {
+                    Dto::SQS::ReceiveMessageResponse response;
+                    if (!TryReceiveMessages(database, queue, request, response)) {
+                        ScheduleWakeup(database, queue.queueUrl);
+                        return false;
+                    }
+                    callback(response);
+                    return true;
+                },
+                [request, callback]() {
+                    log_trace << "Receive message wait time elapsed, queueUrl: " << request.queueUrl;
+                    callback({});
+                });
+        ScheduleWakeup(_database, queue.queueUrl);
+    }
+
+    bool SQSService::TryReceiveMessages(Database::SQSDatabase &database, const Database::Entity::SQS::Queue &queue, const Dto::SQS::ReceiveMessageRequest &request, Dto::SQS::ReceiveMessageResponse &response) {
+
+        Database::Entity::SQS::MessageList messageList;
+        database.ReceiveMessages(queue.region, queue.queueUrl, queue.attributes.visibilityTimeout, request.maxMessages, messageList);
+        log_trace << "Messages in database, url: " << queue.queueUrl << " count: " << messageList.size();
+
+        // TODO: Check
+        // Reduce attributes, the response contains only the requested attributes. The MD5 of the attributes in the response is only calculated on the requested attributes
+        /*for (auto &message: messageList) {
+            for (auto &attributeName: request.attributeName) {
+                message.messageAttributes.erase(std::remove_if(message.attributes.begin(),
+                                                        message.attributes.end(),
+                                                        [attributeName](const Database::Entity::SQS::MessageAttribute &attribute) {
+                                                            return attributeName == attribute.attributeName;
+                                                        }),
+                                         message.attributes.end());
+            }
+        }*/
+
+        if (messageList.empty()) {
+            return false;
+        }
+
+        SQSStatistics::instance().MessagesReceived(queue.queueUrl, messageList);
+        ScheduleMaintenance(queue.region, queue.queueUrl);
+        log_info << "Messages received, count: " << messageList.size() << " requestId: " << request.requestId;
+        response.messageList = std::move(messageList);
+        response.requestId = request.requestId;
+        return true;
+    }
+
+    void SQSService::ScheduleWakeup(Database::SQSDatabase &database, const std::string &queueUrl) {
+
+        system_clock::time_point reset = database.GetNextMessageReset(queueUrl);
+        if (reset != system_clock::time_point::max()) {
+            GetWaitList().NotifyAt(queueUrl, std::max(reset, system_clock::now() + std::chrono::milliseconds(SQS_MIN_WAKEUP_DELAY)));
+        }
+    }
+
+    void SQSService::NotifyReceivers(const std::string &queueUrl) {
+        GetWaitList().Notify(queueUrl);
+    }
+
+    Core::WaitList &SQSService::GetWaitList() {
+        static Core::WaitList waitList;
+        return waitList;
+    }
+
+    void SQSService::ScheduleMaintenance(const std::string &region, const std::string &queueUrl, system_clock::time_point timePoint) {
+        if (timePoint == system_clock::time_point::max()) {
+            return;
+        }
+        GetMaintenanceQueue().Schedule(region + '\n' + queueUrl, timePoint);
+    }
+
+    std::vector<std::pair<std::string, std::string>> SQSService::TakeDueMaintenance(system_clock::time_point now) {
+
+        std::vector<std::pair<std::string, std::string>> queues;
+        for (const auto &key: GetMaintenanceQueue().TakeDue(now)) {
+            size_t pos = key.find('\n');
+            queues.emplace_back(key.substr(0, pos), key.substr(pos + 1));
+        }
+        return queues;
+    }
+
+    Core::DeadlineQueue &SQSService::GetMaintenanceQueue() {
+        static Core::DeadlineQueue maintenanceQueue;
+        return maintenanceQueue;
     }
 
     void SQSService::DeleteMessage(const Dto::SQS::DeleteMessageRequest &request) {
@@ -493,6 +770,8 @@ namespace AwsMock::Service {
 
             // Delete from database
             _database.DeleteMessage({.queueUrl = request.queueUrl, .receiptHandle = request.receiptHandle});
+            SQSStatistics::instance().MessagesDeleted(request.queueUrl, 1);
+            ScheduleMaintenance(request.region, request.queueUrl);
             log_debug << "Message deleted, receiptHandle: " << request.receiptHandle;
 
         } catch (Poco::Exception &ex) {
@@ -501,25 +780,36 @@ namespace AwsMock::Service {
         }
     }
 
-    void SQSService::DeleteMessageBatch(const Dto::SQS::DeleteMessageBatchRequest &request) {
+    Dto::SQS::DeleteMessageBatchResponse SQSService::DeleteMessageBatch(const Dto::SQS::DeleteMessageBatchRequest &request) {
         Core::MetricServiceTimer measure(SQS_SERVICE_TIMER, "method", "delete_message_batch");
         log_trace << "Delete message batch request, size: " << request.deleteMessageBatchEntries.size();
 
         try {
 
+            std::vector<std::string> receiptHandles;
             for (const auto &entry: request.deleteMessageBatchEntries) {
+                receiptHandles.emplace_back(entry.receiptHandle);
+            }
+
+            // Delete from database, single write for all entries
+            std::vector<std::string> deleted = _database.DeleteMessages(request.queueUrl, receiptHandles);
 
-                // TODO: Check existence
-                if (!_database.MessageExists(entry.receiptHandle)) {
-                    //throw Core::ServiceException("Message does not exist", Poco::Net::HTTPResponse::HTTP_NOT_FOUND);
+            Dto::SQS::DeleteMessageBatchResponse response = {.requestId = request.requestId};
+            for (const auto &entry: request.deleteMessageBatchEntries) {
+                if (std::find(deleted.begin(), deleted.end(), entry.receiptHandle) != deleted.end()) {
+                    response.successful.emplace_back(entry.id);
+                } else {
                     log_warning << "Message does not exist, id: " << entry.id;
-                    return;
+                    response.failed.push_back({.id = entry.id, .code = "ReceiptHandleIsInvalid", .message = "Message does not exist, receiptHandle: " + entry.receiptHandle});
                 }
+            }
+            log_debug << "Message batch deleted, successful: " << response.successful.size() << " failed: " << response.failed.size();
 
-                // Delete from database
-                _database.DeleteMessage(entry.receiptHandle);
+            if (!deleted.empty()) {
+                SQSStatistics::instance().MessagesDeleted(request.queueUrl, static_cast<long>(deleted.size()));
+                ScheduleMaintenance(request.region, request.queueUrl);
             }
-            log_debug << "Message batch deleted, count: " << request.deleteMessageBatchEntries.size();
+            return response;
 
         } catch (Poco::Exception &ex) {
             log_error << ex.message();
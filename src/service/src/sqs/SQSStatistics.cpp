@@ -0,0 +1,135 @@
+//
+// Created by vogje01 on 6/15/24.
+//
+
+#include <awsmock/service/sqs/SQSStatistics.h>
+
+namespace AwsMock::Service {
+
+    void SQSStatistics::MessagesSent(const std::string &queueUrl, const std::string &name, long count, bool delayed) {
+
+        std::shared_ptr<QueueCounters> counters = GetCounters(queueUrl, name);
+        if (delayed) {
+            counters->delayed += count;
+        } else {
+            counters->visible += count;
+        }
+    }
+
+    void SQSStatistics::MessagesReceived(const std::string &queueUrl, const Database::Entity::SQS::MessageList &messages) {
+
+        std::shared_ptr<QueueCounters> counters = GetCounters(queueUrl);
+        Decrement(counters->visible, static_cast<long>(messages.size()));
+        counters->inFlight += static_cast<long>(messages.size());
+
+        // Wait time of the first receive only
+        auto now = std::chrono::system_clock::now();
+        for (const auto &message: messages) {
+            if (message.retries != 1) {
+                continue;
+            }
+            long millis = std::max(0L, static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(now - message.created).count()));
+            int bucket = 0;
+            while (bucket < SQS_WAIT_TIME_BUCKETS - 1 && millis >= (1L << bucket)) {
+                bucket++;
+            }
+            counters->waitTimeBuckets[bucket]++;
+            counters->waitTimeSum += millis;
+            counters->waitTimeCount++;
+        }
+    }
+
+    void SQSStatistics::MessagesDeleted(const std::string &queueUrl, long count) {
+
+        std::shared_ptr<QueueCounters> counters = GetCounters(queueUrl);
+        Decrement(counters->inFlight, count);
+    }
+
+    void SQSStatistics::Reconcile(const std::string &queueUrl, const std::string &name, long visible, long inFlight, long delayed) {
+
+        std::shared_ptr<QueueCounters> counters = GetCounters(queueUrl, name);
+        counters->visible = visible;
+        counters->inFlight = inFlight;
+        counters->delayed = delayed;
+        log_trace << "Queue statistics reconciled, queueUrl: " << queueUrl << " visible: " << visible << " inFlight: " << inFlight << " delayed: " << delayed;
+    }
+
+    void SQSStatistics::RemoveQueue(const std::string &queueUrl) {
+        boost::mutex::scoped_lock lock(_mutex);
+        _queues.erase(queueUrl);
+    }
+
+    SQSStatistics::QueueStatistics SQSStatistics::GetQueueStatistics(const std::string &queueUrl) {
+
+        std::shared_ptr<QueueCounters> counters;
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            auto it = _queues.find(queueUrl);
+            if (it == _queues.end()) {
+                return {.queueUrl = queueUrl};
+            }
+            counters = it->second;
+        }
+        return ToStatistics(queueUrl, *counters);
+    }
+
+    std::vector<SQSStatistics::QueueStatistics> SQSStatistics::ListQueueStatistics() {
+
+        std::map<std::string, std::shared_ptr<QueueCounters>> queues;
+        {
+            boost::mutex::scoped_lock lock(_mutex);
+            queues = _queues;
+        }
+
+        std::vector<QueueStatistics> statistics;
+        statistics.reserve(queues.size());
+        for (const auto &[queueUrl, counters]: queues) {
+            statistics.emplace_back(ToStatistics(queueUrl, *counters));
+        }
+        return statistics;
+    }
+
+    std::shared_ptr<SQSStatistics::QueueCounters> SQSStatistics::GetCounters(const std::string &queueUrl, const std::string &name) {
+        boost::mutex::scoped_lock lock(_mutex);
+
+        std::shared_ptr<QueueCounters> &counters = _queues[queueUrl];
+        if (!counters) {
+            counters = std::make_shared<QueueCounters>();
+            counters->name = name.empty() ? queueUrl.substr(queueUrl.find_last_of('/') + 1) : name;
+        }
+        return counters;
+    }
+
+    void SQSStatistics::Decrement(std::atomic<long> &counter, long count) {
+
+        long value = counter.load();
+        while (!counter.compare_exchange_weak(value, std::max(0L, value - count))) {
+        }
+    }
+
+    SQSStatistics::QueueStatistics SQSStatistics::ToStatistics(const std::string &queueUrl, const QueueCounters &counters) {
+
+        QueueStatistics statistics = {.queueUrl = queueUrl,
+                                      .name = counters.name,
+                                      .visible = counters.visible,
+                                      .inFlight = counters.inFlight,
+                                      .delayed = counters.delayed};
+
+        long count = counters.waitTimeCount;
+        if (count > 0) {
+            statistics.averageWaitTime = static_cast<double>(counters.waitTimeSum) / static_cast<double>(count);
+
+            // Upper bound of the bucket, which contains the 99th percentile
+            long seen = 0;
+            for (int bucket = 0; bucket < SQS_WAIT_TIME_BUCKETS; bucket++) {
+                seen += counters.waitTimeBuckets[bucket];
+                if (seen * 100 >= count * 99) {
+                    statistics.p99WaitTime = static_cast<double>(1L << bucket);
+                    break;
+                }
+            }
+        }
+        return statistics;
+    }
+
+}// namespace AwsMock::Service
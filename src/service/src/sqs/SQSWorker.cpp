@@ -19,43 +19,82 @@ namespace AwsMock::Service {
 
     void SQSWorker::ResetMessages() {
 
-        Database::Entity::SQS::QueueList queueList = _sqsDatabase.ListQueues();
-        log_trace << "SQS worker starting, count: " << queueList.size();
+        auto now = system_clock::now();
 
-        if (queueList.empty()) {
-            return;
+        // Sweep over all queues at startup and from time to time, catches messages, which were not sent through this service instance
+        if (now >= _nextSweep) {
+            Database::Entity::SQS::QueueList queueList = _sqsDatabase.ListQueues();
+            for (const auto &queue: queueList) {
+                SQSService::ScheduleMaintenance(queue.region, queue.queueUrl, now);
+            }
+            _nextSweep = now + std::chrono::seconds(_sweepPeriod);
+            log_trace << "SQS worker sweep, count: " << queueList.size();
         }
 
-        // Loop over queues and do some maintenance work
-        for (auto &queue: queueList) {
-
-            // Check retention period
-            if (queue.attributes.messageRetentionPeriod > 0) {
-                _sqsDatabase.MessageRetention(queue.queueUrl, queue.attributes.messageRetentionPeriod);
+        // Only queues with changed messages or with a passed deadline are maintained, an idle server does nothing
+        std::vector<std::pair<std::string, std::string>> dueQueues = SQSService::TakeDueMaintenance(now);
+        for (const auto &[region, queueUrl]: dueQueues) {
+            try {
+                MaintainQueue(region, queueUrl);
+            } catch (Poco::Exception &ex) {
+                log_error << "Queue maintenance failed, queueUrl: " << queueUrl << " error: " << ex.message();
             }
+        }
+        log_trace << "SQS worker finished, count: " << dueQueues.size();
+    }
 
-            // Reset resources which have expired
-            _sqsDatabase.ResetMessages(queue.queueUrl, queue.attributes.visibilityTimeout);
+    void SQSWorker::MaintainQueue(const std::string &region, const std::string &queueUrl) {
 
-            // Set counter default userAttributes
-            queue.attributes.approximateNumberOfMessages = _sqsDatabase.CountMessages(queue.region, queue.queueUrl);
-            queue.attributes.approximateNumberOfMessagesDelayed = _sqsDatabase.CountMessagesByStatus(queue.region, queue.queueUrl, Database::Entity::SQS::MessageStatus::DELAYED);
-            queue.attributes.approximateNumberOfMessagesNotVisible = _sqsDatabase.CountMessagesByStatus(queue.region, queue.queueUrl, Database::Entity::SQS::MessageStatus::INVISIBLE);
+        // Deleted in the meantime
+        if (!_sqsDatabase.QueueUrlExists(region, queueUrl)) {
+            return;
+        }
+        Database::Entity::SQS::Queue queue = _sqsDatabase.GetQueueByUrl(region, queueUrl);
 
-            // Check retries
-            if (!queue.attributes.redrivePolicy.deadLetterTargetArn.empty()) {
-                _sqsDatabase.RedriveMessages(queue.queueUrl, queue.attributes.redrivePolicy);
-            }
+        // Check retention period
+        if (queue.attributes.messageRetentionPeriod > 0) {
+            _sqsDatabase.MessageRetention(queue.queueUrl, queue.attributes.messageRetentionPeriod);
+        }
 
-            // Check delays
-            if (queue.attributes.delaySeconds > 0) {
-                _sqsDatabase.ResetDelayedMessages(queue.queueUrl, queue.attributes.delaySeconds);
-            }
+        // Reset resources which have expired
+        _sqsDatabase.ResetMessages(queue.queueUrl, queue.attributes.visibilityTimeout);
+
+        // Check delays
+        if (queue.attributes.delaySeconds > 0) {
+            _sqsDatabase.ResetDelayedMessages(queue.queueUrl, queue.attributes.delaySeconds);
+        }
 
+        // Check retries, the dead letter queue gets new messages
+        if (!queue.attributes.redrivePolicy.deadLetterTargetArn.empty()) {
+            std::string dlqQueueUrl = Core::AwsUtils::ConvertSQSQueueArnToUrl(queue.attributes.redrivePolicy.deadLetterTargetArn);
+            _sqsDatabase.RedriveMessages(queue.queueUrl, queue.attributes.redrivePolicy);
+            SQSService::NotifyReceivers(dlqQueueUrl);
+            SQSService::ScheduleMaintenance(queue.region, dlqQueueUrl);
+        }
+
+        // Messages might have become visible, wake up the waiting receivers
+        SQSService::NotifyReceivers(queue.queueUrl);
+
+        // Update the counters, the queue is written only, if they have changed
+        long messages = _sqsDatabase.CountMessages(queue.region, queue.queueUrl);
+        long visible = _sqsDatabase.CountMessagesByStatus(queue.region, queue.queueUrl, Database::Entity::SQS::MessageStatus::INITIAL);
+        long delayed = _sqsDatabase.CountMessagesByStatus(queue.region, queue.queueUrl, Database::Entity::SQS::MessageStatus::DELAYED);
+        long notVisible = _sqsDatabase.CountMessagesByStatus(queue.region, queue.queueUrl, Database::Entity::SQS::MessageStatus::INVISIBLE);
+        SQSStatistics::instance().Reconcile(queue.queueUrl, queue.name, visible, notVisible, delayed);
+        if (messages != queue.attributes.approximateNumberOfMessages || delayed != queue.attributes.approximateNumberOfMessagesDelayed || notVisible != queue.attributes.approximateNumberOfMessagesNotVisible) {
+            queue.attributes.approximateNumberOfMessages = messages;
+            queue.attributes.approximateNumberOfMessagesDelayed = delayed;
+            queue.attributes.approximateNumberOfMessagesNotVisible = notVisible;
             _sqsDatabase.UpdateQueue(queue);
             log_trace << "Queue updated, queueName" << queue.name;
         }
-        log_trace << "SQS worker finished, count: " << queueList.size();
+
+        // Next maintenance, when the next visibility timeout or delay ends, or the oldest message exceeds the retention period
+        system_clock::time_point next = _sqsDatabase.GetNextMessageReset(queue.queueUrl);
+        if (queue.attributes.messageRetentionPeriod > 0) {
+            next = std::min(next, _sqsDatabase.GetNextMessageExpiry(queue.queueUrl, queue.attributes.messageRetentionPeriod));
+        }
+        SQSService::ScheduleMaintenance(queue.region, queue.queueUrl, next);
     }
 
-}// namespace AwsMock::Service
\ No newline at end of file
+}// namespace AwsMock::Service
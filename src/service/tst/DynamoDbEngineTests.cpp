@@ -0,0 +1,191 @@
+//
+// Created by vogje01 on 6/8/24.
+//
+
+#ifndef AWMOCK_DYNAMODB_ENGINE_TEST_H
+#define AWMOCK_DYNAMODB_ENGINE_TEST_H
+
+// GTest includes
+#include <gtest/gtest.h>
+
+// AwsMock includes
+#include <awsmock/service/dynamodb/DynamoDbEngine.h>
+
+#define REGION "eu-central-1"
+#define TABLE_NAME "test-table"
+
+namespace AwsMock::Service {
+
+    /**
+     * Native DynamoDB engine and expression tests.
+     */
+    class DynamoDbEngineTest : public ::testing::Test {
+
+      protected:
+
+        void SetUp() override {
+            Dto::DynamoDb::DynamoDbResponse response = _engine.CreateTable(REGION, R"({"TableName":"test-table",
+                "AttributeDefinitions":[{"AttributeName":"orgaNr","AttributeType":"N"},{"AttributeName":"date","AttributeType":"S"},{"AttributeName":"status","AttributeType":"S"}],
+                "KeySchema":[{"AttributeName":"orgaNr","KeyType":"HASH"},{"AttributeName":"date","KeyType":"RANGE"}],
+                "GlobalSecondaryIndexes":[{"IndexName":"status-index","KeySchema":[{"AttributeName":"status","KeyType":"HASH"}],"Projection":{"ProjectionType":"KEYS_ONLY"}}]})");
+            ASSERT_EQ(boost::beast::http::status::ok, response.status);
+        }
+
+        void TearDown() override {
+            _engine.DeleteAllTables();
+        }
+
+        void PutItem(int orgaNr, const std::string &date, const std::string &status) {
+            Dto::DynamoDb::DynamoDbResponse response = _engine.PutItem(REGION, R"({"TableName":"test-table","Item":{"orgaNr":{"N":")" + std::to_string(orgaNr) +
+                                                                                        R"("},"date":{"S":")" + date + R"("},"status":{"S":")" + status + R"("}}})");
+            ASSERT_EQ(boost::beast::http::status::ok, response.status);
+        }
+
+        static Poco::JSON::Object::Ptr Parse(const std::string &body) {
+            Poco::JSON::Parser parser;
+            return parser.parse(body).extract<Poco::JSON::Object::Ptr>();
+        }
+
+        DynamoDbEngine _engine;
+    };
+
+    TEST_F(DynamoDbEngineTest, ExpressionTest) {
+
+        // arrange
+        Poco::JSON::Object::Ptr item = Parse(R"({"id":{"S":"abc"},"count":{"N":"10"},"tags":{"SS":["a","b"]},"map":{"M":{"key":{"S":"value"}}}})");
+        Poco::JSON::Object::Ptr names = Parse(R"({"#c":"count"})");
+        Poco::JSON::Object::Ptr values = Parse(R"({":low":{"N":"5"},":high":{"N":"1.0E1"},":prefix":{"S":"ab"},":tag":{"S":"b"},":value":{"S":"value"}})");
+
+        // act
+        DynamoDbExpression between("#c BETWEEN :low AND :high", names, values);
+        DynamoDbExpression functions("begins_with(id, :prefix) AND contains(tags, :tag) AND map.key = :value", names, values);
+        DynamoDbExpression negation("NOT attribute_exists(id) OR size(tags) > :low", names, values);
+
+        // assert
+        EXPECT_TRUE(between.Evaluate(item));
+        EXPECT_TRUE(functions.Evaluate(item));
+        EXPECT_FALSE(negation.Evaluate(item));
+        EXPECT_THROW(DynamoDbExpression("#c = :missing", names, values), Core::BadRequestException);
+    }
+
+    TEST_F(DynamoDbEngineTest, PutGetItemTest) {
+
+        // arrange
+        PutItem(1, "2024-01-01", "open");
+
+        // act
+        Dto::DynamoDb::DynamoDbResponse response = _engine.GetItem(REGION, R"({"TableName":"test-table","Key":{"orgaNr":{"N":"1.0"},"date":{"S":"2024-01-01"}}})");
+
+        // assert
+        EXPECT_EQ(boost::beast::http::status::ok, response.status);
+        EXPECT_EQ("open", Parse(response.body)->getObject("Item")->getObject("status")->getValue<std::string>("S"));
+        EXPECT_EQ(1, _engine.CountItems());
+    }
+
+    TEST_F(DynamoDbEngineTest, ConditionalPutTest) {
+
+        // arrange
+        PutItem(1, "2024-01-01", "open");
+
+        // act
+        Dto::DynamoDb::DynamoDbResponse response = _engine.PutItem(REGION, R"json({"TableName":"test-table","Item":{"orgaNr":{"N":"1"},"date":{"S":"2024-01-01"}},
+            "ConditionExpression":"attribute_not_exists(orgaNr)"})json");
+
+        // assert
+        EXPECT_EQ(boost::beast::http::status::bad_request, response.status);
+        EXPECT_TRUE(response.body.find("ConditionalCheckFailedException") != std::string::npos);
+    }
+
+    TEST_F(DynamoDbEngineTest, QueryTest) {
+
+        // arrange
+        PutItem(1, "2024-01-01", "open");
+        PutItem(1, "2024-02-01", "closed");
+        PutItem(1, "2024-03-01", "open");
+        PutItem(2, "2024-02-01", "open");
+
+        // act
+        Dto::DynamoDb::DynamoDbResponse response = _engine.Query(REGION, R"({"TableName":"test-table","KeyConditionExpression":"orgaNr = :o AND #d >= :d",
+            "FilterExpression":"#s = :s","ExpressionAttributeNames":{"#d":"date","#s":"status"},
+            "ExpressionAttributeValues":{":o":{"N":"1"},":d":{"S":"2024-02"},":s":{"S":"open"}},"ScanIndexForward":false})");
+
+        // assert
+        EXPECT_EQ(boost::beast::http::status::ok, response.status);
+        Poco::JSON::Object::Ptr result = Parse(response.body);
+        EXPECT_EQ(1, result->getValue<int>("Count"));
+        EXPECT_EQ(2, result->getValue<int>("ScannedCount"));
+        EXPECT_EQ("2024-03-01", result->getArray("Items")->getObject(0)->getObject("date")->getValue<std::string>("S"));
+    }
+
+    TEST_F(DynamoDbEngineTest, QueryPaginationTest) {
+
+        // arrange
+        PutItem(1, "2024-01-01", "open");
+        PutItem(1, "2024-02-01", "open");
+        PutItem(1, "2024-03-01", "open");
+
+        // act
+        Dto::DynamoDb::DynamoDbResponse first = _engine.Query(REGION, R"({"TableName":"test-table","KeyConditionExpression":"orgaNr = :o",
+            "ExpressionAttributeValues":{":o":{"N":"1"}},"Limit":2})");
+        Poco::JSON::Object::Ptr lastEvaluatedKey = Parse(first.body)->getObject("LastEvaluatedKey");
+        Dto::DynamoDb::DynamoDbResponse second = _engine.Query(REGION, R"({"TableName":"test-table","KeyConditionExpression":"orgaNr = :o",
+            "ExpressionAttributeValues":{":o":{"N":"1"}},"Limit":2,"ExclusiveStartKey":)" + Core::JsonUtils::ToJsonString(*lastEvaluatedKey) + "}");
+
+        // assert
+        EXPECT_EQ(2, Parse(first.body)->getValue<int>("Count"));
+        EXPECT_EQ("2024-02-01", lastEvaluatedKey->getObject("date")->getValue<std::string>("S"));
+        EXPECT_EQ(1, Parse(second.body)->getValue<int>("Count"));
+        EXPECT_FALSE(Parse(second.body)->has("LastEvaluatedKey"));
+    }
+
+    TEST_F(DynamoDbEngineTest, IndexQueryTest) {
+
+        // arrange
+        PutItem(1, "2024-01-01", "open");
+        PutItem(2, "2024-01-01", "closed");
+        PutItem(3, "2024-01-01", "open");
+        PutItem(3, "2024-01-01", "closed");
+
+        // act
+        Dto::DynamoDb::DynamoDbResponse response = _engine.Query(REGION, R"({"TableName":"test-table","IndexName":"status-index",
+            "KeyConditionExpression":"#s = :s","ExpressionAttributeNames":{"#s":"status"},"ExpressionAttributeValues":{":s":{"S":"open"}}})");
+
+        // assert
+        EXPECT_EQ(boost::beast::http::status::ok, response.status);
+        Poco::JSON::Object::Ptr result = Parse(response.body);
+        EXPECT_EQ(1, result->getValue<int>("Count"));
+        EXPECT_EQ(3, result->getArray("Items")->getObject(0)->size());
+    }
+
+    TEST_F(DynamoDbEngineTest, DeleteItemScanTest) {
+
+        // arrange
+        PutItem(1, "2024-01-01", "open");
+        PutItem(2, "2024-01-01", "open");
+
+        // act
+        Dto::DynamoDb::DynamoDbResponse deleteResponse = _engine.DeleteItem(REGION, R"({"TableName":"test-table","Key":{"orgaNr":{"N":"1"},"date":{"S":"2024-01-01"}}})");
+        Dto::DynamoDb::DynamoDbResponse scanResponse = _engine.Scan(REGION, R"({"TableName":"test-table"})");
+        Dto::DynamoDb::DynamoDbResponse indexResponse = _engine.Scan(REGION, R"({"TableName":"test-table","IndexName":"status-index"})");
+
+        // assert
+        EXPECT_EQ(boost::beast::http::status::ok, deleteResponse.status);
+        EXPECT_EQ(1, Parse(scanResponse.body)->getValue<int>("Count"));
+        EXPECT_EQ(1, Parse(indexResponse.body)->getValue<int>("Count"));
+    }
+
+    TEST_F(DynamoDbEngineTest, TableNotFoundTest) {
+
+        // arrange
+
+        // act
+        Dto::DynamoDb::DynamoDbResponse response = _engine.Scan(REGION, R"({"TableName":"unknown"})");
+
+        // assert
+        EXPECT_EQ(boost::beast::http::status::bad_request, response.status);
+        EXPECT_TRUE(response.body.find("ResourceNotFoundException") != std::string::npos);
+    }
+
+}// namespace AwsMock::Service
+
+#endif// AWMOCK_DYNAMODB_ENGINE_TEST_H
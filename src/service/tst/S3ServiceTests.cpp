@@ -105,6 +105,39 @@ namespace AwsMock::Service {
         // assert
     }
 
+    TEST_F(S3ServiceTest, ObjectBlobStoreTest) {
+
+        // arrange
+        _configuration.SetValue("awsmock.service.s3.blob.store.active", true);
+        Dto::S3::CreateBucketRequest request = {.region = REGION, .name = BUCKET, .owner = OWNER};
+        Dto::S3::CreateBucketResponse response = _service.CreateBucket(request);
+        std::ifstream ifs1(testFile);
+        Dto::S3::PutObjectRequest putRequest1 = {.region = REGION, .bucket = BUCKET, .key = KEY};
+        _service.PutObject(putRequest1, ifs1, false);
+        std::ifstream ifs2(testFile);
+        Dto::S3::PutObjectRequest putRequest2 = {.region = REGION, .bucket = BUCKET, .key = std::string(KEY) + ".2"};
+        _service.PutObject(putRequest2, ifs2, false);
+
+        // act
+        Dto::S3::CopyObjectRequest copyRequest = {.region = REGION, .sourceBucket = BUCKET, .sourceKey = KEY, .targetBucket = BUCKET, .targetKey = std::string(KEY) + ".3"};
+        _service.CopyObject(copyRequest);
+        Database::Entity::S3::Object object1 = _database.GetObject(REGION, BUCKET, KEY);
+        Database::Entity::S3::Object object3 = _database.GetObject(REGION, BUCKET, std::string(KEY) + ".3");
+        long copied = S3BlobStore::CountReferences(object1.internalName);
+        _service.DeleteObject({.region = REGION, .bucket = BUCKET, .key = KEY});
+        long deleted = S3BlobStore::CountReferences(object3.internalName);
+
+        // assert
+        EXPECT_TRUE(S3BlobStore::IsBlob(object1.internalName));
+        EXPECT_NE(object1.internalName, object3.internalName);
+        EXPECT_EQ(3, copied);
+        EXPECT_EQ(2, deleted);
+        _service.DeleteObject({.region = REGION, .bucket = BUCKET, .key = std::string(KEY) + ".2"});
+        _service.DeleteObject({.region = REGION, .bucket = BUCKET, .key = std::string(KEY) + ".3"});
+        EXPECT_EQ(0, S3BlobStore::CountReferences(object3.internalName));
+        _configuration.SetValue("awsmock.service.s3.blob.store.active", false);
+    }
+
 }// namespace AwsMock::Service
 
 #endif// AWMOCK_CORE_S3_SERVICE_TEST_H
\ No newline at end of file
@@ -205,6 +205,47 @@ namespace AwsMock::Service {
         EXPECT_EQ(0, _database.CountMessages(REGION, queueUrl));
     }
 
+    TEST_F(SQSServiceTest, FifoMessageDeduplicationTest) {
+
+        // arrange
+        Dto::SQS::CreateQueueRequest queueRequest = {.region = REGION, .queueName = QUEUE ".fifo", .owner = OWNER, .attributes = {{.attributeName = "ContentBasedDeduplication", .attributeValue = "true"}}, .requestId = Poco::UUIDGenerator().createRandom().toString()};
+        Dto::SQS::CreateQueueResponse queueResponse = _service.CreateQueue(queueRequest);
+        std::string queueUrl = queueResponse.queueUrl;
+        Dto::SQS::SendMessageRequest msgRequest = {.region = REGION, .queueUrl = queueUrl, .body = BODY, .messageGroupId = "group", .requestId = Poco::UUIDGenerator().createRandom().toString()};
+
+        // act
+        Dto::SQS::SendMessageResponse msgResponse1 = _service.SendMessage(msgRequest);
+        Dto::SQS::SendMessageResponse msgResponse2 = _service.SendMessage(msgRequest);
+        msgRequest.messageGroupId.clear();
+
+        // assert
+        EXPECT_EQ(msgResponse1.messageId, msgResponse2.messageId);
+        EXPECT_EQ(msgResponse1.sequenceNumber, msgResponse2.sequenceNumber);
+        EXPECT_EQ(1, _database.CountMessages(REGION, queueUrl));
+        EXPECT_THROW(_service.SendMessage(msgRequest), Core::ServiceException);
+    }
+
+    TEST_F(SQSServiceTest, QueueAttributesCounterTest) {
+
+        // arrange
+        Dto::SQS::CreateQueueRequest queueRequest = {.region = REGION, .queueName = QUEUE, .queueUrl = QUEUE_URL, .owner = OWNER, .requestId = Poco::UUIDGenerator().createRandom().toString()};
+        Dto::SQS::CreateQueueResponse queueResponse = _service.CreateQueue(queueRequest);
+        std::string queueUrl = queueResponse.queueUrl;
+        for (int i = 0; i < 2; i++) {
+            _service.SendMessage({.region = REGION, .queueUrl = queueUrl, .body = BODY, .requestId = Poco::UUIDGenerator().createRandom().toString()});
+        }
+        _service.ReceiveMessages({.region = REGION, .queueUrl = queueUrl, .queueName = QUEUE, .maxMessages = 1, .waitTimeSeconds = 0});
+
+        // act
+        Dto::SQS::GetQueueAttributesResponse response = _service.GetQueueAttributes({.region = REGION, .queueUrl = queueUrl, .attributeNames = {"ApproximateNumberOfMessages", "ApproximateNumberOfMessagesNotVisible"}});
+
+        // assert
+        ASSERT_EQ(2, response.attributes.size());
+        EXPECT_EQ("1", response.attributes[0].second);
+        EXPECT_EQ("1", response.attributes[1].second);
+        EXPECT_GE(SQSStatistics::instance().GetQueueStatistics(queueUrl).averageWaitTime, 0);
+    }
+
     TEST_F(SQSServiceTest, GetMd5AttributesTest) {
 
         // arrange